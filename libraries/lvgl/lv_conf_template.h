@@ -66,6 +66,26 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Tiered heap for LV_MEM_CUSTOM (misc/lv_mem_tier.c): two TLSF pools instead of one.
+ *Blocks up to LV_MEM_TIER_FAST_MAX bytes go to the fast pool, a static array in internal RAM,
+ *larger ones to the slow pool from LV_MEM_TIER_SLOW_ALLOC, e.g. in external RAM. A full pool spills to the other one.
+ *Set LV_MEM_CUSTOM_INCLUDE to "lv_mem_tier.h" and LV_MEM_CUSTOM_ALLOC/FREE/REALLOC to lv_mem_tier_alloc/free/realloc*/
+#define LV_USE_MEM_TIER 0
+#if LV_USE_MEM_TIER
+    /*Size of the fast pool in bytes (>= 2kB)*/
+    #define LV_MEM_TIER_FAST_SIZE (32U * 1024U)
+
+    /*Largest block in bytes that goes to the fast pool first*/
+    #define LV_MEM_TIER_FAST_MAX 1024
+
+    /*Size of the slow pool in bytes, 0: no slow pool*/
+    #define LV_MEM_TIER_SLOW_SIZE (256U * 1024U)
+
+    /*Allocator of the slow pool, called once*/
+    #define LV_MEM_TIER_SLOW_INCLUDE <stdlib.h>
+    #define LV_MEM_TIER_SLOW_ALLOC   malloc
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
@@ -83,6 +103,11 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Let pointer input drivers report the swipes and long presses their touch controller recognized
+ *(`gesture_dir` and `long_pressed` of `lv_indev_data_t`). `gesture_src` of the driver selects
+ *those, LVGL's own detection or both*/
+#define LV_USE_INDEV_HW_GESTURE 0
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -121,6 +146,16 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /* Upper limit of the memory used by the cached circles in bytes, radius * 6 + 6 bytes per circle.
+    * The least used circles are dropped to make room for a new one.
+    * 0: no limit, only LV_CIRCLE_CACHE_SIZE counts */
+    #define LV_CIRCLE_CACHE_BUDGET 0
+
+    /*Allocator of the circle buffers, e.g. to keep them in external RAM*/
+    #define LV_CIRCLE_CACHE_INCLUDE "../misc/lv_mem.h"
+    #define LV_CIRCLE_CACHE_ALLOC   lv_mem_alloc
+    #define LV_CIRCLE_CACHE_FREE    lv_mem_free
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -146,6 +181,12 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Draw the parts of a refresh in horizontal stripes on more threads at once, see `lv_refr_set_stripes()`.
+ *The application starts the threads, LVGL splits the parts and waits for the stripes before the flush.
+ *The draw state of each thread is `__thread` (GCC and Clang).
+ *Requires LV_IMG_CACHE_DEF_SIZE 0 and LV_COLOR_SCREEN_TRANSP 0*/
+#define LV_USE_REFR_STRIPES 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -172,6 +213,12 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Inner loops of the normal blend mode (see lv_draw_sw_blend.h)
+ *0: reference C loops
+ *1: RGB565 kernels working on 2 or 4 pixels per machine word (LV_COLOR_DEPTH 16 only)
+ *2: reserved for ESP32-S3 PIE (SIMD) kernels, not implemented: an #error*/
+#define LV_DRAW_SW_BLEND_KERNELS 0
+
 /*-------------
  * GPU
  *-----------*/
@@ -285,7 +332,7 @@
 #endif
 
 /*1: Show the used memory and the memory fragmentation
- * Requires LV_MEM_CUSTOM = 0*/
+ * Requires LV_MEM_CUSTOM = 0 or LV_USE_MEM_TIER*/
 #define LV_USE_MEM_MONITOR 0
 #if LV_USE_MEM_MONITOR
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
@@ -419,6 +466,22 @@
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Keep the glyphs drawn most recently decoded to 8 bit opacity maps, so a letter drawn again is blended
+ *without decoding its bitmap. box width * box height bytes are used per glyph.
+ *Sub-pixel and image font glyphs and letters with opacity are always decoded.
+ *0: to disable caching*/
+#define LV_GLYPH_CACHE_SIZE 0
+
+/*Upper limit of the memory used by the cached glyphs in bytes.
+ *The least recently drawn glyphs are dropped to make room for a new one, pinned glyphs are kept.
+ *0: no limit, only LV_GLYPH_CACHE_SIZE counts*/
+#define LV_GLYPH_CACHE_BUDGET 0
+
+/*Allocator of the glyph opacity maps, e.g. to keep them in external RAM*/
+#define LV_GLYPH_CACHE_INCLUDE "../../misc/lv_mem.h"
+#define LV_GLYPH_CACHE_ALLOC   lv_mem_alloc
+#define LV_GLYPH_CACHE_FREE    lv_mem_free
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -168,6 +168,13 @@ LV_EXPORT_CONST_INT(LV_DPI_DEF);
     #define LV_LOG_TRACE_ANIM       0
 #endif  /*LV_USE_LOG*/
 
+/*Draw state that each thread drawing stripes keeps for itself*/
+#if LV_USE_REFR_STRIPES
+    #define LV_ATTRIBUTE_DRAW_TLS __thread
+#else
+    #define LV_ATTRIBUTE_DRAW_TLS
+#endif  /*LV_USE_REFR_STRIPES*/
+
 
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
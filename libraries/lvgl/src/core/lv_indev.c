@@ -40,6 +40,10 @@ static void indev_proc_release(_lv_indev_proc_t * proc);
 static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(_lv_indev_proc_t * proc);
 static void indev_gesture(_lv_indev_proc_t * proc);
+#if LV_USE_INDEV_HW_GESTURE
+    static void indev_gesture_release(_lv_indev_proc_t * proc);
+    static void indev_gesture_send(_lv_indev_proc_t * proc, lv_dir_t dir);
+#endif
 static bool indev_reset_check(_lv_indev_proc_t * proc);
 
 /**********************
@@ -377,11 +381,21 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
     i->proc.types.pointer.act_point.x = data->point.x;
     i->proc.types.pointer.act_point.y = data->point.y;
 
+#if LV_USE_INDEV_HW_GESTURE
+    /*Kept until the press ends, the controller may report them before LVGL found the pressed object*/
+    if(data->gesture_dir != LV_DIR_NONE) i->proc.types.pointer.gesture_hw_dir = data->gesture_dir;
+    if(data->long_pressed) i->proc.types.pointer.long_pr_hw = 1;
+#endif
+
     if(i->proc.state == LV_INDEV_STATE_PRESSED) {
         indev_proc_press(&i->proc);
     }
     else {
         indev_proc_release(&i->proc);
+#if LV_USE_INDEV_HW_GESTURE
+        i->proc.types.pointer.gesture_hw_dir = LV_DIR_NONE;
+        i->proc.types.pointer.long_pr_hw = 0;
+#endif
     }
 
     i->proc.types.pointer.last_point.x = i->proc.types.pointer.act_point.x;
@@ -918,8 +932,13 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
 
         /*If there is no scrolling then check for long press time*/
         if(proc->types.pointer.scroll_obj == NULL && proc->long_pr_sent == 0) {
+            bool long_pr = lv_tick_elaps(proc->pr_timestamp) > indev_act->driver->long_press_time;
+#if LV_USE_INDEV_HW_GESTURE
+            if(indev_act->driver->gesture_src == LV_INDEV_GESTURE_HW) long_pr = proc->types.pointer.long_pr_hw;
+            else if(indev_act->driver->gesture_src == LV_INDEV_GESTURE_HW_SW) long_pr |= proc->types.pointer.long_pr_hw;
+#endif
             /*Call the ancestor's event handler about the long press if enough time elapsed*/
-            if(lv_tick_elaps(proc->pr_timestamp) > indev_act->driver->long_press_time) {
+            if(long_pr) {
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, indev_act);
                 if(indev_reset_check(proc)) return;
 
@@ -966,6 +985,14 @@ static void indev_proc_release(_lv_indev_proc_t * proc)
     if(indev_obj_act) {
         LV_LOG_INFO("released");
 
+#if LV_USE_INDEV_HW_GESTURE
+        /*A swipe the controller reported with the release or one LVGL held back*/
+        if(indev_act->driver->gesture_src != LV_INDEV_GESTURE_SW) {
+            indev_gesture_release(proc);
+            if(indev_reset_check(proc)) return;
+        }
+#endif
+
         /*Send RELEASE Call the ancestor's event handler and event*/
         lv_event_send(indev_obj_act, LV_EVENT_RELEASED, indev_act);
         if(indev_reset_check(proc)) return;
@@ -1039,6 +1066,10 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev)
         indev->proc.types.pointer.scroll_throw_vect.y = 0;
         indev->proc.types.pointer.gesture_sum.x     = 0;
         indev->proc.types.pointer.gesture_sum.y     = 0;
+#if LV_USE_INDEV_HW_GESTURE
+        indev->proc.types.pointer.gesture_hw_dir    = LV_DIR_NONE;
+        indev->proc.types.pointer.long_pr_hw        = 0;
+#endif
         indev->proc.reset_query                     = 0;
         indev_obj_act                               = NULL;
     }
@@ -1123,6 +1154,18 @@ void indev_gesture(_lv_indev_proc_t * proc)
     if(proc->types.pointer.scroll_obj) return;
     if(proc->types.pointer.gesture_sent) return;
 
+#if LV_USE_INDEV_HW_GESTURE
+    lv_indev_gesture_src_t src = indev_act->driver->gesture_src;
+    if(src != LV_INDEV_GESTURE_SW) {
+        if(proc->types.pointer.gesture_hw_dir != LV_DIR_NONE) {
+            indev_gesture_send(proc, proc->types.pointer.gesture_hw_dir);
+            return;
+        }
+        /*With HW_SW LVGL's own is sent as soon as it is found, the first one sent wins*/
+        if(src == LV_INDEV_GESTURE_HW) return;
+    }
+#endif
+
     lv_obj_t * gesture_obj = proc->types.pointer.act_obj;
 
     /*If gesture parent is active check recursively the gesture attribute*/
@@ -1145,26 +1188,63 @@ void indev_gesture(_lv_indev_proc_t * proc)
     if((LV_ABS(proc->types.pointer.gesture_sum.x) > indev_act->driver->gesture_limit) ||
        (LV_ABS(proc->types.pointer.gesture_sum.y) > indev_act->driver->gesture_limit)) {
 
-        proc->types.pointer.gesture_sent = 1;
-
+        lv_dir_t dir;
         if(LV_ABS(proc->types.pointer.gesture_sum.x) > LV_ABS(proc->types.pointer.gesture_sum.y)) {
             if(proc->types.pointer.gesture_sum.x > 0)
-                proc->types.pointer.gesture_dir = LV_DIR_RIGHT;
+                dir = LV_DIR_RIGHT;
             else
-                proc->types.pointer.gesture_dir = LV_DIR_LEFT;
+                dir = LV_DIR_LEFT;
         }
         else {
             if(proc->types.pointer.gesture_sum.y > 0)
-                proc->types.pointer.gesture_dir = LV_DIR_BOTTOM;
+                dir = LV_DIR_BOTTOM;
             else
-                proc->types.pointer.gesture_dir = LV_DIR_TOP;
+                dir = LV_DIR_TOP;
         }
 
+        proc->types.pointer.gesture_sent = 1;
+        proc->types.pointer.gesture_dir = dir;
         lv_event_send(gesture_obj, LV_EVENT_GESTURE, indev_act);
         if(indev_reset_check(proc)) return;
     }
 }
 
+#if LV_USE_INDEV_HW_GESTURE
+/**
+ * Send the gesture the controller reported with the release of a press
+ * @param proc pointer to an input device state
+ */
+static void indev_gesture_release(_lv_indev_proc_t * proc)
+{
+    if(proc->types.pointer.scroll_obj) return;
+    if(proc->types.pointer.gesture_sent) return;
+
+    if(proc->types.pointer.gesture_hw_dir != LV_DIR_NONE) {
+        indev_gesture_send(proc, proc->types.pointer.gesture_hw_dir);
+    }
+}
+
+/**
+ * Send a gesture to the pressed object or the parent it bubbles to
+ * @param proc pointer to an input device state
+ * @param dir direction of the gesture
+ */
+static void indev_gesture_send(_lv_indev_proc_t * proc, lv_dir_t dir)
+{
+    lv_obj_t * gesture_obj = proc->types.pointer.act_obj;
+    while(gesture_obj && lv_obj_has_flag(gesture_obj, LV_OBJ_FLAG_GESTURE_BUBBLE)) {
+        gesture_obj = lv_obj_get_parent(gesture_obj);
+    }
+
+    proc->types.pointer.gesture_hw_dir = LV_DIR_NONE;
+    if(gesture_obj == NULL) return;
+
+    proc->types.pointer.gesture_sent = 1;
+    proc->types.pointer.gesture_dir = dir;
+    lv_event_send(gesture_obj, LV_EVENT_GESTURE, indev_act);
+}
+#endif
+
 /**
  * Checks if the reset_query flag has been set. If so, perform necessary global indev cleanup actions
  * @param proc pointer to an input device 'proc'
@@ -14,6 +14,7 @@
 #include "lv_theme.h"
 #include "../misc/lv_assert.h"
 #include "../draw/lv_draw.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_async.h"
@@ -197,6 +198,7 @@ void lv_init(void)
 void lv_deinit(void)
 {
     _lv_gc_clear_roots();
+    lv_draw_sw_glyph_cache_clear(NULL);
 
     lv_disp_set_default(NULL);
     lv_mem_deinit();
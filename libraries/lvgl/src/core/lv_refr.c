@@ -23,9 +23,27 @@
     #include "../widgets/lv_label.h"
 #endif
 
+#if LV_USE_REFR_STRIPES
+    #include "../widgets/lv_img.h"
+    #include "../widgets/lv_btnmatrix.h"
+    #include "../widgets/lv_dropdown.h"
+    #include "../widgets/lv_table.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_REFR_STRIPES
+    #if LV_IMG_CACHE_DEF_SIZE
+        #error "LV_USE_REFR_STRIPES requires LV_IMG_CACHE_DEF_SIZE 0, a stripe could close a cached image another one draws"
+    #endif
+    #if LV_COLOR_SCREEN_TRANSP
+        #error "LV_USE_REFR_STRIPES requires LV_COLOR_SCREEN_TRANSP 0, the screen background clears the whole draw buffer"
+    #endif
+    #if LV_ENABLE_GC
+        #error "LV_USE_REFR_STRIPES can't be used with LV_ENABLE_GC, the roots of the draw state are thread local"
+    #endif
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -48,6 +66,19 @@ typedef struct {
 #endif
 } mem_monitor_t;
 
+#if LV_USE_REFR_STRIPES
+/*A stripe drawn by a worker*/
+typedef struct {
+    lv_disp_t disp;             /*Copy of the display, the layers change `screen_transp` of its driver*/
+    lv_disp_drv_t driver;
+    lv_draw_ctx_t * draw_ctx;   /*Copy of the draw context of the display*/
+    uint32_t draw_ctx_size;
+    lv_area_t clip_area;        /*The rows of the stripe*/
+    lv_obj_t * top_act_scr;
+    lv_obj_t * top_prev_scr;
+} refr_stripe_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -56,6 +87,7 @@ static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
@@ -69,12 +101,22 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 #if LV_USE_MEM_MONITOR
     static void mem_monitor_init(mem_monitor_t * mem_monitor);
 #endif
+#if LV_USE_REFR_STRIPES
+    static void refr_area_part_stripes(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr);
+    static void refr_stripe(void * p);
+    static bool stripe_obj_lock(const lv_obj_t * obj);
+    static void stripe_obj_unlock(void);
+    static bool obj_changes_while_drawing(const lv_obj_t * obj);
+    static bool img_moves_coords(const lv_obj_t * obj);
+    static void stripes_mem_lock(void);
+    static void stripes_mem_unlock(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t px_num;
-static lv_disp_t * disp_refr; /*Display being refreshed*/
+static LV_ATTRIBUTE_DRAW_TLS lv_disp_t * disp_refr; /*Display being refreshed, a copy in the stripe workers*/
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -84,6 +126,14 @@ static lv_disp_t * disp_refr; /*Display being refreshed*/
     static mem_monitor_t    mem_monitor;
 #endif
 
+#if LV_USE_REFR_STRIPES
+    static lv_refr_stripes_t stripes;   /*`workers == 0`: draw on the caller only*/
+    static refr_stripe_t stripe_jobs[LV_REFR_STRIPES_MAX - 1];
+    static bool stripes_running;
+    static LV_ATTRIBUTE_DRAW_TLS bool stripe_obj_locked;  /*This thread draws under `LV_REFR_STRIPES_LOCK_OBJ`*/
+    static lv_refr_stripes_stats_t stripes_stats;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -280,6 +330,72 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+#if LV_USE_REFR_STRIPES
+/**
+ * Draw the parts of the refreshes in horizontal stripes on more threads at once.
+ * @param new_stripes   the threads to use, copied. NULL: draw everything on the caller
+ */
+void lv_refr_set_stripes(const lv_refr_stripes_t * new_stripes)
+{
+    if(new_stripes == NULL || new_stripes->workers == 0) {
+        lv_memset_00(&stripes, sizeof(stripes));
+        return;
+    }
+
+    LV_ASSERT_NULL(new_stripes->start_cb);
+    LV_ASSERT_NULL(new_stripes->wait_cb);
+    LV_ASSERT_NULL(new_stripes->lock_cb);
+    LV_ASSERT_NULL(new_stripes->unlock_cb);
+
+    stripes = *new_stripes;
+    if(stripes.workers > LV_REFR_STRIPES_MAX - 1) stripes.workers = LV_REFR_STRIPES_MAX - 1;
+}
+
+/**
+ * Get how the parts were drawn since the last reset
+ * @param stats     store the counters here
+ */
+void lv_refr_get_stripes_stats(lv_refr_stripes_stats_t * stats)
+{
+    *stats = stripes_stats;
+}
+
+/**
+ * Reset the counters of `lv_refr_get_stripes_stats()`
+ */
+void lv_refr_reset_stripes_stats(void)
+{
+    lv_memset_00(&stripes_stats, sizeof(stripes_stats));
+}
+
+/**
+ * Tell if the stripes of a part are being drawn right now
+ * @return true: shared state can be changed only under `_lv_refr_stripes_lock()`
+ */
+bool _lv_refr_stripes_running(void)
+{
+    return stripes_running;
+}
+
+/**
+ * Take a lock of the shared state while the stripes are drawn, nothing otherwise
+ * @param lock      the lock to take
+ */
+void _lv_refr_stripes_lock(lv_refr_stripes_lock_t lock)
+{
+    if(stripes_running) stripes.lock_cb(lock);
+}
+
+/**
+ * Give back a lock taken with `_lv_refr_stripes_lock()`
+ * @param lock      the lock to give
+ */
+void _lv_refr_stripes_unlock(lv_refr_stripes_lock_t lock)
+{
+    if(stripes_running) stripes.unlock_cb(lock);
+}
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param tmr pointer to the timer itself
@@ -417,7 +533,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
-#if LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0 && LV_USE_LABEL
+#if LV_USE_MEM_MONITOR && (LV_MEM_CUSTOM == 0 || LV_USE_MEM_TIER) && LV_USE_LABEL
     lv_obj_t * mem_label = mem_monitor.mem_label;
     if(mem_label == NULL) {
         mem_label = lv_label_create(lv_layer_sys());
@@ -734,6 +850,23 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
         top_prev_scr = lv_refr_get_top_obj(draw_ctx->buf_area, disp_refr->prev_scr);
     }
 
+#if LV_USE_REFR_STRIPES
+    refr_area_part_stripes(draw_ctx, top_act_scr, top_prev_scr);
+#else
+    refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+#endif
+
+    draw_buf_flush(disp_refr);
+}
+
+/**
+ * Draw the part of `draw_ctx->buf_area` which is in `draw_ctx->clip_area`
+ * @param draw_ctx      the draw context of the display
+ * @param top_act_scr   the top object of the active screen which covers the whole part, or NULL
+ * @param top_prev_scr  the same on the previous screen
+ */
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr)
+{
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         lv_area_t a;
@@ -794,10 +927,193 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+}
 
-    draw_buf_flush(disp_refr);
+#if LV_USE_REFR_STRIPES
+/**
+ * Draw a part in horizontal stripes. The workers draw all but the first one, each with its own copy
+ * of the draw context and the display, while the caller draws the first one.
+ * They share the draw buffer but every stripe writes only the rows of its own clip area.
+ * Returns when all the stripes are ready.
+ * @param draw_ctx      the draw context of the display
+ * @param top_act_scr   the top object of the active screen which covers the whole part, or NULL
+ * @param top_prev_scr  the same on the previous screen
+ */
+static void refr_area_part_stripes(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_act_scr, lv_obj_t * top_prev_scr)
+{
+    if(stripes.workers == 0) {
+        refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+        return;
+    }
+
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    lv_coord_t h = lv_area_get_height(clip_area);
+    lv_coord_t cnt = stripes.workers + 1;
+    if(stripes.min_rows > 0 && h / cnt < stripes.min_rows) cnt = h / stripes.min_rows;
+    if(cnt > h) cnt = h;
+    if(cnt < 2) {
+        stripes_stats.whole++;
+        refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+        return;
+    }
+
+    /*The first `h % cnt` stripes get one more row*/
+    lv_area_t own_area = *clip_area;
+    own_area.y2 = own_area.y1 + h / cnt + (h % cnt > 0 ? 1 : 0) - 1;
+
+    uint32_t draw_ctx_size = disp_refr->driver->draw_ctx_size;
+    lv_coord_t y = own_area.y2 + 1;
+    lv_coord_t i;
+    for(i = 1; i < cnt; i++) {
+        refr_stripe_t * s = &stripe_jobs[i - 1];
+        if(s->draw_ctx_size < draw_ctx_size) {
+            lv_draw_ctx_t * new_ctx = lv_mem_realloc(s->draw_ctx, draw_ctx_size);
+            LV_ASSERT_MALLOC(new_ctx);
+            if(new_ctx == NULL) break;
+            s->draw_ctx = new_ctx;
+            s->draw_ctx_size = draw_ctx_size;
+        }
+
+        s->clip_area = *clip_area;
+        s->clip_area.y1 = y;
+        s->clip_area.y2 = y + h / cnt + (h % cnt > i ? 1 : 0) - 1;
+        y = s->clip_area.y2 + 1;
+
+        lv_memcpy(s->draw_ctx, draw_ctx, draw_ctx_size);
+        s->draw_ctx->clip_area = &s->clip_area;
+        s->driver = *disp_refr->driver;
+        s->driver.draw_ctx = s->draw_ctx;
+        s->disp = *disp_refr;
+        s->disp.driver = &s->driver;
+        s->top_act_scr = top_act_scr;
+        s->top_prev_scr = top_prev_scr;
+    }
+
+    /*Without memory for a copy of the draw context the caller draws the rest too*/
+    if(i < cnt) {
+        cnt = i;
+        if(cnt < 2) {
+            stripes_stats.whole++;
+            refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+            return;
+        }
+        stripe_jobs[cnt - 2].clip_area.y2 = clip_area->y2;
+    }
+
+    _lv_mem_set_lock(stripes_mem_lock, stripes_mem_unlock);
+    stripes_running = true;
+
+    for(i = 1; i < cnt; i++) {
+        stripes.start_cb(i - 1, refr_stripe, &stripe_jobs[i - 1]);
+    }
+
+    draw_ctx->clip_area = &own_area;
+    refr_area_part_draw(draw_ctx, top_act_scr, top_prev_scr);
+    draw_ctx->clip_area = clip_area;
+
+    /*Flush only the complete part*/
+    stripes.wait_cb();
+
+    stripes_running = false;
+    _lv_mem_set_lock(NULL, NULL);
+
+    stripes_stats.split++;
+    stripes_stats.stripes += cnt - 1;
+}
+
+/**
+ * Draw a stripe on a worker
+ * @param p     pointer to a `refr_stripe_t`
+ */
+static void refr_stripe(void * p)
+{
+    refr_stripe_t * s = p;
+    disp_refr = &s->disp;
+    refr_area_part_draw(s->draw_ctx, s->top_act_scr, s->top_prev_scr);
+    disp_refr = NULL;
+
+    /*`lv_timer_handler()` frees only the buffers of its own thread*/
+    lv_mem_buf_free_all();
+}
+
+/**
+ * Take `LV_REFR_STRIPES_LOCK_OBJ` to draw a widget which changes itself while drawing,
+ * unless this stripe holds it already
+ * @param obj   pointer to a widget
+ * @return      true: taken, give it back with `stripe_obj_unlock()`
+ */
+static bool stripe_obj_lock(const lv_obj_t * obj)
+{
+    if(!stripes_running || stripe_obj_locked || !obj_changes_while_drawing(obj)) return false;
+
+    stripes.lock_cb(LV_REFR_STRIPES_LOCK_OBJ);
+    stripe_obj_locked = true;
+    return true;
+}
+
+static void stripe_obj_unlock(void)
+{
+    stripe_obj_locked = false;
+    stripes.unlock_cb(LV_REFR_STRIPES_LOCK_OBJ);
 }
 
+/**
+ * Tell if a widget changes itself while it draws, switches its state to get the styles of its buttons
+ * or cells for example. The parent of an image which moves its coordinates counts too,
+ * it reads the coordinates of its children for the scrollbars.
+ * @param obj   pointer to a widget
+ * @return      true: only one stripe at a time can draw it
+ */
+static bool obj_changes_while_drawing(const lv_obj_t * obj)
+{
+    if(img_moves_coords(obj)) return true;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(img_moves_coords(obj->spec_attr->children[i])) return true;
+    }
+
+#if LV_USE_BTNMATRIX
+    if(lv_obj_has_class(obj, &lv_btnmatrix_class)) return true;
+#endif
+#if LV_USE_TABLE
+    if(lv_obj_has_class(obj, &lv_table_class)) return true;
+#endif
+#if LV_USE_DROPDOWN
+    if(lv_obj_has_class(obj, &lv_dropdownlist_class)) return true;
+#endif
+    return false;
+}
+
+/**
+ * Tell if an image draws its background with moved coordinates, rotated or zoomed
+ * @param obj   pointer to a widget
+ * @return      true: the coordinates change while it draws
+ */
+static bool img_moves_coords(const lv_obj_t * obj)
+{
+#if LV_USE_IMG
+    if(lv_obj_has_class(obj, &lv_img_class)) {
+        const lv_img_t * img = (const lv_img_t *)obj;
+        return img->angle != 0 || img->zoom != LV_IMG_ZOOM_NONE;
+    }
+#endif
+    LV_UNUSED(obj);
+    return false;
+}
+
+static void stripes_mem_lock(void)
+{
+    stripes.lock_cb(LV_REFR_STRIPES_LOCK_MEM);
+}
+
+static void stripes_mem_unlock(void)
+{
+    stripes.unlock_cb(LV_REFR_STRIPES_LOCK_MEM);
+}
+#endif /*LV_USE_REFR_STRIPES*/
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -878,9 +1194,15 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
         }
 
         /*Call the post draw draw function of the parents of the to object*/
+#if LV_USE_REFR_STRIPES
+        bool parent_locked = stripe_obj_lock(parent);
+#endif
         lv_event_send(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)draw_ctx);
         lv_event_send(parent, LV_EVENT_DRAW_POST, (void *)draw_ctx);
         lv_event_send(parent, LV_EVENT_DRAW_POST_END, (void *)draw_ctx);
+#if LV_USE_REFR_STRIPES
+        if(parent_locked) stripe_obj_unlock();
+#endif
 
         /*The new border will be the last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -969,6 +1291,16 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+#if LV_USE_REFR_STRIPES
+    /*Only one stripe at a time can draw a widget which changes itself while drawing, the other ones
+     *would see it changed. Its children are drawn under the same lock, they can be such widgets too.*/
+    if(stripe_obj_lock(obj)) {
+        refr_obj(draw_ctx, obj);
+        stripe_obj_unlock();
+        return;
+    }
+#endif
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(draw_ctx, obj);
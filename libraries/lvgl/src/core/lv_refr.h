@@ -22,10 +22,62 @@ extern "C" {
 
 #define LV_REFR_TASK_PRIO LV_TASK_PRIO_MID
 
+#if LV_USE_REFR_STRIPES
+/*A part is drawn in at most this many stripes: one on the caller, the others on the workers*/
+#define LV_REFR_STRIPES_MAX 4
+
+#define LV_REFR_STRIPES_LOCK(lock)      _lv_refr_stripes_lock(lock)
+#define LV_REFR_STRIPES_UNLOCK(lock)    _lv_refr_stripes_unlock(lock)
+#define LV_REFR_STRIPES_RUNNING()       _lv_refr_stripes_running()
+#else
+#define LV_REFR_STRIPES_LOCK(lock)
+#define LV_REFR_STRIPES_UNLOCK(lock)
+#define LV_REFR_STRIPES_RUNNING()       false
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_STRIPES
+/**
+ * The state shared by the stripes of a part. If more are needed at once they are taken in this order.
+ */
+typedef enum {
+    LV_REFR_STRIPES_LOCK_OBJ,       /**< Widgets which switch their own state while they draw (button matrix, table)*/
+    LV_REFR_STRIPES_LOCK_CACHE,     /**< The circle and glyph caches*/
+    LV_REFR_STRIPES_LOCK_MEM,       /**< The LVGL heap*/
+    _LV_REFR_STRIPES_LOCK_NUM
+} lv_refr_stripes_lock_t;
+
+/**
+ * Threads of the application which draw stripes of the refreshed parts
+ */
+typedef struct {
+    /**Threads besides the one calling `lv_timer_handler()`, at most `LV_REFR_STRIPES_MAX - 1`*/
+    uint8_t workers;
+
+    /**Parts are drawn by the caller alone if a stripe would have fewer rows*/
+    lv_coord_t min_rows;
+
+    /**Call `stripe_cb(stripe)` on the thread `worker` (0..workers - 1) and return without waiting for it*/
+    void (*start_cb)(uint8_t worker, void (*stripe_cb)(void * stripe), void * stripe);
+
+    /**Return when every stripe started since the last call has been drawn*/
+    void (*wait_cb)(void);
+
+    /**Take and give a lock. Called only while the stripes of a part are drawn*/
+    void (*lock_cb)(lv_refr_stripes_lock_t lock);
+    void (*unlock_cb)(lv_refr_stripes_lock_t lock);
+} lv_refr_stripes_t;
+
+typedef struct {
+    uint32_t split;     /**< Parts drawn in stripes*/
+    uint32_t whole;     /**< Parts drawn by the caller alone, they had too few rows*/
+    uint32_t stripes;   /**< Stripes drawn by the workers*/
+} lv_refr_stripes_stats_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -98,6 +150,46 @@ void lv_refr_reset_fps_counter(void);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+#if LV_USE_REFR_STRIPES
+/**
+ * Draw the parts of the refreshes in horizontal stripes on more threads at once.
+ * Each stripe is drawn with its own draw context into its own rows of the draw buffer,
+ * the part is flushed when all of them are ready.
+ * @param stripes   the threads to use, copied. NULL: draw everything on the caller
+ * @note Call it only between refreshes
+ */
+void lv_refr_set_stripes(const lv_refr_stripes_t * stripes);
+
+/**
+ * Get how the parts were drawn since the last reset
+ * @param stats     store the counters here
+ */
+void lv_refr_get_stripes_stats(lv_refr_stripes_stats_t * stats);
+
+/**
+ * Reset the counters of `lv_refr_get_stripes_stats()`
+ */
+void lv_refr_reset_stripes_stats(void);
+
+/**
+ * Tell if the stripes of a part are being drawn right now
+ * @return true: shared state can be changed only under `_lv_refr_stripes_lock()`
+ */
+bool _lv_refr_stripes_running(void);
+
+/**
+ * Take a lock of the shared state while the stripes are drawn, nothing otherwise
+ * @param lock      the lock to take
+ */
+void _lv_refr_stripes_lock(lv_refr_stripes_lock_t lock);
+
+/**
+ * Give back a lock taken with `_lv_refr_stripes_lock()`
+ * @param lock      the lock to give
+ */
+void _lv_refr_stripes_unlock(lv_refr_stripes_lock_t lock);
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
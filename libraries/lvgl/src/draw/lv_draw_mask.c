@@ -12,12 +12,15 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_gc.h"
+#include "../core/lv_refr.h"
+#include LV_CIRCLE_CACHE_INCLUDE
 
 /*********************
  *      DEFINES
  *********************/
 #define CIRCLE_CACHE_LIFE_MAX   1000
 #define CIRCLE_CACHE_AGING(life, r)   life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
+#define CIRCLE_BUF_SIZE(r)      ((r) > 0 ? (uint32_t)(r) * 6 + 6 : 0)
 
 /**********************
  *      TYPEDEFS
@@ -56,6 +59,9 @@ static void circ_init(lv_point_t * c, lv_coord_t * tmp, lv_coord_t radius);
 static bool circ_cont(lv_point_t * c);
 static void circ_next(lv_point_t * c, lv_coord_t * tmp);
 static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
+static _lv_draw_mask_radius_circle_dsc_t * circle_cache_least_used(const _lv_draw_mask_radius_circle_dsc_t * skip,
+                                                                   bool cached_only);
+static uint32_t circle_cache_bytes(void);
 static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
@@ -63,6 +69,9 @@ static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, l
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t circle_cache_hit;
+static uint32_t circle_cache_miss;
+static uint32_t circle_cache_evict;
 
 /**********************
  *      MACROS
@@ -214,13 +223,15 @@ void lv_draw_mask_free_param(void * p)
     if(pdsc->type == LV_DRAW_MASK_TYPE_RADIUS) {
         lv_draw_mask_radius_param_t * radius_p = (lv_draw_mask_radius_param_t *) p;
         if(radius_p->circle) {
+            LV_REFR_STRIPES_LOCK(LV_REFR_STRIPES_LOCK_CACHE);
             if(radius_p->circle->life < 0) {
-                lv_mem_free(radius_p->circle->cir_opa);
+                LV_CIRCLE_CACHE_FREE(radius_p->circle->buf);
                 lv_mem_free(radius_p->circle);
             }
             else {
                 radius_p->circle->used_cnt--;
             }
+            LV_REFR_STRIPES_UNLOCK(LV_REFR_STRIPES_LOCK_CACHE);
         }
     }
     else if(pdsc->type == LV_DRAW_MASK_TYPE_POLYGON) {
@@ -234,12 +245,39 @@ void _lv_draw_mask_cleanup(void)
     uint8_t i;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
         if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
+            LV_CIRCLE_CACHE_FREE(LV_GC_ROOT(_lv_circle_cache[i]).buf);
         }
         lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
     }
 }
 
+/**
+ * Get the statistics of the circle cache used by the radius masks.
+ * @param stats     store the counters and the current size of the cache here
+ */
+void lv_draw_mask_get_circle_cache_stats(lv_draw_mask_circle_cache_stats_t * stats)
+{
+    uint32_t i;
+    stats->hit = circle_cache_hit;
+    stats->miss = circle_cache_miss;
+    stats->evict = circle_cache_evict;
+    stats->bytes = circle_cache_bytes();
+    stats->entries = 0;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) stats->entries++;
+    }
+}
+
+/**
+ * Zero the hit, miss and evict counters of the circle cache.
+ */
+void lv_draw_mask_reset_circle_cache_stats(void)
+{
+    circle_cache_hit = 0;
+    circle_cache_miss = 0;
+    circle_cache_evict = 0;
+}
+
 /**
  * Count the currently added masks
  * @return number of active masks
@@ -493,24 +531,45 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
 
     uint32_t i;
 
+    /*The stripes share the cache, an entry is also calculated under the lock
+     *so no stripe can find it half done*/
+    LV_REFR_STRIPES_LOCK(LV_REFR_STRIPES_LOCK_CACHE);
+
     /*Try to reuse a circle cache entry*/
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
         if(LV_GC_ROOT(_lv_circle_cache[i]).radius == radius) {
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+            circle_cache_hit++;
+            LV_REFR_STRIPES_UNLOCK(LV_REFR_STRIPES_LOCK_CACHE);
             return;
         }
     }
+    circle_cache_miss++;
 
     /*If not found find a free entry with lowest life*/
-    _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
-    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).used_cnt == 0) {
-            if(!entry) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
-            else if(LV_GC_ROOT(_lv_circle_cache[i]).life < entry->life) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
+    _lv_draw_mask_radius_circle_dsc_t * entry = circle_cache_least_used(NULL, false);
+
+#if LV_CIRCLE_CACHE_BUDGET
+    /*Drop the other least used circles until the new one fits into the budget.
+     *If it can't fit even alone it's calculated for this mask only.*/
+    if(CIRCLE_BUF_SIZE(radius) > LV_CIRCLE_CACHE_BUDGET) entry = NULL;
+    if(entry) {
+        uint32_t other_bytes = circle_cache_bytes() - CIRCLE_BUF_SIZE(entry->radius);
+        while(other_bytes + CIRCLE_BUF_SIZE(radius) > LV_CIRCLE_CACHE_BUDGET) {
+            _lv_draw_mask_radius_circle_dsc_t * victim = circle_cache_least_used(entry, true);
+            if(victim == NULL) {
+                entry = NULL;
+                break;
+            }
+            other_bytes -= CIRCLE_BUF_SIZE(victim->radius);
+            LV_CIRCLE_CACHE_FREE(victim->buf);
+            lv_memset_00(victim, sizeof(_lv_draw_mask_radius_circle_dsc_t));
+            circle_cache_evict++;
         }
     }
+#endif
 
     if(!entry) {
         entry = lv_mem_alloc(sizeof(_lv_draw_mask_radius_circle_dsc_t));
@@ -519,6 +578,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         entry->life = -1;
     }
     else {
+        if(entry->buf) circle_cache_evict++;
         entry->used_cnt++;
         entry->life = 0;
         CIRCLE_CACHE_AGING(entry->life, radius);
@@ -527,6 +587,8 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     param->circle = entry;
 
     circ_calc_aa4(param->circle, radius);
+
+    LV_REFR_STRIPES_UNLOCK(LV_REFR_STRIPES_LOCK_CACHE);
 }
 
 /**
@@ -1368,9 +1430,9 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
     c->radius = radius;
 
     /*Allocate buffers*/
-    if(c->buf) lv_mem_free(c->buf);
+    if(c->buf) LV_CIRCLE_CACHE_FREE(c->buf);
 
-    c->buf = lv_mem_alloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
+    c->buf = LV_CIRCLE_CACHE_ALLOC(CIRCLE_BUF_SIZE(radius));  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
     LV_ASSERT_MALLOC(c->buf);
     c->cir_opa = c->buf;
     c->opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
@@ -1510,6 +1572,39 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
     lv_mem_buf_release(cir_x);
 }
 
+/**
+ * Find the circle cache entry with the lowest life among the ones no mask uses.
+ * @param skip          don't return this entry (can be `NULL`)
+ * @param cached_only   true: only entries holding a circle; false: empty entries too
+ * @return the entry or `NULL` if there is no such entry
+ */
+static _lv_draw_mask_radius_circle_dsc_t * circle_cache_least_used(const _lv_draw_mask_radius_circle_dsc_t * skip,
+                                                                   bool cached_only)
+{
+    _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        _lv_draw_mask_radius_circle_dsc_t * c = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(c->used_cnt != 0 || c == skip) continue;
+        if(cached_only && c->buf == NULL) continue;
+        if(!entry || c->life < entry->life) entry = c;
+    }
+    return entry;
+}
+
+/**
+ * @return the bytes allocated for the circles in the cache
+ */
+static uint32_t circle_cache_bytes(void)
+{
+    uint32_t bytes = 0;
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) bytes += CIRCLE_BUF_SIZE(LV_GC_ROOT(_lv_circle_cache[i]).radius);
+    }
+    return bytes;
+}
+
 static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start)
 {
@@ -165,6 +165,14 @@ typedef struct  {
 
 typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
 
+typedef struct {
+    uint32_t hit;       /**< Radius masks that found their circle in the cache*/
+    uint32_t miss;      /**< Radius masks that had to calculate their circle*/
+    uint32_t evict;     /**< Cached circles dropped for an other radius*/
+    uint32_t bytes;     /**< Current size of the cached circles*/
+    uint32_t entries;   /**< Current number of cached circles*/
+} lv_draw_mask_circle_cache_stats_t;
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_mask_common_dsc_t dsc;
@@ -294,6 +302,17 @@ void lv_draw_mask_free_param(void * p);
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Get the statistics of the circle cache used by the radius masks.
+ * @param stats     store the counters and the current size of the cache here
+ */
+void lv_draw_mask_get_circle_cache_stats(lv_draw_mask_circle_cache_stats_t * stats);
+
+/**
+ * Zero the hit, miss and evict counters of the circle cache.
+ */
+void lv_draw_mask_reset_circle_cache_stats(void);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -43,6 +43,15 @@ typedef struct {
     uint32_t has_alpha : 1;
 } lv_draw_sw_layer_ctx_t;
 
+typedef struct {
+    uint32_t hit;       /**< Letters blended from a cached glyph*/
+    uint32_t miss;      /**< Letters whose glyph had to be decoded*/
+    uint32_t evict;     /**< Cached glyphs dropped for an other glyph*/
+    uint32_t bytes;     /**< Current size of the cached glyphs*/
+    uint32_t entries;   /**< Current number of cached glyphs*/
+    uint32_t pinned;    /**< Cached glyphs which are never dropped*/
+} lv_draw_sw_glyph_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -61,6 +70,35 @@ void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, con
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
                        uint32_t letter);
 
+/**
+ * Decode the glyphs of some letters into the glyph cache and keep them there
+ * until `lv_draw_sw_glyph_cache_clear()`, e.g. the digits of a counter.
+ * Pinned glyphs count in `LV_GLYPH_CACHE_SIZE` and `LV_GLYPH_CACHE_BUDGET` too.
+ * Does nothing if `LV_GLYPH_CACHE_SIZE` is 0.
+ * @param font      font of the letters, the glyphs missing from it are taken from its fallback
+ * @param txt       UTF-8 text with the letters to pin
+ * @return          number of letters whose glyph is pinned now
+ */
+uint32_t lv_draw_sw_glyph_cache_pin(const lv_font_t * font, const char * txt);
+
+/**
+ * Drop glyphs from the glyph cache, the pinned ones too.
+ * `lv_font_free()` and `lv_ft_font_destroy()` call it for their font.
+ * @param font      drop the glyphs of this font only, NULL to drop every glyph
+ */
+void lv_draw_sw_glyph_cache_clear(const lv_font_t * font);
+
+/**
+ * Get the statistics of the glyph cache.
+ * @param stats     store the counters and the current size of the cache here
+ */
+void lv_draw_sw_get_glyph_cache_stats(lv_draw_sw_glyph_cache_stats_t * stats);
+
+/**
+ * Zero the hit, miss and evict counters of the glyph cache.
+ */
+void lv_draw_sw_reset_glyph_cache_stats(void);
+
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_img_dsc_t * draw_dsc,
                                                         const lv_area_t * coords, const uint8_t * src_buf,
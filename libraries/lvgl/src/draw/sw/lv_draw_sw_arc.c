@@ -31,6 +31,7 @@ typedef struct {
     lv_coord_t width;
     lv_draw_rect_dsc_t * draw_dsc;
     const lv_area_t * draw_area;
+    const lv_area_t * hole;
     lv_draw_ctx_t * draw_ctx;
 } quarter_draw_dsc_t;
 
@@ -43,6 +44,10 @@ typedef struct {
     static void draw_quarter_2(quarter_draw_dsc_t * q);
     static void draw_quarter_3(quarter_draw_dsc_t * q);
     static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area);
+    static void draw_ring(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords,
+                          const lv_area_t * hole);
+    static bool clip_has_arc(const lv_area_t * clip_area, const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                             uint16_t start_angle, uint16_t end_angle, bool rounded);
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
@@ -68,6 +73,9 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
     lv_coord_t width = dsc->width;
     if(width > radius) width = radius;
 
+    /*Nothing to do if only a part without arc is redrawn, e.g. a label in the middle or an other sector*/
+    if(!clip_has_arc(draw_ctx->clip_area, center, radius, width, start_angle, end_angle, dsc->rounded)) return;
+
     lv_draw_rect_dsc_t cir_dsc;
     lv_draw_rect_dsc_init(&cir_dsc);
     cir_dsc.blend_mode = dsc->blend_mode;
@@ -108,10 +116,23 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
     lv_draw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
     int16_t mask_out_id = lv_draw_mask_add(&mask_out_param, NULL);
 
+    /*The masks remove everything in the hole, don't even blend a square inside it.
+     *Its corners are 2 pixels in from the inner circle because of the anti-aliasing. (181 / 256 < 1 / sqrt(2))*/
+    lv_area_t hole;
+    const lv_area_t * hole_p = NULL;
+    if(radius - width - 2 > 0) {
+        lv_coord_t hole_half = ((radius - width - 2) * 181) >> 8;
+        hole.x1 = center->x - hole_half;
+        hole.y1 = center->y - hole_half;
+        hole.x2 = center->x + hole_half - 1;
+        hole.y2 = center->y + hole_half - 1;
+        if(hole_half > 0) hole_p = &hole;
+    }
+
     /*Draw a full ring*/
     if(start_angle + 360 == end_angle || start_angle == end_angle + 360) {
         cir_dsc.radius = LV_RADIUS_CIRCLE;
-        lv_draw_rect(draw_ctx, &cir_dsc, &area_out);
+        draw_ring(draw_ctx, &cir_dsc, &area_out, hole_p);
 
         lv_draw_mask_remove_id(mask_out_id);
         if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_remove_id(mask_in_id);
@@ -153,6 +174,7 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
         q_dsc.width = width;
         q_dsc.draw_dsc = &cir_dsc;
         q_dsc.draw_area = &area_out;
+        q_dsc.hole = hole_p;
         q_dsc.draw_ctx = draw_ctx;
 
         draw_quarter_0(&q_dsc);
@@ -161,7 +183,7 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
         draw_quarter_3(&q_dsc);
     }
     else {
-        lv_draw_rect(draw_ctx, &cir_dsc, &area_out);
+        draw_ring(draw_ctx, &cir_dsc, &area_out, hole_p);
     }
 
     lv_draw_mask_free_param(&mask_angle_param);
@@ -227,6 +249,77 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
  **********************/
 
 #if LV_DRAW_COMPLEX
+/**
+ * Draw the masked rectangle of the ring on the clip area, leaving out the part in `hole`.
+ * @param draw_ctx      draw context, its clip area is split around `hole` and restored
+ * @param dsc           the ring's rectangle
+ * @param coords        coordinates of the rectangle
+ * @param hole          the area to skip, `NULL` to draw everything
+ */
+static void draw_ring(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords,
+                      const lv_area_t * hole)
+{
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    lv_area_t skip;
+    if(hole == NULL || !_lv_area_intersect(&skip, clip_area_ori, hole)) {
+        lv_draw_rect(draw_ctx, dsc, coords);
+        return;
+    }
+
+    /*Above, below, left and right of the skipped part*/
+    lv_area_t parts[4];
+    lv_area_copy(&parts[0], clip_area_ori);
+    parts[0].y2 = skip.y1 - 1;
+    lv_area_copy(&parts[1], clip_area_ori);
+    parts[1].y1 = skip.y2 + 1;
+    lv_area_copy(&parts[2], &skip);
+    parts[2].x1 = clip_area_ori->x1;
+    parts[2].x2 = skip.x1 - 1;
+    lv_area_copy(&parts[3], &skip);
+    parts[3].x1 = skip.x2 + 1;
+    parts[3].x2 = clip_area_ori->x2;
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        if(lv_area_get_width(&parts[i]) <= 0 || lv_area_get_height(&parts[i]) <= 0) continue;
+        draw_ctx->clip_area = &parts[i];
+        lv_draw_rect(draw_ctx, dsc, coords);
+    }
+    draw_ctx->clip_area = clip_area_ori;
+}
+
+/**
+ * Tell if the clip area can have pixels of an arc.
+ * @return false if the clip area is in the hole of the ring or out of the bounding box of the arc's angles
+ */
+static bool clip_has_arc(const lv_area_t * clip_area, const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                         uint16_t start_angle, uint16_t end_angle, bool rounded)
+{
+    /*The farthest corner of the clip area is compared. The center is on a pixel edge,
+     *pixel `x` covers `x..x+1`. Keep 2 pixels for anti-aliasing.*/
+    int32_t r_hole = radius - width - 2;
+    if(r_hole > 0) {
+        int32_t dx = LV_MAX(LV_ABS(clip_area->x1 - center->x), LV_ABS(clip_area->x2 + 1 - center->x));
+        int32_t dy = LV_MAX(LV_ABS(clip_area->y1 - center->y), LV_ABS(clip_area->y2 + 1 - center->y));
+        if(dx * dx + dy * dy < r_hole * r_hole) return false;
+    }
+
+    lv_area_t arc_area;
+    if(start_angle + 360 == end_angle || start_angle == end_angle + 360) {
+        arc_area.x1 = center->x - radius;
+        arc_area.y1 = center->y - radius;
+        arc_area.x2 = center->x + radius - 1;
+        arc_area.y2 = center->y + radius - 1;
+    }
+    else {
+        while(start_angle >= 360) start_angle -= 360;
+        while(end_angle >= 360) end_angle -= 360;
+        lv_draw_arc_get_area(center->x, center->y, radius, start_angle, end_angle, width, rounded, &arc_area);
+    }
+
+    return _lv_area_is_on(&arc_area, clip_area);
+}
+
 static void draw_quarter_0(quarter_draw_dsc_t * q)
 {
     const lv_area_t * clip_area_ori = q->draw_ctx->clip_area;
@@ -243,7 +336,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     else if(q->start_quarter == 0 || q->end_quarter == 0) {
@@ -258,7 +351,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
         if(q->end_quarter == 0) {
@@ -271,7 +364,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
     }
@@ -288,7 +381,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -310,7 +403,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     else if(q->start_quarter == 1 || q->end_quarter == 1) {
@@ -325,7 +418,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
         if(q->end_quarter == 1) {
@@ -338,7 +431,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
     }
@@ -355,7 +448,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -377,7 +470,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     else if(q->start_quarter == 2 || q->end_quarter == 2) {
@@ -392,7 +485,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
         if(q->end_quarter == 2) {
@@ -405,7 +498,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
     }
@@ -422,7 +515,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -444,7 +537,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
     else if(q->start_quarter == 3 || q->end_quarter == 3) {
@@ -459,7 +552,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
         if(q->end_quarter == 3) {
@@ -472,7 +565,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
             }
         }
     }
@@ -489,7 +582,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->hole);
         }
     }
 
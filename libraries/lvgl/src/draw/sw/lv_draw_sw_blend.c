@@ -69,10 +69,40 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
 static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
 #endif /*LV_DRAW_COMPLEX*/
 
+static void fill_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color);
+static void fill_opa_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                         lv_opa_t opa);
+static void fill_mask_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                          const lv_opa_t * mask, lv_coord_t mask_stride);
+static void copy_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf, lv_coord_t src_stride,
+                     int32_t w, int32_t h);
+static void copy_opa_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                         lv_coord_t src_stride, int32_t w, int32_t h, lv_opa_t opa);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_sw_blend_kernels_t lv_draw_sw_blend_kernels_ref = {
+    .fill = fill_ref,
+    .fill_opa = fill_opa_ref,
+    .fill_mask = fill_mask_ref,
+    .copy = copy_ref,
+    .copy_opa = copy_opa_ref,
+};
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_DRAW_SW_BLEND_KERNELS == LV_DRAW_SW_BLEND_KERNELS_SWAR && LV_COLOR_DEPTH == 16
+static const lv_draw_sw_blend_kernels_t * kernels = &lv_draw_sw_blend_kernels_swar;
+#elif LV_DRAW_SW_BLEND_KERNELS == LV_DRAW_SW_BLEND_KERNELS_PIE
+#error "PIE kernels not implemented, set LV_DRAW_SW_BLEND_KERNELS to 0 or 1"
+#else
+static const lv_draw_sw_blend_kernels_t * kernels = &lv_draw_sw_blend_kernels_ref;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -207,6 +237,16 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx,
 }
 
 
+void lv_draw_sw_blend_set_kernels(const lv_draw_sw_blend_kernels_t * new_kernels)
+{
+    kernels = new_kernels ? new_kernels : &lv_draw_sw_blend_kernels_ref;
+}
+
+const lv_draw_sw_blend_kernels_t * lv_draw_sw_blend_get_kernels(void)
+{
+    return kernels;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -257,95 +297,18 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
     /*No mask*/
     if(mask == NULL) {
         if(opa >= LV_OPA_MAX) {
-            for(y = 0; y < h; y++) {
-                lv_color_fill(dest_buf, color, w);
-                dest_buf += dest_stride;
-            }
+            kernels->fill(dest_buf, dest_stride, w, h, color);
         }
         /*Has opacity*/
         else {
-            lv_color_t last_dest_color = lv_color_black();
-            lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
-
-#if LV_COLOR_MIX_ROUND_OFS == 0 && LV_COLOR_DEPTH == 16
-            /*lv_color_mix work with an optimized algorithm with 16 bit color depth.
-             *However, it introduces some rounded error on opa.
-             *Introduce the same error here too to make lv_color_premult produces the same result */
-            opa = (uint32_t)((uint32_t)opa + 4) >> 3;
-            opa = opa << 3;
-#endif
-
-            uint16_t color_premult[3];
-            lv_color_premult(color, opa, color_premult);
-            lv_opa_t opa_inv = 255 - opa;
-
-            for(y = 0; y < h; y++) {
-                for(x = 0; x < w; x++) {
-                    if(last_dest_color.full != dest_buf[x].full) {
-                        last_dest_color = dest_buf[x];
-                        last_res_color = lv_color_mix_premult(color_premult, dest_buf[x], opa_inv);
-                    }
-                    dest_buf[x] = last_res_color;
-                }
-                dest_buf += dest_stride;
-            }
+            kernels->fill_opa(dest_buf, dest_stride, w, h, color, opa);
         }
     }
     /*Masked*/
     else {
-#if LV_COLOR_DEPTH == 16
-        uint32_t c32 = color.full + ((uint32_t)color.full << 16);
-#endif
         /*Only the mask matters*/
         if(opa >= LV_OPA_MAX) {
-            int32_t x_end4 = w - 4;
-            for(y = 0; y < h; y++) {
-                for(x = 0; x < w && ((lv_uintptr_t)(mask) & 0x3); x++) {
-                    FILL_NORMAL_MASK_PX(color)
-                }
-
-                for(; x <= x_end4; x += 4) {
-                    uint32_t mask32 = *((uint32_t *)mask);
-                    if(mask32 == 0xFFFFFFFF) {
-#if LV_COLOR_DEPTH == 16
-                        if((lv_uintptr_t)dest_buf & 0x3) {
-                            *(dest_buf + 0) = color;
-                            uint32_t * d = (uint32_t *)(dest_buf + 1);
-                            *d = c32;
-                            *(dest_buf + 3) = color;
-                        }
-                        else {
-                            uint32_t * d = (uint32_t *)dest_buf;
-                            *d = c32;
-                            *(d + 1) = c32;
-                        }
-#else
-                        dest_buf[0] = color;
-                        dest_buf[1] = color;
-                        dest_buf[2] = color;
-                        dest_buf[3] = color;
-#endif
-                        dest_buf += 4;
-                        mask += 4;
-                    }
-                    else if(mask32) {
-                        FILL_NORMAL_MASK_PX(color)
-                        FILL_NORMAL_MASK_PX(color)
-                        FILL_NORMAL_MASK_PX(color)
-                        FILL_NORMAL_MASK_PX(color)
-                    }
-                    else {
-                        mask += 4;
-                        dest_buf += 4;
-                    }
-                }
-
-                for(; x < w ; x++) {
-                    FILL_NORMAL_MASK_PX(color)
-                }
-                dest_buf += (dest_stride - w);
-                mask += (mask_stride - w);
-            }
+            kernels->fill_mask(dest_buf, dest_stride, w, h, color, mask, mask_stride);
         }
         /*With opacity*/
         else {
@@ -409,10 +372,10 @@ static inline void set_px_argb(uint8_t * buf, lv_color_t color, lv_opa_t opa)
 static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t opa, lv_color_t (*blend_fp)(lv_color_t,
                                                                                                            lv_color_t, lv_opa_t))
 {
-    static lv_color_t last_dest_color;
-    static lv_color_t last_src_color;
-    static lv_color_t last_res_color;
-    static uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
+    static LV_ATTRIBUTE_DRAW_TLS lv_color_t last_dest_color;
+    static LV_ATTRIBUTE_DRAW_TLS lv_color_t last_src_color;
+    static LV_ATTRIBUTE_DRAW_TLS lv_color_t last_res_color;
+    static LV_ATTRIBUTE_DRAW_TLS uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
 
     lv_color_t bg_color;
 
@@ -658,20 +621,10 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
     /*Simple fill (maybe with opacity), no masking*/
     if(mask == NULL) {
         if(opa >= LV_OPA_MAX) {
-            for(y = 0; y < h; y++) {
-                lv_memcpy(dest_buf, src_buf, w * sizeof(lv_color_t));
-                dest_buf += dest_stride;
-                src_buf += src_stride;
-            }
+            kernels->copy(dest_buf, dest_stride, src_buf, src_stride, w, h);
         }
         else {
-            for(y = 0; y < h; y++) {
-                for(x = 0; x < w; x++) {
-                    dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
-                }
-                dest_buf += dest_stride;
-                src_buf += src_stride;
-            }
+            kernels->copy_opa(dest_buf, dest_stride, src_buf, src_stride, w, h, opa);
         }
     }
     /*Masked*/
@@ -738,6 +691,135 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
     }
 }
 
+/*Reference kernels, the loops `fill_normal` and `map_normal` used to inline*/
+
+static void LV_ATTRIBUTE_FAST_MEM fill_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                           lv_color_t color)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_color_fill(dest_buf, color, w);
+        dest_buf += dest_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_opa_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                               lv_color_t color, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+
+    lv_color_t last_dest_color = lv_color_black();
+    lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
+
+#if LV_COLOR_MIX_ROUND_OFS == 0 && LV_COLOR_DEPTH == 16
+    /*lv_color_mix work with an optimized algorithm with 16 bit color depth.
+     *However, it introduces some rounded error on opa.
+     *Introduce the same error here too to make lv_color_premult produces the same result */
+    opa = (uint32_t)((uint32_t)opa + 4) >> 3;
+    opa = opa << 3;
+#endif
+
+    uint16_t color_premult[3];
+    lv_color_premult(color, opa, color_premult);
+    lv_opa_t opa_inv = 255 - opa;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            if(last_dest_color.full != dest_buf[x].full) {
+                last_dest_color = dest_buf[x];
+                last_res_color = lv_color_mix_premult(color_premult, dest_buf[x], opa_inv);
+            }
+            dest_buf[x] = last_res_color;
+        }
+        dest_buf += dest_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                lv_color_t color, const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    int32_t x;
+    int32_t y;
+
+#if LV_COLOR_DEPTH == 16
+    uint32_t c32 = color.full + ((uint32_t)color.full << 16);
+#endif
+    int32_t x_end4 = w - 4;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w && ((lv_uintptr_t)(mask) & 0x3); x++) {
+            FILL_NORMAL_MASK_PX(color)
+        }
+
+        for(; x <= x_end4; x += 4) {
+            uint32_t mask32 = *((uint32_t *)mask);
+            if(mask32 == 0xFFFFFFFF) {
+#if LV_COLOR_DEPTH == 16
+                if((lv_uintptr_t)dest_buf & 0x3) {
+                    *(dest_buf + 0) = color;
+                    uint32_t * d = (uint32_t *)(dest_buf + 1);
+                    *d = c32;
+                    *(dest_buf + 3) = color;
+                }
+                else {
+                    uint32_t * d = (uint32_t *)dest_buf;
+                    *d = c32;
+                    *(d + 1) = c32;
+                }
+#else
+                dest_buf[0] = color;
+                dest_buf[1] = color;
+                dest_buf[2] = color;
+                dest_buf[3] = color;
+#endif
+                dest_buf += 4;
+                mask += 4;
+            }
+            else if(mask32) {
+                FILL_NORMAL_MASK_PX(color)
+                FILL_NORMAL_MASK_PX(color)
+                FILL_NORMAL_MASK_PX(color)
+                FILL_NORMAL_MASK_PX(color)
+            }
+            else {
+                mask += 4;
+                dest_buf += 4;
+            }
+        }
+
+        for(; x < w ; x++) {
+            FILL_NORMAL_MASK_PX(color)
+        }
+        dest_buf += (dest_stride - w);
+        mask += (mask_stride - w);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM copy_ref(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                                           lv_coord_t src_stride, int32_t w, int32_t h)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memcpy(dest_buf, src_buf, w * sizeof(lv_color_t));
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM copy_opa_ref(lv_color_t * dest_buf, lv_coord_t dest_stride,
+                                               const lv_color_t * src_buf, lv_coord_t src_stride,
+                                               int32_t w, int32_t h, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
+        }
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
 
 
 #if LV_COLOR_SCREEN_TRANSP
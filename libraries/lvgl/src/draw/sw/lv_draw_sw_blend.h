@@ -22,6 +22,11 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Values of `LV_DRAW_SW_BLEND_KERNELS`*/
+#define LV_DRAW_SW_BLEND_KERNELS_REF    0
+#define LV_DRAW_SW_BLEND_KERNELS_SWAR   1
+#define LV_DRAW_SW_BLEND_KERNELS_PIE    2   /*Reserved for ESP32-S3 PIE (SIMD) kernels, not implemented*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,6 +45,32 @@ typedef struct {
 
 struct _lv_draw_ctx_t;
 
+/**
+ * The inner loops of the normal blend mode without `set_px_cb` or screen transparency.
+ * The buffers are already clipped, `w` and `h` are the size of the blended area and
+ * the strides are in pixels. All kernels must give the same result as the reference ones.
+ */
+typedef struct {
+    /**Fill with a color*/
+    void (*fill)(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color);
+
+    /**Fill with a color and an opacity in the `LV_OPA_MIN < opa < LV_OPA_MAX` range*/
+    void (*fill_opa)(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                     lv_opa_t opa);
+
+    /**Fill with a color through a mask*/
+    void (*fill_mask)(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                      const lv_opa_t * mask, lv_coord_t mask_stride);
+
+    /**Copy an image*/
+    void (*copy)(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf, lv_coord_t src_stride,
+                 int32_t w, int32_t h);
+
+    /**Mix an image with an opacity in the `LV_OPA_MIN < opa < LV_OPA_MAX` range*/
+    void (*copy_opa)(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                     lv_coord_t src_stride, int32_t w, int32_t h, lv_opa_t opa);
+} lv_draw_sw_blend_kernels_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -59,6 +90,30 @@ void lv_draw_sw_blend(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_d
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_basic(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_sw_blend_dsc_t * dsc);
 
+/**
+ * Select the kernels used by `lv_draw_sw_blend_basic`.
+ * @param kernels       pointer to a kernel table (only the pointer is saved) or `NULL` for the reference kernels
+ */
+void lv_draw_sw_blend_set_kernels(const lv_draw_sw_blend_kernels_t * kernels);
+
+/**
+ * Get the kernels used by `lv_draw_sw_blend_basic`.
+ * @return              pointer to the active kernel table
+ */
+const lv_draw_sw_blend_kernels_t * lv_draw_sw_blend_get_kernels(void);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**The plain C loops, always available*/
+extern const lv_draw_sw_blend_kernels_t lv_draw_sw_blend_kernels_ref;
+
+#if LV_COLOR_DEPTH == 16
+/**RGB565 kernels working on several pixels per machine word*/
+extern const lv_draw_sw_blend_kernels_t lv_draw_sw_blend_kernels_swar;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,418 @@
+/**
+ * @file lv_draw_sw_blend_swar.c
+ *
+ * RGB565 blend kernels handling 2 (32 bit word) or 4 (64 bit word) pixels at once.
+ * They give the same result as the reference kernels in lv_draw_sw_blend.c bit by bit.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+
+#if LV_COLOR_DEPTH == 16
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Use 64 bit words (4 pixels) on 64 bit CPUs and 32 bit words (2 pixels) on the others*/
+#ifndef LV_DRAW_SW_BLEND_SWAR_64
+    #if UINTPTR_MAX > 0xFFFFFFFFUL
+        #define LV_DRAW_SW_BLEND_SWAR_64 1
+    #else
+        #define LV_DRAW_SW_BLEND_SWAR_64 0
+    #endif
+#endif
+
+#if LV_DRAW_SW_BLEND_SWAR_64
+    #define SWAR_PX         4
+    #define SWAR_REP(c)     ((uint64_t)(uint16_t)(c) * 0x0001000100010001ULL)
+    #define SWAR_REP2(c)    ((uint64_t)(uint32_t)(c) * 0x0000000100000001ULL)
+#else
+    #define SWAR_PX         2
+    #define SWAR_REP(c)     ((uint32_t)(uint16_t)(c) * 0x00010001UL)
+    #define SWAR_REP2(c)    ((uint32_t)(c))
+#endif
+#define SWAR_ALIGN          (sizeof(swar_t) - 1)
+
+/*RGB565 spread to 32 bit with the green moved up: 00000GGGGGG00000RRRRR000000BBBBB.
+ *Every channel has room for a 5 bit multiplier above it.*/
+#define SPREAD_MASK         0x07E0F81FUL
+
+/*Two pixels split into two words of three channels each, again with 5 free bits above
+ *every channel: B0, R0 and G1 in place, G0, B1 and R1 after a shift right by 5*/
+#define MIX_MASK_A          SWAR_REP2(0x07E0F81FUL)
+#define MIX_MASK_B          SWAR_REP2(0x07C0F83FUL)
+
+/*Clear the lowest bit of every channel before halving so nothing crosses into the next one*/
+#define HALF_MASK           0xF7DE
+
+/*Building the channel tables of `fill_opa_swar` costs more than it saves on small areas*/
+#define FILL_OPA_MIN_PX     64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_BLEND_SWAR_64
+typedef uint64_t swar_t;
+#else
+typedef uint32_t swar_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void fill_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color);
+static void fill_opa_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                          lv_opa_t opa);
+static void fill_mask_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                           const lv_opa_t * mask, lv_coord_t mask_stride);
+static void copy_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                      lv_coord_t src_stride, int32_t w, int32_t h);
+static void copy_opa_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                          lv_coord_t src_stride, int32_t w, int32_t h, lv_opa_t opa);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_sw_blend_kernels_t lv_draw_sw_blend_kernels_swar = {
+    .fill = fill_swar,
+    .fill_opa = fill_opa_swar,
+    .fill_mask = fill_mask_swar,
+    .copy = copy_swar,
+    .copy_opa = copy_opa_swar,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*Convert between the buffer's byte order and plain RGB565*/
+#if LV_COLOR_16_SWAP
+    #define PX_NATIVE(c)    ((uint16_t)((uint16_t)(c) << 8 | (uint16_t)(c) >> 8))
+    #define WORD_NATIVE(w)  ((((w) >> 8) & SWAR_REP(0x00FF)) | (((w) << 8) & SWAR_REP(0xFF00)))
+#else
+    #define PX_NATIVE(c)    ((uint16_t)(c))
+    #define WORD_NATIVE(w)  (w)
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * The same as `lv_color_mix` on native RGB565 with the foreground already spread.
+ * @param fg        foreground spread with `SPREAD_MASK`
+ * @param bg        native background pixel
+ * @param mix       0..32 weight of the foreground
+ * @return          native result
+ */
+static inline uint16_t mix_px(uint32_t fg, uint16_t bg, uint32_t mix)
+{
+    uint32_t bg_s = ((uint32_t)bg | ((uint32_t)bg << 16)) & SPREAD_MASK;
+    uint32_t res = ((((fg - bg_s) * mix) >> 5) + bg_s) & SPREAD_MASK;
+    return (uint16_t)((res >> 16) | res);
+}
+
+/**
+ * Mix a word of native pixels with another one, `SWAR_PX` pixels at once.
+ * Sums instead of differences: no channel goes negative and borrows into its neighbour.
+ * @param fg        native foreground pixels
+ * @param bg        native background pixels
+ * @param mix       0..32 weight of the foreground
+ * @return          native results
+ */
+static inline swar_t mix_word(swar_t fg, swar_t bg, uint32_t mix)
+{
+    swar_t fg_a = fg & MIX_MASK_A;
+    swar_t bg_a = bg & MIX_MASK_A;
+    swar_t fg_b = (fg >> 5) & MIX_MASK_B;
+    swar_t bg_b = (bg >> 5) & MIX_MASK_B;
+    swar_t res_a = ((fg_a * mix + bg_a * (32 - mix)) >> 5) & MIX_MASK_A;
+    swar_t res_b = ((fg_b * mix + bg_b * (32 - mix)) >> 5) & MIX_MASK_B;
+    return res_a | (res_b << 5);
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                            lv_color_t color)
+{
+    swar_t cw = SWAR_REP(color.full);
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        uint16_t * d = (uint16_t *)dest_buf;
+        int32_t x = 0;
+        for(; x < w && ((lv_uintptr_t)d & SWAR_ALIGN); x++) *d++ = color.full;
+
+        swar_t * dw = (swar_t *)d;
+        for(; x <= w - 4 * SWAR_PX; x += 4 * SWAR_PX) {
+            dw[0] = cw;
+            dw[1] = cw;
+            dw[2] = cw;
+            dw[3] = cw;
+            dw += 4;
+        }
+        for(; x <= w - SWAR_PX; x += SWAR_PX) *dw++ = cw;
+
+        d = (uint16_t *)dw;
+        for(; x < w; x++) *d++ = color.full;
+
+        dest_buf += dest_stride;
+    }
+}
+
+/*The reference loop remembers the last destination and result, starting from black and
+ *`lv_color_mix(color, black, opa)`. That seed can differ from the premultiplied result for
+ *black, so black pixels get it until the first other color shows up.
+ *Every other pixel is `lv_color_mix_premult` of its channels, looked up from three tables.
+ *Whole words equal to the previous one reuse its result, which covers plain backgrounds.*/
+static void LV_ATTRIBUTE_FAST_MEM fill_opa_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                lv_color_t color, lv_opa_t opa)
+{
+    if(w * h < FILL_OPA_MIN_PX) {
+        lv_draw_sw_blend_kernels_ref.fill_opa(dest_buf, dest_stride, w, h, color, opa);
+        return;
+    }
+
+    uint16_t seed = lv_color_mix(color, lv_color_black(), opa).full;
+
+#if LV_COLOR_MIX_ROUND_OFS == 0
+    /*The same rounding as in the reference kernel*/
+    opa = (uint32_t)((uint32_t)opa + 4) >> 3;
+    opa = opa << 3;
+#endif
+    uint16_t color_premult[3];
+    lv_color_premult(color, opa, color_premult);
+    lv_opa_t opa_inv = 255 - opa;
+
+    uint16_t lut_r[32];
+    uint16_t lut_g[64];
+    uint16_t lut_b[32];
+    uint32_t i;
+    for(i = 0; i < 32; i++) {
+        lut_r[i] = LV_UDIV255(color_premult[0] + i * opa_inv + LV_COLOR_MIX_ROUND_OFS) << 11;
+        lut_b[i] = LV_UDIV255(color_premult[2] + i * opa_inv + LV_COLOR_MIX_ROUND_OFS);
+    }
+    for(i = 0; i < 64; i++) {
+        lut_g[i] = LV_UDIV255(color_premult[1] + i * opa_inv + LV_COLOR_MIX_ROUND_OFS) << 5;
+    }
+
+    uint16_t black_res = PX_NATIVE(lut_r[0] | lut_g[0] | lut_b[0]);
+    bool seeded = true;
+
+    uint16_t last_px = 0;
+    uint16_t last_px_res = seed;
+    swar_t last_word = 0;
+    swar_t last_word_res = SWAR_REP(seed);
+
+#define FILL_OPA_PX(px_in, px_out)                                                              \
+    do {                                                                                        \
+        uint16_t _c = (px_in);                                                                  \
+        if(_c != last_px) {                                                                     \
+            uint16_t _n = PX_NATIVE(_c);                                                        \
+            last_px = _c;                                                                       \
+            last_px_res = PX_NATIVE(lut_r[_n >> 11] | lut_g[(_n >> 5) & 0x3F] | lut_b[_n & 0x1F]); \
+            if(seeded) {                                                                        \
+                seeded = false;                                                                 \
+                last_word = 0;                                                                  \
+                last_word_res = SWAR_REP(black_res);                                            \
+            }                                                                                   \
+        }                                                                                       \
+        (px_out) = last_px_res;                                                                 \
+    } while(0)
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = (uint16_t *)dest_buf;
+        int32_t x = 0;
+        for(; x < w && ((lv_uintptr_t)d & SWAR_ALIGN); x++, d++) FILL_OPA_PX(*d, *d);
+
+        swar_t * dw = (swar_t *)d;
+        for(; x <= w - SWAR_PX; x += SWAR_PX, dw++) {
+            swar_t in = *dw;
+            if(in == last_word) {
+                *dw = last_word_res;
+                continue;
+            }
+
+            bool was_seeded = seeded;
+            uint16_t * p = (uint16_t *)dw;
+            FILL_OPA_PX(p[0], p[0]);
+            FILL_OPA_PX(p[1], p[1]);
+#if SWAR_PX == 4
+            FILL_OPA_PX(p[2], p[2]);
+            FILL_OPA_PX(p[3], p[3]);
+#endif
+            /*A word mixing the seed and real results can't be reused.
+             *memcpy as the pixels were just written as uint16_t (strict aliasing)*/
+            if(was_seeded == seeded) {
+                last_word = in;
+                lv_memcpy(&last_word_res, p, sizeof(swar_t));
+            }
+        }
+
+        d = (uint16_t *)dw;
+        for(; x < w; x++, d++) FILL_OPA_PX(*d, *d);
+
+        dest_buf += dest_stride;
+    }
+#undef FILL_OPA_PX
+}
+
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                 lv_color_t color, const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    uint32_t c32 = (uint32_t)color.full * 0x10001UL;
+    uint16_t fg_n = PX_NATIVE(color.full);
+    uint32_t fg_s = ((uint32_t)fg_n | ((uint32_t)fg_n << 16)) & SPREAD_MASK;
+
+#define FILL_MASK_PX(i)                                                                     \
+    if(m[i] == LV_OPA_COVER) d[i] = color.full;                                             \
+    else if(m[i]) d[i] = PX_NATIVE(mix_px(fg_s, PX_NATIVE(d[i]), ((uint32_t)m[i] + 4) >> 3));
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = (uint16_t *)dest_buf;
+        const lv_opa_t * m = mask;
+        int32_t x = 0;
+
+        /*Read the mask 4 bytes at a time from aligned addresses, the ESP32 faults on the others*/
+        for(; x < w && ((lv_uintptr_t)m & 0x3); x++, d++, m++) {
+            FILL_MASK_PX(0)
+        }
+
+        for(; x <= w - 4; x += 4, d += 4, m += 4) {
+            uint32_t m32 = *(const uint32_t *)m;
+            if(m32 == 0) continue;
+            if(m32 == 0xFFFFFFFF) {
+#if LV_DRAW_SW_BLEND_SWAR_64
+                if(((lv_uintptr_t)d & 0x7) == 0) {
+                    *(uint64_t *)d = SWAR_REP(color.full);
+                    continue;
+                }
+#endif
+                if((lv_uintptr_t)d & 0x3) {
+                    d[0] = color.full;
+                    *(uint32_t *)(d + 1) = c32;
+                    d[3] = color.full;
+                }
+                else {
+                    *(uint32_t *)d = c32;
+                    *(uint32_t *)(d + 2) = c32;
+                }
+            }
+            else {
+                FILL_MASK_PX(0)
+                FILL_MASK_PX(1)
+                FILL_MASK_PX(2)
+                FILL_MASK_PX(3)
+            }
+        }
+
+        for(; x < w; x++, d++, m++) {
+            FILL_MASK_PX(0)
+        }
+
+        dest_buf += dest_stride;
+        mask += mask_stride;
+    }
+#undef FILL_MASK_PX
+}
+
+static void LV_ATTRIBUTE_FAST_MEM copy_swar(lv_color_t * dest_buf, lv_coord_t dest_stride, const lv_color_t * src_buf,
+                                            lv_coord_t src_stride, int32_t w, int32_t h)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = (uint16_t *)dest_buf;
+        const uint16_t * s = (const uint16_t *)src_buf;
+
+        /*Words only if both buffers can reach an aligned address together*/
+        if((((lv_uintptr_t)d ^ (lv_uintptr_t)s) & SWAR_ALIGN) == 0) {
+            int32_t x = 0;
+            for(; x < w && ((lv_uintptr_t)d & SWAR_ALIGN); x++) *d++ = *s++;
+
+            swar_t * dw = (swar_t *)d;
+            const swar_t * sw = (const swar_t *)s;
+            for(; x <= w - 4 * SWAR_PX; x += 4 * SWAR_PX) {
+                dw[0] = sw[0];
+                dw[1] = sw[1];
+                dw[2] = sw[2];
+                dw[3] = sw[3];
+                dw += 4;
+                sw += 4;
+            }
+            for(; x <= w - SWAR_PX; x += SWAR_PX) *dw++ = *sw++;
+
+            d = (uint16_t *)dw;
+            s = (const uint16_t *)sw;
+            for(; x < w; x++) *d++ = *s++;
+        }
+        else {
+            lv_memcpy(d, s, w * sizeof(lv_color_t));
+        }
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+/*`lv_color_mix` uses 5 bit weights, (opa + 4) >> 3. 16 is a plain average which needs no
+ *multiply at all, the others go through `mix_word`.*/
+static void LV_ATTRIBUTE_FAST_MEM copy_opa_swar(lv_color_t * dest_buf, lv_coord_t dest_stride,
+                                                const lv_color_t * src_buf, lv_coord_t src_stride,
+                                                int32_t w, int32_t h, lv_opa_t opa)
+{
+    uint32_t mix = ((uint32_t)opa + 4) >> 3;
+    if(mix == 0) return;
+
+#define COPY_OPA_PX()                                                                       \
+    do {                                                                                    \
+        uint16_t _fg = PX_NATIVE(*s);                                                       \
+        uint32_t _fg_s = ((uint32_t)_fg | ((uint32_t)_fg << 16)) & SPREAD_MASK;            \
+        *d = PX_NATIVE(mix_px(_fg_s, PX_NATIVE(*d), mix));                                  \
+    } while(0)
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = (uint16_t *)dest_buf;
+        const uint16_t * s = (const uint16_t *)src_buf;
+        int32_t x = 0;
+
+        /*Words only if both buffers can reach an aligned address together*/
+        if((((lv_uintptr_t)d ^ (lv_uintptr_t)s) & SWAR_ALIGN) == 0) {
+            for(; x < w && ((lv_uintptr_t)d & SWAR_ALIGN); x++, d++, s++) COPY_OPA_PX();
+
+            swar_t * dw = (swar_t *)d;
+            const swar_t * sw = (const swar_t *)s;
+            if(mix == 16) {
+                for(; x <= w - SWAR_PX; x += SWAR_PX, dw++, sw++) {
+                    swar_t a = WORD_NATIVE(*sw);
+                    swar_t b = WORD_NATIVE(*dw);
+                    swar_t res = (a & b) + (((a ^ b) & SWAR_REP(HALF_MASK)) >> 1);
+                    *dw = WORD_NATIVE(res);
+                }
+            }
+            else {
+                for(; x <= w - SWAR_PX; x += SWAR_PX, dw++, sw++) {
+                    swar_t res = mix_word(WORD_NATIVE(*sw), WORD_NATIVE(*dw), mix);
+                    *dw = WORD_NATIVE(res);
+                }
+            }
+            d = (uint16_t *)dw;
+            s = (const uint16_t *)sw;
+        }
+
+        for(; x < w; x++, d++, s++) COPY_OPA_PX();
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+#undef COPY_OPA_PX
+}
+
+#endif /*LV_COLOR_DEPTH == 16*/
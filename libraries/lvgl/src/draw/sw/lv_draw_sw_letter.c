@@ -14,6 +14,10 @@
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_txt.h"
+#if LV_GLYPH_CACHE_SIZE
+    #include LV_GLYPH_CACHE_INCLUDE
+#endif
 
 /*********************
  *      DEFINES
@@ -23,6 +27,18 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_GLYPH_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;     /*The font having the glyph, i.e. `resolved_font` of the glyph dsc.*/
+    uint32_t letter;
+    lv_opa_t * opa_map;         /*`box_w * box_h` opacity values row by row. NULL if the entry is free*/
+    uint32_t last_use;          /*`glyph_cache_time` when the glyph was drawn the last time*/
+    uint16_t box_w;
+    uint16_t box_h;
+    uint8_t pinned;             /*Never dropped for an other glyph*/
+} glyph_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -30,6 +46,15 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                            const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 
+#if LV_GLYPH_CACHE_SIZE
+static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                           const lv_point_t * pos, lv_font_glyph_dsc_t * g, const lv_opa_t * opa_map);
+static bool glyph_cacheable(const lv_font_glyph_dsc_t * g);
+static glyph_cache_entry_t * glyph_cache_find(const lv_font_t * font, uint32_t letter);
+static glyph_cache_entry_t * glyph_cache_add(const lv_font_glyph_dsc_t * g, uint32_t letter, const uint8_t * map_p);
+static void glyph_cache_touch(glyph_cache_entry_t * entry);
+#endif
+
 
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
@@ -39,6 +64,13 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_GLYPH_CACHE_SIZE
+static glyph_cache_entry_t glyph_cache[LV_GLYPH_CACHE_SIZE];
+static uint32_t glyph_cache_time;
+static uint32_t glyph_cache_hit;
+static uint32_t glyph_cache_miss;
+static uint32_t glyph_cache_evict;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -140,6 +172,23 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
         return;
     }
 
+#if LV_GLYPH_CACHE_SIZE
+    /*A cached glyph doesn't need its bitmap at all*/
+    bool cacheable = dsc->opa >= LV_OPA_MAX && glyph_cacheable(&g);
+    if(cacheable) {
+        /*No glyph is dropped while stripes are drawn so the entry stays valid without the lock*/
+        LV_REFR_STRIPES_LOCK(LV_REFR_STRIPES_LOCK_CACHE);
+        glyph_cache_entry_t * entry = glyph_cache_find(g.resolved_font, letter);
+        if(entry) glyph_cache_hit++;
+        else glyph_cache_miss++;
+        LV_REFR_STRIPES_UNLOCK(LV_REFR_STRIPES_LOCK_CACHE);
+        if(entry) {
+            draw_letter_cached(draw_ctx, dsc, &gpos, &g, entry->opa_map);
+            return;
+        }
+    }
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -154,10 +203,109 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
 #endif
     }
     else {
+#if LV_GLYPH_CACHE_SIZE
+        if(cacheable) {
+            LV_REFR_STRIPES_LOCK(LV_REFR_STRIPES_LOCK_CACHE);
+            glyph_cache_entry_t * entry = glyph_cache_add(&g, letter, map_p);
+            LV_REFR_STRIPES_UNLOCK(LV_REFR_STRIPES_LOCK_CACHE);
+            if(entry) {
+                draw_letter_cached(draw_ctx, dsc, &gpos, &g, entry->opa_map);
+                return;
+            }
+        }
+#endif
         draw_letter_normal(draw_ctx, dsc, &gpos, &g, map_p);
     }
 }
 
+/**
+ * Decode the glyphs of some letters into the glyph cache and keep them there
+ * until `lv_draw_sw_glyph_cache_clear()`.
+ * @param font      font of the letters, the glyphs missing from it are taken from its fallback
+ * @param txt       UTF-8 text with the letters to pin
+ * @return          number of letters whose glyph is pinned now
+ */
+uint32_t lv_draw_sw_glyph_cache_pin(const lv_font_t * font, const char * txt)
+{
+#if LV_GLYPH_CACHE_SIZE
+    uint32_t pinned = 0;
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(txt, &i);
+        lv_font_glyph_dsc_t g;
+        if(!lv_font_get_glyph_dsc(font, &g, letter, '\0')) continue;
+        if(g.box_w == 0 || g.box_h == 0 || !glyph_cacheable(&g)) continue;
+
+        glyph_cache_entry_t * entry = glyph_cache_find(g.resolved_font, letter);
+        if(entry == NULL) {
+            const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+            if(map_p) entry = glyph_cache_add(&g, letter, map_p);
+        }
+        if(entry) {
+            entry->pinned = 1;
+            pinned++;
+        }
+    }
+    return pinned;
+#else
+    LV_UNUSED(font);
+    LV_UNUSED(txt);
+    return 0;
+#endif
+}
+
+/**
+ * Drop glyphs from the glyph cache, the pinned ones too.
+ * @param font      drop the glyphs of this font only, NULL to drop every glyph
+ */
+void lv_draw_sw_glyph_cache_clear(const lv_font_t * font)
+{
+#if LV_GLYPH_CACHE_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+        glyph_cache_entry_t * entry = &glyph_cache[i];
+        if(entry->opa_map == NULL || (font && entry->font != font)) continue;
+        LV_GLYPH_CACHE_FREE(entry->opa_map);
+        lv_memset_00(entry, sizeof(glyph_cache_entry_t));
+    }
+#else
+    LV_UNUSED(font);
+#endif
+}
+
+/**
+ * Get the statistics of the glyph cache.
+ * @param stats     store the counters and the current size of the cache here
+ */
+void lv_draw_sw_get_glyph_cache_stats(lv_draw_sw_glyph_cache_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_draw_sw_glyph_cache_stats_t));
+#if LV_GLYPH_CACHE_SIZE
+    uint32_t i;
+    stats->hit = glyph_cache_hit;
+    stats->miss = glyph_cache_miss;
+    stats->evict = glyph_cache_evict;
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+        if(glyph_cache[i].opa_map == NULL) continue;
+        stats->bytes += (uint32_t)glyph_cache[i].box_w * glyph_cache[i].box_h;
+        stats->entries++;
+        if(glyph_cache[i].pinned) stats->pinned++;
+    }
+#endif
+}
+
+/**
+ * Zero the hit, miss and evict counters of the glyph cache.
+ */
+void lv_draw_sw_reset_glyph_cache_stats(void)
+{
+#if LV_GLYPH_CACHE_SIZE
+    glyph_cache_hit = 0;
+    glyph_cache_miss = 0;
+    glyph_cache_evict = 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -218,9 +366,9 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
             return; /*Invalid bpp. Can't render the letter*/
     }
 
-    static lv_opa_t opa_table[256];
-    static lv_opa_t prev_opa = LV_OPA_TRANSP;
-    static uint32_t prev_bpp = 0;
+    static LV_ATTRIBUTE_DRAW_TLS lv_opa_t opa_table[256];
+    static LV_ATTRIBUTE_DRAW_TLS lv_opa_t prev_opa = LV_OPA_TRANSP;
+    static LV_ATTRIBUTE_DRAW_TLS uint32_t prev_bpp = 0;
     if(opa < LV_OPA_MAX) {
         if(prev_opa != opa || prev_bpp != bpp) {
             uint32_t i;
@@ -351,6 +499,203 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     lv_mem_buf_release(mask_buf);
 }
 
+#if LV_GLYPH_CACHE_SIZE
+/**
+ * Blend a letter from the opacity map of its cached glyph.
+ * The map is the mask of the blend directly, unless masks or disabled anti-aliasing would change it.
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos, lv_font_glyph_dsc_t * g, const lv_opa_t * opa_map)
+{
+    int32_t box_w = g->box_w;
+    int32_t box_h = g->box_h;
+
+    /*Calculate the col/row start/end on the map*/
+    int32_t col_start = pos->x >= draw_ctx->clip_area->x1 ? 0 : draw_ctx->clip_area->x1 - pos->x;
+    int32_t col_end   = pos->x + box_w <= draw_ctx->clip_area->x2 ? box_w : draw_ctx->clip_area->x2 - pos->x + 1;
+    int32_t row_start = pos->y >= draw_ctx->clip_area->y1 ? 0 : draw_ctx->clip_area->y1 - pos->y;
+    int32_t row_end   = pos->y + box_h <= draw_ctx->clip_area->y2 ? box_h : draw_ctx->clip_area->y2 - pos->y + 1;
+
+    lv_area_t fill_area;
+    fill_area.x1 = col_start + pos->x;
+    fill_area.x2 = col_end + pos->x - 1;
+    fill_area.y1 = row_start + pos->y;
+    fill_area.y2 = row_end + pos->y - 1;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    bool copy = lv_disp_get_antialiasing(_lv_refr_get_disp_refreshing()) == false;
+#if LV_DRAW_COMPLEX
+    if(lv_draw_mask_is_any(&fill_area)) copy = true;
+#endif
+
+    if(copy) {
+        /*Work on a copy of the rows to keep the cached map intact*/
+        lv_coord_t fill_w = lv_area_get_width(&fill_area);
+        lv_opa_t * mask_buf = lv_mem_buf_get(fill_w);
+        lv_area_t row_area;
+        row_area.x1 = fill_area.x1;
+        row_area.x2 = fill_area.x2;
+        blend_dsc.mask_buf = mask_buf;
+        blend_dsc.blend_area = &row_area;
+        blend_dsc.mask_area = &row_area;
+
+        int32_t row;
+        for(row = row_start; row < row_end; row++) {
+            row_area.y1 = row + pos->y;
+            row_area.y2 = row_area.y1;
+            lv_memcpy(mask_buf, opa_map + row * box_w + col_start, fill_w);
+#if LV_DRAW_COMPLEX
+            if(lv_draw_mask_apply(mask_buf, row_area.x1, row_area.y1, fill_w) == LV_DRAW_MASK_RES_TRANSP) continue;
+#endif
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        }
+        lv_mem_buf_release(mask_buf);
+        return;
+    }
+
+    /*The whole glyph is the mask, the blend reads only the clipped part of it*/
+    lv_area_t map_area;
+    map_area.x1 = pos->x;
+    map_area.y1 = pos->y;
+    map_area.x2 = pos->x + box_w - 1;
+    map_area.y2 = pos->y + box_h - 1;
+    blend_dsc.mask_buf = (lv_opa_t *)opa_map;
+    blend_dsc.mask_area = &map_area;
+    blend_dsc.blend_area = &fill_area;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+}
+
+static bool glyph_cacheable(const lv_font_glyph_dsc_t * g)
+{
+    if(g->is_placeholder || g->resolved_font->subpx) return false;
+
+    switch(g->bpp) {
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 8:
+            break;
+        default:
+            return false;   /*Image font or invalid*/
+    }
+
+    return LV_GLYPH_CACHE_BUDGET == 0 || (uint32_t)g->box_w * g->box_h <= LV_GLYPH_CACHE_BUDGET;
+}
+
+static glyph_cache_entry_t * glyph_cache_find(const lv_font_t * font, uint32_t letter)
+{
+    uint32_t i;
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+        glyph_cache_entry_t * entry = &glyph_cache[i];
+        if(entry->letter == letter && entry->font == font && entry->opa_map) {
+            glyph_cache_touch(entry);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void glyph_cache_touch(glyph_cache_entry_t * entry)
+{
+    glyph_cache_time++;
+    if(glyph_cache_time == 0) {
+        /*Wrapped around, forget the order of use rather than keeping a wrong one*/
+        uint32_t i;
+        for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) glyph_cache[i].last_use = 0;
+        glyph_cache_time = 1;
+    }
+    entry->last_use = glyph_cache_time;
+}
+
+/**
+ * Decode a glyph into a cache entry. The least recently drawn glyphs which are not pinned
+ * are dropped until a free entry is found and the glyph fits into `LV_GLYPH_CACHE_BUDGET`.
+ * @return the new entry or NULL if the glyph can't be cached
+ */
+static glyph_cache_entry_t * glyph_cache_add(const lv_font_glyph_dsc_t * g, uint32_t letter, const uint8_t * map_p)
+{
+    uint32_t size = (uint32_t)g->box_w * g->box_h;
+    uint32_t bytes = 0;
+    glyph_cache_entry_t * entry = NULL;
+    uint32_t i;
+
+#if LV_USE_REFR_STRIPES
+    /*An other stripe might have added it since the miss*/
+    entry = glyph_cache_find(g->resolved_font, letter);
+    if(entry) return entry;
+#endif
+
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+        if(glyph_cache[i].opa_map) bytes += (uint32_t)glyph_cache[i].box_w * glyph_cache[i].box_h;
+        else if(entry == NULL) entry = &glyph_cache[i];
+    }
+
+    while(entry == NULL || (LV_GLYPH_CACHE_BUDGET && bytes + size > LV_GLYPH_CACHE_BUDGET)) {
+        /*The other stripes might draw any of the cached glyphs right now*/
+        if(LV_REFR_STRIPES_RUNNING()) return NULL;
+
+        glyph_cache_entry_t * victim = NULL;
+        for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+            glyph_cache_entry_t * e = &glyph_cache[i];
+            if(e->opa_map == NULL || e->pinned) continue;
+            if(victim == NULL || e->last_use < victim->last_use) victim = e;
+        }
+        if(victim == NULL) return NULL;
+
+        bytes -= (uint32_t)victim->box_w * victim->box_h;
+        LV_GLYPH_CACHE_FREE(victim->opa_map);
+        lv_memset_00(victim, sizeof(glyph_cache_entry_t));
+        glyph_cache_evict++;
+        if(entry == NULL) entry = victim;
+    }
+
+    lv_opa_t * opa_map = LV_GLYPH_CACHE_ALLOC(size);
+    if(opa_map == NULL) return NULL;
+
+    /*Decode the glyph the same way as `draw_letter_normal()` does. The rows of the bitmap aren't padded.*/
+    uint32_t bpp = g->bpp == 3 ? 4 : g->bpp;
+    const uint8_t * bpp_opa_table_p;
+    switch(bpp) {
+        case 1:
+            bpp_opa_table_p = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            bpp_opa_table_p = _lv_bpp2_opa_table;
+            break;
+        case 4:
+            bpp_opa_table_p = _lv_bpp4_opa_table;
+            break;
+        default:
+            bpp_opa_table_p = _lv_bpp8_opa_table;
+            break;
+    }
+
+    uint32_t px_mask = (1 << bpp) - 1;
+    uint32_t bit = 0;
+    for(i = 0; i < size; i++) {
+        uint32_t letter_px = (map_p[bit >> 3] >> (8 - bpp - (bit & 0x7))) & px_mask;
+        opa_map[i] = bpp_opa_table_p[letter_px];
+        bit += bpp;
+    }
+
+    entry->font = g->resolved_font;
+    entry->letter = letter;
+    entry->opa_map = opa_map;
+    entry->box_w = g->box_w;
+    entry->box_h = g->box_h;
+    entry->pinned = 0;
+    glyph_cache_touch(entry);
+    return entry;
+}
+#endif /*LV_GLYPH_CACHE_SIZE*/
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p)
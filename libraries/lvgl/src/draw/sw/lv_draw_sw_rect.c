@@ -53,9 +53,9 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
  *  STATIC VARIABLES
  **********************/
 #if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
-    static uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
-    static int32_t sh_cache_size = -1;
-    static int32_t sh_cache_r = -1;
+    static LV_ATTRIBUTE_DRAW_TLS uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
+    static LV_ATTRIBUTE_DRAW_TLS int32_t sh_cache_size = -1;
+    static LV_ATTRIBUTE_DRAW_TLS int32_t sh_cache_r = -1;
 #endif
 
 /**********************
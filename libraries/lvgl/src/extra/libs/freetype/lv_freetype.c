@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_freetype.h"
+#include "../../../draw/sw/lv_draw_sw.h"
 #if LV_USE_FREETYPE
 
 #include "ft2build.h"
@@ -169,6 +170,7 @@ bool lv_ft_font_init(lv_ft_info_t * info)
 
 void lv_ft_font_destroy(lv_font_t * font)
 {
+    lv_draw_sw_glyph_cache_clear(font);
 #if LV_FREETYPE_CACHE_SIZE >= 0
     lv_ft_font_destroy_cache(font);
 #else
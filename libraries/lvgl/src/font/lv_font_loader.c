@@ -13,6 +13,7 @@
 #include "../lvgl.h"
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
+#include "../draw/sw/lv_draw_sw.h"
 
 /**********************
  *      TYPEDEFS
@@ -117,6 +118,8 @@ lv_font_t * lv_font_load(const char * font_name)
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_draw_sw_glyph_cache_clear(font);
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
@@ -73,6 +73,16 @@ typedef enum {
     LV_INDEV_STATE_PRESSED
 } lv_indev_state_t;
 
+#if LV_USE_INDEV_HW_GESTURE
+/** Where the gestures of a pointer input device come from*/
+enum {
+    LV_INDEV_GESTURE_SW = 0,    /**< LVGL detects them from the points*/
+    LV_INDEV_GESTURE_HW,        /**< Only those the driver reports*/
+    LV_INDEV_GESTURE_HW_SW,     /**< Those the driver reports, and LVGL's as soon as found if the driver reported none yet*/
+};
+typedef uint8_t lv_indev_gesture_src_t;
+#endif
+
 /** Data structure passed to an input driver to fill*/
 typedef struct {
     lv_point_t point; /**< For LV_INDEV_TYPE_POINTER the currently pressed point*/
@@ -82,6 +92,10 @@ typedef struct {
 
     lv_indev_state_t state; /**< LV_INDEV_STATE_REL or LV_INDEV_STATE_PR*/
     bool continue_reading;  /**< If set to true, the read callback is invoked again*/
+#if LV_USE_INDEV_HW_GESTURE
+    lv_dir_t gesture_dir;   /**< For LV_INDEV_TYPE_POINTER a swipe the controller recognized, else LV_DIR_NONE*/
+    bool long_pressed;      /**< For LV_INDEV_TYPE_POINTER the controller recognized a long press*/
+#endif
 } lv_indev_data_t;
 
 /** Initialized by the user and registered by 'lv_indev_add()'*/
@@ -119,6 +133,11 @@ typedef struct _lv_indev_drv_t {
     /**< At least this difference should be to send a gesture*/
     uint8_t gesture_limit;
 
+#if LV_USE_INDEV_HW_GESTURE
+    /**< Gestures reported by the driver, detected by LVGL or both, `LV_INDEV_GESTURE_...`*/
+    lv_indev_gesture_src_t gesture_src;
+#endif
+
     /**< Long press time in milliseconds*/
     uint16_t long_press_time;
 
@@ -159,6 +178,10 @@ typedef struct _lv_indev_proc_t {
             lv_dir_t scroll_dir : 4;
             lv_dir_t gesture_dir : 4;
             uint8_t gesture_sent : 1;
+#if LV_USE_INDEV_HW_GESTURE
+            lv_dir_t gesture_hw_dir : 4; /*Reported by the driver, not sent yet*/
+            uint8_t long_pr_hw : 1;      /*The driver reported a long press*/
+#endif
         } pointer;
         struct {
             /*Keypad data*/
@@ -27,7 +27,7 @@
 #define LV_COLOR_DEPTH 16
 
 /*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 0
+#define LV_COLOR_16_SWAP 1
 
 /*Enable features to draw on transparent background.
  *It's required if opa, and transform_* style properties are used.
@@ -46,7 +46,7 @@
  *=========================*/
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
-#define LV_MEM_CUSTOM 0
+#define LV_MEM_CUSTOM 1
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
@@ -60,12 +60,38 @@
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    #define LV_MEM_CUSTOM_INCLUDE "lv_mem_tier.h"   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lv_mem_tier_alloc
+    #define LV_MEM_CUSTOM_FREE    lv_mem_tier_free
+    #define LV_MEM_CUSTOM_REALLOC lv_mem_tier_realloc
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Tiered heap for LV_MEM_CUSTOM (misc/lv_mem_tier.c): two TLSF pools instead of one.
+ *Blocks up to LV_MEM_TIER_FAST_MAX bytes (objects, styles, short texts, line buffers of the draw) go to
+ *the fast pool, a static array in internal RAM. Larger ones (image caches, layers, long texts) go to
+ *the slow pool from LV_MEM_TIER_SLOW_ALLOC, PSRAM on the ESP32-S3. A full pool spills to the other one.
+ *`lv_mem_monitor()` sums both pools, `lv_mem_tier_get_stats()` gives them one by one.*/
+#define LV_USE_MEM_TIER 1
+#if LV_USE_MEM_TIER
+    /*Size of the fast pool in bytes (>= 2kB)*/
+    #define LV_MEM_TIER_FAST_SIZE (32U * 1024U)
+
+    /*Largest block in bytes that goes to the fast pool first*/
+    #define LV_MEM_TIER_FAST_MAX 1024
+
+    /*Size of the slow pool in bytes, 0: no slow pool*/
+    #define LV_MEM_TIER_SLOW_SIZE (256U * 1024U)
+
+    /*Allocator of the slow pool, called once. Without PSRAM there is no slow pool*/
+    #ifdef ESP_PLATFORM
+        #define LV_MEM_TIER_SLOW_INCLUDE "esp_heap_caps.h"
+        #define LV_MEM_TIER_SLOW_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_SPIRAM)
+    #else
+        #define LV_MEM_TIER_SLOW_INCLUDE <stdlib.h>
+        #define LV_MEM_TIER_SLOW_ALLOC   malloc
+    #endif
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
@@ -83,9 +109,14 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Let pointer input drivers report the swipes and long presses their touch controller recognized
+ *(`gesture_dir` and `long_pressed` of `lv_indev_data_t`). `gesture_src` of the driver selects
+ *those, LVGL's own detection or both*/
+#define LV_USE_INDEV_HW_GESTURE 1
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
-#define LV_TICK_CUSTOM 0
+#define LV_TICK_CUSTOM 1
 #if LV_TICK_CUSTOM
     #define LV_TICK_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
     #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
@@ -120,7 +151,24 @@
     * The circumference of 1/4 circle are saved for anti-aliasing
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
-    #define LV_CIRCLE_CACHE_SIZE 4
+    #define LV_CIRCLE_CACHE_SIZE 16
+
+    /* Upper limit of the memory used by the cached circles in bytes, radius * 6 + 6 bytes per circle.
+    * The least used circles are dropped to make room for a new one.
+    * 0: no limit, only LV_CIRCLE_CACHE_SIZE counts */
+    #define LV_CIRCLE_CACHE_BUDGET (16 * 1024)
+
+    /*Allocator of the circle buffers, e.g. to keep them in external RAM.
+     *On the ESP32-S3 they go to PSRAM and to internal RAM if there is none*/
+#ifdef ESP_PLATFORM
+    #define LV_CIRCLE_CACHE_INCLUDE "esp_heap_caps.h"
+    #define LV_CIRCLE_CACHE_ALLOC(size) heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT)
+    #define LV_CIRCLE_CACHE_FREE    heap_caps_free
+#else
+    #define LV_CIRCLE_CACHE_INCLUDE "../misc/lv_mem.h"
+    #define LV_CIRCLE_CACHE_ALLOC   lv_mem_alloc
+    #define LV_CIRCLE_CACHE_FREE    lv_mem_free
+#endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -146,6 +194,12 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Draw the parts of a refresh in horizontal stripes on more threads at once, see `lv_refr_set_stripes()`.
+ *The application starts the threads, LVGL splits the parts and waits for the stripes before the flush.
+ *The draw state of each thread is `__thread` (GCC and Clang).
+ *Requires LV_IMG_CACHE_DEF_SIZE 0 and LV_COLOR_SCREEN_TRANSP 0*/
+#define LV_USE_REFR_STRIPES 1
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -172,6 +226,12 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Inner loops of the normal blend mode (see lv_draw_sw_blend.h)
+ *0: reference C loops
+ *1: RGB565 kernels working on 2 or 4 pixels per machine word (LV_COLOR_DEPTH 16 only)
+ *2: reserved for ESP32-S3 PIE (SIMD) kernels, not implemented: an #error*/
+#define LV_DRAW_SW_BLEND_KERNELS 1
+
 /*-------------
  * GPU
  *-----------*/
@@ -285,7 +345,7 @@
 #endif
 
 /*1: Show the used memory and the memory fragmentation
- * Requires LV_MEM_CUSTOM = 0*/
+ * Requires LV_MEM_CUSTOM = 0 or LV_USE_MEM_TIER*/
 #define LV_USE_MEM_MONITOR 0
 #if LV_USE_MEM_MONITOR
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_LEFT_MID
@@ -360,28 +420,31 @@
  *===================*/
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
- *https://fonts.google.com/specimen/Montserrat*/
-#define LV_FONT_MONTSERRAT_8  1
-#define LV_FONT_MONTSERRAT_10 1
-#define LV_FONT_MONTSERRAT_12 1
+ *https://fonts.google.com/specimen/Montserrat
+ *Only the default size is built whole. The sizes the UI uses are glyph
+ *subsets in the sketch (ui_font_montserrat_*.c, declared below), made by
+ *host/font_subset.py, which also checks these settings*/
+#define LV_FONT_MONTSERRAT_8  0
+#define LV_FONT_MONTSERRAT_10 0
+#define LV_FONT_MONTSERRAT_12 0
 #define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_22 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_26 1
-#define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_30 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_34 1
-#define LV_FONT_MONTSERRAT_36 1
-#define LV_FONT_MONTSERRAT_38 1
-#define LV_FONT_MONTSERRAT_40 1
-#define LV_FONT_MONTSERRAT_42 1
-#define LV_FONT_MONTSERRAT_44 1
-#define LV_FONT_MONTSERRAT_46 1
-#define LV_FONT_MONTSERRAT_48 1
+#define LV_FONT_MONTSERRAT_16 0
+#define LV_FONT_MONTSERRAT_18 0
+#define LV_FONT_MONTSERRAT_20 0
+#define LV_FONT_MONTSERRAT_22 0
+#define LV_FONT_MONTSERRAT_24 0
+#define LV_FONT_MONTSERRAT_26 0
+#define LV_FONT_MONTSERRAT_28 0
+#define LV_FONT_MONTSERRAT_30 0
+#define LV_FONT_MONTSERRAT_32 0
+#define LV_FONT_MONTSERRAT_34 0
+#define LV_FONT_MONTSERRAT_36 0
+#define LV_FONT_MONTSERRAT_38 0
+#define LV_FONT_MONTSERRAT_40 0
+#define LV_FONT_MONTSERRAT_42 0
+#define LV_FONT_MONTSERRAT_44 0
+#define LV_FONT_MONTSERRAT_46 0
+#define LV_FONT_MONTSERRAT_48 0
 
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_12_SUBPX      0
@@ -396,7 +459,9 @@
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
  *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
-#define LV_FONT_CUSTOM_DECLARE
+#define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(lv_font_montserrat_12) LV_FONT_DECLARE(lv_font_montserrat_18) \
+                                 LV_FONT_DECLARE(lv_font_montserrat_20) LV_FONT_DECLARE(lv_font_montserrat_24) \
+                                 LV_FONT_DECLARE(lv_font_montserrat_48)
 
 /*Always set a default font*/
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
@@ -419,6 +484,29 @@
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Keep the glyphs drawn most recently decoded to 8 bit opacity maps, so a letter drawn again is blended
+ *without decoding its bitmap. box width * box height bytes are used per glyph.
+ *Sub-pixel and image font glyphs and letters with opacity are always decoded.
+ *0: to disable caching*/
+#define LV_GLYPH_CACHE_SIZE 64
+
+/*Upper limit of the memory used by the cached glyphs in bytes.
+ *The least recently drawn glyphs are dropped to make room for a new one, pinned glyphs are kept.
+ *0: no limit, only LV_GLYPH_CACHE_SIZE counts*/
+#define LV_GLYPH_CACHE_BUDGET (24 * 1024)
+
+/*Allocator of the glyph opacity maps, e.g. to keep them in external RAM.
+ *On the ESP32-S3 they go to PSRAM and to internal RAM if there is none*/
+#ifdef ESP_PLATFORM
+    #define LV_GLYPH_CACHE_INCLUDE "esp_heap_caps.h"
+    #define LV_GLYPH_CACHE_ALLOC(size) heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT)
+    #define LV_GLYPH_CACHE_FREE    heap_caps_free
+#else
+    #define LV_GLYPH_CACHE_INCLUDE <stdlib.h>
+    #define LV_GLYPH_CACHE_ALLOC   malloc
+    #define LV_GLYPH_CACHE_FREE    free
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -688,7 +776,7 @@
  *----------*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
@@ -727,15 +815,16 @@
 * EXAMPLES
 *==================*/
 
-/*Enable the examples to be built with the library*/
-#define LV_BUILD_EXAMPLES 1
+/*Enable the examples to be built with the library
+ *(off: some need Montserrat sizes that are only subsets here)*/
+#define LV_BUILD_EXAMPLES 0
 
 /*===================
  * DEMO USAGE
  ====================*/
 
 /*Show some widget. It might be required to increase `LV_MEM_SIZE` */
-#define LV_USE_DEMO_WIDGETS 1
+#define LV_USE_DEMO_WIDGETS 0   /*needs the whole Montserrat 12..24*/
 #if LV_USE_DEMO_WIDGETS
 #define LV_DEMO_WIDGETS_SLIDESHOW 1
 #endif
@@ -754,7 +843,7 @@
 #define LV_USE_DEMO_STRESS 1
 
 /*Music player demo*/
-#define LV_USE_DEMO_MUSIC 1
+#define LV_USE_DEMO_MUSIC 0     /*needs the whole Montserrat 12 and 16*/
 #if LV_USE_DEMO_MUSIC
     #define LV_DEMO_MUSIC_SQUARE    0
     #define LV_DEMO_MUSIC_LANDSCAPE 0
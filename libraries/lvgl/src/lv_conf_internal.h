@@ -188,6 +188,62 @@
     #endif
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Tiered heap for LV_MEM_CUSTOM (misc/lv_mem_tier.c): two TLSF pools instead of one.
+ *Blocks up to LV_MEM_TIER_FAST_MAX bytes go to the fast pool, a static array in internal RAM,
+ *larger ones to the slow pool from LV_MEM_TIER_SLOW_ALLOC, e.g. in external RAM. A full pool spills to the other one.
+ *Set LV_MEM_CUSTOM_INCLUDE to "lv_mem_tier.h" and LV_MEM_CUSTOM_ALLOC/FREE/REALLOC to lv_mem_tier_alloc/free/realloc*/
+#ifndef LV_USE_MEM_TIER
+    #ifdef CONFIG_LV_USE_MEM_TIER
+        #define LV_USE_MEM_TIER CONFIG_LV_USE_MEM_TIER
+    #else
+        #define LV_USE_MEM_TIER 0
+    #endif
+#endif
+#if LV_USE_MEM_TIER
+    /*Size of the fast pool in bytes (>= 2kB)*/
+    #ifndef LV_MEM_TIER_FAST_SIZE
+        #ifdef CONFIG_LV_MEM_TIER_FAST_SIZE
+            #define LV_MEM_TIER_FAST_SIZE CONFIG_LV_MEM_TIER_FAST_SIZE
+        #else
+            #define LV_MEM_TIER_FAST_SIZE (32U * 1024U)
+        #endif
+    #endif
+
+    /*Largest block in bytes that goes to the fast pool first*/
+    #ifndef LV_MEM_TIER_FAST_MAX
+        #ifdef CONFIG_LV_MEM_TIER_FAST_MAX
+            #define LV_MEM_TIER_FAST_MAX CONFIG_LV_MEM_TIER_FAST_MAX
+        #else
+            #define LV_MEM_TIER_FAST_MAX 1024
+        #endif
+    #endif
+
+    /*Size of the slow pool in bytes, 0: no slow pool*/
+    #ifndef LV_MEM_TIER_SLOW_SIZE
+        #ifdef CONFIG_LV_MEM_TIER_SLOW_SIZE
+            #define LV_MEM_TIER_SLOW_SIZE CONFIG_LV_MEM_TIER_SLOW_SIZE
+        #else
+            #define LV_MEM_TIER_SLOW_SIZE (256U * 1024U)
+        #endif
+    #endif
+
+    /*Allocator of the slow pool, called once*/
+    #ifndef LV_MEM_TIER_SLOW_INCLUDE
+        #ifdef CONFIG_LV_MEM_TIER_SLOW_INCLUDE
+            #define LV_MEM_TIER_SLOW_INCLUDE CONFIG_LV_MEM_TIER_SLOW_INCLUDE
+        #else
+            #define LV_MEM_TIER_SLOW_INCLUDE <stdlib.h>
+        #endif
+    #endif
+    #ifndef LV_MEM_TIER_SLOW_ALLOC
+        #ifdef CONFIG_LV_MEM_TIER_SLOW_ALLOC
+            #define LV_MEM_TIER_SLOW_ALLOC CONFIG_LV_MEM_TIER_SLOW_ALLOC
+        #else
+            #define LV_MEM_TIER_SLOW_ALLOC   malloc
+        #endif
+    #endif
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #ifndef LV_MEM_BUF_MAX_NUM
@@ -229,6 +285,17 @@
     #endif
 #endif
 
+/*Let pointer input drivers report the swipes and long presses their touch controller recognized
+ *(`gesture_dir` and `long_pressed` of `lv_indev_data_t`). `gesture_src` of the driver selects
+ *those, LVGL's own detection or both*/
+#ifndef LV_USE_INDEV_HW_GESTURE
+    #ifdef CONFIG_LV_USE_INDEV_HW_GESTURE
+        #define LV_USE_INDEV_HW_GESTURE CONFIG_LV_USE_INDEV_HW_GESTURE
+    #else
+        #define LV_USE_INDEV_HW_GESTURE 0
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -313,6 +380,40 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /* Upper limit of the memory used by the cached circles in bytes, radius * 6 + 6 bytes per circle.
+    * The least used circles are dropped to make room for a new one.
+    * 0: no limit, only LV_CIRCLE_CACHE_SIZE counts */
+    #ifndef LV_CIRCLE_CACHE_BUDGET
+        #ifdef CONFIG_LV_CIRCLE_CACHE_BUDGET
+            #define LV_CIRCLE_CACHE_BUDGET CONFIG_LV_CIRCLE_CACHE_BUDGET
+        #else
+            #define LV_CIRCLE_CACHE_BUDGET 0
+        #endif
+    #endif
+
+    /*Allocator of the circle buffers, e.g. to keep them in external RAM*/
+    #ifndef LV_CIRCLE_CACHE_INCLUDE
+        #ifdef CONFIG_LV_CIRCLE_CACHE_INCLUDE
+            #define LV_CIRCLE_CACHE_INCLUDE CONFIG_LV_CIRCLE_CACHE_INCLUDE
+        #else
+            #define LV_CIRCLE_CACHE_INCLUDE "../misc/lv_mem.h"
+        #endif
+    #endif
+    #ifndef LV_CIRCLE_CACHE_ALLOC
+        #ifdef CONFIG_LV_CIRCLE_CACHE_ALLOC
+            #define LV_CIRCLE_CACHE_ALLOC CONFIG_LV_CIRCLE_CACHE_ALLOC
+        #else
+            #define LV_CIRCLE_CACHE_ALLOC   lv_mem_alloc
+        #endif
+    #endif
+    #ifndef LV_CIRCLE_CACHE_FREE
+        #ifdef CONFIG_LV_CIRCLE_CACHE_FREE
+            #define LV_CIRCLE_CACHE_FREE CONFIG_LV_CIRCLE_CACHE_FREE
+        #else
+            #define LV_CIRCLE_CACHE_FREE    lv_mem_free
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -356,6 +457,18 @@
     #endif
 #endif
 
+/*Draw the parts of a refresh in horizontal stripes on more threads at once, see `lv_refr_set_stripes()`.
+ *The application starts the threads, LVGL splits the parts and waits for the stripes before the flush.
+ *The draw state of each thread is `__thread` (GCC and Clang).
+ *Requires LV_IMG_CACHE_DEF_SIZE 0 and LV_COLOR_SCREEN_TRANSP 0*/
+#ifndef LV_USE_REFR_STRIPES
+    #ifdef CONFIG_LV_USE_REFR_STRIPES
+        #define LV_USE_REFR_STRIPES CONFIG_LV_USE_REFR_STRIPES
+    #else
+        #define LV_USE_REFR_STRIPES 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -412,6 +525,18 @@
     #endif
 #endif
 
+/*Inner loops of the normal blend mode (see lv_draw_sw_blend.h)
+ *0: reference C loops
+ *1: RGB565 kernels working on 2 or 4 pixels per machine word (LV_COLOR_DEPTH 16 only)
+ *2: reserved for ESP32-S3 PIE (SIMD) kernels, not implemented: an #error*/
+#ifndef LV_DRAW_SW_BLEND_KERNELS
+    #ifdef CONFIG_LV_DRAW_SW_BLEND_KERNELS
+        #define LV_DRAW_SW_BLEND_KERNELS CONFIG_LV_DRAW_SW_BLEND_KERNELS
+    #else
+        #define LV_DRAW_SW_BLEND_KERNELS 0
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -769,7 +894,7 @@
 #endif
 
 /*1: Show the used memory and the memory fragmentation
- * Requires LV_MEM_CUSTOM = 0*/
+ * Requires LV_MEM_CUSTOM = 0 or LV_USE_MEM_TIER*/
 #ifndef LV_USE_MEM_MONITOR
     #ifdef CONFIG_LV_USE_MEM_MONITOR
         #define LV_USE_MEM_MONITOR CONFIG_LV_USE_MEM_MONITOR
@@ -1261,6 +1386,52 @@
     #endif
 #endif
 
+/*Keep the glyphs drawn most recently decoded to 8 bit opacity maps, so a letter drawn again is blended
+ *without decoding its bitmap. box width * box height bytes are used per glyph.
+ *Sub-pixel and image font glyphs and letters with opacity are always decoded.
+ *0: to disable caching*/
+#ifndef LV_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_GLYPH_CACHE_SIZE
+        #define LV_GLYPH_CACHE_SIZE CONFIG_LV_GLYPH_CACHE_SIZE
+    #else
+        #define LV_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Upper limit of the memory used by the cached glyphs in bytes.
+ *The least recently drawn glyphs are dropped to make room for a new one, pinned glyphs are kept.
+ *0: no limit, only LV_GLYPH_CACHE_SIZE counts*/
+#ifndef LV_GLYPH_CACHE_BUDGET
+    #ifdef CONFIG_LV_GLYPH_CACHE_BUDGET
+        #define LV_GLYPH_CACHE_BUDGET CONFIG_LV_GLYPH_CACHE_BUDGET
+    #else
+        #define LV_GLYPH_CACHE_BUDGET 0
+    #endif
+#endif
+
+/*Allocator of the glyph opacity maps, e.g. to keep them in external RAM*/
+#ifndef LV_GLYPH_CACHE_INCLUDE
+    #ifdef CONFIG_LV_GLYPH_CACHE_INCLUDE
+        #define LV_GLYPH_CACHE_INCLUDE CONFIG_LV_GLYPH_CACHE_INCLUDE
+    #else
+        #define LV_GLYPH_CACHE_INCLUDE "../../misc/lv_mem.h"
+    #endif
+#endif
+#ifndef LV_GLYPH_CACHE_ALLOC
+    #ifdef CONFIG_LV_GLYPH_CACHE_ALLOC
+        #define LV_GLYPH_CACHE_ALLOC CONFIG_LV_GLYPH_CACHE_ALLOC
+    #else
+        #define LV_GLYPH_CACHE_ALLOC   lv_mem_alloc
+    #endif
+#endif
+#ifndef LV_GLYPH_CACHE_FREE
+    #ifdef CONFIG_LV_GLYPH_CACHE_FREE
+        #define LV_GLYPH_CACHE_FREE CONFIG_LV_GLYPH_CACHE_FREE
+    #else
+        #define LV_GLYPH_CACHE_FREE    lv_mem_free
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -2481,6 +2652,13 @@ LV_EXPORT_CONST_INT(LV_DPI_DEF);
     #define LV_LOG_TRACE_ANIM       0
 #endif  /*LV_USE_LOG*/
 
+/*Draw state that each thread drawing stripes keeps for itself*/
+#if LV_USE_REFR_STRIPES
+    #define LV_ATTRIBUTE_DRAW_TLS __thread
+#else
+    #define LV_ATTRIBUTE_DRAW_TLS
+#endif  /*LV_USE_REFR_STRIPES*/
+
 
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
@@ -40,6 +40,7 @@ extern "C" {
 #define LV_DISPATCH10(f, t, n)
 #define LV_DISPATCH11(f, t, n)          LV_DISPATCH(f, t, n)
 
+/*The roots of the draw state are thread local with LV_USE_REFR_STRIPES, see LV_ATTRIBUTE_DRAW_TLS*/
 #define LV_ITERATE_ROOTS(f)                                                                            \
     LV_DISPATCH(f, lv_ll_t, _lv_timer_ll) /*Linked list to store the lv_timers*/                       \
     LV_DISPATCH(f, lv_ll_t, _lv_disp_ll)  /*Linked list of display device*/                            \
@@ -51,15 +52,15 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)                                                 \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
-    LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
+    LV_DISPATCH_COND(f, LV_ATTRIBUTE_DRAW_TLS _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0) \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
+    LV_DISPATCH(f, LV_ATTRIBUTE_DRAW_TLS lv_mem_buf_arr_t , lv_mem_buf)                                \
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
-    LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
+    LV_DISPATCH_COND(f, LV_ATTRIBUTE_DRAW_TLS _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1) \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
-    LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
-    LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
+    LV_DISPATCH_COND(f, LV_ATTRIBUTE_DRAW_TLS uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1) \
+    LV_DISPATCH(f, LV_ATTRIBUTE_DRAW_TLS uint8_t * , _lv_grad_cache_mem)                               \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
@@ -9,6 +9,7 @@
  *********************/
 #include "lv_mem.h"
 #include "lv_tlsf.h"
+#include "lv_mem_tier.h"
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
@@ -61,6 +62,11 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_USE_REFR_STRIPES
+    static void (*mem_lock_cb)(void);
+    static void (*mem_unlock_cb)(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -76,6 +82,14 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
 #define SET8(x) *d8 = x; d8++;
 #define REPEAT8(expr) expr expr expr expr expr expr expr expr
 
+#if LV_USE_REFR_STRIPES
+    #define MEM_LOCK()   do { if(mem_lock_cb) mem_lock_cb(); } while(0)
+    #define MEM_UNLOCK() do { if(mem_unlock_cb) mem_unlock_cb(); } while(0)
+#else
+    #define MEM_LOCK()
+    #define MEM_UNLOCK()
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -98,6 +112,8 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+#elif LV_USE_MEM_TIER
+    lv_mem_tier_init();
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -130,6 +146,7 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
+    MEM_LOCK();
 #if LV_MEM_CUSTOM == 0
     void * alloc = lv_tlsf_malloc(tlsf, size);
 #else
@@ -159,6 +176,7 @@ void * lv_mem_alloc(size_t size)
 #endif
         MEM_TRACE("allocated at %p", alloc);
     }
+    MEM_UNLOCK();
     return alloc;
 }
 
@@ -172,6 +190,7 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+    MEM_LOCK();
 #if LV_MEM_CUSTOM == 0
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
@@ -182,6 +201,7 @@ void lv_mem_free(void * data)
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
+    MEM_UNLOCK();
 }
 
 /**
@@ -202,11 +222,13 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+    MEM_LOCK();
 #if LV_MEM_CUSTOM == 0
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
+    MEM_UNLOCK();
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't allocate memory");
         return NULL;
@@ -233,6 +255,11 @@ lv_res_t lv_mem_test(void)
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
+#elif LV_USE_MEM_TIER
+    if(lv_mem_tier_test() != LV_RES_OK) {
+        LV_LOG_WARN("tiers failed");
+        return LV_RES_INV;
+    }
 #endif
     MEM_TRACE("passed");
     return LV_RES_OK;
@@ -265,6 +292,8 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     mon_p->max_used = max_used;
 
     MEM_TRACE("finished");
+#elif LV_USE_MEM_TIER
+    lv_mem_tier_monitor(mon_p);
 #endif
 }
 
@@ -358,6 +387,19 @@ void lv_mem_buf_free_all(void)
     }
 }
 
+#if LV_USE_REFR_STRIPES
+/**
+ * Guard the allocator with a lock while more threads draw
+ * @param lock_cb   take the lock, NULL: no lock
+ * @param unlock_cb give the lock back
+ */
+void _lv_mem_set_lock(void (*lock_cb)(void), void (*unlock_cb)(void))
+{
+    mem_lock_cb = lock_cb;
+    mem_unlock_cb = unlock_cb;
+}
+#endif
+
 #if LV_MEMCPY_MEMSET_STD == 0
 /**
  * Same as `memcpy` but optimized for 4 byte operation.
@@ -119,6 +119,16 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+#if LV_USE_REFR_STRIPES
+/**
+ * Guard the allocator with a lock while more threads draw.
+ * The temporal buffers need no lock, every thread has its own.
+ * @param lock_cb   take the lock, NULL: no lock
+ * @param unlock_cb give the lock back
+ */
+void _lv_mem_set_lock(void (*lock_cb)(void), void (*unlock_cb)(void));
+#endif
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
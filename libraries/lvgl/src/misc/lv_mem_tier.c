@@ -0,0 +1,316 @@
+/**
+ * @file lv_mem_tier.c
+ * Tiered heap for `LV_MEM_CUSTOM`.
+ * The fast pool is a static array, so it is in internal RAM,
+ * the slow pool is allocated once with `LV_MEM_TIER_SLOW_ALLOC`.
+ * Both are TLSF heaps like the built-in one of lv_mem.c.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_tier.h"
+#if LV_USE_MEM_TIER
+
+#include "lv_tlsf.h"
+#include "lv_assert.h"
+#include "lv_log.h"
+#include "lv_math.h"
+
+#if LV_MEM_TIER_SLOW_SIZE
+    #include LV_MEM_TIER_SLOW_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifdef LV_ARCH_64
+    #define MEM_UNIT         uint64_t
+#else
+    #define MEM_UNIT         uint32_t
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_tlsf_t tlsf;         /*NULL if the pool could not be allocated*/
+    uint8_t * start;
+    uint32_t size;
+    uint32_t used;          /*bytes of the blocks in use*/
+    uint32_t max_used;
+    uint32_t alloc_cnt;
+    uint32_t spill_cnt;
+} lv_mem_tier_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void tier_create(lv_mem_tier_t * t, void * mem, uint32_t size);
+static uint32_t tier_pick(size_t size);
+static lv_mem_tier_t * tier_get(const void * data);
+static void * tier_malloc(lv_mem_tier_t * t, size_t size);
+static void used_add(lv_mem_tier_t * t, size_t size);
+static void used_sub(lv_mem_tier_t * t, size_t size);
+static void tier_walker(void * ptr, size_t size, int used, void * user);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_mem_tier_t tiers[_LV_MEM_TIER_NUM];
+static bool inited;
+static uint32_t cur_used;
+static uint32_t max_used;
+static uint32_t move_cnt;
+static uint32_t fail_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_tier_init(void)
+{
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT fast_mem[LV_MEM_TIER_FAST_SIZE / sizeof(MEM_UNIT)];
+
+    if(inited) return;
+    inited = true;
+
+    tier_create(&tiers[LV_MEM_TIER_FAST], fast_mem, sizeof(fast_mem));
+#if LV_MEM_TIER_SLOW_SIZE
+    void * slow_mem = LV_MEM_TIER_SLOW_ALLOC(LV_MEM_TIER_SLOW_SIZE);
+    if(slow_mem) tier_create(&tiers[LV_MEM_TIER_SLOW], slow_mem, LV_MEM_TIER_SLOW_SIZE);
+    else LV_LOG_WARN("couldn't allocate the slow pool (%lu bytes), only the fast pool is used",
+                         (unsigned long)LV_MEM_TIER_SLOW_SIZE);
+#endif
+}
+
+void * lv_mem_tier_alloc(size_t size)
+{
+    if(!inited) lv_mem_tier_init();
+
+    uint32_t want = tier_pick(size);
+    void * p = tier_malloc(&tiers[want], size);
+    if(p == NULL) {
+        /*The preferred pool is full*/
+        p = tier_malloc(&tiers[!want], size);
+        if(p) tiers[!want].spill_cnt++;
+        else fail_cnt++;
+    }
+    return p;
+}
+
+void lv_mem_tier_free(void * data)
+{
+    if(data == NULL) return;
+
+    lv_mem_tier_t * t = tier_get(data);
+    LV_ASSERT_MSG(t != NULL, "The block is in neither pool");
+    if(t == NULL) return;
+
+    /*The size lv_tlsf_free() returns has the flags of the block in it*/
+    used_sub(t, lv_tlsf_block_size(data));
+    lv_tlsf_free(t->tlsf, data);
+}
+
+void * lv_mem_tier_realloc(void * data, size_t new_size)
+{
+    if(data == NULL) return lv_mem_tier_alloc(new_size);
+
+    lv_mem_tier_t * cur = tier_get(data);
+    LV_ASSERT_MSG(cur != NULL, "The block is in neither pool");
+    if(cur == NULL) return NULL;
+
+    /*Try the pool of the new size first, then the other one*/
+    uint32_t want = tier_pick(new_size);
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        lv_mem_tier_t * t = &tiers[i == 0 ? want : !want];
+        size_t old_size = lv_tlsf_block_size(data);
+        void * p;
+        if(t == cur) {
+            p = lv_tlsf_realloc(t->tlsf, data, new_size);
+            if(p == NULL) continue;
+            used_sub(t, old_size);
+            used_add(t, lv_tlsf_block_size(p));
+        }
+        else {
+            p = tier_malloc(t, new_size);
+            if(p == NULL) continue;
+            lv_memcpy(p, data, LV_MIN(old_size, new_size));
+            used_sub(cur, old_size);
+            lv_tlsf_free(cur->tlsf, data);
+            move_cnt++;
+        }
+        if(i != 0) t->spill_cnt++;
+        return p;
+    }
+
+    fail_cnt++;
+    return NULL;
+}
+
+int32_t lv_mem_tier_of(const void * data)
+{
+    lv_mem_tier_t * t = tier_get(data);
+    return t ? (int32_t)(t - tiers) : -1;
+}
+
+void lv_mem_tier_monitor(lv_mem_monitor_t * mon_p)
+{
+    lv_mem_tier_stats_t stats;
+    uint32_t i;
+
+    lv_memset_00(mon_p, sizeof(lv_mem_monitor_t));
+    lv_mem_tier_get_stats(&stats);
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        lv_mem_tier_info_t * info = &stats.tier[i];
+        mon_p->total_size += info->total_size;
+        mon_p->free_cnt += info->free_cnt;
+        mon_p->free_size += info->free_size;
+        mon_p->free_biggest_size = LV_MAX(mon_p->free_biggest_size, info->free_biggest_size);
+        mon_p->used_cnt += info->used_cnt;
+    }
+
+    if(mon_p->total_size) mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    mon_p->max_used = max_used;
+}
+
+void lv_mem_tier_get_stats(lv_mem_tier_stats_t * stats)
+{
+    uint32_t i;
+
+    if(!inited) lv_mem_tier_init();
+
+    lv_memset_00(stats, sizeof(lv_mem_tier_stats_t));
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        lv_mem_tier_t * t = &tiers[i];
+        lv_mem_tier_info_t * info = &stats->tier[i];
+        if(t->tlsf == NULL) continue;
+
+        lv_tlsf_walk_pool(lv_tlsf_get_pool(t->tlsf), tier_walker, info);
+        info->total_size = t->size;
+        info->max_used = t->max_used;
+        info->alloc_cnt = t->alloc_cnt;
+        info->spill_cnt = t->spill_cnt;
+        if(info->free_size > 0) {
+            info->frag_pct = 100 - info->free_biggest_size * 100U / info->free_size;
+        }
+    }
+    stats->move_cnt = move_cnt;
+    stats->fail_cnt = fail_cnt;
+}
+
+void lv_mem_tier_reset_stats(void)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        tiers[i].max_used = tiers[i].used;
+        tiers[i].alloc_cnt = 0;
+        tiers[i].spill_cnt = 0;
+    }
+    max_used = cur_used;
+    move_cnt = 0;
+    fail_cnt = 0;
+}
+
+lv_res_t lv_mem_tier_test(void)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        lv_mem_tier_t * t = &tiers[i];
+        if(t->tlsf == NULL) continue;
+
+        if(lv_tlsf_check(t->tlsf)) {
+            LV_LOG_WARN("pool %d failed", (int)i);
+            return LV_RES_INV;
+        }
+
+        if(lv_tlsf_check_pool(lv_tlsf_get_pool(t->tlsf))) {
+            LV_LOG_WARN("blocks of pool %d failed", (int)i);
+            return LV_RES_INV;
+        }
+    }
+    return LV_RES_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void tier_create(lv_mem_tier_t * t, void * mem, uint32_t size)
+{
+    t->tlsf = lv_tlsf_create_with_pool(mem, size);
+    t->start = mem;
+    t->size = size;
+}
+
+/*The pool a block of `size` bytes belongs to*/
+static uint32_t tier_pick(size_t size)
+{
+    if(size > LV_MEM_TIER_FAST_MAX && tiers[LV_MEM_TIER_SLOW].tlsf) return LV_MEM_TIER_SLOW;
+    return LV_MEM_TIER_FAST;
+}
+
+static lv_mem_tier_t * tier_get(const void * data)
+{
+    const uint8_t * p = data;
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        lv_mem_tier_t * t = &tiers[i];
+        if(t->tlsf && p >= t->start && p < t->start + t->size) return t;
+    }
+    return NULL;
+}
+
+static void * tier_malloc(lv_mem_tier_t * t, size_t size)
+{
+    if(t->tlsf == NULL) return NULL;
+
+    void * p = lv_tlsf_malloc(t->tlsf, size);
+    if(p) {
+        t->alloc_cnt++;
+        used_add(t, lv_tlsf_block_size(p));
+    }
+    return p;
+}
+
+static void used_add(lv_mem_tier_t * t, size_t size)
+{
+    t->used += size;
+    t->max_used = LV_MAX(t->max_used, t->used);
+    cur_used += size;
+    max_used = LV_MAX(max_used, cur_used);
+}
+
+static void used_sub(lv_mem_tier_t * t, size_t size)
+{
+    t->used -= LV_MIN(t->used, size);
+    cur_used -= LV_MIN(cur_used, size);
+}
+
+static void tier_walker(void * ptr, size_t size, int used, void * user)
+{
+    LV_UNUSED(ptr);
+
+    lv_mem_tier_info_t * info = user;
+    if(used) {
+        info->used_cnt++;
+        info->used_size += size;
+    }
+    else {
+        info->free_cnt++;
+        info->free_size += size;
+        if(size > info->free_biggest_size)
+            info->free_biggest_size = size;
+    }
+}
+
+#endif /*LV_USE_MEM_TIER*/
@@ -0,0 +1,138 @@
+/**
+ * @file lv_mem_tier.h
+ * Tiered heap for `LV_MEM_CUSTOM`: a fast and a slow TLSF pool
+ */
+
+#ifndef LV_MEM_TIER_H
+#define LV_MEM_TIER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "lv_mem.h"
+
+#if LV_USE_MEM_TIER
+
+#if LV_MEM_CUSTOM == 0
+    #error "LV_USE_MEM_TIER is an allocator for LV_MEM_CUSTOM 1"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_MEM_TIER_FAST,   /**< Static array, internal RAM*/
+    LV_MEM_TIER_SLOW,   /**< From `LV_MEM_TIER_SLOW_ALLOC`, e.g. PSRAM*/
+    _LV_MEM_TIER_NUM
+};
+
+/**
+ * Information about one pool
+ */
+typedef struct {
+    uint32_t total_size;        /**< Size of the pool, 0 if it could not be allocated*/
+    uint32_t used_size;         /**< Bytes of the blocks in use*/
+    uint32_t max_used;          /**< High-water mark of `used_size`*/
+    uint32_t used_cnt;          /**< Blocks in use*/
+    uint32_t free_size;         /**< Bytes of the free blocks*/
+    uint32_t free_cnt;
+    uint32_t free_biggest_size; /**< Largest block that can be allocated*/
+    uint8_t frag_pct;           /**< 100 - biggest free * 100 / free*/
+    uint32_t alloc_cnt;         /**< Blocks allocated here*/
+    uint32_t spill_cnt;         /**< Blocks that belonged to the other pool, but it was full*/
+} lv_mem_tier_info_t;
+
+typedef struct {
+    lv_mem_tier_info_t tier[_LV_MEM_TIER_NUM];
+    uint32_t move_cnt;          /**< Reallocations that moved a block to the other pool*/
+    uint32_t fail_cnt;          /**< Allocations neither pool had room for*/
+} lv_mem_tier_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the pools. Called by `lv_mem_init()` and on the first allocation.
+ */
+void lv_mem_tier_init(void);
+
+/**
+ * Allocate a block, from the fast pool if it is at most `LV_MEM_TIER_FAST_MAX` bytes,
+ * else from the slow pool. A full pool spills to the other one.
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory, NULL if neither pool has room
+ */
+void * lv_mem_tier_alloc(size_t size);
+
+/**
+ * Free a block of either pool
+ * @param data pointer to an allocated memory, can be NULL
+ */
+void lv_mem_tier_free(void * data);
+
+/**
+ * Reallocate a block. It moves to the pool its new size belongs to,
+ * e.g. a text growing past `LV_MEM_TIER_FAST_MAX` leaves the fast pool.
+ * @param data pointer to an allocated memory or NULL
+ * @param new_size the desired new size in byte
+ * @return pointer to the new memory, NULL on failure, then `data` is kept
+ */
+void * lv_mem_tier_realloc(void * data, size_t new_size);
+
+/**
+ * Get the pool a block is in
+ * @param data pointer to an allocated memory
+ * @return `LV_MEM_TIER_FAST`, `LV_MEM_TIER_SLOW` or -1 if it is in neither
+ */
+int32_t lv_mem_tier_of(const void * data);
+
+/**
+ * Fill the heap information of `lv_mem_monitor()` with the sum of both pools
+ * @param mon_p pointer to a lv_mem_monitor_t variable
+ */
+void lv_mem_tier_monitor(lv_mem_monitor_t * mon_p);
+
+/**
+ * Walk both pools and give the information of each
+ * @param stats pointer to a lv_mem_tier_stats_t variable
+ */
+void lv_mem_tier_get_stats(lv_mem_tier_stats_t * stats);
+
+/**
+ * Clear the counters and set the high-water marks to the current use
+ */
+void lv_mem_tier_reset_stats(void);
+
+/**
+ * Check the integrity of both pools
+ * @return LV_RES_OK if they are fine
+ */
+lv_res_t lv_mem_tier_test(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_MEM_TIER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_TIER_H*/
@@ -86,6 +86,7 @@ void lv_arc_set_start_angle(lv_obj_t * obj, uint16_t start)
     lv_arc_t * arc = (lv_arc_t *)obj;
 
     if(start > 360) start -= 360;
+    if(start == arc->indic_angle_start) return;
 
     int16_t old_delta = arc->indic_angle_end - arc->indic_angle_start;
     int16_t new_delta = arc->indic_angle_end - start;
@@ -109,6 +110,8 @@ void lv_arc_set_end_angle(lv_obj_t * obj, uint16_t end)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_arc_t * arc = (lv_arc_t *)obj;
     if(end > 360) end -= 360;
+    /*Values that map to the same angle don't move the indicator or the knob*/
+    if(end == arc->indic_angle_end) return;
 
     int16_t old_delta = arc->indic_angle_end - arc->indic_angle_start;
     int16_t new_delta = end - arc->indic_angle_start;
@@ -598,14 +598,16 @@ static void draw_img(lv_event_t * e)
             bg_coords.y2 += obj->coords.y1;
         }
 
+        /*Without a transformation they are the same, leave the coordinates alone for the stripes drawn next to this one*/
+        bool move_coords = !_lv_area_is_equal(&obj->coords, &bg_coords);
         lv_area_t ori_coords;
         lv_area_copy(&ori_coords, &obj->coords);
-        lv_area_copy(&obj->coords, &bg_coords);
+        if(move_coords) lv_area_copy(&obj->coords, &bg_coords);
 
         lv_res_t res = lv_obj_event_base(MY_CLASS, e);
         if(res != LV_RES_OK) return;
 
-        lv_area_copy(&obj->coords, &ori_coords);
+        if(move_coords) lv_area_copy(&obj->coords, &ori_coords);
 
         if(code == LV_EVENT_DRAW_MAIN) {
             if(img->h == 0 || img->w == 0) return;
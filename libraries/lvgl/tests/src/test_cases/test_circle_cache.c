@@ -0,0 +1,113 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*The test build limits the cache to 8 circles and 2048 bytes (see CMakeLists.txt)*/
+#define CIRCLE_BYTES(r)     ((r) * 6 + 6)
+
+static lv_draw_mask_circle_cache_stats_t stats;
+
+static void init_mask(lv_draw_mask_radius_param_t * param, lv_coord_t radius)
+{
+    lv_area_t rect = {0, 0, radius * 2 - 1, radius * 2 - 1};
+    lv_draw_mask_radius_init(param, &rect, radius, false);
+}
+
+static void use_circle(lv_coord_t radius)
+{
+    lv_draw_mask_radius_param_t param;
+    init_mask(&param, radius);
+    lv_draw_mask_free_param(&param);
+}
+
+void setUp(void)
+{
+    _lv_draw_mask_cleanup();
+    lv_draw_mask_reset_circle_cache_stats();
+}
+
+void tearDown(void)
+{
+    _lv_draw_mask_cleanup();
+}
+
+void test_circle_cache_hit_after_miss(void)
+{
+    use_circle(10);
+    use_circle(10);
+
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(CIRCLE_BYTES(10), stats.bytes);
+}
+
+void test_circle_cache_stays_in_budget(void)
+{
+    /*1704 bytes fit, the 5th circle doesn't*/
+    use_circle(40);
+    use_circle(60);
+    use_circle(80);
+    use_circle(100);
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict);
+
+    use_circle(120);
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.miss);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.evict);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_CIRCLE_CACHE_BUDGET, stats.bytes);
+
+    /*The newest circle is kept*/
+    use_circle(120);
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit);
+}
+
+void test_circle_cache_keeps_used_circles(void)
+{
+    lv_draw_mask_radius_param_t param;
+    init_mask(&param, 200);
+    TEST_ASSERT_EQUAL_INT(200, param.circle->radius);
+    uint8_t * buf = param.circle->buf;
+
+    /*Nothing else fits next to it, these are calculated for their masks only*/
+    use_circle(150);
+    use_circle(160);
+
+    TEST_ASSERT_EQUAL_INT(200, param.circle->radius);
+    TEST_ASSERT_EQUAL_PTR(buf, param.circle->buf);
+    lv_draw_mask_free_param(&param);
+
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(CIRCLE_BYTES(200), stats.bytes);
+}
+
+void test_circle_cache_too_large_circle_is_not_cached(void)
+{
+    use_circle(30);
+
+    lv_draw_mask_radius_param_t param;
+    init_mask(&param, 400);
+    TEST_ASSERT_LESS_THAN_INT32(0, param.circle->life);
+
+    /*The mask works with the uncached circle too*/
+    lv_opa_t row[800];
+    lv_memset_ff(row, sizeof(row));
+    lv_draw_mask_res_t res = param.dsc.cb(row, 0, 0, sizeof(row), &param);
+    TEST_ASSERT_EQUAL(LV_DRAW_MASK_RES_CHANGED, res);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_TRANSP, row[0]);
+    lv_draw_mask_free_param(&param);
+
+    lv_draw_mask_get_circle_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(CIRCLE_BYTES(30), stats.bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict);
+}
+
+#endif
@@ -0,0 +1,119 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+
+/*The test build limits the cache to 8 glyphs and 2048 bytes (see CMakeLists.txt)*/
+
+static lv_draw_sw_glyph_cache_stats_t stats;
+static lv_obj_t * label;
+
+static uint32_t glyph_bytes(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    lv_font_get_glyph_dsc(font, &g, letter, '\0');
+    return (uint32_t)g.box_w * g.box_h;
+}
+
+static void draw(const lv_font_t * font, const char * txt)
+{
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, txt);
+    lv_refr_now(NULL);
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_scr_act());
+    lv_draw_sw_glyph_cache_clear(NULL);
+    lv_draw_sw_reset_glyph_cache_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_draw_sw_glyph_cache_clear(NULL);
+}
+
+void test_glyph_cache_hit_after_miss(void)
+{
+    draw(&lv_font_montserrat_14, "1111");
+
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(glyph_bytes(&lv_font_montserrat_14, '1'), stats.bytes);
+}
+
+void test_glyph_cache_drops_least_recent(void)
+{
+    draw(&lv_font_montserrat_14, "ABCDEFGHIJ");
+
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.evict);
+    TEST_ASSERT_EQUAL_UINT32(8, stats.entries);
+
+    /*J was drawn last, A first*/
+    lv_draw_sw_reset_glyph_cache_stats();
+    draw(&lv_font_montserrat_14, "J");
+    draw(&lv_font_montserrat_14, "A");
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss);
+}
+
+void test_glyph_cache_keeps_pinned_glyphs(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(2, lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_14, "01"));
+
+    draw(&lv_font_montserrat_14, "ABCDEFGHIJ");
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(8, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.pinned);
+
+    lv_draw_sw_reset_glyph_cache_stats();
+    draw(&lv_font_montserrat_14, "10");
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss);
+}
+
+void test_glyph_cache_stays_in_budget(void)
+{
+    uint32_t m_bytes = glyph_bytes(&lv_font_montserrat_48, 'M');
+    uint32_t w_bytes = glyph_bytes(&lv_font_montserrat_48, 'W');
+    TEST_ASSERT_GREATER_THAN_UINT32(LV_GLYPH_CACHE_BUDGET, m_bytes + w_bytes);
+
+    draw(&lv_font_montserrat_48, "MW");
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.evict);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(w_bytes, stats.bytes);
+}
+
+void test_glyph_cache_clear_one_font(void)
+{
+    lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_14, "1");
+    lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_48, "1");
+
+    lv_draw_sw_glyph_cache_clear(&lv_font_montserrat_48);
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(glyph_bytes(&lv_font_montserrat_14, '1'), stats.bytes);
+}
+
+void test_glyph_cache_skips_letters_with_opacity(void)
+{
+    lv_obj_set_style_text_opa(label, LV_OPA_50, 0);
+    draw(&lv_font_montserrat_14, "11");
+
+    lv_draw_sw_get_glyph_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entries);
+}
+
+#endif
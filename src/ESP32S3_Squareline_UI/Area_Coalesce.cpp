@@ -0,0 +1,86 @@
+/*****************************************************************************
+* | File      	:   Area_Coalesce.cpp
+* | Function    :   Merging of LVGL's dirty areas by bus cost
+* | Info        :
+*                Greedy: any pair whose union is no more expensive is
+*                merged, then the list is walked again until no pair
+*                merges. LV_INV_BUF_SIZE (32) areas at most, so the
+*                quadratic walk stays short. Runs on the LVGL task only.
+******************************************************************************/
+#include "Area_Coalesce.h"
+
+#include <string.h>
+
+static AREA_COALESCE_STATS Area_Coalesce_Stats;
+
+/******************************************************************************
+function:	Bus cost of sending an area as its own window
+parameter:
+    Area        : LVGL area, inclusive
+    Window_Cost : bytes of bus time one window costs besides its pixels
+    Colmod      : LCD_1IN28_COLOR_565 (2 bytes a pixel) or LCD_1IN28_COLOR_444 (1.5)
+******************************************************************************/
+UDOUBLE Area_Coalesce_Cost(const lv_area_t *Area, UDOUBLE Window_Cost, UBYTE Colmod)
+{
+    UDOUBLE Pixels = lv_area_get_size(Area);
+
+    if(Colmod == LCD_1IN28_COLOR_444)
+        return Window_Cost + Pixels * 3 / 2;
+    return Window_Cost + Pixels * 2;
+}
+
+/******************************************************************************
+function:	Merge dirty areas while their bounding box is the cheaper
+parameter:
+    Areas       : LVGL areas, merged in place
+    Count       : areas in Areas
+    Window_Cost : as for Area_Coalesce_Cost()
+    Colmod      : as for Area_Coalesce_Cost()
+return:
+    the new number of areas; every pixel of the old ones is in one of them
+******************************************************************************/
+uint16_t Area_Coalesce(lv_area_t *Areas, uint16_t Count, UDOUBLE Window_Cost, UBYTE Colmod)
+{
+    UBYTE Merged = 1;
+    uint16_t i, j;
+
+    Area_Coalesce_Stats.Calls++;
+    Area_Coalesce_Stats.Areas_In += Count;
+    for(i = 0; i < Count; i++)
+        Area_Coalesce_Stats.Pixels_In += lv_area_get_size(&Areas[i]);
+
+    while(Merged) {
+        Merged = 0;
+        for(i = 0; i < Count; i++) {
+            for(j = i + 1; j < Count; j++) {
+                lv_area_t u;
+                _lv_area_join(&u, &Areas[i], &Areas[j]);
+                if(Area_Coalesce_Cost(&u, Window_Cost, Colmod) >
+                   Area_Coalesce_Cost(&Areas[i], Window_Cost, Colmod) + Area_Coalesce_Cost(&Areas[j], Window_Cost, Colmod))
+                    continue;
+
+                Areas[i] = u;
+                Areas[j--] = Areas[--Count];
+                Merged = 1;
+            }
+        }
+    }
+
+    Area_Coalesce_Stats.Areas_Out += Count;
+    for(i = 0; i < Count; i++)
+        Area_Coalesce_Stats.Pixels_Out += lv_area_get_size(&Areas[i]);
+    return Count;
+}
+
+/******************************************************************************
+function:	Read or clear the counters
+******************************************************************************/
+void Area_Coalesce_GetStats(AREA_COALESCE_STATS *Stats)
+{
+    *Stats = Area_Coalesce_Stats;
+}
+
+void Area_Coalesce_ResetStats(void)
+{
+    memset(&Area_Coalesce_Stats, 0, sizeof(Area_Coalesce_Stats));
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   Area_Coalesce.h
+* | Function    :   Merging of LVGL's dirty areas by bus cost
+* | Info        :
+*                LVGL only joins dirty areas when the union wastes no
+*                pixel. On this bus every window costs its CASET/RASET/RAMWR
+*                setup and a handful of queued transactions, so two areas
+*                are merged whenever their bounding box costs less to render
+*                and send than the two apart: the wasted pixels cost less
+*                than the window setup saved.
+******************************************************************************/
+#ifndef __AREA_COALESCE_H
+#define __AREA_COALESCE_H
+
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+#include <lvgl.h>
+
+typedef struct{
+	UDOUBLE Calls;              // area lists coalesced
+	UDOUBLE Areas_In;           // dirty areas handed in
+	UDOUBLE Areas_Out;          // areas left after merging
+	UDOUBLE Pixels_In;          // pixels of the areas handed in, overlaps counted twice
+	UDOUBLE Pixels_Out;         // pixels of the areas left
+}AREA_COALESCE_STATS;
+
+UDOUBLE Area_Coalesce_Cost(const lv_area_t *Area, UDOUBLE Window_Cost, UBYTE Colmod);
+uint16_t Area_Coalesce(lv_area_t *Areas, uint16_t Count, UDOUBLE Window_Cost, UBYTE Colmod);
+
+void Area_Coalesce_GetStats(AREA_COALESCE_STATS *Stats);
+void Area_Coalesce_ResetStats(void);
+#endif
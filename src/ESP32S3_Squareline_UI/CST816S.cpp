@@ -27,6 +27,7 @@
 #include <FunctionalInterrupt.h>
 
 #include "CST816S.h"
+#include "I2C_Bus.h"
 
 
 /*!
@@ -45,21 +46,26 @@ CST816S::CST816S(int sda, int scl, int rst, int irq) {
   _scl = scl;
   _rst = rst;
   _irq = irq;
+  _isr_cb = NULL;
 
 }
 
 /*!
     @brief  read touch data
+	@return	0 on success, not 0 if the controller did not answer; data
+			is left as it was then
 */
-void CST816S::read_touch() {
+uint8_t CST816S::read_touch() {
   byte data_raw[8];
-  i2c_read(CST816S_ADDRESS, 0x01, data_raw, 6);
+  uint8_t status = i2c_read(CST816S_ADDRESS, 0x01, data_raw, 6);
+  if (status) return status;
 
   data.gestureID = data_raw[0];
   data.points = data_raw[1];
   data.event = data_raw[2] >> 6;
   data.x = ((data_raw[2] & 0xF) << 8) + data_raw[3];
   data.y = ((data_raw[4] & 0xF) << 8) + data_raw[5];
+  return 0;
 }
 
 /*!
@@ -67,6 +73,9 @@ void CST816S::read_touch() {
 */
 void IRAM_ATTR CST816S::handleISR(void) {
   _event_available = true;
+  if (_isr_cb != NULL) {
+    _isr_cb();
+  }
 
 }
 
@@ -95,14 +104,23 @@ void CST816S::begin(int interrupt) {
   attachInterrupt(_irq, std::bind(&CST816S::handleISR, this), interrupt);
 }
 
+/*!
+    @brief  call a function from the touch interrupt, e.g. to wake the task
+            that reads the touch
+	@param	callback
+			runs in interrupt context, must be IRAM_ATTR; NULL to remove
+*/
+void CST816S::setInterruptCallback(void (*callback)(void)) {
+  _isr_cb = callback;
+}
+
 /*!
     @brief  check for a touch event
 */
 bool CST816S::available() {
   if (_event_available) {
-    read_touch();
     _event_available = false;
-    return true;
+    return read_touch() == 0;
   }
   return false;
 }
@@ -167,13 +185,8 @@ String CST816S::gesture() {
 */
 uint8_t CST816S::i2c_read(uint16_t addr, uint8_t reg_addr, uint8_t *reg_data, uint32_t length)
 {
-  Wire.beginTransmission(addr);
-  Wire.write(reg_addr);
-  if ( Wire.endTransmission(true))return -1;
-  Wire.requestFrom(addr, length, true);
-  for (int i = 0; i < length; i++) {
-    *reg_data++ = Wire.read();
-  }
+  // Through the bus task, ahead of the IMU's reads
+  if (I2C_Bus_Read(addr, reg_addr, reg_data, length, I2C_BUS_PRIO_TOUCH))return -1;
   return 0;
 }
 
@@ -191,11 +204,6 @@ uint8_t CST816S::i2c_read(uint16_t addr, uint8_t reg_addr, uint8_t *reg_data, ui
 */
 uint8_t CST816S::i2c_write(uint8_t addr, uint8_t reg_addr, const uint8_t *reg_data, uint32_t length)
 {
-  Wire.beginTransmission(addr);
-  Wire.write(reg_addr);
-  for (int i = 0; i < length; i++) {
-    Wire.write(*reg_data++);
-  }
-  if ( Wire.endTransmission(true))return -1;
+  if (I2C_Bus_Write(addr, reg_addr, reg_data, length, I2C_BUS_PRIO_TOUCH))return -1;
   return 0;
 }
\ No newline at end of file
@@ -62,14 +62,16 @@ class CST816S {
     bool available();
     data_struct data;
     String gesture();
+    void setInterruptCallback(void (*callback)(void));
 
-  void read_touch();
+  uint8_t read_touch();
   private:
     int _sda;
     int _scl;
     int _rst;
     int _irq;
     bool _event_available;
+    void (*_isr_cb)(void);
 
     void IRAM_ATTR handleISR();
     // void read_touch();
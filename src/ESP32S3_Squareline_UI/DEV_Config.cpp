@@ -28,13 +28,66 @@
 ******************************************************************************/
 #include "DEV_Config.h"
 
+#if DEV_SPI_DMA
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#endif
+
 uint slice_num;
 SPIClass * vspi = NULL;
+
+static DEV_SPI_Done_Callback spi_done_cb = NULL;
+
+#if DEV_SPI_DMA
+/**
+ * Queued SPI transaction, DC level and completion argument travel with it.
+ * Segments over the 4 TXDATA bytes are copied into seg for the DMA
+ **/
+typedef struct {
+    uint32_t seg[DEV_SPI_SEG_MAX / 4];
+    spi_transaction_t trans;
+    uint8_t dc;
+    void *arg;
+} DEV_SPI_Trans;
+
+static spi_device_handle_t lcd_spi = NULL;
+static DEV_DMA_ATTR DEV_SPI_Trans spi_pool[DEV_SPI_QUEUE_SIZE];
+static uint32_t spi_head = 0;
+static uint32_t spi_inflight = 0;
+
+static void IRAM_ATTR DEV_SPI_Pre_Transfer(spi_transaction_t *t)
+{
+    DEV_SPI_Trans *q = (DEV_SPI_Trans *)t->user;
+    if (q != NULL) {
+        gpio_set_level((gpio_num_t)LCD_DC_PIN, q->dc);
+    }
+}
+
+static void IRAM_ATTR DEV_SPI_Post_Transfer(spi_transaction_t *t)
+{
+    DEV_SPI_Trans *q = (DEV_SPI_Trans *)t->user;
+    if (q != NULL && q->arg != NULL && spi_done_cb != NULL) {
+        spi_done_cb(q->arg);
+    }
+}
+
+static void DEV_SPI_Reclaim(void)
+{
+    spi_transaction_t *done;
+    spi_device_get_trans_result(lcd_spi, &done, portMAX_DELAY);
+    spi_inflight--;
+}
+#endif
+
 /**
  * GPIO read and write
  **/
 void DEV_Digital_Write(uint16_t Pin, uint8_t Value)
 {
+    // DC must not move while queued pixel data is still on the bus
+    if (Pin == LCD_DC_PIN) {
+        DEV_SPI_Wait_Idle();
+    }
     digitalWrite(Pin, Value);
 }
 
@@ -48,12 +101,161 @@ uint8_t DEV_Digital_Read(uint16_t Pin)
  **/
 void DEV_SPI_WriteByte(uint8_t Value)
 {
+#if DEV_SPI_DMA
+    spi_transaction_t t = {};
+    DEV_SPI_Wait_Idle();
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 8;
+    t.tx_data[0] = Value;
+    spi_device_polling_transmit(lcd_spi, &t);
+#else
     vspi->transfer(Value);
+#endif
 }
 
 void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
 {
+#if DEV_SPI_DMA
+    spi_transaction_t t = {};
+    DEV_SPI_Wait_Idle();
+    while (Len > 0) {
+        uint32_t n = Len > DEV_SPI_MAX_TRANSFER ? DEV_SPI_MAX_TRANSFER : Len;
+        t.length = n * 8;
+        t.tx_buffer = pData;
+        spi_device_polling_transmit(lcd_spi, &t);
+        pData += n;
+        Len -= n;
+    }
+#else
      vspi->transfer(pData, Len);
+#endif
+}
+
+/******************************************************************************
+function:	Queue a write without waiting for it to reach the bus
+parameter:
+    pData : data to send, must stay valid until the transfer completes
+    Len   : number of bytes
+    Dc    : level of LCD_DC_PIN while the bytes are clocked out
+    Arg   : if not NULL, passed to the done callback once the bytes are out
+Info:
+    Up to 4 bytes are copied into the transaction, so command parameters
+    may live on the caller's stack.
+******************************************************************************/
+void DEV_SPI_Queue_nByte(const uint8_t *pData, uint32_t Len, uint8_t Dc, void *Arg)
+{
+#if DEV_SPI_DMA
+    while (Len > 0) {
+        uint32_t n = Len > DEV_SPI_MAX_TRANSFER ? DEV_SPI_MAX_TRANSFER : Len;
+        if (spi_inflight >= DEV_SPI_QUEUE_SIZE) {
+            DEV_SPI_Reclaim();
+        }
+
+        DEV_SPI_Trans *q = &spi_pool[spi_head];
+        spi_head = (spi_head + 1) % DEV_SPI_QUEUE_SIZE;
+        memset(&q->trans, 0, sizeof(q->trans));
+        q->dc = Dc;
+        q->arg = (n == Len) ? Arg : NULL;
+        q->trans.user = q;
+        q->trans.length = n * 8;
+        if (n <= 4) {
+            q->trans.flags = SPI_TRANS_USE_TXDATA;
+            memcpy(q->trans.tx_data, pData, n);
+        } else {
+            q->trans.tx_buffer = pData;
+        }
+        spi_device_queue_trans(lcd_spi, &q->trans, portMAX_DELAY);
+        spi_inflight++;
+
+        pData += n;
+        Len -= n;
+    }
+#else
+    digitalWrite(LCD_DC_PIN, Dc);
+    vspi->writeBytes(pData, Len);
+    if (Arg != NULL && spi_done_cb != NULL) {
+        spi_done_cb(Arg);
+    }
+#endif
+}
+
+/******************************************************************************
+function:	Queue a run of short command/parameter segments in one go
+parameter:
+    pData : segment bytes back to back
+    pSeg  : one descriptor per segment, DEV_SPI_SEG_DC | length
+    Count : number of segments
+Info:
+    Every segment is one transaction with its DC level, so a window
+    (CASET + 4, RASET + 4, RAMWR) is five: DC is a GPIO set between
+    transactions. The bytes are copied into the transactions, inline up
+    to 4 and into the slot's DMA buffer up to DEV_SPI_SEG_MAX (longer
+    segments are split), so pData can be reused as soon as this returns.
+******************************************************************************/
+void DEV_SPI_Queue_Seq(const uint8_t *pData, const uint8_t *pSeg, uint8_t Count)
+{
+#if DEV_SPI_DMA
+    for (uint8_t i = 0; i < Count; i++) {
+        uint8_t Dc = (pSeg[i] & DEV_SPI_SEG_DC) ? 1 : 0;
+        uint32_t Len = pSeg[i] & DEV_SPI_SEG_LEN;
+        while (Len > 0) {
+            uint32_t n = Len > DEV_SPI_SEG_MAX ? DEV_SPI_SEG_MAX : Len;
+            if (spi_inflight >= DEV_SPI_QUEUE_SIZE) {
+                DEV_SPI_Reclaim();
+            }
+
+            // The slot's buffer is free again: its transaction was reclaimed
+            DEV_SPI_Trans *q = &spi_pool[spi_head];
+            spi_head = (spi_head + 1) % DEV_SPI_QUEUE_SIZE;
+            memset(&q->trans, 0, sizeof(q->trans));
+            q->dc = Dc;
+            q->arg = NULL;
+            q->trans.user = q;
+            q->trans.length = n * 8;
+            if (n <= 4) {
+                q->trans.flags = SPI_TRANS_USE_TXDATA;
+                memcpy(q->trans.tx_data, pData, n);
+            } else {
+                memcpy(q->seg, pData, n);
+                q->trans.tx_buffer = q->seg;
+            }
+            spi_device_queue_trans(lcd_spi, &q->trans, portMAX_DELAY);
+            spi_inflight++;
+
+            pData += n;
+            Len -= n;
+        }
+    }
+#else
+    for (uint8_t i = 0; i < Count; i++) {
+        uint32_t Len = pSeg[i] & DEV_SPI_SEG_LEN;
+        digitalWrite(LCD_DC_PIN, (pSeg[i] & DEV_SPI_SEG_DC) ? 1 : 0);
+        vspi->writeBytes(pData, Len);
+        pData += Len;
+    }
+#endif
+}
+
+/******************************************************************************
+function:	Block until every queued write has left the bus
+******************************************************************************/
+void DEV_SPI_Wait_Idle(void)
+{
+#if DEV_SPI_DMA
+    while (spi_inflight > 0) {
+        DEV_SPI_Reclaim();
+    }
+#endif
+}
+
+/******************************************************************************
+function:	Register the function called when a queued write with Arg finishes
+Info:
+    With DEV_SPI_DMA the callback runs in interrupt context.
+******************************************************************************/
+void DEV_SPI_Set_Done_Callback(DEV_SPI_Done_Callback Callback)
+{
+    spi_done_cb = Callback;
 }
 
 /**
@@ -132,6 +334,37 @@ void DEV_I2C_Read_nByte(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len)
     Wire.endTransmission();
 }
 
+/******************************************************************************
+function:	Read or write Len bytes from Reg on, for I2C_Bus
+return:
+    0 on success, 1 if the device did not answer or sent less
+Info:
+    Reads stop after the register like DEV_I2C_Read_nByte. Len must fit
+    the Wire buffer, I2C_Bus keeps reads to I2C_BUS_CHUNK bytes.
+******************************************************************************/
+uint8_t DEV_I2C_Transfer(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len, uint8_t Write)
+{
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    if (Write) {
+        Wire.write(pData, Len);
+        return Wire.endTransmission() != 0;
+    }
+    if (Wire.endTransmission() != 0)
+        return 1;
+    if (Wire.requestFrom(addr, (size_t)Len) != Len)
+        return 1;
+    for (uint32_t i = 0; i < Len; i++) {
+        pData[i] = Wire.read();
+    }
+    return 0;
+}
+
+void DEV_I2C_Set_Clock(uint32_t Hz)
+{
+    Wire.setClock(Hz);
+}
+
 uint16_t DEC_ADC_Read(void)
 {
   return analogReadMilliVolts(BAT_ADC_PIN);
@@ -177,6 +410,64 @@ void DEV_SET_PWM(uint8_t Value)
     }
 }
 
+/******************************************************************************
+function:	Start a thread
+parameter:
+    Func : thread body, must not return
+    Arg  : passed to Func
+    Core : CPU it runs on, 0 shares with WiFi, 1 runs loop()
+Info:
+    Returns 0 on success
+******************************************************************************/
+uint8_t DEV_Thread_Create(DEV_Thread_Func Func, void *Arg, uint8_t Core)
+{
+    return DEV_Thread_Create_Priority(Func, Arg, Core, DEV_THREAD_PRIORITY);
+}
+
+/******************************************************************************
+function:	Start a thread with another FreeRTOS priority
+parameter:
+    Priority : DEV_THREAD_PRIORITY_IO for a thread that must run as soon
+               as it is woken, e.g. to read a device
+******************************************************************************/
+uint8_t DEV_Thread_Create_Priority(DEV_Thread_Func Func, void *Arg, uint8_t Core, uint8_t Priority)
+{
+    TaskHandle_t task = NULL;
+    if (xTaskCreatePinnedToCore(Func, "dev_thread", DEV_THREAD_STACK, Arg,
+                                Priority, &task, Core) != pdPASS) {
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	Counting semaphore, NULL if out of memory
+parameter:
+    Initial : count it starts with
+******************************************************************************/
+DEV_Sem DEV_Sem_Create(uint32_t Initial)
+{
+    return (DEV_Sem)xSemaphoreCreateCounting(0xFFFF, Initial);
+}
+
+void DEV_Sem_Give(DEV_Sem Sem)
+{
+    xSemaphoreGive((SemaphoreHandle_t)Sem);
+}
+
+// From an interrupt; a woken thread of higher priority runs when it returns
+void IRAM_ATTR DEV_Sem_Give_ISR(DEV_Sem Sem)
+{
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR((SemaphoreHandle_t)Sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void DEV_Sem_Take(DEV_Sem Sem)
+{
+    xSemaphoreTake((SemaphoreHandle_t)Sem, portMAX_DELAY);
+}
+
 /**
  * delay x ms
  **/
@@ -190,6 +481,12 @@ void DEV_Delay_us(uint32_t xus)
     delayMicroseconds(xus);
 }
 
+// Microseconds since boot, wrapping; also called from interrupts
+uint32_t IRAM_ATTR DEV_Micros(void)
+{
+    return micros();
+}
+
 void DEV_GPIO_Init(void)
 {
 
@@ -222,10 +519,38 @@ uint8_t DEV_Module_Init(void)
     // GPIO Config
     DEV_GPIO_Init();
     // SPI Config
+#if DEV_SPI_DMA
+    // CS stays under GPIO control, LCD_1IN28_Reset() holds it low
+    spi_bus_config_t buscfg = {};
+    buscfg.mosi_io_num = LCD_MOSI_PIN;
+    buscfg.miso_io_num = -1;
+    buscfg.sclk_io_num = LCD_CLK_PIN;
+    buscfg.quadwp_io_num = -1;
+    buscfg.quadhd_io_num = -1;
+    buscfg.max_transfer_sz = DEV_SPI_MAX_TRANSFER;
+    if (spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK) {
+        printf("DEV_Module_Init SPI bus Fail \r\n");
+        return 1;
+    }
+
+    spi_device_interface_config_t devcfg = {};
+    devcfg.mode = 0;
+    devcfg.clock_speed_hz = DEV_SPI_FREQ_HZ;
+    devcfg.spics_io_num = -1;
+    devcfg.flags = SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_NO_DUMMY;
+    devcfg.queue_size = DEV_SPI_QUEUE_SIZE;
+    devcfg.pre_cb = DEV_SPI_Pre_Transfer;
+    devcfg.post_cb = DEV_SPI_Post_Transfer;
+    if (spi_bus_add_device(SPI2_HOST, &devcfg, &lcd_spi) != ESP_OK) {
+        printf("DEV_Module_Init SPI device Fail \r\n");
+        return 1;
+    }
+#else
     vspi = new SPIClass(VSPI);
     vspi->begin(LCD_CLK_PIN, LCD_MISO_PIN, LCD_MOSI_PIN, LCD_CS_PIN); //SCLK, MISO, MOSI, SS
     pinMode(vspi->pinSS(), OUTPUT); //VSPI SS
-    vspi->beginTransaction(SPISettings(80000000, MSBFIRST, SPI_MODE0));
+    vspi->beginTransaction(SPISettings(DEV_SPI_FREQ_HZ, MSBFIRST, SPI_MODE0));
+#endif
     
     // I2C Config
     Wire.setPins(DEV_SDA_PIN, DEV_SCL_PIN);
@@ -242,6 +567,13 @@ Info:
 ******************************************************************************/
 void DEV_Module_Exit(void)
 {
+#if DEV_SPI_DMA
+  DEV_SPI_Wait_Idle();
+  spi_bus_remove_device(lcd_spi);
+  spi_bus_free(SPI2_HOST);
+  lcd_spi = NULL;
+#else
   vspi->end();
+#endif
   Wire.end();
 }
@@ -31,9 +31,22 @@
 
 #include "stdio.h"
 
+// DEV_HOST builds the drivers on a PC against host/DEV_Config_host.cpp,
+// which records the SPI traffic into a mock GC9A01 instead of a bus
+#ifdef DEV_HOST
+#include <stdint.h>
+#include <string.h>
+#define DEV_DMA_ATTR
+#define DEV_ISR_ATTR
+#else
 #include <Arduino.h>
 #include <SPI.h>
 #include <Wire.h>
+// Static buffers the SPI DMA reads from directly
+#define DEV_DMA_ATTR DMA_ATTR
+// Functions called from interrupts
+#define DEV_ISR_ATTR IRAM_ATTR
+#endif
 #include "Debug.h"
 /**
  * data
@@ -67,9 +80,58 @@
 #define Touch_INT_PIN   (5)
 #define Touch_RST_PIN   (13)
 
+#define IMU_INT1_PIN    (4)
+#define IMU_INT2_PIN    (3)
+
 #define BAT_ADC_PIN     (1)
 // #define BAR_CHANNEL     (A3)
 
+/**
+ * SPI config
+ * DEV_SPI_DMA = 1 drives the LCD through the ESP-IDF spi_master driver so
+ * pixel data can be queued and sent by DMA in the background.
+ * DEV_SPI_DMA = 0 keeps the blocking SPIClass path; queued writes are then
+ * sent immediately and complete before DEV_SPI_Queue_nByte returns.
+ **/
+#define DEV_SPI_DMA             1
+#define DEV_SPI_FREQ_HZ         (80000000)
+#define DEV_SPI_QUEUE_SIZE      (16)
+#define DEV_SPI_MAX_TRANSFER    (32768)     // bytes per DMA transaction
+
+// DEV_SPI_Queue_Seq segment descriptor: DC level in the top bit, length below
+#define DEV_SPI_SEG_DC          0x80
+#define DEV_SPI_SEG_LEN         0x7F
+// Bytes a queued segment carries with it, one transaction each; longer
+// segments are split
+#define DEV_SPI_SEG_MAX         (32)
+
+typedef void (*DEV_SPI_Done_Callback)(void *Arg);
+
+/**
+ * Threads
+ * Worker threads and counting semaphores: FreeRTOS tasks pinned to a core
+ * on the board, pthreads on the host. Threads never return.
+ **/
+#define DEV_THREAD_STACK        (4096)
+#define DEV_THREAD_PRIORITY     (1)         // the same as the Arduino loop task
+#define DEV_THREAD_PRIORITY_IO  (2)         // short device reads that preempt loop() and other tasks
+
+typedef void (*DEV_Thread_Func)(void *Arg);
+typedef void *DEV_Sem;
+
+// Counters only one thread (or interrupt) stores and others read: the
+// owner counts with DEV_Count(), the others load with DEV_Count_Since()
+// and reset by keeping the count as a base instead of storing a zero
+static inline void DEV_ISR_ATTR DEV_Count(UDOUBLE *Counter, UDOUBLE N)
+{
+    __atomic_store_n(Counter, *Counter + N, __ATOMIC_RELAXED);
+}
+
+static inline UDOUBLE DEV_Count_Since(UDOUBLE *Counter, UDOUBLE Base)
+{
+    return __atomic_load_n(Counter, __ATOMIC_RELAXED) - Base;
+}
+
 /*------------------------------------------------------------------------------------------------------*/
 
 void DEV_Digital_Write(uint16_t Pin, uint8_t Value);
@@ -85,8 +147,21 @@ uint16_t DEC_ADC_Read(void);
 void DEV_SPI_WriteByte(uint8_t Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 
+void DEV_SPI_Queue_nByte(const uint8_t *pData, uint32_t Len, uint8_t Dc, void *Arg);
+void DEV_SPI_Queue_Seq(const uint8_t *pData, const uint8_t *pSeg, uint8_t Count);
+void DEV_SPI_Wait_Idle(void);
+void DEV_SPI_Set_Done_Callback(DEV_SPI_Done_Callback Callback);
+
+uint8_t DEV_Thread_Create(DEV_Thread_Func Func, void *Arg, uint8_t Core);
+uint8_t DEV_Thread_Create_Priority(DEV_Thread_Func Func, void *Arg, uint8_t Core, uint8_t Priority);
+DEV_Sem DEV_Sem_Create(uint32_t Initial);
+void DEV_Sem_Give(DEV_Sem Sem);
+void DEV_Sem_Give_ISR(DEV_Sem Sem);
+void DEV_Sem_Take(DEV_Sem Sem);
+
 void DEV_Delay_ms(uint32_t xms);
 void DEV_Delay_us(uint32_t xus);
+uint32_t DEV_Micros(void);
 
 void DEV_I2C_Write_Byte(uint8_t addr, uint8_t reg, uint8_t Value);
 void DEV_I2C_Write_nByte(uint8_t addr, uint8_t *pData, uint32_t Len);
@@ -95,6 +170,16 @@ void DEV_I2C_Write_Register(uint8_t addr,uint8_t reg, uint16_t value);
 uint8_t DEV_I2C_Read_Byte(uint8_t addr, uint8_t reg);
 void DEV_I2C_Read_Register(uint8_t addr,uint8_t reg, uint16_t *value);
 void DEV_I2C_Read_nByte(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len);
+uint8_t DEV_I2C_Transfer(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len, uint8_t Write);
+void DEV_I2C_Set_Clock(uint32_t Hz);
+
+#ifdef DEV_HOST
+// Host: a simulated device answers at Addr. Func reads or writes Len bytes
+// from Reg on and returns 0, or 1 to not acknowledge; Max_Hz is the fastest
+// clock it takes, faster transfers to it fail
+typedef uint8_t (*DEV_I2C_Sim_Func)(uint8_t Reg, uint8_t *pData, uint32_t Len, uint8_t Write, void *Arg);
+void DEV_I2C_Sim_Attach(uint8_t Addr, DEV_I2C_Sim_Func Func, void *Arg, uint32_t Max_Hz);
+#endif
 
 void DEV_SET_PWM(uint8_t Value);
 
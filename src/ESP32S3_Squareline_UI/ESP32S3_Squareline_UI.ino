@@ -4,6 +4,15 @@
 #include "LCD_1in28.h"
 #include "DEV_Config.h"
 #include "CST816S.h"
+#include "UI_Binding.h"
+#include "Area_Coalesce.h"
+#include "UI_Screens.h"
+#include "UI_Transition.h"
+#include "Touch_Reader.h"
+#include "I2C_Bus.h"
+#include "IMU_Fifo.h"
+#include "Step_Counter.h"
+#include "Render_Worker.h"
 #include "ui.h"  // SquareLine Studio UI
 #include <WiFi.h>
 #include <WiFiMulti.h>  // Required by MicroSui library
@@ -15,7 +24,87 @@
 // WiFiMulti object is defined in MicroSui library, just declare it here
 extern WiFiMulti WiFiMulti;
 
-#define EXAMPLE_LVGL_TICK_PERIOD_MS    2
+// Print display bus overhead (setup vs pixel bytes) and the UI, DRAW, HEAP,
+// TOUCH, I2C and IMU counters every N ms, one prefix per subsystem, 0 = off
+#define LCD_STATS_INTERVAL_MS          0
+
+// Dirty area coalescing: one window costs its setup bytes plus about 16
+// bytes of bus time for each of its ~6 queued transactions
+#define COALESCE_WINDOW_COST           (LCD_1IN28_WINDOW_SETUP + 6 * 16)
+// Print the dirty areas of every refresh before coalescing as an "AREAS:"
+// line, for host/coalesce_check -f. 0 = off
+#define COALESCE_TRACE                 0
+
+// Pixel format on the LCD bus. LCD_1IN28_COLOR_444 sends 12 bit pixels,
+// a quarter fewer bytes per frame for 4 instead of 5/6 bits per channel
+#define LCD_COLOR_MODE                 LCD_1IN28_COLOR_565
+
+// Dirty areas of at least this many pixels that LVGL would paint in one
+// solid color go straight to the LCD fill path without rendering, 0 = off
+#define LCD_FILL_MIN_AREA              (240 * 8)
+
+// Full frame direct mode: LVGL renders into two 240x240 framebuffers in
+// PSRAM and only the pixels that differ from the frame on the panel go
+// out. 0 = partial mode, LVGL renders the dirty areas into the small draw
+// buffers below. Falls back to partial mode if the PSRAM is missing
+#define LCD_DIRECT_MODE                0
+
+// Render workers on core 0 (loop() runs on core 1): LVGL draws every
+// refreshed part in horizontal stripes, the workers draw all but the first
+// and the flush waits for them. Needs LV_USE_REFR_STRIPES 1, 0 = off
+#define LCD_RENDER_WORKERS             0
+
+// Refresh governor: loop() sleeps until the next LVGL timer or app task is
+// due, or until a touch interrupt. Display refresh period while something
+// animates or a screen is being loaded, and otherwise. With nothing
+// invalidated LVGL does not refresh at all
+#define REFR_ANIM_PERIOD_MS            16
+#define REFR_IDLE_PERIOD_MS            33
+// Longest sleep when nothing is due
+#define REFR_MAX_SLEEP_MS              500
+// Touch polling stops this long after the last touch, the interrupt restarts it
+#define TOUCH_IDLE_MS                  100
+// Touch reads on a task of their own on core 0, woken by the touch interrupt;
+// loop() only takes the samples from a queue. 0 = loop() reads the controller.
+// The finger counts as lifted after TOUCH_RELEASE_MS without a sample
+#define TOUCH_READER_TASK              1
+#define TOUCH_RELEASE_MS               30
+// Screen swipes from the CST816S's own gesture recognition (needs the reader
+// task and LV_USE_INDEV_HW_GESTURE): LV_INDEV_GESTURE_HW_SW takes the
+// controller's swipes and long presses and, while the controller has reported
+// none, sends LVGL's as soon as it detects one; the first one sent wins.
+// LV_INDEV_GESTURE_HW only the controller's, LV_INDEV_GESTURE_SW only LVGL's
+#define TOUCH_GESTURE_SRC              LV_INDEV_GESTURE_HW_SW
+// The touch controller and the IMU share the I2C bus through a task of its
+// own on core 0: touch reads go before the IMU's, whose long reads go out in
+// chunks, so a touch waits for one chunk at most. 0 = callers use the bus themselves
+#define I2C_BUS_TASK                   1
+// Clock per device, up to I2C_BUS_FAST_PLUS_HZ for devices rated for
+// Fast-mode Plus; the CST816S and the QMI8658's I2C are rated for 400 kHz
+#define TOUCH_I2C_HZ                   I2C_BUS_DEFAULT_HZ
+#define IMU_I2C_HZ                     I2C_BUS_DEFAULT_HZ
+// The QMI8658 samples into its FIFO at IMU_FIFO_ODR and a task of its own on
+// core 0 reads it in one burst per watermark interrupt (INT2); loop() takes
+// the samples in blocks. 0 = loop() reads one sample every 50 ms.
+// Without a block for IMU_FIFO_POLL_MS the FIFO is read without the interrupt
+#define IMU_FIFO                       1
+#define IMU_FIFO_POLL_MS               1000
+// Without the FIFO loop() reads one sample every STEP_POLL_MS for the step
+// counter, at QMI8658_init()'s 8 g range
+#define STEP_POLL_MS                   50
+#define STEP_POLL_LSB_PER_G            4096
+// Print loop wakeups and frames rendered/skipped every N ms, 0 = off
+#define REFR_STATS_INTERVAL_MS         0
+
+// LVGL heap the SquareLine screens may keep built (all five take ~16 KB of
+// the tiered heap in lv_conf.h). Screens other than Screen1 are built on first
+// use or while idle, and the longest unused ones are deleted when they would not fit
+#define UI_SCREENS_BUDGET              (20 * 1024)
+
+// Screen changes animate two snapshots of the screens instead of drawing
+// both screens again every frame; 2 x 113 KB in PSRAM. 0 = always live.
+// A screen with an animation of its own is drawn live either way
+#define UI_SNAPSHOT_TRANSITIONS        1
 
 // WiFi Configuration - Can be updated from Screen4
 char WIFI_SSID[33] = "XuanHop_2.4G";  // Max 32 chars + null terminator
@@ -44,14 +133,36 @@ const char* TRANSACTION_BYTES = "000002000840420f00000000000020b0bd39aa7e029a1c6
 static const uint16_t screenWidth  = 240;
 static const uint16_t screenHeight = 240;
 
+// Two draw buffers in DMA-capable RAM: LVGL renders into one while the
+// other is still being clocked out to the panel. In direct mode they are
+// the staging buffers the changed pixels are copied through instead
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[ screenWidth * screenHeight / 10 ];
+static DMA_ATTR lv_color_t buf1[ screenWidth * screenHeight / 10 ];
+static DMA_ATTR lv_color_t buf2[ screenWidth * screenHeight / 10 ];
 
-CST816S touch(6, 7, 13, 5);  // sda, scl, rst, irq
+// Small flushes are copied here and sent together at the end of a refresh
+static DMA_ATTR UWORD batch_buf[ screenWidth * 16 ];
+
+// Dirty areas sent as solid fills instead of being rendered
+static uint32_t fill_areas = 0;
+static uint32_t fill_pixels = 0;
 
-// Buffer for custom LCD driver (allocated in PSRAM)
-// This is required by LCD_1in28.cpp
-UWORD *BlackImage = NULL;
+#if LCD_DIRECT_MODE
+// Columns [start, end) of each row LVGL redrew since the last frame
+static UWORD diff_row_start[ screenHeight ];
+static UWORD diff_row_end[ screenHeight ];
+#endif
+// Refresh governor counters: loop() wakeups, refresh timer runs that
+// rendered something and runs left with nothing to render
+static uint32_t refr_wakeups = 0;
+static uint32_t refr_frames = 0;
+static uint32_t refr_skipped = 0;
+static uint32_t refr_sleep_ms = 0;
+
+CST816S touch(6, 7, 13, 5);  // sda, scl, rst, irq
+#if TOUCH_READER_TASK
+static bool touch_reader = false;    // samples come from Touch_Reader
+#endif
 
 // Countdown timer variables
 int countdown_value = 60;
@@ -63,6 +174,14 @@ unsigned long last_balance_update = 0;
 const unsigned long balance_update_interval = 30000; // 30 seconds
 String current_balance = "0";
 
+// Values shown on the SquareLine widgets, set from any task and flushed
+// once per frame at the top of loop()
+static UI_BINDING *bind_balance = NULL;
+static UI_BINDING *bind_time = NULL;
+static UI_BINDING *bind_time_arc = NULL;
+static UI_BINDING *bind_steps = NULL;
+static UI_BINDING *bind_steps_arc = NULL;
+
 // SUI Client and Keypair
 MicroSuiClient suiClient;
 MicroSuiEd25519 suiKeypair;
@@ -82,12 +201,9 @@ lv_obj_t * statusMessage = NULL;
 
 // Step counter variables
 int stepCount = 0;
-float lastAccMagnitude = 0;
-bool stepDetected = false;
-unsigned long lastStepTime = 0;
-const unsigned long stepCooldown = 300; // 300ms between steps
-const float stepThreshold = 0.8; // g-force threshold for step detection
+static STEP_COUNTER step_counter;   // raw samples in, at the rate of the IMU mode
 bool imuInitialized = false;
+static bool imu_fifo = false;
 
 #if LV_USE_LOG != 0
 /* Serial debugging */
@@ -101,45 +217,581 @@ void my_print(const char * buf)
 /* Display flushing using custom LCD driver */
 void my_disp_flush( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p )
 {
-    uint32_t w = ( area->x2 - area->x1 + 1 );
-    uint32_t h = ( area->y2 - area->y1 + 1 );
-
-    // Copy LVGL buffer to BlackImage at correct position (full-screen buffer layout)
-    // BlackImage is 240x240, copy the dirty region into it
-    uint16_t *src = (uint16_t *)&color_p->full;
-
-    for(uint32_t row = 0; row < h; row++) {
-        uint32_t y = area->y1 + row;
-        uint32_t dst_offset = area->x1 + y * 240;  // BlackImage is 240 width
-        uint16_t *src_row = &src[row * w];
-
-        // Copy and swap bytes for this row
-        for(uint32_t col = 0; col < w; col++) {
-            uint16_t color = src_row[col];
-            BlackImage[dst_offset + col] = (color >> 8) | (color << 8);
+    uint16_t *px = (uint16_t *)&color_p->full;
+
+#if LCD_DIRECT_MODE
+    if ( disp_drv->direct_mode ) {
+        // area and color_p are the whole frame. Once the last area is drawn
+        // send what differs from the frame on the panel, still in the other
+        // buffer, in the rows diff_mark_areas noted
+        if ( !lv_disp_flush_is_last( disp_drv ) ) {
+            lv_disp_flush_ready( disp_drv );
+            return;
+        }
+
+        lv_disp_draw_buf_t *db = disp_drv->draw_buf;
+        const UWORD *front = (const UWORD *)( color_p == db->buf1 ? db->buf2 : db->buf1 );
+        UWORD n = LCD_1IN28_DisplayDiff_Async( front, px, diff_row_start, diff_row_end, disp_drv );
+        memset( diff_row_end, 0, sizeof( diff_row_end ) );
+        if ( n == 0 ) lv_disp_flush_ready( disp_drv );
+        return;
+    }
+#endif
+
+    // The GC9A01 wants big-endian RGB565. With LV_COLOR_16_SWAP (the
+    // SquareLine project's "16 bit swap") LVGL renders it that way and the
+    // pixels go out untouched. An export without the swap still works: the
+    // driver then swaps the bytes while it copies or compacts the area
+    // anyway, or in place, LVGL does not read the buffer again once it has
+    // been handed to flush
+
+    // Small areas are copied into the batch and the buffer goes back to
+    // LVGL right away; the whole batch is queued with the last area of the
+    // refresh. LVGL waits for that flush before the next one, so the batch
+    // buffer is free again by then. LVGL area is inclusive, the driver
+    // expects exclusive
+    if ( LCD_1IN28_Batch_Add(area->x1, area->y1, area->x2 + 1, area->y2 + 1, px) ) {
+        if ( !lv_disp_flush_is_last( disp_drv ) || !LCD_1IN28_Batch_Submit( disp_drv ) ) {
+            lv_disp_flush_ready( disp_drv );
         }
+        return;
     }
 
-    // Use original LCD_1IN28_DisplayWindows function
-    // Note: LVGL area is inclusive (x2, y2 are last pixels)
-    // But DisplayWindows expects exclusive end (so +1)
-    LCD_1IN28_DisplayWindows(area->x1, area->y1, area->x2 + 1, area->y2 + 1, BlackImage);
+    // Too big to copy: what is batched goes first, then this area is
+    // queued straight from the draw buffer, the DMA done callback releases it
+    LCD_1IN28_Batch_Submit( NULL );
+#if LCD_1IN28_ROUND
+    // Only the part inside the circle goes out; nothing visible means no
+    // DMA and so no done callback
+    if ( LCD_1IN28_DisplayWindows_Round_Async(area->x1, area->y1, area->x2 + 1, area->y2 + 1, px, disp_drv) == 0 ) {
+        lv_disp_flush_ready( disp_drv );
+    }
+#else
+    LCD_1IN28_DisplayWindows_Async(area->x1, area->y1, area->x2 + 1, area->y2 + 1, px, disp_drv);
+#endif
+}
 
-    lv_disp_flush_ready( disp_drv );
+#if LCD_DIRECT_MODE
+/* Note the columns of each row the dirty areas cover, the frame diff only
+ * compares those */
+static void diff_mark_areas( lv_disp_t *disp )
+{
+    for ( uint16_t i = 0; i < disp->inv_p; i++ ) {
+        const lv_area_t *a = &disp->inv_areas[i];
+        for ( lv_coord_t y = a->y1; y <= a->y2; y++ ) {
+            if ( diff_row_start[y] >= diff_row_end[y] ) {
+                diff_row_start[y] = a->x1;
+                diff_row_end[y] = a->x2 + 1;
+            } else {
+                diff_row_start[y] = LV_MIN( diff_row_start[y], (UWORD)a->x1 );
+                diff_row_end[y] = LV_MAX( diff_row_end[y], (UWORD)( a->x2 + 1 ) );
+            }
+        }
+    }
+}
+#endif
+
+/* Called from the SPI interrupt once the last pixel of a flush is out */
+void my_disp_flush_done( void *arg )
+{
+    lv_disp_flush_ready( (lv_disp_drv_t *)arg );
 }
 
-void example_increase_lvgl_tick(void *arg)
+#if LCD_1IN28_ROUND
+/* Shrink an area to the bounding box of its part inside the circle.
+ * Returns false if none of it is visible */
+static bool round_clip_area( lv_area_t *area )
+{
+    lv_coord_t x1 = LV_COORD_MAX, x2 = -1, y1 = -1, y2 = -1;
+
+    for ( lv_coord_t y = area->y1; y <= area->y2; y++ ) {
+        UWORD xs, xe;
+        LCD_1IN28_GetSpan( y, &xs, &xe );
+        lv_coord_t s = LV_MAX( area->x1, (lv_coord_t)xs );
+        lv_coord_t e = LV_MIN( area->x2, (lv_coord_t)xe - 1 );
+        if ( s > e ) continue;
+        if ( y1 < 0 ) y1 = y;
+        y2 = y;
+        x1 = LV_MIN( x1, s );
+        x2 = LV_MAX( x2, e );
+    }
+    if ( y1 < 0 ) return false;
+
+    lv_area_set( area, x1, y1, x2, y2 );
+    return true;
+}
+
+/* Cut a clipped area into bands that each fit the draw buffer in one go,
+ * every band only as wide as the circle is over its rows. LVGL would cut
+ * it into full width stripes otherwise and render the corners of each.
+ * Returns the number of bands, 0 if they don't fit in `max` */
+static uint16_t round_split_area( const lv_area_t *area, uint32_t buf_px, lv_area_t *out, uint16_t max )
+{
+    uint16_t n = 0;
+    lv_coord_t y = area->y1;
+
+    while ( y <= area->y2 ) {
+        lv_area_t band;
+        band.x1 = LV_COORD_MAX;
+        band.x2 = -1;
+        band.y1 = y;
+
+        // The area is clipped already and the circle is convex, so every
+        // row in it has a visible span
+        for ( ; y <= area->y2; y++ ) {
+            UWORD xs, xe;
+            LCD_1IN28_GetSpan( y, &xs, &xe );
+            lv_coord_t nx1 = LV_MIN( band.x1, LV_MAX( area->x1, (lv_coord_t)xs ) );
+            lv_coord_t nx2 = LV_MAX( band.x2, LV_MIN( area->x2, (lv_coord_t)xe - 1 ) );
+            if ( y > band.y1 && (uint32_t)(nx2 - nx1 + 1) * (y - band.y1 + 1) > buf_px ) break;
+            band.x1 = nx1;
+            band.x2 = nx2;
+        }
+        band.y2 = y - 1;
+
+        if ( n == max ) return 0;
+        out[n++] = band;
+    }
+    return n;
+}
+
+/* Trim the dirty areas to the glass so the invisible corners are never drawn */
+static void round_trim_areas( lv_disp_t *disp )
+{
+    uint32_t buf_px = disp->driver->draw_buf->size;
+    lv_area_t areas[LV_INV_BUF_SIZE];
+    uint16_t n = 0;
+
+    for ( uint16_t i = 0; i < disp->inv_p; i++ ) {
+        lv_area_t a = disp->inv_areas[i];
+        if ( !round_clip_area( &a ) ) continue;
+
+        // Keep a slot for each area still to come
+        uint16_t room = LV_INV_BUF_SIZE - n - (disp->inv_p - i - 1);
+        uint16_t bands = disp->driver->direct_mode ? 0 : round_split_area( &a, buf_px, &areas[n], room );
+        if ( bands == 0 ) areas[n++] = a;
+        else n += bands;
+    }
+
+    lv_memcpy_small( disp->inv_areas, areas, n * sizeof( lv_area_t ) );
+    disp->inv_p = n;
+}
+#endif
+
+#if LCD_FILL_MIN_AREA
+/* Does obj, or anything it draws outside itself, reach into area? */
+static bool fill_obj_touches( lv_obj_t *obj, const lv_area_t *area )
+{
+    if ( lv_obj_has_flag( obj, LV_OBJ_FLAG_HIDDEN ) ) return false;
+
+    lv_area_t a = obj->coords;
+    lv_coord_t ext = _lv_obj_get_ext_draw_size( obj );
+    lv_area_increase( &a, ext, ext );
+    return _lv_area_is_on( &a, area );
+}
+
+/* The object LVGL would draw last over the whole area: descend into the
+ * topmost child that reaches into it as long as that child holds all of
+ * it. NULL if something only partly over the area is drawn on top */
+static lv_obj_t *fill_find_top( lv_obj_t *obj, const lv_area_t *area )
+{
+    if ( !_lv_area_is_in( area, &obj->coords, 0 ) ) return NULL;
+
+    for ( int32_t i = (int32_t)lv_obj_get_child_cnt( obj ) - 1; i >= 0; i-- ) {
+        lv_obj_t *child = lv_obj_get_child( obj, i );
+        if ( fill_obj_touches( child, area ) ) return fill_find_top( child, area );
+    }
+    return obj;
+}
+
+/* Would obj paint the area in its plain background color and nothing
+ * else? Only the base object class qualifies (screens, panels), anything
+ * that draws its own content or goes through a layer does not */
+static bool fill_obj_is_plain( lv_obj_t *obj, const lv_area_t *area )
+{
+    if ( lv_obj_get_class( obj ) != &lv_obj_class ) return false;
+    if ( lv_obj_get_style_bg_grad_dir( obj, LV_PART_MAIN ) != LV_GRAD_DIR_NONE ) return false;
+    if ( lv_obj_get_style_bg_img_src( obj, LV_PART_MAIN ) != NULL ) return false;
+    if ( lv_obj_get_style_color_filter_dsc( obj, LV_PART_MAIN ) != NULL ) return false;
+    if ( lv_obj_get_style_transform_width( obj, LV_PART_MAIN ) != 0 ) return false;
+    if ( lv_obj_get_style_transform_height( obj, LV_PART_MAIN ) != 0 ) return false;
+
+    // Border and rounded corners only matter if the area reaches them
+    lv_coord_t bw = lv_obj_get_style_border_width( obj, LV_PART_MAIN );
+    if ( bw > 0 && lv_obj_get_style_border_opa( obj, LV_PART_MAIN ) > LV_OPA_MIN ) {
+        lv_area_t inner = obj->coords;
+        lv_area_increase( &inner, -bw, -bw );
+        if ( !_lv_area_is_in( area, &inner, 0 ) ) return false;
+    }
+    // Radius, bg_opa, opa and clip_corner: LVGL's own test
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area;
+    lv_event_send( obj, LV_EVENT_COVER_CHECK, &info );
+    if ( info.res != LV_COVER_RES_COVER ) return false;
+
+    // Parents still draw their scrollbars (and late borders) on top, and
+    // fade or transform everything inside them
+    for ( lv_obj_t *p = obj; p != NULL; p = lv_obj_get_parent( p ) ) {
+        if ( _lv_obj_get_layer_type( p ) != LV_LAYER_TYPE_NONE ) return false;
+        if ( lv_obj_get_style_opa( p, LV_PART_MAIN ) < LV_OPA_MAX ) return false;
+        if ( lv_obj_get_style_border_post( p, LV_PART_MAIN ) &&
+             lv_obj_get_style_border_width( p, LV_PART_MAIN ) > 0 ) return false;
+
+        lv_area_t hor, ver;
+        lv_obj_get_scrollbar_area( p, &hor, &ver );
+        if ( lv_area_get_size( &hor ) > 0 && _lv_area_is_on( &hor, area ) ) return false;
+        if ( lv_area_get_size( &ver ) > 0 && _lv_area_is_on( &ver, area ) ) return false;
+    }
+    return true;
+}
+
+/* The single color the area would be rendered in, if it is one */
+static bool fill_area_color( lv_disp_t *disp, const lv_area_t *area, UWORD *color )
+{
+    // Nothing may show on the top and system layers there
+    lv_obj_t *layers[] = { disp->top_layer, disp->sys_layer };
+    for ( uint8_t l = 0; l < 2; l++ ) {
+        if ( lv_obj_get_style_bg_opa( layers[l], LV_PART_MAIN ) > LV_OPA_MIN ) return false;
+        for ( uint32_t i = 0; i < lv_obj_get_child_cnt( layers[l] ); i++ ) {
+            if ( fill_obj_touches( lv_obj_get_child( layers[l], i ), area ) ) return false;
+        }
+    }
+
+    // During a screen animation the screen drawn second has to cover it
+    lv_obj_t *scr = disp->prev_scr && disp->draw_prev_over_act ? disp->prev_scr : disp->act_scr;
+    lv_obj_t *top = fill_find_top( scr, area );
+    if ( top == NULL || !fill_obj_is_plain( top, area ) ) return false;
+
+    lv_color_t c = lv_obj_get_style_bg_color( top, LV_PART_MAIN );
+    *color = (LV_COLOR_GET_R( c ) << 11) | (LV_COLOR_GET_G( c ) << 5) | LV_COLOR_GET_B( c );
+    return true;
+}
+
+/* Send the dirty areas that are one plain color from the LCD fill pattern
+ * and drop them from the list, LVGL never renders them. They go on the bus
+ * ahead of the flushes of this refresh; an area of it overlapping one is
+ * rendered in full, so the later flush leaves the same pixels */
+static void fill_solid_areas( lv_disp_t *disp )
+{
+    uint16_t n = 0;
+
+    for ( uint16_t i = 0; i < disp->inv_p; i++ ) {
+        const lv_area_t *a = &disp->inv_areas[i];
+        UWORD color;
+
+        if ( lv_area_get_size( a ) >= LCD_FILL_MIN_AREA && fill_area_color( disp, a, &color ) ) {
+            LCD_1IN28_FillWindows_Async( a->x1, a->y1, a->x2 + 1, a->y2 + 1, color, NULL );
+            fill_areas++;
+            fill_pixels += lv_area_get_size( a );
+            continue;
+        }
+        disp->inv_areas[n++] = *a;
+    }
+    disp->inv_p = n;
+}
+#endif
+
+/* Display refresh timer: coalesces the dirty areas (and trims them to the
+ * round glass) before LVGL renders them */
+static void my_refr_timer( lv_timer_t *timer )
+{
+    lv_disp_t *disp = (lv_disp_t *)timer->user_data;
+
+    // Layout updates invalidate too; LVGL repeats this but finds nothing to do
+    if ( disp->act_scr ) lv_obj_update_layout( disp->act_scr );
+    if ( disp->prev_scr ) lv_obj_update_layout( disp->prev_scr );
+    lv_obj_update_layout( disp->top_layer );
+    lv_obj_update_layout( disp->sys_layer );
+
+    if ( !disp->driver->full_refresh && disp->inv_p > 0 ) {
+        // Direct mode only sends what changed, merging would just render more
+#if COALESCE_TRACE
+        Serial.print( "AREAS:" );
+        for ( uint16_t i = 0; i < disp->inv_p; i++ ) {
+            const lv_area_t *a = &disp->inv_areas[i];
+            Serial.printf( " %d,%d,%d,%d", a->x1, a->y1, a->x2, a->y2 );
+        }
+        Serial.println();
+#endif
+        if ( !disp->driver->direct_mode ) {
+            disp->inv_p = Area_Coalesce( disp->inv_areas, disp->inv_p, COALESCE_WINDOW_COST, LCD_COLOR_MODE );
+        }
+#if LCD_1IN28_ROUND
+        round_trim_areas( disp );
+#endif
+#if LCD_FILL_MIN_AREA
+        // Direct mode keeps its buffer up to date, it has to render all
+        if ( !disp->driver->direct_mode ) fill_solid_areas( disp );
+#endif
+#if LCD_DIRECT_MODE
+        if ( disp->driver->direct_mode ) diff_mark_areas( disp );
+#endif
+    }
+
+    // The fill path may have taken every area, then LVGL has nothing to draw
+    if ( disp->inv_p > 0 ) refr_frames++;
+    else refr_skipped++;
+
+    _lv_disp_refr_timer( timer );
+}
+
+#if LCD_STATS_INTERVAL_MS
+/* Setup cost vs pixel payload of the flushes since the last report, and
+   the counters of the other subsystems, each line under its own prefix */
+void printLcdStats()
+{
+    LCD_1IN28_STATS st;
+    LCD_1IN28_GetStats( &st );
+    LCD_1IN28_ResetStats();
+    if ( st.Flushes == 0 && st.Fills == 0 ) return;
+
+    AREA_COALESCE_STATS ac;
+    Area_Coalesce_GetStats( &ac );
+    Area_Coalesce_ResetStats();
+    Serial.printf( "LCD: %lu dirty areas (%lu px) coalesced to %lu (%lu px), %lu batches\n",
+                   (unsigned long)ac.Areas_In, (unsigned long)ac.Pixels_In,
+                   (unsigned long)ac.Areas_Out, (unsigned long)ac.Pixels_Out,
+                   (unsigned long)st.Batches );
+    Serial.printf( "LCD: %lu areas (%lu px) filled without rendering, %lu fills\n",
+                   (unsigned long)fill_areas, (unsigned long)fill_pixels, (unsigned long)st.Fills );
+    fill_areas = fill_pixels = 0;
+#if LCD_DIRECT_MODE
+    Serial.printf( "LCD: frame diff, %lu of %lu redrawn pixels changed\n",
+                   (unsigned long)st.Diff_Changed, (unsigned long)st.Diff_Pixels );
+#endif
+    UI_SCREENS_STATS us;
+    UI_Screens_GetStats( &us );
+    UI_Screens_ResetStats();
+    Serial.printf( "UI: screens %lu built on demand (%lu us), %lu preloaded, %lu found built, %lu evicted, %lu B resident\n",
+                   (unsigned long)us.Builds, (unsigned long)us.Build_us, (unsigned long)us.Preloads,
+                   (unsigned long)us.Hits, (unsigned long)us.Evictions, (unsigned long)us.Resident_Bytes );
+#if UI_SNAPSHOT_TRANSITIONS
+    UI_TRANSITION_STATS ut;
+    UI_Transition_GetStats( &ut );
+    UI_Transition_ResetStats();
+    Serial.printf( "UI: screen changes %lu from snapshots, %lu live (%lu animating)\n",
+                   (unsigned long)ut.Snapshots, (unsigned long)( ut.Live + ut.Busy ), (unsigned long)ut.Busy );
+#endif
+    UI_BINDING_STATS ub;
+    UI_Binding_GetStats( &ub );
+    UI_Binding_ResetStats();
+    Serial.printf( "UI: %lu bound values set, %lu widget updates (%lu unchanged, %lu coalesced)\n",
+                   (unsigned long)ub.Sets, (unsigned long)ub.Applied,
+                   (unsigned long)ub.Unchanged, (unsigned long)ub.Coalesced );
+#if LV_DRAW_COMPLEX
+    lv_draw_mask_circle_cache_stats_t cc;
+    lv_draw_mask_get_circle_cache_stats( &cc );
+    lv_draw_mask_reset_circle_cache_stats();
+    Serial.printf( "DRAW: circle cache %lu hits, %lu misses, %lu evicted, %lu circles in %lu B\n",
+                   (unsigned long)cc.hit, (unsigned long)cc.miss, (unsigned long)cc.evict,
+                   (unsigned long)cc.entries, (unsigned long)cc.bytes );
+#endif
+#if LCD_RENDER_WORKERS
+    RENDER_WORKER_STATS rw;
+    Render_Worker_GetStats( &rw );
+    Render_Worker_ResetStats();
+    Serial.printf( "DRAW: %lu parts in stripes, %lu whole, %lu stripes on core 0\n",
+                   (unsigned long)rw.Split, (unsigned long)rw.Whole, (unsigned long)rw.Stripes );
+#endif
+#if LV_GLYPH_CACHE_SIZE
+    lv_draw_sw_glyph_cache_stats_t gc;
+    lv_draw_sw_get_glyph_cache_stats( &gc );
+    lv_draw_sw_reset_glyph_cache_stats();
+    Serial.printf( "DRAW: glyph cache %lu hits, %lu misses, %lu evicted, %lu glyphs (%lu pinned) in %lu B\n",
+                   (unsigned long)gc.hit, (unsigned long)gc.miss, (unsigned long)gc.evict,
+                   (unsigned long)gc.entries, (unsigned long)gc.pinned, (unsigned long)gc.bytes );
+#endif
+#if LV_USE_MEM_TIER
+    lv_mem_tier_stats_t ms;
+    lv_mem_tier_get_stats( &ms );
+    lv_mem_tier_reset_stats();
+    for ( int t = 0; t < _LV_MEM_TIER_NUM; t++ ) {
+        const lv_mem_tier_info_t *mt = &ms.tier[t];
+        Serial.printf( "HEAP: %s %lu of %lu B used (peak %lu), %lu blocks, %lu allocs (%lu spilled), largest free %lu B, %u%% frag\n",
+                       t == LV_MEM_TIER_FAST ? "fast" : "slow", (unsigned long)mt->used_size,
+                       (unsigned long)mt->total_size, (unsigned long)mt->max_used, (unsigned long)mt->used_cnt,
+                       (unsigned long)mt->alloc_cnt, (unsigned long)mt->spill_cnt,
+                       (unsigned long)mt->free_biggest_size, (unsigned)mt->frag_pct );
+    }
+    Serial.printf( "HEAP: %lu blocks moved between tiers, %lu allocs failed\n",
+                   (unsigned long)ms.move_cnt, (unsigned long)ms.fail_cnt );
+#endif
+#if TOUCH_READER_TASK
+    if ( touch_reader ) {
+        TOUCH_READER_STATS ts;
+        Touch_Reader_GetStats( &ts );
+        Touch_Reader_ResetStats();
+        Serial.printf( "TOUCH: %lu irqs, %lu reads (%lu us avg off loop), %lu samples (%lu gestures), %lu dropped, %lu errors, latency %lu us avg %lu max\n",
+                       (unsigned long)ts.Interrupts, (unsigned long)ts.Reads,
+                       (unsigned long)( ts.Reads ? ts.Read_us / ts.Reads : 0 ),
+                       (unsigned long)ts.Samples, (unsigned long)ts.Gestures,
+                       (unsigned long)ts.Dropped, (unsigned long)ts.Errors,
+                       (unsigned long)( ts.Samples ? ts.Latency_us / ts.Samples : 0 ),
+                       (unsigned long)ts.Max_Latency_us );
+    }
+#endif
+#if I2C_BUS_TASK
+    I2C_BUS_STATS bs;
+    I2C_Bus_GetStats( &bs );
+    I2C_Bus_ResetStats();
+    Serial.printf( "I2C: %lu%% busy, %lu txns in %lu transfers (%lu merged, %lu preempted), %lu errors, wait %lu/%lu us touch %lu/%lu us imu avg/max\n",
+                   (unsigned long)( bs.Elapsed_us ? (uint64_t)bs.Busy_us * 100 / bs.Elapsed_us : 0 ),
+                   (unsigned long)bs.Transactions, (unsigned long)bs.Transfers,
+                   (unsigned long)bs.Merged, (unsigned long)bs.Preempted, (unsigned long)bs.Errors,
+                   (unsigned long)( bs.Done[I2C_BUS_PRIO_TOUCH] ? bs.Wait_us[I2C_BUS_PRIO_TOUCH] / bs.Done[I2C_BUS_PRIO_TOUCH] : 0 ),
+                   (unsigned long)bs.Max_Wait_us[I2C_BUS_PRIO_TOUCH],
+                   (unsigned long)( bs.Done[I2C_BUS_PRIO_IMU] ? bs.Wait_us[I2C_BUS_PRIO_IMU] / bs.Done[I2C_BUS_PRIO_IMU] : 0 ),
+                   (unsigned long)bs.Max_Wait_us[I2C_BUS_PRIO_IMU] );
+#endif
+#if IMU_FIFO
+    if ( imu_fifo ) {
+        IMU_FIFO_STATS is;
+        IMU_Fifo_GetStats( &is );
+        IMU_Fifo_ResetStats();
+        Serial.printf( "IMU: %lu irqs, %lu drains (%lu us avg off loop), %lu samples in %lu blocks, %lu B on the bus, %lu overflows, %lu dropped, %lu errors\n",
+                       (unsigned long)is.Interrupts, (unsigned long)is.Drains,
+                       (unsigned long)( is.Drains ? is.Drain_us / is.Drains : 0 ),
+                       (unsigned long)is.Samples, (unsigned long)is.Blocks, (unsigned long)is.Bytes,
+                       (unsigned long)is.Overflows, (unsigned long)is.Dropped, (unsigned long)is.Errors );
+    }
+#endif
+    Serial.printf( "LCD: %lu flushes, %lu windows, setup %lu B in %lu segs (%lu skipped), pixels %lu B, %lu B setup/flush, %lu B copied\n",
+                   (unsigned long)st.Flushes, (unsigned long)st.Windows,
+                   (unsigned long)st.Setup_Bytes, (unsigned long)st.Setup_Segs,
+                   (unsigned long)st.Skipped_Cmds, (unsigned long)st.Pixel_Bytes,
+                   (unsigned long)(st.Flushes ? st.Setup_Bytes / st.Flushes : 0),
+                   (unsigned long)st.Copy_Bytes );
+}
+#endif
+
+// loop() task and the touch input device, for the refresh governor
+static TaskHandle_t ui_task = NULL;
+// What woke loop(), bits of its task notification
+#define UI_WAKE_TOUCH   ( 1 << 0 )
+#define UI_WAKE_IMU     ( 1 << 1 )
+static lv_indev_t *touch_indev = NULL;
+static uint32_t touch_last_ms = 0;
+
+/* Touch interrupt: wake loop() so the touch is read without polling */
+static void IRAM_ATTR touch_wake()
 {
-    /* Tell LVGL how many milliseconds has elapsed */
-    lv_tick_inc(EXAMPLE_LVGL_TICK_PERIOD_MS);
+    BaseType_t woken = pdFALSE;
+    if ( ui_task ) xTaskNotifyFromISR( ui_task, UI_WAKE_TOUCH, eSetBits, &woken );
+    portYIELD_FROM_ISR( woken );
 }
 
+#if TOUCH_READER_TASK
+/* Reader task: one controller read per interrupt; a failed read is
+ * counted as an error, not queued as a sample */
+static UBYTE touch_read_sample( TOUCH_SAMPLE *s )
+{
+    UBYTE status = touch.read_touch();
+    if ( status ) return status;
+    s->X = touch.data.x;
+    s->Y = touch.data.y;
+    s->Gesture = touch.data.gestureID;
+    s->Points = touch.data.points;
+    s->Event = touch.data.event;
+    return 0;
+}
+
+/* Reader task: a sample is queued, wake loop() */
+static void touch_notify()
+{
+    if ( ui_task ) xTaskNotify( ui_task, UI_WAKE_TOUCH, eSetBits );
+}
+#endif
+
+#if IMU_FIFO
+/* IMU task: a block of samples is waiting, wake loop() */
+static void imu_notify()
+{
+    if ( ui_task ) xTaskNotify( ui_task, UI_WAKE_IMU, eSetBits );
+}
+#endif
+
+/* Woken by the touch interrupt: poll the touchpad again, starting now */
+static void touch_resume()
+{
+    touch_last_ms = millis();
+    if ( touch_indev == NULL ) return;
+    lv_timer_resume( touch_indev->driver->read_timer );
+    lv_timer_ready( touch_indev->driver->read_timer );
+}
+
+/* Refresh governor: picks the refresh rate, stops touch polling once the
+ * finger is gone and returns how long loop() may sleep as far as LVGL is
+ * concerned. lv_next is what lv_timer_handler() returned */
+static uint32_t refr_govern( uint32_t lv_next )
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    uint32_t period = ( lv_anim_count_running() > 0 || disp->prev_scr ) ?
+                      REFR_ANIM_PERIOD_MS : REFR_IDLE_PERIOD_MS;
+
+    if ( disp->refr_timer->period != period ) {
+        lv_timer_set_period( disp->refr_timer, period );
+        lv_timer_set_period( lv_anim_get_timer(), period );
+    }
+
+    if ( touch_indev ) {
+        lv_timer_t *read = touch_indev->driver->read_timer;
+        if ( !read->paused && touch_indev->proc.state == LV_INDEV_STATE_REL &&
+             millis() - touch_last_ms > TOUCH_IDLE_MS ) {
+            lv_timer_pause( read );
+        }
+    }
+
+    // Code that ran after lv_timer_handler() may have invalidated something
+    // or set a binding that the next frame shows
+    if ( !disp->refr_timer->paused || UI_Binding_Pending() ) {
+        uint32_t elaps = lv_tick_elaps( disp->refr_timer->last_run );
+        uint32_t due = elaps >= period ? 0 : period - elaps;
+        if ( due < lv_next ) lv_next = due;
+    }
+    return lv_next;
+}
+
+/* Nothing to render, animate or read: the time a screen may be preloaded */
+static bool refr_idle()
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    if ( !disp->refr_timer->paused || disp->prev_scr || lv_anim_count_running() > 0 ) return false;
+    if ( UI_Binding_Pending() ) return false;
+    return touch_indev == NULL || touch_indev->driver->read_timer->paused;
+}
+
+/* Time left until an interval measured from last runs out */
+static uint32_t time_until( unsigned long last, unsigned long interval, unsigned long now )
+{
+    unsigned long elaps = now - last;
+    return elaps >= interval ? 0 : interval - elaps;
+}
+
+#if REFR_STATS_INTERVAL_MS
+void printRefrStats( unsigned long elaps )
+{
+    Serial.printf( "REFR: %lu wakeups, %lu frames rendered, %lu skipped, slept %lu of %lu ms\n",
+                   (unsigned long)refr_wakeups, (unsigned long)refr_frames,
+                   (unsigned long)refr_skipped, (unsigned long)refr_sleep_ms, elaps );
+    refr_wakeups = refr_frames = refr_skipped = refr_sleep_ms = 0;
+}
+#endif
+
 /*Read the touchpad - FIXED VERSION*/
 void my_touchpad_read( lv_indev_drv_t * indev_drv, lv_indev_data_t * data )
 {
+#if TOUCH_READER_TASK
+    if ( touch_reader ) {
+        Touch_Reader_Read( indev_drv, data );
+        if ( data->state == LV_INDEV_STATE_PR ) touch_last_ms = millis();
+        return;
+    }
+#endif
     // Read touch input
     if( touch.available() )
     {
+        touch_last_ms = millis();
         data->state = LV_INDEV_STATE_PR;
         data->point.x = touch.data.x;
         data->point.y = touch.data.y;
@@ -409,7 +1061,16 @@ void initializeIMU() {
     }
 }
 
-// Step detection algorithm with improved sensitivity
+// Steps the counter found in a call; a walk's first steps come at once
+void addSteps(uint32_t steps) {
+    if (steps == 0) {
+        return;
+    }
+    stepCount += steps;
+    Serial.print("✓ Step detected! Count: ");
+    Serial.println(stepCount);
+}
+
 void detectStep() {
     if (!imuInitialized) {
         static unsigned long lastWarning = 0;
@@ -420,68 +1081,23 @@ void detectStep() {
         return;
     }
 
-    float acc[3];
-    float gyro[3];
-    unsigned int timestamp;
+    short acc[3];
+    short gyro[3];
 
     // Read accelerometer data
-    QMI8658_read_xyz(acc, gyro, &timestamp);
-
-    // Calculate vertical acceleration (Z-axis typically points up when device is flat)
-    // For step detection, we mainly care about vertical motion
-    float verticalAcc = abs(acc[2]);  // Z-axis acceleration
-
-    // Calculate total acceleration magnitude for reference
-    float accMagnitude = sqrt(acc[0]*acc[0] + acc[1]*acc[1] + acc[2]*acc[2]);
-
-    // Debug logging every 2 seconds
-    static unsigned long lastDebug = 0;
-    if (millis() - lastDebug > 2000) {
-        Serial.print("IMU Debug - Acc: [");
-        Serial.print(acc[0], 2);
-        Serial.print(", ");
-        Serial.print(acc[1], 2);
-        Serial.print(", ");
-        Serial.print(acc[2], 2);
-        Serial.print("] Mag: ");
-        Serial.print(accMagnitude, 2);
-        Serial.print(" Steps: ");
-        Serial.println(stepCount);
-        lastDebug = millis();
-    }
-
-    // Improved step detection:
-    // Look for acceleration changes (peaks) that indicate steps
-    // Using derivative approach: detect when acceleration increases then decreases
-
-    unsigned long currentTime = millis();
-
-    // Check if acceleration magnitude changed significantly
-    float accChange = accMagnitude - lastAccMagnitude;
-
-    // Detect step: rising edge (acceleration increasing above threshold)
-    if (accChange > stepThreshold && !stepDetected) {
-        // Check cooldown period
-        if (currentTime - lastStepTime > stepCooldown) {
-            stepDetected = true;
-            stepCount++;
-            lastStepTime = currentTime;
-
-            Serial.print("✓ Step detected! Count: ");
-            Serial.print(stepCount);
-            Serial.print(" (AccChange: ");
-            Serial.print(accChange, 2);
-            Serial.println(")");
-        }
-    }
+    QMI8658_read_xyz_raw(acc, gyro, NULL);
+    addSteps(Step_Counter_Process(&step_counter, &acc, 1));
+}
 
-    // Reset step detection when acceleration stabilizes
-    if (abs(accChange) < (stepThreshold * 0.3)) {
-        stepDetected = false;
+#if IMU_FIFO
+// Step detection on a block from the FIFO, all samples in one call
+void detectStepBlock(const IMU_BLOCK *block) {
+    if (block->Overflow) {
+        Serial.println("WARNING: IMU FIFO overrun, samples lost");
     }
-
-    lastAccMagnitude = accMagnitude;
+    addSteps(Step_Counter_Process(&step_counter, block->Acc, block->Count));
 }
+#endif
 
 // Reset step counter
 extern "C" void resetStepCounter() {
@@ -601,7 +1217,7 @@ void showStatusScreen(bool success, const char* title, const char* message, int
     // Auto close and return to Screen1 after delay
     if (autoCloseMs > 0) {
         delay(autoCloseMs);
-        _ui_screen_change(&ui_Screen1, LV_SCR_LOAD_ANIM_FADE_ON, 300, 0, &ui_Screen1_screen_init);
+        UI_Screens_Change( &ui_Screen1, LV_SCR_LOAD_ANIM_FADE_ON, 300, 0, ui_Screen1_screen_init );
     }
 }
 
@@ -951,10 +1567,8 @@ void signAndExecuteTask(void *parameter) {
         if (WiFi.status() == WL_CONNECTED) {
             Serial.println("Updating balance...");
             current_balance = fetchSUIBalance();
-            if (ui_balance != NULL) {
-                lv_label_set_text(ui_balance, current_balance.c_str());
-                Serial.println("Balance updated on UI");
-            }
+            UI_Binding_Set_Text(bind_balance, current_balance.c_str());
+            Serial.println("Balance updated on UI");
         }
     } else {
         Serial.println("\n========================================");
@@ -1060,6 +1674,16 @@ extern "C" void executeSignAndExecute() {
     }
 }
 
+// ui_Screen4.c keeps the focused text area in a global of its own; clear it
+// with the screen so an evicted Screen4 leaves nothing dangling
+extern "C" lv_obj_t *activeTextArea;
+
+static void screen4_destroy()
+{
+    ui_Screen4_screen_destroy();
+    activeTextArea = NULL;
+}
+
 void setup()
 {
     Serial.begin( 115200 ); /* prepare for possible serial debug */
@@ -1079,16 +1703,6 @@ void setup()
         Serial.println("PSRAM not available");
     }
 
-    // Allocate frame buffer in PSRAM (240*240*2 = 115200 bytes)
-    UDOUBLE Imagesize = LCD_1IN28_HEIGHT * LCD_1IN28_WIDTH * 2;
-    if ((BlackImage = (UWORD *)ps_malloc(Imagesize)) == NULL){
-        Serial.println("Failed to allocate BlackImage in PSRAM!");
-        while(1);
-    }
-    Serial.print("BlackImage allocated in PSRAM: ");
-    Serial.print(Imagesize);
-    Serial.println(" bytes");
-
     // Initialize GPIO and LCD
     Serial.println("Initializing LCD hardware...");
     if (DEV_Module_Init() != 0){
@@ -1097,8 +1711,19 @@ void setup()
     }
     Serial.println("GPIO Init successful!");
 
+    I2C_Bus_Set_Clock( CST816S_ADDRESS, TOUCH_I2C_HZ );
+    I2C_Bus_Set_Clock( QMI8658_SLAVE_ADDR_L, IMU_I2C_HZ );
+    I2C_Bus_Set_Clock( QMI8658_SLAVE_ADDR_H, IMU_I2C_HZ );
+#if I2C_BUS_TASK
+    if ( I2C_Bus_Init( 0 ) ) {
+        Serial.println("I2C bus task failed, drivers use the bus themselves");
+    }
+#endif
+
     // Initialize LCD
     LCD_1IN28_Init(HORIZONTAL);
+    LCD_1IN28_SetColorMode(LCD_COLOR_MODE);
+    LCD_1IN28_SetByteOrder(LV_COLOR_16_SWAP ? LCD_1IN28_ORDER_PANEL : LCD_1IN28_ORDER_SWAPPED);
     Serial.println("LCD initialized");
 
     // Clear LCD to black
@@ -1110,17 +1735,71 @@ void setup()
     lv_log_register_print_cb( my_print ); /* register print function for debugging */
 #endif
     Serial.println("LVGL initialized");
+#if LCD_RENDER_WORKERS
+    if ( Render_Worker_Init( LCD_RENDER_WORKERS, 0, RENDER_WORKER_MIN_ROWS ) ) {
+        Serial.println("Render workers failed, LVGL draws on one core");
+    }
+#endif
+
+    if ( UI_Binding_Init() ) {
+        Serial.println("UI binding lock failed, values are set from loop() only");
+    }
 
     // Initialize touch controller
     Serial.println("Initializing touch controller...");
     touch.begin();
+    ui_task = xTaskGetCurrentTaskHandle();
+#if TOUCH_READER_TASK
+    touch_reader = Touch_Reader_Init( touch_read_sample, touch_notify, 0, TOUCH_RELEASE_MS ) == 0;
+    if ( touch_reader ) {
+        touch.setInterruptCallback( Touch_Reader_Wake_ISR );
+    } else {
+        Serial.println("Touch reader task failed, reading touch from loop()");
+        touch.setInterruptCallback( touch_wake );
+    }
+#else
+    touch.setInterruptCallback( touch_wake );
+#endif
     Serial.println("Touch initialized");
 
     // Initialize IMU sensor (QMI8658)
     Serial.println("Initializing IMU sensor...");
     initializeIMU();
-
-    lv_disp_draw_buf_init( &draw_buf, buf, NULL, screenWidth * screenHeight / 10 );
+#if IMU_FIFO
+    if ( imuInitialized ) {
+        imu_fifo = IMU_Fifo_Init( QMI8658_get_addr(), imu_notify, 0 ) == 0;
+        if ( imu_fifo ) {
+            pinMode( IMU_INT2_PIN, INPUT );
+            attachInterrupt( IMU_INT2_PIN, IMU_Fifo_Wake_ISR, RISING );
+        } else {
+            Serial.println("IMU FIFO failed, polling the IMU from loop()");
+            QMI8658_init();
+        }
+    }
+    if ( imu_fifo ) {
+        Step_Counter_Init( &step_counter, 1000000000UL / IMU_FIFO_PERIOD_US, IMU_FIFO_LSB_PER_G );
+    } else
+#endif
+    Step_Counter_Init( &step_counter, 1000000UL / STEP_POLL_MS, STEP_POLL_LSB_PER_G );
+
+#if LCD_DIRECT_MODE
+    // Both frames start black like the panel after LCD_1IN28_Clear
+    lv_color_t *fb1 = (lv_color_t *)ps_calloc( screenWidth * screenHeight, sizeof( lv_color_t ) );
+    lv_color_t *fb2 = (lv_color_t *)ps_calloc( screenWidth * screenHeight, sizeof( lv_color_t ) );
+    bool direct = fb1 != NULL && fb2 != NULL;
+    if ( direct ) {
+        lv_disp_draw_buf_init( &draw_buf, fb1, fb2, screenWidth * screenHeight );
+        LCD_1IN28_Diff_Init( (UWORD *)buf1, (UWORD *)buf2, screenWidth * screenHeight / 10 );
+    } else {
+        Serial.println( "No PSRAM for the framebuffers, using partial mode" );
+        free( fb1 );
+        free( fb2 );
+        lv_disp_draw_buf_init( &draw_buf, buf1, buf2, screenWidth * screenHeight / 10 );
+    }
+#else
+    lv_disp_draw_buf_init( &draw_buf, buf1, buf2, screenWidth * screenHeight / 10 );
+#endif
+    DEV_SPI_Set_Done_Callback( my_disp_flush_done );
 
     /*Initialize the display*/
     static lv_disp_drv_t disp_drv;
@@ -1130,24 +1809,24 @@ void setup()
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
     disp_drv.draw_buf = &draw_buf;
-    lv_disp_drv_register( &disp_drv );
+#if LCD_DIRECT_MODE
+    disp_drv.direct_mode = direct;
+#endif
+    lv_disp_t *disp = lv_disp_drv_register( &disp_drv );
+    lv_timer_set_cb( disp->refr_timer, my_refr_timer );
+    LCD_1IN28_Batch_Init( batch_buf, sizeof( batch_buf ) / sizeof( batch_buf[0] ) );
 
     /*Initialize the (dummy) input device driver*/
     static lv_indev_drv_t indev_drv;
     lv_indev_drv_init( &indev_drv );
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = my_touchpad_read;
-    lv_indev_drv_register( &indev_drv );
-
-    // Setup LVGL timer
-    const esp_timer_create_args_t lvgl_tick_timer_args = {
-      .callback = &example_increase_lvgl_tick,
-      .name = "lvgl_tick"
-    };
+#if TOUCH_READER_TASK && LV_USE_INDEV_HW_GESTURE
+    if ( touch_reader ) indev_drv.gesture_src = TOUCH_GESTURE_SRC;
+#endif
+    touch_indev = lv_indev_drv_register( &indev_drv );
 
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer);
-    esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000);
+    // LVGL takes its tick from millis() (LV_TICK_CUSTOM), no tick timer needed
 
     // Show splash screen with "COMMAND OSS" - animated colors
     Serial.println("Showing splash screen...");
@@ -1197,11 +1876,53 @@ void setup()
         testOfflineSign();
     }
 
+    // Screens the gestures open, in the order they are expected, with the
+    // changes of the SquareLine handlers; Screen1 stays built, the others
+    // go when they do not fit UI_SCREENS_BUDGET
+    UI_Screens_Init( UI_SCREENS_BUDGET );
+    UI_Screens_Add( &ui_Screen1, ui_Screen1_screen_init, ui_Screen1_screen_destroy, "Screen1", 1 );
+    UI_Screens_Add( &ui_Screen2, ui_Screen2_screen_init, ui_Screen2_screen_destroy, "Screen2", 0 );
+    UI_Screens_Add( &ui_Screen3, ui_Screen3_screen_init, ui_Screen3_screen_destroy, "Screen3", 0 );
+    UI_Screens_Add( &ui_Screen4, ui_Screen4_screen_init, screen4_destroy, "Screen4", 0 );
+    UI_Screens_Add( &ui_Screen5, ui_Screen5_screen_init, ui_Screen5_screen_destroy, "Screen5", 0 );
+    UI_Screens_Link( &ui_Screen1, &ui_Screen5, LV_DIR_LEFT, LV_SCR_LOAD_ANIM_MOVE_LEFT, 100 );      // steps
+    UI_Screens_Link( &ui_Screen1, &ui_Screen3, LV_DIR_TOP, LV_SCR_LOAD_ANIM_MOVE_TOP, 100 );        // countdown
+    UI_Screens_Link( &ui_Screen1, &ui_Screen2, LV_DIR_RIGHT, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 100 );    // lock
+    UI_Screens_Link( &ui_Screen1, &ui_Screen4, LV_DIR_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 100 );  // WiFi
+    UI_Screens_Link( &ui_Screen2, &ui_Screen1, LV_DIR_LEFT, LV_SCR_LOAD_ANIM_MOVE_LEFT, 100 );
+    UI_Screens_Link( &ui_Screen3, &ui_Screen1, LV_DIR_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 150 );
+    UI_Screens_Link( &ui_Screen4, &ui_Screen1, LV_DIR_TOP, LV_SCR_LOAD_ANIM_MOVE_TOP, 100 );
+    UI_Screens_Link( &ui_Screen5, &ui_Screen1, LV_DIR_RIGHT, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 100 );
+
+#if UI_SNAPSHOT_TRANSITIONS
+    size_t snap_size = screenWidth * screenHeight * sizeof( lv_color_t );
+    void *snap_old = ps_malloc( snap_size );
+    void *snap_new = ps_malloc( snap_size );
+    if ( snap_old != NULL && snap_new != NULL ) {
+        UI_Transition_Init( snap_old, snap_new, snap_size );
+    } else {
+        Serial.println( "No PSRAM for the screen snapshots, screen changes are drawn live" );
+        free( snap_old );
+        free( snap_new );
+    }
+#endif
+
     // Load SquareLine Studio UI
     Serial.println("Loading SquareLine Studio UI...");
-    ui_init();
+    UI_Screens_Start( ui_init );
     Serial.println("UI loaded!");
 
+    bind_balance = UI_Binding_Label_Text( &ui_balance );
+    bind_time = UI_Binding_Label_Int( &ui_time1, "%d" );
+    bind_time_arc = UI_Binding_Arc( &ui_Arc1 );
+    bind_steps = UI_Binding_Label_Int( &ui_LabelStepCount, "%d" );
+    bind_steps_arc = UI_Binding_Arc( &ui_Arc_Steps );
+
+    // The counters redraw their digits on every update, keep them decoded
+    lv_draw_sw_glyph_cache_pin( &lv_font_montserrat_48, "0123456789" );
+    lv_draw_sw_glyph_cache_pin( &lv_font_montserrat_24, "0123456789" );
+    lv_draw_sw_glyph_cache_pin( LV_FONT_DEFAULT, "0123456789." );
+
     // Set address display with shortened SUI address
     String shortAddr = shortenAddress(SUI_ADDRESS);
     lv_label_set_text(ui_address, shortAddr.c_str());
@@ -1209,9 +1930,9 @@ void setup()
     // Fetch initial balance
     if (WiFi.status() == WL_CONNECTED) {
         current_balance = fetchSUIBalance();
-        lv_label_set_text(ui_balance, current_balance.c_str());
+        UI_Binding_Set_Text(bind_balance, current_balance.c_str());
     } else {
-        lv_label_set_text(ui_balance, "No WiFi");
+        UI_Binding_Set_Text(bind_balance, "No WiFi");
     }
 
     Serial.println( "Setup done" );
@@ -1219,7 +1940,9 @@ void setup()
 
 void loop()
 {
-    lv_timer_handler(); /* let the GUI do its work */
+    UI_Binding_Flush();                    /* bound values changed since the last frame */
+    uint32_t lv_next = lv_timer_handler(); /* let the GUI do its work */
+    refr_wakeups++;
 
     // If transaction is in progress, skip non-critical operations
     // to reduce WiFi interference
@@ -1241,17 +1964,9 @@ void loop()
             countdown_value = 60; // Reset to 60
         }
 
-        // Update ui_time1 label if it exists
-        if (ui_time1 != NULL) {
-            char time_str[4];
-            snprintf(time_str, sizeof(time_str), "%d", countdown_value);
-            lv_label_set_text(ui_time1, time_str);
-        }
-
-        // Update Arc1 value to match countdown if it exists
-        if (ui_Arc1 != NULL) {
-            lv_arc_set_value(ui_Arc1, countdown_value);
-        }
+        // ui_time1 and Arc1 show it while Screen3 is loaded
+        UI_Binding_Set_Int(bind_time, countdown_value);
+        UI_Binding_Set_Int(bind_time_arc, countdown_value);
     }
 
     // Update balance periodically (every 30 seconds)
@@ -1267,32 +1982,79 @@ void loop()
         // Fetch and update balance
         if (WiFi.status() == WL_CONNECTED) {
             current_balance = fetchSUIBalance();
-            if (ui_balance != NULL) {
-                lv_label_set_text(ui_balance, current_balance.c_str());
-            }
+            UI_Binding_Set_Text(bind_balance, current_balance.c_str());
         }
     }
 
     // Step detection (run frequently for accuracy)
     static unsigned long last_step_check = 0;
-    if (current_time - last_step_check >= 50) {  // Check every 50ms
+    bool steps_due = false;
+#if IMU_FIFO
+    if (imu_fifo) {
+        IMU_BLOCK block;
+        while (IMU_Fifo_Read(&block) == 0) {
+            detectStepBlock(&block);
+            last_step_check = current_time;
+            steps_due = true;
+        }
+        // A missed watermark edge would leave the FIFO full for good
+        if (current_time - last_step_check >= IMU_FIFO_POLL_MS) {
+            last_step_check = current_time;
+            IMU_Fifo_Poll();
+        }
+    } else
+#endif
+    if (current_time - last_step_check >= STEP_POLL_MS) {
         last_step_check = current_time;
         detectStep();
+        steps_due = true;
+    }
+    if (steps_due) {
+        // Screen5 shows the count; the bindings skip an unchanged one so
+        // an idle screen is not redrawn 20 times a second
+        UI_Binding_Set_Int(bind_steps, stepCount);
+
+        // Update arc (max 1000 steps display, loop after)
+        int arcValue = stepCount % 1000;
+        if (arcValue == 0 && stepCount > 0) {
+            arcValue = 1000;  // Show full when multiple of 1000
+        }
+        UI_Binding_Set_Int(bind_steps_arc, arcValue);
+    }
 
-        // Update Screen5 UI if active
-        if (ui_LabelStepCount != NULL && ui_Arc_Steps != NULL) {
-            char stepStr[10];
-            snprintf(stepStr, sizeof(stepStr), "%d", stepCount);
-            lv_label_set_text(ui_LabelStepCount, stepStr);
+#if LCD_STATS_INTERVAL_MS
+    static unsigned long last_lcd_stats = 0;
+    if (current_time - last_lcd_stats >= LCD_STATS_INTERVAL_MS) {
+        last_lcd_stats = current_time;
+        printLcdStats();
+    }
+#endif
 
-            // Update arc (max 1000 steps display, loop after)
-            int arcValue = stepCount % 1000;
-            if (arcValue == 0 && stepCount > 0) {
-                arcValue = 1000;  // Show full when multiple of 1000
-            }
-            lv_arc_set_value(ui_Arc_Steps, arcValue);
-        }
+#if REFR_STATS_INTERVAL_MS
+    static unsigned long last_refr_stats = 0;
+    if (current_time - last_refr_stats >= REFR_STATS_INTERVAL_MS) {
+        printRefrStats( current_time - last_refr_stats );
+        last_refr_stats = current_time;
     }
+#endif
+
+    // Sleep until the next LVGL timer or task above is due; a touch
+    // or an IMU block ends the sleep early, only a touch polls again
+    current_time = millis();
+    uint32_t wait = refr_govern( lv_next );
+    wait = min( wait, time_until( last_countdown_update, countdown_interval, current_time ) );
+    wait = min( wait, time_until( last_balance_update, balance_update_interval, current_time ) );
+    wait = min( wait, time_until( last_step_check, imu_fifo ? IMU_FIFO_POLL_MS : STEP_POLL_MS, current_time ) );
+#if LCD_STATS_INTERVAL_MS
+    wait = min( wait, time_until( last_lcd_stats, LCD_STATS_INTERVAL_MS, current_time ) );
+#endif
+    wait = constrain( wait, 1, REFR_MAX_SLEEP_MS );    // at least one tick for the other tasks
+
+    // One screen a gesture may open per idle wakeup, the next one soon after
+    if ( refr_idle() && UI_Screens_Idle() ) wait = 1;
 
-    delay( 5 );
+    uint32_t woke = 0;
+    if ( xTaskNotifyWait( 0, UINT32_MAX, &woke, pdMS_TO_TICKS( wait ) ) == pdTRUE &&
+         ( woke & UI_WAKE_TOUCH ) ) touch_resume();
+    refr_sleep_ms += millis() - current_time;
 }
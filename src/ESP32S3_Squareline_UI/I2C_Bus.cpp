@@ -0,0 +1,483 @@
+/*****************************************************************************
+* | File      	:   I2C_Bus.cpp
+* | Function    :   One task owns the I2C bus, the drivers queue transactions
+* | Info        :
+*                Each priority has a queue of its own, linked through the
+*                transactions themselves, so queueing never allocates. The
+*                wake semaphore is given once per transaction; transactions
+*                that another one took along leave a give with an empty
+*                queue behind, which the task skips.
+*                A chunked read looks at the higher queues between its
+*                chunks and runs what waits there first. I2C gives no way
+*                to pause a transfer, a chunk on the wire always ends.
+*                Only the bus task (or the caller, before I2C_Bus_Init)
+*                touches the wire and the scratch buffer, and it is the
+*                only one to store the stats. The stats calls run on
+*                another task, so a reset keeps a base to count from and
+*                asks the bus task to start the maximum waits again.
+******************************************************************************/
+#include "I2C_Bus.h"
+
+typedef struct{
+	I2C_TXN *Head;
+	I2C_TXN *Tail;
+}I2C_BUS_QUEUE;
+
+typedef struct{
+	UBYTE Addr;
+	UDOUBLE Hz;
+}I2C_BUS_DEVICE;
+
+static I2C_BUS_QUEUE I2C_Bus_Queue[I2C_BUS_PRIOS];
+static DEV_Sem I2C_Bus_Lock = NULL;         // the queues, a semaphore of one
+static DEV_Sem I2C_Bus_Wake = NULL;
+// I2C_Bus_Run(): one caller per priority at a time waits for its transactions
+static DEV_Sem I2C_Bus_Sync_Lock[I2C_BUS_PRIOS];
+static DEV_Sem I2C_Bus_Sync_Done[I2C_BUS_PRIOS];
+
+static I2C_BUS_DEVICE I2C_Bus_Device[I2C_BUS_DEVICES];
+static UBYTE I2C_Bus_Devices = 0;
+static UDOUBLE I2C_Bus_Hz = I2C_BUS_DEFAULT_HZ;
+
+static UBYTE I2C_Bus_Scratch[I2C_BUS_CHUNK];   // merged reads
+static I2C_BUS_STATS I2C_Bus_Stats;
+static I2C_BUS_STATS I2C_Bus_Base;          // the counts at the last reset
+static UDOUBLE I2C_Bus_Reset_us = 0;
+static UDOUBLE I2C_Bus_Resets = 0;          // only the stats calls store it
+static UDOUBLE I2C_Bus_Max_Resets = 0;      // the resets the bus task took, only it stores it
+
+static UDOUBLE I2C_Bus_Device_Hz(UBYTE Addr)
+{
+    for(UBYTE i = 0; i < I2C_Bus_Devices; i++)
+        if(I2C_Bus_Device[i].Addr == Addr)
+            return I2C_Bus_Device[i].Hz;
+    return I2C_BUS_DEFAULT_HZ;
+}
+
+/******************************************************************************
+function:	One transfer on the wire, at the clock of the device
+******************************************************************************/
+static UBYTE I2C_Bus_Xfer(UBYTE Addr, UBYTE Reg, UBYTE *Buf, UWORD Len, UBYTE Write)
+{
+    UDOUBLE hz = I2C_Bus_Device_Hz(Addr);
+    UDOUBLE t0;
+    UBYTE status;
+
+    if(hz != I2C_Bus_Hz) {
+        DEV_I2C_Set_Clock(hz);
+        I2C_Bus_Hz = hz;
+        DEV_Count(&I2C_Bus_Stats.Clock_Switches, 1);
+    }
+    t0 = DEV_Micros();
+    status = DEV_I2C_Transfer(Addr, Reg, Buf, Len, Write);
+    DEV_Count(&I2C_Bus_Stats.Busy_us, DEV_Micros() - t0);
+    DEV_Count(&I2C_Bus_Stats.Transfers, 1);
+    DEV_Count(&I2C_Bus_Stats.Bytes, Len);
+    if(status)
+        DEV_Count(&I2C_Bus_Stats.Errors, 1);
+    return status;
+}
+
+static void I2C_Bus_Started(I2C_TXN *Txn)
+{
+    UDOUBLE wait, resets;
+
+    if(I2C_Bus_Wake == NULL)
+        return;
+    resets = __atomic_load_n(&I2C_Bus_Resets, __ATOMIC_RELAXED);
+    if(resets != I2C_Bus_Max_Resets) {
+        for(UBYTE p = 0; p < I2C_BUS_PRIOS; p++)
+            __atomic_store_n(&I2C_Bus_Stats.Max_Wait_us[p], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&I2C_Bus_Max_Resets, resets, __ATOMIC_RELEASE);
+    }
+    wait = DEV_Micros() - Txn->Queued_us;
+    DEV_Count(&I2C_Bus_Stats.Wait_us[Txn->Prio], wait);
+    if(wait > I2C_Bus_Stats.Max_Wait_us[Txn->Prio])
+        __atomic_store_n(&I2C_Bus_Stats.Max_Wait_us[Txn->Prio], wait, __ATOMIC_RELAXED);
+}
+
+static void I2C_Bus_Finish(I2C_TXN *Txn, UBYTE Status)
+{
+    Txn->Status = Status;
+    DEV_Count(&I2C_Bus_Stats.Transactions, 1);
+    DEV_Count(&I2C_Bus_Stats.Done[Txn->Prio], 1);
+    if(Txn->Done)
+        Txn->Done(Txn);
+}
+
+static I2C_TXN *I2C_Bus_Pop(UBYTE Prio)
+{
+    I2C_BUS_QUEUE *q = &I2C_Bus_Queue[Prio];
+    I2C_TXN *t = q->Head;
+
+    if(t) {
+        q->Head = t->Next;
+        if(q->Head == NULL)
+            q->Tail = NULL;
+    }
+    return t;
+}
+
+static UBYTE I2C_Bus_Mergeable(const I2C_TXN *Txn)
+{
+    return (Txn->Flags & (I2C_TXN_WRITE | I2C_TXN_FIFO)) == 0 && Txn->Len < I2C_BUS_CHUNK;
+}
+
+/******************************************************************************
+function:	Take the reads of the same device along with Batch[0]
+Info:
+    Called with the lock held. A queued read joins when its registers lie
+    within I2C_BUS_BATCH_GAP of the batch and the whole span still fits in
+    one chunk. Returns the number of reads in Batch.
+******************************************************************************/
+static UBYTE I2C_Bus_Collect(I2C_TXN **Batch, UWORD *Lo, UWORD *Hi)
+{
+    I2C_TXN *t = Batch[0];
+    I2C_BUS_QUEUE *q = &I2C_Bus_Queue[t->Prio];
+    UBYTE n = 1, joined = 1;
+
+    *Lo = t->Reg;
+    *Hi = t->Reg + t->Len;
+    if(!I2C_Bus_Mergeable(t))
+        return 1;
+    // Again after every join, the wider span can reach reads that were skipped
+    while(joined && n < I2C_BUS_BATCH_TXNS) {
+        I2C_TXN *prev = NULL;
+        joined = 0;
+        for(I2C_TXN *c = q->Head; c != NULL; prev = c, c = c->Next) {
+            UWORD lo, hi;
+            if(c->Addr != t->Addr || !I2C_Bus_Mergeable(c))
+                continue;
+            if(c->Reg > *Hi + I2C_BUS_BATCH_GAP || c->Reg + c->Len + I2C_BUS_BATCH_GAP < *Lo)
+                continue;
+            lo = c->Reg < *Lo ? c->Reg : *Lo;
+            hi = c->Reg + c->Len > *Hi ? c->Reg + c->Len : *Hi;
+            if(hi - lo > I2C_BUS_CHUNK || hi > 0x100)
+                continue;
+            // Unlink it
+            if(prev)
+                prev->Next = c->Next;
+            else
+                q->Head = c->Next;
+            if(q->Tail == c)
+                q->Tail = prev;
+            Batch[n++] = c;
+            *Lo = lo;
+            *Hi = hi;
+            joined = 1;
+            break;
+        }
+    }
+    return n;
+}
+
+static void I2C_Bus_Exec(I2C_TXN *Txn);
+
+/******************************************************************************
+function:	Run what waits in the queues above Prio
+return:
+    the number of transactions run
+******************************************************************************/
+static UDOUBLE I2C_Bus_Serve_Above(UBYTE Prio)
+{
+    UDOUBLE served = 0;
+
+    if(I2C_Bus_Wake == NULL || Prio == 0)
+        return 0;
+    for(;;) {
+        I2C_TXN *t = NULL;
+        DEV_Sem_Take(I2C_Bus_Lock);
+        for(UBYTE p = 0; p < Prio && t == NULL; p++)
+            t = I2C_Bus_Pop(p);
+        DEV_Sem_Give(I2C_Bus_Lock);
+        if(t == NULL)
+            return served;
+        I2C_Bus_Exec(t);
+        served++;
+    }
+}
+
+/******************************************************************************
+function:	Run one transaction, in chunks if it is a long read
+******************************************************************************/
+static void I2C_Bus_Exec(I2C_TXN *Txn)
+{
+    UBYTE status = 0;
+
+    I2C_Bus_Started(Txn);
+    if(Txn->Flags & I2C_TXN_WRITE) {
+        I2C_Bus_Finish(Txn, I2C_Bus_Xfer(Txn->Addr, Txn->Reg, Txn->Buf, Txn->Len, 1));
+        return;
+    }
+    for(UWORD pos = 0; pos < Txn->Len && status == 0; pos += I2C_BUS_CHUNK) {
+        UWORD n = Txn->Len - pos < I2C_BUS_CHUNK ? Txn->Len - pos : I2C_BUS_CHUNK;
+        UBYTE reg = (Txn->Flags & I2C_TXN_FIFO) ? Txn->Reg : (UBYTE)(Txn->Reg + pos);
+        if(pos > 0 && I2C_Bus_Serve_Above(Txn->Prio))
+            DEV_Count(&I2C_Bus_Stats.Preempted, 1);
+        status = I2C_Bus_Xfer(Txn->Addr, reg, Txn->Buf + pos, n, 0);
+    }
+    I2C_Bus_Finish(Txn, status);
+}
+
+/******************************************************************************
+function:	Run reads merged into one transfer over Lo..Hi
+******************************************************************************/
+static void I2C_Bus_Exec_Batch(I2C_TXN **Batch, UBYTE Count, UWORD Lo, UWORD Hi)
+{
+    UBYTE status;
+
+    for(UBYTE i = 0; i < Count; i++)
+        I2C_Bus_Started(Batch[i]);
+    status = I2C_Bus_Xfer(Batch[0]->Addr, (UBYTE)Lo, I2C_Bus_Scratch, Hi - Lo, 0);
+    DEV_Count(&I2C_Bus_Stats.Merged, Count - 1);
+    for(UBYTE i = 0; i < Count; i++) {
+        if(status == 0)
+            memcpy(Batch[i]->Buf, I2C_Bus_Scratch + (Batch[i]->Reg - Lo), Batch[i]->Len);
+        I2C_Bus_Finish(Batch[i], status);
+    }
+}
+
+static void I2C_Bus_Thread(void *Arg)
+{
+    I2C_TXN *batch[I2C_BUS_BATCH_TXNS];
+    UWORD lo, hi;
+    UBYTE n;
+
+    (void)Arg;
+    for(;;) {
+        DEV_Sem_Take(I2C_Bus_Wake);
+        batch[0] = NULL;
+        DEV_Sem_Take(I2C_Bus_Lock);
+        for(UBYTE p = 0; p < I2C_BUS_PRIOS && batch[0] == NULL; p++)
+            batch[0] = I2C_Bus_Pop(p);
+        n = batch[0] ? I2C_Bus_Collect(batch, &lo, &hi) : 0;
+        DEV_Sem_Give(I2C_Bus_Lock);
+        if(n == 1)
+            I2C_Bus_Exec(batch[0]);
+        else if(n > 1)
+            I2C_Bus_Exec_Batch(batch, n, lo, hi);
+    }
+}
+
+/******************************************************************************
+function:	Start the bus task
+parameter:
+    Core : CPU of the bus task
+Info:
+    Returns 0 on success; on failure transactions keep running in the
+    caller. Call it after DEV_Module_Init() and before the drivers' tasks
+    use the bus.
+******************************************************************************/
+UBYTE I2C_Bus_Init(UBYTE Core)
+{
+    if(I2C_Bus_Wake != NULL)
+        return 1;
+    memset(I2C_Bus_Queue, 0, sizeof(I2C_Bus_Queue));
+    memset(&I2C_Bus_Stats, 0, sizeof(I2C_BUS_STATS));
+    memset(&I2C_Bus_Base, 0, sizeof(I2C_BUS_STATS));
+    I2C_Bus_Reset_us = DEV_Micros();
+    I2C_Bus_Lock = DEV_Sem_Create(1);
+    for(UBYTE p = 0; p < I2C_BUS_PRIOS; p++) {
+        I2C_Bus_Sync_Lock[p] = DEV_Sem_Create(1);
+        I2C_Bus_Sync_Done[p] = DEV_Sem_Create(0);
+        if(I2C_Bus_Sync_Lock[p] == NULL || I2C_Bus_Sync_Done[p] == NULL)
+            return 1;
+    }
+    I2C_Bus_Wake = DEV_Sem_Create(0);
+    if(I2C_Bus_Lock == NULL || I2C_Bus_Wake == NULL)
+        return 1;
+    if(DEV_Thread_Create_Priority(I2C_Bus_Thread, NULL, Core, DEV_THREAD_PRIORITY_IO)) {
+        I2C_Bus_Wake = NULL;
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	The clock to talk to a device with
+parameter:
+    Addr : 7 bit address
+    Hz   : up to I2C_BUS_FAST_PLUS_HZ, for devices rated for Fast-mode Plus
+Info:
+    Every device on the bus sees the traffic to the others. Only raise a
+    device above I2C_BUS_DEFAULT_HZ when all of them tolerate the faster
+    clock on the wire. Returns 1 if Hz is out of range or the table is full.
+******************************************************************************/
+UBYTE I2C_Bus_Set_Clock(UBYTE Addr, UDOUBLE Hz)
+{
+    UBYTE i;
+
+    if(Hz == 0 || Hz > I2C_BUS_FAST_PLUS_HZ)
+        return 1;
+    for(i = 0; i < I2C_Bus_Devices; i++)
+        if(I2C_Bus_Device[i].Addr == Addr)
+            break;
+    if(i == I2C_BUS_DEVICES)
+        return 1;
+    I2C_Bus_Device[i].Addr = Addr;
+    I2C_Bus_Device[i].Hz = Hz;
+    if(i == I2C_Bus_Devices)
+        I2C_Bus_Devices++;
+    return 0;
+}
+
+/******************************************************************************
+function:	Queue transactions, Done is called as each completes
+parameter:
+    Txns  : Count transactions, they must stay valid until they are done
+Info:
+    All of them are queued at once, so reads of one device among them can
+    be merged. Without the bus task they run before this returns.
+******************************************************************************/
+void I2C_Bus_Submit(I2C_TXN *Txns, UBYTE Count)
+{
+    UDOUBLE now;
+
+    if(I2C_Bus_Wake == NULL) {
+        for(UBYTE i = 0; i < Count; i++)
+            I2C_Bus_Exec(&Txns[i]);
+        return;
+    }
+    now = DEV_Micros();
+    DEV_Sem_Take(I2C_Bus_Lock);
+    for(UBYTE i = 0; i < Count; i++) {
+        I2C_TXN *t = &Txns[i];
+        I2C_BUS_QUEUE *q;
+        if(t->Prio >= I2C_BUS_PRIOS)
+            t->Prio = I2C_BUS_PRIOS - 1;
+        q = &I2C_Bus_Queue[t->Prio];
+        t->Queued_us = now;
+        t->Next = NULL;
+        if(q->Tail)
+            q->Tail->Next = t;
+        else
+            q->Head = t;
+        q->Tail = t;
+    }
+    DEV_Sem_Give(I2C_Bus_Lock);
+    for(UBYTE i = 0; i < Count; i++)
+        DEV_Sem_Give(I2C_Bus_Wake);
+}
+
+static void I2C_Bus_Sync_Done_Cb(I2C_TXN *Txn)
+{
+    DEV_Sem_Give((DEV_Sem)Txn->Arg);
+}
+
+/******************************************************************************
+function:	Queue transactions and wait until all are done
+parameter:
+    Txns  : Count transactions of the priority of the first; Done and Arg
+            are set here
+return:
+    0 if all of them succeeded
+Info:
+    Never call it from a Done callback, the bus task would wait on itself.
+******************************************************************************/
+UBYTE I2C_Bus_Run(I2C_TXN *Txns, UBYTE Count)
+{
+    UBYTE prio = Txns[0].Prio < I2C_BUS_PRIOS ? Txns[0].Prio : I2C_BUS_PRIOS - 1;
+    UBYTE status = 0;
+
+    if(I2C_Bus_Wake == NULL) {
+        for(UBYTE i = 0; i < Count; i++)
+            Txns[i].Done = NULL;
+        I2C_Bus_Submit(Txns, Count);
+    } else {
+        DEV_Sem_Take(I2C_Bus_Sync_Lock[prio]);
+        for(UBYTE i = 0; i < Count; i++) {
+            Txns[i].Prio = prio;
+            Txns[i].Done = I2C_Bus_Sync_Done_Cb;
+            Txns[i].Arg = I2C_Bus_Sync_Done[prio];
+        }
+        I2C_Bus_Submit(Txns, Count);
+        for(UBYTE i = 0; i < Count; i++)
+            DEV_Sem_Take(I2C_Bus_Sync_Done[prio]);
+        DEV_Sem_Give(I2C_Bus_Sync_Lock[prio]);
+    }
+    for(UBYTE i = 0; i < Count; i++)
+        status |= Txns[i].Status;
+    return status;
+}
+
+/******************************************************************************
+function:	Read Len bytes from Reg on and wait for them
+return:
+    0 on success, 1 if the device did not answer
+******************************************************************************/
+UBYTE I2C_Bus_Read(UBYTE Addr, UBYTE Reg, UBYTE *Buf, UWORD Len, UBYTE Prio)
+{
+    I2C_TXN t;
+
+    memset(&t, 0, sizeof(t));
+    t.Addr = Addr;
+    t.Reg = Reg;
+    t.Flags = I2C_TXN_READ;
+    t.Prio = Prio;
+    t.Buf = Buf;
+    t.Len = Len;
+    return I2C_Bus_Run(&t, 1);
+}
+
+/******************************************************************************
+function:	Write Len bytes from Reg on and wait until they are sent
+******************************************************************************/
+UBYTE I2C_Bus_Write(UBYTE Addr, UBYTE Reg, const UBYTE *Buf, UWORD Len, UBYTE Prio)
+{
+    I2C_TXN t;
+
+    memset(&t, 0, sizeof(t));
+    t.Addr = Addr;
+    t.Reg = Reg;
+    t.Flags = I2C_TXN_WRITE;
+    t.Prio = Prio;
+    t.Buf = (UBYTE *)Buf;
+    t.Len = Len;
+    return I2C_Bus_Run(&t, 1);
+}
+
+/******************************************************************************
+function:	Counts since the last reset
+Info:
+    Call it from one task, the same as I2C_Bus_ResetStats(). A transfer
+    that ends meanwhile may be in Transfers but not yet in Busy_us. The
+    maximum waits read 0 until the bus task started a transaction after
+    the reset.
+******************************************************************************/
+void I2C_Bus_GetStats(I2C_BUS_STATS *Stats)
+{
+    UBYTE max = __atomic_load_n(&I2C_Bus_Max_Resets, __ATOMIC_ACQUIRE) == I2C_Bus_Resets;
+
+    Stats->Transactions = DEV_Count_Since(&I2C_Bus_Stats.Transactions, I2C_Bus_Base.Transactions);
+    Stats->Transfers = DEV_Count_Since(&I2C_Bus_Stats.Transfers, I2C_Bus_Base.Transfers);
+    Stats->Bytes = DEV_Count_Since(&I2C_Bus_Stats.Bytes, I2C_Bus_Base.Bytes);
+    Stats->Busy_us = DEV_Count_Since(&I2C_Bus_Stats.Busy_us, I2C_Bus_Base.Busy_us);
+    Stats->Elapsed_us = DEV_Micros() - I2C_Bus_Reset_us;
+    Stats->Merged = DEV_Count_Since(&I2C_Bus_Stats.Merged, I2C_Bus_Base.Merged);
+    Stats->Preempted = DEV_Count_Since(&I2C_Bus_Stats.Preempted, I2C_Bus_Base.Preempted);
+    Stats->Clock_Switches = DEV_Count_Since(&I2C_Bus_Stats.Clock_Switches, I2C_Bus_Base.Clock_Switches);
+    Stats->Errors = DEV_Count_Since(&I2C_Bus_Stats.Errors, I2C_Bus_Base.Errors);
+    for(UBYTE p = 0; p < I2C_BUS_PRIOS; p++) {
+        Stats->Done[p] = DEV_Count_Since(&I2C_Bus_Stats.Done[p], I2C_Bus_Base.Done[p]);
+        Stats->Wait_us[p] = DEV_Count_Since(&I2C_Bus_Stats.Wait_us[p], I2C_Bus_Base.Wait_us[p]);
+        Stats->Max_Wait_us[p] = max ? DEV_Count_Since(&I2C_Bus_Stats.Max_Wait_us[p], 0) : 0;
+    }
+}
+
+void I2C_Bus_ResetStats(void)
+{
+    I2C_Bus_Base.Transactions = DEV_Count_Since(&I2C_Bus_Stats.Transactions, 0);
+    I2C_Bus_Base.Transfers = DEV_Count_Since(&I2C_Bus_Stats.Transfers, 0);
+    I2C_Bus_Base.Bytes = DEV_Count_Since(&I2C_Bus_Stats.Bytes, 0);
+    I2C_Bus_Base.Busy_us = DEV_Count_Since(&I2C_Bus_Stats.Busy_us, 0);
+    I2C_Bus_Base.Merged = DEV_Count_Since(&I2C_Bus_Stats.Merged, 0);
+    I2C_Bus_Base.Preempted = DEV_Count_Since(&I2C_Bus_Stats.Preempted, 0);
+    I2C_Bus_Base.Clock_Switches = DEV_Count_Since(&I2C_Bus_Stats.Clock_Switches, 0);
+    I2C_Bus_Base.Errors = DEV_Count_Since(&I2C_Bus_Stats.Errors, 0);
+    for(UBYTE p = 0; p < I2C_BUS_PRIOS; p++) {
+        I2C_Bus_Base.Done[p] = DEV_Count_Since(&I2C_Bus_Stats.Done[p], 0);
+        I2C_Bus_Base.Wait_us[p] = DEV_Count_Since(&I2C_Bus_Stats.Wait_us[p], 0);
+    }
+    I2C_Bus_Reset_us = DEV_Micros();
+    __atomic_store_n(&I2C_Bus_Resets, I2C_Bus_Resets + 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,84 @@
+/*****************************************************************************
+* | File      	:   I2C_Bus.h
+* | Function    :   One task owns the I2C bus, the drivers queue transactions
+* | Info        :
+*                The CST816S and the QMI8658 share SDA/SCL. Their drivers
+*                no longer use Wire themselves: they queue I2C_TXNs, and the
+*                bus task runs them one at a time, the highest priority
+*                first. Reads longer than I2C_BUS_CHUNK go out in pieces, so
+*                a touch read waits for one piece of an IMU burst, not all
+*                of it. Reads of one device queued together, like the IMU's
+*                timestamp and sample registers, become a single read.
+*                Each device has a clock of its own, the bus switches
+*                between them (I2C_Bus_Set_Clock).
+*                Built on DEV_I2C_Transfer: Wire on the board, a simulated
+*                bus on the host. Before I2C_Bus_Init() every transaction
+*                runs at once in the caller, like the drivers did before.
+******************************************************************************/
+#ifndef __I2C_BUS_H
+#define __I2C_BUS_H
+
+#include "DEV_Config.h"
+
+// Priorities, 0 is served first
+#define I2C_BUS_PRIO_TOUCH      0
+#define I2C_BUS_PRIO_IMU        1
+#define I2C_BUS_PRIOS           2
+
+#define I2C_BUS_CHUNK           32          // bytes per read on the wire, higher priorities go between
+#define I2C_BUS_BATCH_GAP       4           // registers a merged read may skip between two reads
+#define I2C_BUS_BATCH_TXNS      4           // reads merged into one at most
+#define I2C_BUS_DEVICES         4           // devices with a clock of their own
+#define I2C_BUS_DEFAULT_HZ      (400000)    // Fast-mode, what DEV_Module_Init() sets
+#define I2C_BUS_FAST_PLUS_HZ    (1000000)   // Fast-mode Plus
+
+// I2C_TXN.Flags
+#define I2C_TXN_READ            0x00
+#define I2C_TXN_WRITE           0x01
+#define I2C_TXN_FIFO            0x02        // every chunk reads Reg again (a FIFO port), never merged
+
+typedef struct I2C_TXN I2C_TXN;
+// Called on the bus task when Txn is done, must not wait on the bus
+typedef void (*I2C_BUS_DONE)(I2C_TXN *Txn);
+
+struct I2C_TXN{
+	UBYTE Addr;
+	UBYTE Reg;
+	UBYTE Flags;
+	UBYTE Prio;
+	UBYTE *Buf;
+	UWORD Len;
+	UBYTE Status;           // 0 = done, 1 = the device did not answer; set before Done
+	I2C_BUS_DONE Done;      // can be NULL
+	void *Arg;
+	// The bus's own
+	UDOUBLE Queued_us;
+	I2C_TXN *Next;
+};
+
+typedef struct{
+	UDOUBLE Transactions;           // done
+	UDOUBLE Transfers;              // on the wire, after merging and chunking
+	UDOUBLE Bytes;
+	UDOUBLE Busy_us;                // time on the wire
+	UDOUBLE Elapsed_us;             // since the reset, Busy_us / Elapsed_us is the utilization
+	UDOUBLE Merged;                 // reads that went with another one's transfer
+	UDOUBLE Preempted;              // chunked reads that let a higher priority go first
+	UDOUBLE Clock_Switches;
+	UDOUBLE Errors;
+	UDOUBLE Done[I2C_BUS_PRIOS];    // per priority
+	UDOUBLE Wait_us[I2C_BUS_PRIOS]; // from queued to started
+	UDOUBLE Max_Wait_us[I2C_BUS_PRIOS];
+}I2C_BUS_STATS;
+
+UBYTE I2C_Bus_Init(UBYTE Core);
+UBYTE I2C_Bus_Set_Clock(UBYTE Addr, UDOUBLE Hz);
+
+void I2C_Bus_Submit(I2C_TXN *Txns, UBYTE Count);
+UBYTE I2C_Bus_Run(I2C_TXN *Txns, UBYTE Count);
+UBYTE I2C_Bus_Read(UBYTE Addr, UBYTE Reg, UBYTE *Buf, UWORD Len, UBYTE Prio);
+UBYTE I2C_Bus_Write(UBYTE Addr, UBYTE Reg, const UBYTE *Buf, UWORD Len, UBYTE Prio);
+
+void I2C_Bus_GetStats(I2C_BUS_STATS *Stats);
+void I2C_Bus_ResetStats(void);
+#endif
@@ -0,0 +1,301 @@
+/*****************************************************************************
+* | File      	:   IMU_Fifo.cpp
+* | Function    :   QMI8658 samples in blocks from its FIFO
+* | Info        :
+*                The FIFO runs in stream mode: when nobody drains it, the
+*                oldest samples go and the status reports the overflow.
+*                A drain reads the sample count, asks for FIFO read mode
+*                with the CTRL9 handshake, reads all whole samples from
+*                the data port in one I2C_TXN_FIFO read (the bus splits it
+*                in chunks a touch read can go between) and leaves read
+*                mode again. The IMU thread is the only producer of the
+*                block ring, loop() the only consumer, through the indexes
+*                of an SPSC_Ring; the thread fills the block in its slot.
+*
+*                Each counter of the stats is only stored by the side that
+*                counts it: the interrupt, the IMU thread (and the ring's
+*                drops) or loop(). The stats calls run on loop(), so they
+*                clear its counter and keep a base for the others.
+******************************************************************************/
+#include "IMU_Fifo.h"
+#include "I2C_Bus.h"
+#include "SPSC_Ring.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if (IMU_FIFO_BLOCKS & (IMU_FIFO_BLOCKS - 1)) != 0
+#error "IMU_FIFO_BLOCKS must be a power of two"
+#endif
+
+#define IMU_FIFO_CMD_TRIES      20          // 1 ms polls of a CTRL9 handshake step
+
+static UBYTE IMU_Fifo_Addr = QMI8658_SLAVE_ADDR_L;
+static DEV_Sem IMU_Fifo_Wake = NULL;
+static IMU_NOTIFY_FUNC IMU_Fifo_Notify = NULL;
+
+static IMU_BLOCK IMU_Fifo_Ring[IMU_FIFO_BLOCKS];
+static SPSC_RING IMU_Fifo_Index;
+static UDOUBLE IMU_Fifo_Seq = 0;
+static UBYTE IMU_Fifo_Lost = 0;             // samples were lost since the last block
+static UBYTE IMU_Fifo_Raw[IMU_BLOCK_MAX * IMU_FIFO_SAMPLE_BYTES];
+
+static IMU_FIFO_STATS IMU_Fifo_Stats;
+static IMU_FIFO_STATS IMU_Fifo_Base;        // the other sides' counts at the last reset
+
+static UBYTE IMU_Fifo_Write_Reg(UBYTE Reg, UBYTE Value)
+{
+    DEV_Count(&IMU_Fifo_Stats.Bytes, 1);
+    if(I2C_Bus_Write(IMU_Fifo_Addr, Reg, &Value, 1, I2C_BUS_PRIO_IMU)) {
+        DEV_Count(&IMU_Fifo_Stats.Errors, 1);
+        return 1;
+    }
+    return 0;
+}
+
+static UBYTE IMU_Fifo_Read_Reg(UBYTE Reg, UBYTE *Buf, UWORD Len)
+{
+    DEV_Count(&IMU_Fifo_Stats.Bytes, Len);
+    if(I2C_Bus_Read(IMU_Fifo_Addr, Reg, Buf, Len, I2C_BUS_PRIO_IMU)) {
+        DEV_Count(&IMU_Fifo_Stats.Errors, 1);
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	Run a CTRL9 command
+Info:
+    The chip sets CmdDone in STATUSINT when it carried the command out,
+    the host acknowledges and waits for CmdDone to clear again.
+******************************************************************************/
+static UBYTE IMU_Fifo_Ctrl9(UBYTE Cmd)
+{
+    UBYTE status = 0, i;
+
+    if(IMU_Fifo_Write_Reg(QMI8658Register_Ctrl9, Cmd))
+        return 1;
+    for(i = 0; i < IMU_FIFO_CMD_TRIES; i++) {
+        if(IMU_Fifo_Read_Reg(QMI8658Register_StatusInt, &status, 1) == 0 && (status & QMI8658_STATUSINT_CMD_DONE))
+            break;
+        DEV_Delay_ms(1);
+    }
+    if(i == IMU_FIFO_CMD_TRIES) {
+        DEV_Count(&IMU_Fifo_Stats.Errors, 1);
+        return 1;
+    }
+    // NOP is the acknowledgement
+    if(IMU_Fifo_Write_Reg(QMI8658Register_Ctrl9, QMI8658_Ctrl9_Cmd_NOP))
+        return 1;
+    for(i = 0; i < IMU_FIFO_CMD_TRIES; i++) {
+        if(IMU_Fifo_Read_Reg(QMI8658Register_StatusInt, &status, 1) == 0 && !(status & QMI8658_STATUSINT_CMD_DONE))
+            return 0;
+        DEV_Delay_ms(1);
+    }
+    DEV_Count(&IMU_Fifo_Stats.Errors, 1);
+    return 1;
+}
+
+/******************************************************************************
+function:	Read all whole samples in the FIFO into the next block
+******************************************************************************/
+static void IMU_Fifo_Drain(void)
+{
+    UBYTE cnt[2];
+    UWORD n;
+    UDOUBLE t0 = DEV_Micros(), now, slot;
+    IMU_BLOCK *b;
+
+    // Count in 2 byte words, its top bits in the status
+    if(IMU_Fifo_Read_Reg(QMI8658Register_FifoCount, cnt, 2))
+        return;
+    now = DEV_Micros();
+    n = (UWORD)((((cnt[1] & QMI8658_FIFO_STATUS_COUNT_H) << 8) | cnt[0]) * 2 / IMU_FIFO_SAMPLE_BYTES);
+    if(n > IMU_BLOCK_MAX)
+        n = IMU_BLOCK_MAX;
+    if(cnt[1] & QMI8658_FIFO_STATUS_OVFLOW) {
+        DEV_Count(&IMU_Fifo_Stats.Overflows, 1);
+        IMU_Fifo_Lost = 1;
+    }
+    if(n == 0)
+        return;
+
+    I2C_TXN t;
+    memset(&t, 0, sizeof(t));
+    t.Addr = IMU_Fifo_Addr;
+    t.Reg = QMI8658Register_FifoData;
+    t.Flags = I2C_TXN_FIFO;
+    t.Prio = I2C_BUS_PRIO_IMU;
+    t.Buf = IMU_Fifo_Raw;
+    t.Len = n * IMU_FIFO_SAMPLE_BYTES;
+    if(IMU_Fifo_Ctrl9(QMI8658_Ctrl9_Cmd_Req_Fifo))
+        return;
+    DEV_Count(&IMU_Fifo_Stats.Bytes, t.Len);
+    if(I2C_Bus_Run(&t, 1))
+        DEV_Count(&IMU_Fifo_Stats.Errors, 1);
+    // Out of read mode, whether the read worked or not
+    IMU_Fifo_Write_Reg(QMI8658Register_FifoCtrl, QMI8658_FIFO_MODE_STREAM | IMU_FIFO_SIZE);
+    if(t.Status) {
+        IMU_Fifo_Lost = 1;
+        return;
+    }
+    DEV_Count(&IMU_Fifo_Stats.Drains, 1);
+    DEV_Count(&IMU_Fifo_Stats.Samples, n);
+
+    if(SPSC_Ring_Claim(&IMU_Fifo_Index, IMU_FIFO_BLOCKS, &slot)) {
+        IMU_Fifo_Seq += n;
+        IMU_Fifo_Lost = 1;
+        return;
+    }
+    b = &IMU_Fifo_Ring[slot];
+    b->Seq = IMU_Fifo_Seq;
+    b->Us = now;
+    b->Period_us = IMU_FIFO_PERIOD_US;
+    b->Count = n;
+    b->Overflow = IMU_Fifo_Lost;
+    for(UWORD i = 0; i < n; i++) {
+        const UBYTE *s = &IMU_Fifo_Raw[i * IMU_FIFO_SAMPLE_BYTES];
+        b->Acc[i][0] = (short)((unsigned short)(s[1] << 8) | s[0]);
+        b->Acc[i][1] = (short)((unsigned short)(s[3] << 8) | s[2]);
+        b->Acc[i][2] = (short)((unsigned short)(s[5] << 8) | s[4]);
+    }
+    IMU_Fifo_Seq += n;
+    IMU_Fifo_Lost = 0;
+    SPSC_Ring_Publish(&IMU_Fifo_Index);
+    DEV_Count(&IMU_Fifo_Stats.Drain_us, DEV_Micros() - t0);
+    if(IMU_Fifo_Notify)
+        IMU_Fifo_Notify();
+}
+
+static void IMU_Fifo_Thread(void *Arg)
+{
+    (void)Arg;
+    for(;;) {
+        DEV_Sem_Take(IMU_Fifo_Wake);
+        IMU_Fifo_Drain();
+    }
+}
+
+/******************************************************************************
+function:	Start FIFO acquisition
+parameter:
+    Addr   : the QMI8658's address, QMI8658_get_addr() after QMI8658_init()
+    Notify : wakes loop() when a block is waiting, can be NULL
+    Core   : CPU of the IMU thread
+Info:
+    Sets the accelerometer alone to IMU_FIFO_ODR and IMU_FIFO_RANGE, the
+    gyroscope off, and the FIFO watermark interrupt to INT2, with data
+    ready kept off it. Returns 0 on success; on failure the chip may be
+    left half set up, QMI8658_init() sets it up for polling again. Hand
+    IMU_Fifo_Wake_ISR() to the INT2 pin.
+******************************************************************************/
+UBYTE IMU_Fifo_Init(UBYTE Addr, IMU_NOTIFY_FUNC Notify, UBYTE Core)
+{
+    UBYTE ctrl1;
+
+    if(IMU_Fifo_Wake != NULL)
+        return 1;
+    IMU_Fifo_Addr = Addr;
+    IMU_Fifo_Notify = Notify;
+    SPSC_Ring_Init(&IMU_Fifo_Index);
+    IMU_Fifo_Seq = 0;
+    IMU_Fifo_Lost = 0;
+    memset(&IMU_Fifo_Stats, 0, sizeof(IMU_FIFO_STATS));
+    memset(&IMU_Fifo_Base, 0, sizeof(IMU_FIFO_STATS));
+
+    if(IMU_Fifo_Write_Reg(QMI8658Register_Ctrl7, QMI8658_CTRL7_DISABLE_ALL) ||
+       IMU_Fifo_Write_Reg(QMI8658Register_Ctrl2, (UBYTE)IMU_FIFO_RANGE | (UBYTE)IMU_FIFO_ODR) ||
+       IMU_Fifo_Write_Reg(QMI8658Register_FifoCtrl, QMI8658_FIFO_MODE_BYPASS) ||
+       IMU_Fifo_Ctrl9(QMI8658_Ctrl9_Cmd_Rst_Fifo) ||
+       IMU_Fifo_Write_Reg(QMI8658Register_FifoWtmTh, IMU_FIFO_WATERMARK) ||
+       IMU_Fifo_Write_Reg(QMI8658Register_FifoCtrl, QMI8658_FIFO_MODE_STREAM | IMU_FIFO_SIZE) ||
+       IMU_Fifo_Read_Reg(QMI8658Register_Ctrl1, &ctrl1, 1) ||
+       IMU_Fifo_Write_Reg(QMI8658Register_Ctrl1, (ctrl1 | QMI8658_CTRL1_INT2_ENABLE) & ~QMI8658_CTRL1_FIFO_INT1))
+        return 1;
+
+    IMU_Fifo_Wake = DEV_Sem_Create(0);
+    if(IMU_Fifo_Wake == NULL)
+        return 1;
+    if(DEV_Thread_Create_Priority(IMU_Fifo_Thread, NULL, Core, DEV_THREAD_PRIORITY)) {
+        IMU_Fifo_Wake = NULL;
+        return 1;
+    }
+    // The samples start here, with someone to take them
+    return IMU_Fifo_Write_Reg(QMI8658Register_Ctrl7, QMI8658_CTRL7_ACC_ENABLE | QMI8658_CTRL7_DRDY_DISABLE);
+}
+
+/******************************************************************************
+function:	Watermark interrupt: wake the IMU thread
+******************************************************************************/
+void DEV_ISR_ATTR IMU_Fifo_Wake_ISR(void)
+{
+    if(IMU_Fifo_Wake == NULL)
+        return;
+    DEV_Count(&IMU_Fifo_Stats.Interrupts, 1);
+    DEV_Sem_Give_ISR(IMU_Fifo_Wake);
+}
+
+/******************************************************************************
+function:	Drain without an interrupt
+Info:
+    INT2 stays high while the FIFO is above the watermark, so after a
+    missed edge no other comes. Call it when no block came for longer
+    than the watermark takes to fill.
+******************************************************************************/
+void IMU_Fifo_Poll(void)
+{
+    if(IMU_Fifo_Wake != NULL)
+        DEV_Sem_Give(IMU_Fifo_Wake);
+}
+
+/******************************************************************************
+function:	Take the oldest block
+return:
+    0 on success, 1 if no block is waiting
+******************************************************************************/
+UBYTE IMU_Fifo_Read(IMU_BLOCK *Block)
+{
+    UDOUBLE slot;
+    const IMU_BLOCK *b;
+
+    if(SPSC_Ring_Peek(&IMU_Fifo_Index, IMU_FIFO_BLOCKS, &slot))
+        return 1;
+    b = &IMU_Fifo_Ring[slot];
+    memcpy(Block, b, offsetof(IMU_BLOCK, Acc));
+    memcpy(Block->Acc, b->Acc, b->Count * sizeof(b->Acc[0]));
+    SPSC_Ring_Release(&IMU_Fifo_Index);
+    IMU_Fifo_Stats.Blocks++;
+    return 0;
+}
+
+/******************************************************************************
+function:	Counts since the last reset
+Info:
+    Call on the loop() task, like IMU_Fifo_Read() and IMU_Fifo_ResetStats().
+    A drain that ends meanwhile may be in Drains but not yet in Drain_us.
+******************************************************************************/
+void IMU_Fifo_GetStats(IMU_FIFO_STATS *Stats)
+{
+    Stats->Interrupts = DEV_Count_Since(&IMU_Fifo_Stats.Interrupts, IMU_Fifo_Base.Interrupts);
+    Stats->Drains = DEV_Count_Since(&IMU_Fifo_Stats.Drains, IMU_Fifo_Base.Drains);
+    Stats->Drain_us = DEV_Count_Since(&IMU_Fifo_Stats.Drain_us, IMU_Fifo_Base.Drain_us);
+    Stats->Samples = DEV_Count_Since(&IMU_Fifo_Stats.Samples, IMU_Fifo_Base.Samples);
+    Stats->Bytes = DEV_Count_Since(&IMU_Fifo_Stats.Bytes, IMU_Fifo_Base.Bytes);
+    Stats->Blocks = IMU_Fifo_Stats.Blocks;
+    Stats->Overflows = DEV_Count_Since(&IMU_Fifo_Stats.Overflows, IMU_Fifo_Base.Overflows);
+    Stats->Dropped = DEV_Count_Since(&IMU_Fifo_Index.Dropped, IMU_Fifo_Base.Dropped);
+    Stats->Errors = DEV_Count_Since(&IMU_Fifo_Stats.Errors, IMU_Fifo_Base.Errors);
+}
+
+void IMU_Fifo_ResetStats(void)
+{
+    IMU_Fifo_Base.Interrupts = DEV_Count_Since(&IMU_Fifo_Stats.Interrupts, 0);
+    IMU_Fifo_Base.Drains = DEV_Count_Since(&IMU_Fifo_Stats.Drains, 0);
+    IMU_Fifo_Base.Drain_us = DEV_Count_Since(&IMU_Fifo_Stats.Drain_us, 0);
+    IMU_Fifo_Base.Samples = DEV_Count_Since(&IMU_Fifo_Stats.Samples, 0);
+    IMU_Fifo_Base.Bytes = DEV_Count_Since(&IMU_Fifo_Stats.Bytes, 0);
+    IMU_Fifo_Base.Overflows = DEV_Count_Since(&IMU_Fifo_Stats.Overflows, 0);
+    IMU_Fifo_Base.Dropped = DEV_Count_Since(&IMU_Fifo_Index.Dropped, 0);
+    IMU_Fifo_Base.Errors = DEV_Count_Since(&IMU_Fifo_Stats.Errors, 0);
+    IMU_Fifo_Stats.Blocks = 0;
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************
+* | File      	:   IMU_Fifo.h
+* | Function    :   QMI8658 samples in blocks from its FIFO
+* | Info        :
+*                The accelerometer runs alone at a rate for step counting
+*                and fills the chip's FIFO. At the watermark the chip's
+*                INT2 wakes a thread of its own, which drains the FIFO in
+*                one burst read through I2C_Bus and pushes the samples as
+*                one timestamped IMU_BLOCK into a ring; loop() takes the
+*                blocks with IMU_Fifo_Read(). Every sample reaches the
+*                consumer, in one wakeup per watermark instead of a
+*                register read every 50 ms.
+******************************************************************************/
+#ifndef __IMU_FIFO_H
+#define __IMU_FIFO_H
+
+#include "DEV_Config.h"
+#include "QMI8658.h"
+
+// Walking is 1-3 steps a second; 62.5 Hz keeps the shape of a step with
+// room to spare, 1 kHz only costs power and bus time
+#define IMU_FIFO_ODR            QMI8658AccOdr_62_5Hz
+#define IMU_FIFO_PERIOD_US      16000       // of IMU_FIFO_ODR
+#define IMU_FIFO_RANGE          QMI8658AccRange_8g
+#define IMU_FIFO_LSB_PER_G      4096        // of IMU_FIFO_RANGE
+#define IMU_FIFO_WATERMARK      32          // samples per interrupt, ~0.5 s
+#define IMU_FIFO_SIZE           QMI8658_FIFO_SIZE_64
+#define IMU_FIFO_SAMPLE_BYTES   6           // x, y, z of the accelerometer
+
+#define IMU_BLOCK_MAX           64          // samples, the FIFO size
+#define IMU_FIFO_BLOCKS         4           // blocks waiting for loop(), a power of two
+
+typedef struct{
+	UDOUBLE Seq;            // samples before this block since IMU_Fifo_Init
+	UDOUBLE Us;             // time of the last sample, within one period
+	UDOUBLE Period_us;
+	UWORD Count;
+	UBYTE Overflow;         // the FIFO ran full before it, older samples were lost
+	short Acc[IMU_BLOCK_MAX][3];
+}IMU_BLOCK;
+
+// A block is waiting; called from the IMU thread
+typedef void (*IMU_NOTIFY_FUNC)(void);
+
+typedef struct{
+	UDOUBLE Interrupts;
+	UDOUBLE Drains;             // FIFO reads by the IMU thread
+	UDOUBLE Drain_us;           // time they took, none of it on loop()
+	UDOUBLE Samples;
+	UDOUBLE Bytes;              // read on the bus, counts and commands included
+	UDOUBLE Blocks;             // taken by loop()
+	UDOUBLE Overflows;          // drains that found the FIFO overrun
+	UDOUBLE Dropped;            // blocks drained while the ring was full
+	UDOUBLE Errors;             // failed bus transfers or commands
+}IMU_FIFO_STATS;
+
+UBYTE IMU_Fifo_Init(UBYTE Addr, IMU_NOTIFY_FUNC Notify, UBYTE Core);
+void DEV_ISR_ATTR IMU_Fifo_Wake_ISR(void);
+void IMU_Fifo_Poll(void);
+UBYTE IMU_Fifo_Read(IMU_BLOCK *Block);
+
+void IMU_Fifo_GetStats(IMU_FIFO_STATS *Stats);
+void IMU_Fifo_ResetStats(void);
+#endif
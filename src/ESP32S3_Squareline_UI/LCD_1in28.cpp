@@ -16,9 +16,44 @@
 
 #include <stdlib.h>		//itoa()
 #include <stdio.h>
+#include <string.h>
 
 LCD_1IN28_ATTRIBUTES LCD_1IN28;
 
+typedef struct{
+	UWORD Xstart;
+	UWORD Ystart;
+	UWORD Xend;
+	UWORD Yend;
+}LCD_1IN28_WINDOW;
+
+// Visible columns [SpanStart, SpanEnd) of every row, built at init
+static UBYTE LCD_1IN28_SpanStart[LCD_1IN28_HEIGHT];
+static UBYTE LCD_1IN28_SpanEnd[LCD_1IN28_HEIGHT];
+// Windows picked by LCD_1IN28_PlanRound, at most one per row
+static LCD_1IN28_WINDOW LCD_1IN28_Plan[LCD_1IN28_HEIGHT];
+// Column and row range last sent to the panel, 0xFFFF = unknown
+static LCD_1IN28_WINDOW LCD_1IN28_Last = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+static LCD_1IN28_STATS LCD_1IN28_Stats;
+// Staging buffer and windows of the pending batch
+static UWORD *LCD_1IN28_BatchBuf = NULL;
+static UDOUBLE LCD_1IN28_BatchSize = 0;
+static UDOUBLE LCD_1IN28_BatchUsed = 0;
+static LCD_1IN28_WINDOW LCD_1IN28_BatchWin[LCD_1IN28_BATCH_WINDOWS];
+static UWORD LCD_1IN28_BatchCount = 0;
+// Pixel format the panel was last programmed with
+static UBYTE LCD_1IN28_Colmod = LCD_1IN28_COLOR_565;
+// Byte order of the pixels handed in
+static UBYTE LCD_1IN28_Order = LCD_1IN28_ORDER_PANEL;
+// Pattern streamed by solid fills: FillColor packed for FillColmod,
+// FillColmod 0 = not built yet
+static DEV_DMA_ATTR UWORD LCD_1IN28_FillBuf[LCD_1IN28_FILL_PIXELS];
+static UWORD LCD_1IN28_FillColor = 0;
+static UBYTE LCD_1IN28_FillColmod = 0;
+// Staging buffers of the frame diff, filled and sent in turn
+static UWORD *LCD_1IN28_Stage[2] = {NULL, NULL};
+static UDOUBLE LCD_1IN28_StageSize = 0;
+
 
 /******************************************************************************
 function :	Hardware reset
@@ -137,7 +172,7 @@ static void LCD_1IN28_InitReg(void)
 	LCD_1IN28_SendData_8Bit(0x08);//Set as vertical screen
 
 	LCD_1IN28_SendCommand(0x3A);			
-	LCD_1IN28_SendData_8Bit(0x05); 
+	LCD_1IN28_SendData_8Bit(LCD_1IN28_COLOR_565); 
 
 
 	LCD_1IN28_SendCommand(0x90);			
@@ -351,12 +386,57 @@ static void LCD_1IN28_SetAttributes(UBYTE Scan_dir)
 	LCD_1IN28_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
 }
 
+/********************************************************************************
+function:	Build the table of visible columns of each row
+Info:
+		A pixel is visible when its centre lies inside the 240 px circle.
+		Coordinates are doubled so the test stays on integers.
+********************************************************************************/
+static void LCD_1IN28_InitSpans(void)
+{
+    const long D = LCD_1IN28_WIDTH;
+    UWORD x, y;
+
+    for(y = 0; y < LCD_1IN28_HEIGHT; y++) {
+        long dy = 2 * y + 1 - LCD_1IN28_HEIGHT;
+        for(x = 0; x < LCD_1IN28_WIDTH / 2; x++) {
+            long dx = 2 * x + 1 - LCD_1IN28_WIDTH;
+            if(dx * dx + dy * dy <= D * D)
+                break;
+        }
+        LCD_1IN28_SpanStart[y] = x;
+        LCD_1IN28_SpanEnd[y] = LCD_1IN28_WIDTH - x;
+    }
+}
+
+/********************************************************************************
+function:	Get the visible columns of a row
+parameter:
+		Y       :   row
+		Xstart  :   first visible column
+		Xend    :   last visible column + 1
+********************************************************************************/
+void LCD_1IN28_GetSpan(UWORD Y, UWORD *Xstart, UWORD *Xend)
+{
+    if(Y >= LCD_1IN28_HEIGHT) {
+        *Xstart = *Xend = 0;
+        return;
+    }
+    *Xstart = LCD_1IN28_SpanStart[Y];
+    *Xend = LCD_1IN28_SpanEnd[Y];
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
 ********************************************************************************/
 void LCD_1IN28_Init(UBYTE Scan_dir)
 {
+    LCD_1IN28_InitSpans();
+    LCD_1IN28_Last.Xstart = LCD_1IN28_Last.Xend = 0xFFFF;
+    LCD_1IN28_Last.Ystart = LCD_1IN28_Last.Yend = 0xFFFF;
+    LCD_1IN28_Colmod = LCD_1IN28_COLOR_565;
+
     //Turn on the backlight
     //DEV_SET_PWM(100);
     //Hardware reset
@@ -379,59 +459,399 @@ parameter:
 ********************************************************************************/
 void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    //set the X coordinates
-    LCD_1IN28_SendCommand(0x2A);
-    LCD_1IN28_SendData_8Bit(0x00);
-    LCD_1IN28_SendData_8Bit(Xstart);
-	LCD_1IN28_SendData_8Bit((Xend-1)>>8);
-    LCD_1IN28_SendData_8Bit(Xend-1);
+    LCD_1IN28_CMDLIST List;
 
-    //set the Y coordinates
-    LCD_1IN28_SendCommand(0x2B);
-    LCD_1IN28_SendData_8Bit(0x00);
-	LCD_1IN28_SendData_8Bit(Ystart);
-	LCD_1IN28_SendData_8Bit((Yend-1)>>8);  // FIXED: Was (Xend-1)>>8
-    LCD_1IN28_SendData_8Bit(Yend-1);
+    LCD_1IN28_CmdList_Init(&List);
+    LCD_1IN28_CmdList_Window(&List, Xstart, Ystart, Xend, Yend);
+    LCD_1IN28_CmdList_Submit(&List);
+}
 
-    LCD_1IN28_SendCommand(0X2C);
+/******************************************************************************
+function :	Start an empty command list
+******************************************************************************/
+void LCD_1IN28_CmdList_Init(LCD_1IN28_CMDLIST *List)
+{
+    List->Len = 0;
+    List->SegCount = 0;
 }
 
 /******************************************************************************
-function :	Clear screen
+function :	Append a command and its parameters to a command list
 parameter:
+	Cmd   : command byte, sent with DC low
+	Param : parameter bytes, sent with DC high; may be NULL if Len is 0
+	Len   : number of parameters
+Info:
+	Bytes are appended to the current segment when the DC level does not
+	change, so back to back commands without parameters cost one DC run.
 ******************************************************************************/
-extern UWORD *BlackImage;
-void LCD_1IN28_Clear(UWORD Color)
+static void LCD_1IN28_CmdList_Put(LCD_1IN28_CMDLIST *List, const UBYTE *pData, UBYTE Len, UBYTE Dc)
 {
-    UWORD j;
-    UWORD *Image = NULL;
-    Image = BlackImage;
+    UBYTE *Seg;
+
+    if(Len == 0)
+        return;
+    if(List->Len + Len > LCD_1IN28_CMDLIST_SIZE) {
+        Debug("LCD_1IN28 command list full\r\n");
+        return;
+    }
 
-    Color = ((Color<<8)&0xff00)|(Color>>8);
+    memcpy(&List->Data[List->Len], pData, Len);
+    List->Len += Len;
 
-    for (j = 0; j < LCD_1IN28_HEIGHT*LCD_1IN28_WIDTH; j++) {
-        Image[j] = Color;
+    Seg = &List->Seg[List->SegCount > 0 ? List->SegCount - 1 : 0];
+    if(List->SegCount > 0 && (*Seg & DEV_SPI_SEG_DC) == Dc &&
+       (*Seg & DEV_SPI_SEG_LEN) + Len <= DEV_SPI_SEG_LEN) {
+        *Seg += Len;
+    } else {
+        List->Seg[List->SegCount++] = Dc | Len;
     }
-    
-    LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
+}
+
+void LCD_1IN28_CmdList_Add(LCD_1IN28_CMDLIST *List, UBYTE Cmd, const UBYTE *Param, UBYTE Len)
+{
+    LCD_1IN28_CmdList_Put(List, &Cmd, 1, 0);
+    LCD_1IN28_CmdList_Put(List, Param, Len, DEV_SPI_SEG_DC);
+}
+
+/******************************************************************************
+function :	Append the CASET/RASET/RAMWR sequence of a window
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+Info:
+	The panel keeps its column and row range between writes, so a range
+	equal to the last one sent is left out. A label redrawn in place then
+	costs a single RAMWR.
+******************************************************************************/
+void LCD_1IN28_CmdList_Window(LCD_1IN28_CMDLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UBYTE Param[4];
+
+    if(Xstart != LCD_1IN28_Last.Xstart || Xend != LCD_1IN28_Last.Xend) {
+        Param[0] = Xstart >> 8;
+        Param[1] = Xstart;
+        Param[2] = (Xend-1) >> 8;
+        Param[3] = Xend-1;
+        LCD_1IN28_CmdList_Add(List, 0x2A, Param, 4);
+        LCD_1IN28_Last.Xstart = Xstart;
+        LCD_1IN28_Last.Xend = Xend;
+    } else {
+        LCD_1IN28_Stats.Skipped_Cmds++;
+    }
+
+    if(Ystart != LCD_1IN28_Last.Ystart || Yend != LCD_1IN28_Last.Yend) {
+        Param[0] = Ystart >> 8;
+        Param[1] = Ystart;
+        Param[2] = (Yend-1) >> 8;
+        Param[3] = Yend-1;
+        LCD_1IN28_CmdList_Add(List, 0x2B, Param, 4);
+        LCD_1IN28_Last.Ystart = Ystart;
+        LCD_1IN28_Last.Yend = Yend;
+    } else {
+        LCD_1IN28_Stats.Skipped_Cmds++;
+    }
+
+    LCD_1IN28_CmdList_Add(List, 0x2C, NULL, 0);
+    LCD_1IN28_Stats.Windows++;
+}
+
+/******************************************************************************
+function :	Queue a command list on the bus
+Info:
+	Goes into the same queue as the pixel data, so a window set up here
+	is in place before pixels queued afterwards. The list can be reused
+	as soon as this returns.
+******************************************************************************/
+void LCD_1IN28_CmdList_Submit(const LCD_1IN28_CMDLIST *List)
+{
+    DEV_SPI_Queue_Seq(List->Data, List->Seg, List->SegCount);
+    LCD_1IN28_Stats.Setup_Bytes += List->Len;
+    LCD_1IN28_Stats.Setup_Segs += List->SegCount;
+}
+
+/******************************************************************************
+function :	Read or clear the bus traffic counters
+******************************************************************************/
+void LCD_1IN28_GetStats(LCD_1IN28_STATS *Stats)
+{
+    *Stats = LCD_1IN28_Stats;
+}
+
+void LCD_1IN28_ResetStats(void)
+{
+    memset(&LCD_1IN28_Stats, 0, sizeof(LCD_1IN28_Stats));
+}
+
+/******************************************************************************
+function :	Switch the pixel format used on the bus
+parameter:
+	Mode : LCD_1IN28_COLOR_565 or LCD_1IN28_COLOR_444
+Info:
+	COLMOD is queued behind the windows already in flight, which were
+	packed for the old format and still go out in it.
+******************************************************************************/
+void LCD_1IN28_SetColorMode(UBYTE Mode)
+{
+    LCD_1IN28_CMDLIST List;
+
+    if(Mode != LCD_1IN28_COLOR_565 && Mode != LCD_1IN28_COLOR_444)
+        return;
+    if(Mode == LCD_1IN28_Colmod)
+        return;
+
+    LCD_1IN28_CmdList_Init(&List);
+    LCD_1IN28_CmdList_Add(&List, 0x3A, &Mode, 1);
+    LCD_1IN28_CmdList_Submit(&List);
+    LCD_1IN28_Colmod = Mode;
+}
+
+UBYTE LCD_1IN28_GetColorMode(void)
+{
+    return LCD_1IN28_Colmod;
+}
+
+/******************************************************************************
+function :	Set the byte order of the pixels handed to the driver
+parameter:
+	Order : LCD_1IN28_ORDER_PANEL or LCD_1IN28_ORDER_SWAPPED
+Info:
+	Swapped pixels are put in panel order while the batch, the frame diff
+	staging and the circle compaction copy them, which they do anyway.
+	Only a window queued straight from the caller's buffer without
+	compaction takes a pass of its own, in place.
+******************************************************************************/
+void LCD_1IN28_SetByteOrder(UBYTE Order)
+{
+    LCD_1IN28_Order = Order == LCD_1IN28_ORDER_SWAPPED ? LCD_1IN28_ORDER_SWAPPED : LCD_1IN28_ORDER_PANEL;
+}
+
+UBYTE LCD_1IN28_GetByteOrder(void)
+{
+    return LCD_1IN28_Order;
+}
+
+/******************************************************************************
+function :	Copy pixels, putting them in panel byte order
+parameter:
+	Dst    : may be Src itself, or below it for compacting in place
+	Src    : pixels in the byte order set with LCD_1IN28_SetByteOrder
+	Pixels : number of pixels
+Info:
+	In panel order this is a plain move, nothing at all if Dst is Src.
+	Swapped pixels are turned two per 32 bit word where Dst and Src are
+	aligned alike, each word read before it is written.
+******************************************************************************/
+static void LCD_1IN28_CopyPixels(UWORD *Dst, const UWORD *Src, UDOUBLE Pixels)
+{
+    UDOUBLE i = 0;
+
+    if(LCD_1IN28_Order == LCD_1IN28_ORDER_PANEL) {
+        if(Dst != Src) {
+            memmove(Dst, Src, Pixels * 2);
+            LCD_1IN28_Stats.Copy_Bytes += Pixels * 4;
+        }
+        return;
+    }
+
+    LCD_1IN28_Stats.Copy_Bytes += Pixels * 4;
+    if((((uintptr_t)Dst ^ (uintptr_t)Src) & 2) == 0) {
+        if(((uintptr_t)Dst & 2) && Pixels > 0) {
+            Dst[0] = (UWORD)((Src[0] << 8) | (Src[0] >> 8));
+            i = 1;
+        }
+        for(; i + 2 <= Pixels; i += 2) {
+            UDOUBLE w = *(const UDOUBLE *)&Src[i];
+            *(UDOUBLE *)&Dst[i] = ((w >> 8) & 0x00FF00FF) | ((w << 8) & 0xFF00FF00);
+        }
+    }
+    for(; i < Pixels; i++)
+        Dst[i] = (UWORD)((Src[i] << 8) | (Src[i] >> 8));
+}
+
+/******************************************************************************
+function :	Pack RGB565 pixels into the 12 bit stream of COLMOD 0x03
+parameter:
+	Src    : pixels in panel (big endian) byte order
+	Dst    : (Pixels * 3 + 1) / 2 bytes, may be Src itself
+	Pixels : number of pixels
+Info:
+	Two pixels RRRRGGGG BBBBRRRR GGGGBBBB per three bytes, every channel
+	cut to its top 4 bits. An odd last pixel takes two bytes, the low
+	nibble is padding the panel never completes into a pixel.
+	Each pair is read before its three bytes are written and the output
+	never gets ahead of the input, so packing in place is safe.
+******************************************************************************/
+void LCD_1IN28_Pack444(const UWORD *Src, UBYTE *Dst, UDOUBLE Pixels)
+{
+    const UBYTE *s = (const UBYTE *)Src;
+    UDOUBLE n;
+
+    for(n = Pixels >> 1; n > 0; n--) {
+        // RRRRRGGG GGGBBBBB per pixel, high byte first
+        UBYTE h0 = s[0], l0 = s[1], h1 = s[2], l1 = s[3];
+        Dst[0] = (h0 & 0xF0) | ((h0 & 0x07) << 1) | (l0 >> 7);
+        Dst[1] = ((l0 << 3) & 0xF0) | (h1 >> 4);
+        Dst[2] = ((h1 & 0x07) << 5) | ((l1 >> 3) & 0x10) | ((l1 >> 1) & 0x0F);
+        s += 4;
+        Dst += 3;
+    }
+    if(Pixels & 1) {
+        UBYTE h0 = s[0], l0 = s[1];
+        Dst[0] = (h0 & 0xF0) | ((h0 & 0x07) << 1) | (l0 >> 7);
+        Dst[1] = (l0 << 3) & 0xF0;
+    }
+}
+
+// Bytes that Pixels take on the bus in the current format
+static UDOUBLE LCD_1IN28_PixelBytes(UDOUBLE Pixels)
+{
+    if(LCD_1IN28_Colmod == LCD_1IN28_COLOR_444)
+        return (Pixels * 3 + 1) / 2;
+    return Pixels * 2;
+}
+
+/******************************************************************************
+function :	Send the pixels of the window opened last, blocking
+parameter:
+	Image  : first pixel, in the byte order set with LCD_1IN28_SetByteOrder
+	Width  : pixels per row
+	Height : rows
+	Stride : pixels from one row to the next in Image
+Info:
+	Swapped pixels, and in 444 mode all rows, go through a small buffer so
+	Image is not touched. In 444 mode a pixel left over from an odd row is carried into the next one
+	to keep the stream continuous.
+******************************************************************************/
+static void LCD_1IN28_WritePixels(const UWORD *Image, UWORD Width, UWORD Height, UWORD Stride)
+{
+    UWORD Row[LCD_1IN28_WIDTH + 1];
+    UWORD Carry = 0;
+    UWORD j;
+
     DEV_Digital_Write(LCD_DC_PIN, 1);
-    for(j = 0; j < LCD_1IN28_HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
+    for(j = 0; j < Height; j++) {
+        const UWORD *Line = Image + (UDOUBLE)j * Stride;
+        UWORD n;
+
+        if(LCD_1IN28_Colmod != LCD_1IN28_COLOR_444) {
+            if(LCD_1IN28_Order == LCD_1IN28_ORDER_SWAPPED) {
+                LCD_1IN28_CopyPixels(Row, Line, Width);
+                Line = Row;
+            }
+            DEV_SPI_Write_nByte((uint8_t *)Line, Width * 2);
+            continue;
+        }
+        LCD_1IN28_CopyPixels(&Row[Carry], Line, Width);
+        n = Carry + Width;
+        LCD_1IN28_Pack444(Row, (UBYTE *)Row, n & ~1);
+        DEV_SPI_Write_nByte((uint8_t *)Row, (n >> 1) * 3);
+        Carry = n & 1;
+        if(Carry)
+            Row[0] = Row[n - 1];
+    }
+    if(Carry) {
+        LCD_1IN28_Pack444(Row, (UBYTE *)Row, 1);
+        DEV_SPI_Write_nByte((uint8_t *)Row, 2);
     }
 }
 
+/******************************************************************************
+function :	Cover the visible part of a window with as few bus bytes as possible
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+Info:
+	Walks the rows top to bottom. A row joins the current window when
+	widening it to the row's span costs fewer bytes than the
+	LCD_1IN28_WINDOW_SETUP of a window of its own, so flat parts of the
+	circle merge and steep ones get per-row windows. The plain rectangle
+	is kept if it is cheaper still.
+	Fills LCD_1IN28_Plan and returns the number of windows, 0 if the
+	window lies entirely outside the circle.
+******************************************************************************/
+static UWORD LCD_1IN28_PlanRound(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    LCD_1IN28_WINDOW *Win = NULL;
+    UWORD Count = 0;
+    UDOUBLE Cost = 0;
+    UWORD y;
+
+    for(y = Ystart; y < Yend; y++) {
+        UWORD X0 = LCD_1IN28_SpanStart[y] > Xstart ? LCD_1IN28_SpanStart[y] : Xstart;
+        UWORD X1 = LCD_1IN28_SpanEnd[y] < Xend ? LCD_1IN28_SpanEnd[y] : Xend;
+        if(X0 >= X1) {
+            Win = NULL;
+            continue;
+        }
+
+        if(Win != NULL) {
+            UWORD NX0 = X0 < Win->Xstart ? X0 : Win->Xstart;
+            UWORD NX1 = X1 > Win->Xend ? X1 : Win->Xend;
+            UDOUBLE Rows = y - Win->Ystart;
+            UDOUBLE Grow = ((NX1 - NX0) * (Rows + 1) - (Win->Xend - Win->Xstart) * Rows) * 2;
+            if(Grow <= LCD_1IN28_WINDOW_SETUP + (UDOUBLE)(X1 - X0) * 2) {
+                Win->Xstart = NX0;
+                Win->Xend = NX1;
+                Win->Yend = y + 1;
+                Cost += Grow;
+                continue;
+            }
+        }
+
+        Win = &LCD_1IN28_Plan[Count++];
+        Win->Xstart = X0;
+        Win->Ystart = y;
+        Win->Xend = X1;
+        Win->Yend = y + 1;
+        Cost += LCD_1IN28_WINDOW_SETUP + (UDOUBLE)(X1 - X0) * 2;
+    }
+
+    if(Count > 1 && Cost >= LCD_1IN28_WINDOW_SETUP + (UDOUBLE)(Xend - Xstart) * (Yend - Ystart) * 2) {
+        LCD_1IN28_Plan[0].Xstart = Xstart;
+        LCD_1IN28_Plan[0].Ystart = Ystart;
+        LCD_1IN28_Plan[0].Xend = Xend;
+        LCD_1IN28_Plan[0].Yend = Yend;
+        Count = 1;
+    }
+    return Count;
+}
+
+/******************************************************************************
+function :	Plan the windows of an area: the visible part with
+			LCD_1IN28_ROUND, else the area itself
+Info:
+	Fills LCD_1IN28_Plan and returns the number of windows.
+******************************************************************************/
+static UWORD LCD_1IN28_PlanWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+#if LCD_1IN28_ROUND
+    return LCD_1IN28_PlanRound(Xstart, Ystart, Xend, Yend);
+#else
+    LCD_1IN28_Plan[0].Xstart = Xstart;
+    LCD_1IN28_Plan[0].Ystart = Ystart;
+    LCD_1IN28_Plan[0].Xend = Xend;
+    LCD_1IN28_Plan[0].Yend = Yend;
+    return 1;
+#endif
+}
+
+/******************************************************************************
+function :	Clear screen
+parameter:
+******************************************************************************/
+void LCD_1IN28_Clear(UWORD Color)
+{
+    LCD_1IN28_FillWindows_Async(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, Color, NULL);
+    LCD_1IN28_Wait();
+}
+
 /******************************************************************************
 function :	Sends the image buffer in RAM to displays
 parameter:
 ******************************************************************************/
 void LCD_1IN28_Display(UWORD *Image)
 {
-    UWORD j;
     LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);;
-    for (j = 0; j < LCD_1IN28_HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
-    }
+    LCD_1IN28_WritePixels(Image, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, LCD_1IN28_WIDTH);
 }
 
 void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
@@ -439,19 +859,412 @@ void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend
     // display
     UDOUBLE Addr = 0;
 
-    UWORD j;
+#if LCD_1IN28_ROUND
+    UWORD i, Count = LCD_1IN28_PlanRound(Xstart, Ystart, Xend, Yend);
+    for(i = 0; i < Count; i++){
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_Plan[i];
+        LCD_1IN28_SetWindows(Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+        Addr = Win->Xstart + Win->Ystart * LCD_1IN28_WIDTH;
+        LCD_1IN28_WritePixels(&Image[Addr], Win->Xend - Win->Xstart, Win->Yend - Win->Ystart, LCD_1IN28_WIDTH);
+    }
+    return;
+#endif
+
     LCD_1IN28_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);;
-    for (j = Ystart; j < Yend ; j++) {
-        Addr = Xstart + j * LCD_1IN28_WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
+    Addr = Xstart + Ystart * LCD_1IN28_WIDTH;
+    LCD_1IN28_WritePixels(&Image[Addr], Xend - Xstart, Yend - Ystart, LCD_1IN28_WIDTH);
+}
+
+/******************************************************************************
+function :	Queue a window of pixels without waiting for the bus
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+	Image : Xend-Xstart by Yend-Ystart pixels, packed row after row,
+	        already in panel byte order; must stay untouched until done.
+	        In 444 mode it is packed into the 12 bit stream in place
+	Arg   : handed to the DEV_SPI done callback once the last pixel is out
+******************************************************************************/
+static void LCD_1IN28_QueueWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image, void *Arg)
+{
+    LCD_1IN28_CMDLIST List;
+    UDOUBLE Pixels = (UDOUBLE)(Xend-Xstart) * (Yend-Ystart);
+    UDOUBLE Len = LCD_1IN28_PixelBytes(Pixels);
+
+    if(LCD_1IN28_Colmod == LCD_1IN28_COLOR_444)
+        LCD_1IN28_Pack444(Image, (UBYTE *)Image, Pixels);
+
+    LCD_1IN28_CmdList_Init(&List);
+    LCD_1IN28_CmdList_Window(&List, Xstart, Ystart, Xend, Yend);
+    LCD_1IN28_CmdList_Submit(&List);
+
+    DEV_SPI_Queue_nByte((const uint8_t *)Image, Len, 1, Arg);
+    LCD_1IN28_Stats.Pixel_Bytes += Len;
+}
+
+/******************************************************************************
+function :	Queue a window of pixels from the caller's buffer
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+	Image : packed pixels in the byte order set with LCD_1IN28_SetByteOrder;
+	        swapped ones are turned in place, and in 444 mode packed, so
+	        the content is not preserved. Must stay untouched until done
+	Arg   : handed to the DEV_SPI done callback once the last pixel is out
+******************************************************************************/
+void LCD_1IN28_DisplayWindows_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image, void *Arg)
+{
+    LCD_1IN28_CopyPixels(Image, Image, (UDOUBLE)(Xend - Xstart) * (Yend - Ystart));
+    LCD_1IN28_Stats.Flushes++;
+    LCD_1IN28_QueueWindow(Xstart, Ystart, Xend, Yend, Image, Arg);
+}
+
+/******************************************************************************
+function :	Queue only the part of a window that is inside the circle
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+	Image : packed pixels as for LCD_1IN28_DisplayWindows_Async; the
+	        visible pixels are compacted in place, so the content is
+	        not preserved
+	Arg   : handed to the DEV_SPI done callback once the last pixel is out
+Info:
+	Returns the number of windows queued. With 0 nothing was visible
+	and the done callback will not run for Arg.
+******************************************************************************/
+UWORD LCD_1IN28_DisplayWindows_Round_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image, void *Arg)
+{
+    UWORD Count = LCD_1IN28_PlanRound(Xstart, Ystart, Xend, Yend);
+    UWORD Width = Xend - Xstart;
+    UWORD *Dst = Image;
+    UWORD i, j;
+
+    for(i = 0; i < Count; i++) {
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_Plan[i];
+        UWORD W = Win->Xend - Win->Xstart;
+        UWORD *Start = Dst;
+
+        // Rows only ever shrink, so Dst never overtakes the rows still to
+        // be read nor the windows already queued
+        for(j = Win->Ystart; j < Win->Yend; j++) {
+            LCD_1IN28_CopyPixels(Dst, Image + (UDOUBLE)(j - Ystart) * Width + (Win->Xstart - Xstart), W);
+            Dst += W;
+        }
+        LCD_1IN28_QueueWindow(Win->Xstart, Win->Ystart, Win->Xend, Win->Yend, Start,
+                              i == Count - 1 ? Arg : NULL);
     }
+    LCD_1IN28_Stats.Flushes++;
+    return Count;
 }
 
+/******************************************************************************
+function :	Give the batch its staging buffer
+parameter:
+	Buffer : DMA capable, Size pixels
+******************************************************************************/
+void LCD_1IN28_Batch_Init(UWORD *Buffer, UDOUBLE Size)
+{
+    LCD_1IN28_BatchBuf = Buffer;
+    LCD_1IN28_BatchSize = Size;
+    LCD_1IN28_BatchUsed = 0;
+    LCD_1IN28_BatchCount = 0;
+}
+
+/******************************************************************************
+function :	Copy a window into the pending batch
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+	Image : packed pixels as for LCD_1IN28_DisplayWindows_Async
+Info:
+	With LCD_1IN28_ROUND only the visible spans are copied. Image is free
+	again once this returns 1. Returns 0, and copies nothing, when the
+	window does not fit the staging buffer; send it directly then.
+	The staging buffer is read by the DMA after LCD_1IN28_Batch_Submit,
+	the caller must not add to the next batch before that is done.
+******************************************************************************/
+UBYTE LCD_1IN28_Batch_Add(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Image)
+{
+    UWORD Width = Xend - Xstart;
+    UDOUBLE Pixels = 0;
+    UWORD i, j, Count;
+
+    Count = LCD_1IN28_PlanWindows(Xstart, Ystart, Xend, Yend);
+
+    for(i = 0; i < Count; i++) {
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_Plan[i];
+        Pixels += (UDOUBLE)(Win->Xend - Win->Xstart) * (Win->Yend - Win->Ystart);
+    }
+    if(LCD_1IN28_BatchBuf == NULL ||
+       LCD_1IN28_BatchCount + Count > LCD_1IN28_BATCH_WINDOWS ||
+       LCD_1IN28_BatchUsed + Pixels > LCD_1IN28_BatchSize)
+        return 0;
+
+    for(i = 0; i < Count; i++) {
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_Plan[i];
+        UWORD W = Win->Xend - Win->Xstart;
+        for(j = Win->Ystart; j < Win->Yend; j++) {
+            LCD_1IN28_CopyPixels(&LCD_1IN28_BatchBuf[LCD_1IN28_BatchUsed],
+                                 Image + (UDOUBLE)(j - Ystart) * Width + (Win->Xstart - Xstart), W);
+            LCD_1IN28_BatchUsed += W;
+        }
+        LCD_1IN28_BatchWin[LCD_1IN28_BatchCount++] = *Win;
+    }
+    LCD_1IN28_Stats.Flushes++;
+    return 1;
+}
+
+/******************************************************************************
+function :	Queue every window of the pending batch back to back
+parameter:
+	Arg : handed to the DEV_SPI done callback once the last pixel is out
+Info:
+	Returns 0 if the batch was empty; the done callback will not run for
+	Arg then.
+******************************************************************************/
+UBYTE LCD_1IN28_Batch_Submit(void *Arg)
+{
+    UWORD *Image = LCD_1IN28_BatchBuf;
+    UWORD i;
+
+    if(LCD_1IN28_BatchCount == 0)
+        return 0;
+
+    for(i = 0; i < LCD_1IN28_BatchCount; i++) {
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_BatchWin[i];
+        LCD_1IN28_QueueWindow(Win->Xstart, Win->Ystart, Win->Xend, Win->Yend, Image,
+                              i == LCD_1IN28_BatchCount - 1 ? Arg : NULL);
+        Image += (UDOUBLE)(Win->Xend - Win->Xstart) * (Win->Yend - Win->Ystart);
+    }
+    LCD_1IN28_BatchCount = 0;
+    LCD_1IN28_BatchUsed = 0;
+    LCD_1IN28_Stats.Batches++;
+    return 1;
+}
+
+/******************************************************************************
+function :	Make the fill pattern hold Color in the current pixel format
+Info:
+	The pattern may still be read by the DMA for an earlier fill, so the
+	bus has to be idle before it changes.
+******************************************************************************/
+static void LCD_1IN28_FillPattern(UWORD Color)
+{
+    UWORD Pixel = ((Color<<8)&0xff00)|(Color>>8);
+    UWORD i;
+
+    if(Color == LCD_1IN28_FillColor && LCD_1IN28_Colmod == LCD_1IN28_FillColmod)
+        return;
+
+    DEV_SPI_Wait_Idle();
+    for(i = 0; i < LCD_1IN28_FILL_PIXELS; i++)
+        LCD_1IN28_FillBuf[i] = Pixel;
+    // A single color in 444 repeats every three bytes, every chunk of the
+    // packed pattern starts in phase
+    if(LCD_1IN28_Colmod == LCD_1IN28_COLOR_444)
+        LCD_1IN28_Pack444(LCD_1IN28_FillBuf, (UBYTE *)LCD_1IN28_FillBuf, LCD_1IN28_FILL_PIXELS);
+    LCD_1IN28_FillColor = Color;
+    LCD_1IN28_FillColmod = LCD_1IN28_Colmod;
+}
+
+/******************************************************************************
+function :	Queue a solid color over a window without a framebuffer
+parameter:
+	Xstart, Ystart, Xend, Yend : window, end coordinates exclusive
+	Color : RGB565
+	Arg   : handed to the DEV_SPI done callback once the last pixel is out
+Info:
+	Each window streams the LCD_1IN28_FILL_PIXELS pattern as many times as
+	it needs, nothing is rendered or copied. With LCD_1IN28_ROUND only the
+	visible part is sent. Returns the number of windows queued; with 0 the
+	done callback will not run for Arg.
+******************************************************************************/
+UWORD LCD_1IN28_FillWindows_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, void *Arg)
+{
+    UWORD Count = LCD_1IN28_PlanWindows(Xstart, Ystart, Xend, Yend);
+    UDOUBLE Chunk, Len, n;
+    UWORD i;
+
+    LCD_1IN28_Stats.Fills++;
+    if(Count == 0)
+        return 0;
+
+    LCD_1IN28_FillPattern(Color);
+    Chunk = LCD_1IN28_PixelBytes(LCD_1IN28_FILL_PIXELS);
+    for(i = 0; i < Count; i++) {
+        LCD_1IN28_WINDOW *Win = &LCD_1IN28_Plan[i];
+        LCD_1IN28_SetWindows(Win->Xstart, Win->Ystart, Win->Xend, Win->Yend);
+
+        Len = LCD_1IN28_PixelBytes((UDOUBLE)(Win->Xend - Win->Xstart) * (Win->Yend - Win->Ystart));
+        LCD_1IN28_Stats.Pixel_Bytes += Len;
+        while(Len > 0) {
+            n = Len > Chunk ? Chunk : Len;
+            Len -= n;
+            DEV_SPI_Queue_nByte((const uint8_t *)LCD_1IN28_FillBuf, n, 1,
+                                (i == Count - 1 && Len == 0) ? Arg : NULL);
+        }
+    }
+    return Count;
+}
+
+/******************************************************************************
+function :	Give the frame diff its staging buffers
+parameter:
+	Stage1, Stage2 : DMA capable, Size pixels each, at least one row
+******************************************************************************/
+void LCD_1IN28_Diff_Init(UWORD *Stage1, UWORD *Stage2, UDOUBLE Size)
+{
+    LCD_1IN28_Stage[0] = Stage1;
+    LCD_1IN28_Stage[1] = Stage2;
+    LCD_1IN28_StageSize = Size;
+}
+
+/******************************************************************************
+function :	Find the columns of a row that differ between two frames
+parameter:
+	Front, Back  : the row in both frames, 4 byte aligned
+	Xstart, Xend : columns to compare, end exclusive
+	Dstart, Dend : first and last changed column + 1
+Info:
+	Compares two pixels per 32 bit word from both ends towards the middle,
+	only the two words where it stops are looked at pixel by pixel.
+	Returns 0 if nothing in [Xstart, Xend) changed.
+******************************************************************************/
+static UBYTE LCD_1IN28_DiffRow(const UWORD *Front, const UWORD *Back, UWORD Xstart, UWORD Xend, UWORD *Dstart, UWORD *Dend)
+{
+    const UDOUBLE *F = (const UDOUBLE *)Front;
+    const UDOUBLE *B = (const UDOUBLE *)Back;
+    UWORD First = Xstart >> 1;
+    UWORD Last = (Xend + 1) >> 1;
+    UWORD X0, X1;
+
+    while(First < Last && F[First] == B[First])
+        First++;
+    if(First == Last)
+        return 0;
+    while(F[Last - 1] == B[Last - 1])
+        Last--;
+
+    X0 = First * 2;
+    if(Front[X0] == Back[X0])
+        X0++;
+    X1 = Last * 2;
+    if(Front[X1 - 1] == Back[X1 - 1])
+        X1--;
+
+    // The words at the ends may reach one column past the range
+    if(X0 < Xstart)
+        X0 = Xstart;
+    if(X1 > Xend)
+        X1 = Xend;
+    if(X0 >= X1)
+        return 0;
+    *Dstart = X0;
+    *Dend = X1;
+    return 1;
+}
+
+/******************************************************************************
+function :	Queue what changed between the frame on the panel and the next
+parameter:
+	Front    : full frame on the panel, 4 byte aligned, in the byte order
+	           set with LCD_1IN28_SetByteOrder
+	Back     : full frame to show, same layout
+	RowStart : per row, first column that may have changed
+	RowEnd   : per row, last column that may have changed + 1; rows with
+	           RowEnd <= RowStart are not compared
+	Arg      : handed to the DEV_SPI done callback once the last pixel is out
+Info:
+	Every row is diffed word by word inside its range (and the circle with
+	LCD_1IN28_ROUND). The changed spans are merged into windows the same
+	way LCD_1IN28_PlanRound merges circle rows, unchanged rows in between
+	included when that is cheaper than another window setup. Each window
+	is copied into a staging buffer while the previous one is on the bus,
+	turned into panel byte order on the way, so Front and Back are free again once this returns and stay untouched.
+	Returns the number of windows queued; with 0 the done callback will
+	not run for Arg. Needs LCD_1IN28_Diff_Init first.
+******************************************************************************/
+UWORD LCD_1IN28_DisplayDiff_Async(const UWORD *Front, const UWORD *Back, const UWORD *RowStart, const UWORD *RowEnd, void *Arg)
+{
+    LCD_1IN28_WINDOW *Win = NULL;
+    UWORD Count = 0;
+    UWORD i, y;
+
+    if(LCD_1IN28_Stage[0] == NULL || LCD_1IN28_Stage[1] == NULL)
+        return 0;
+
+    for(y = 0; y < LCD_1IN28_HEIGHT; y++) {
+        UDOUBLE Row = (UDOUBLE)y * LCD_1IN28_WIDTH;
+        UWORD X0 = RowStart[y];
+        UWORD X1 = RowEnd[y] < LCD_1IN28_WIDTH ? RowEnd[y] : LCD_1IN28_WIDTH;
+#if LCD_1IN28_ROUND
+        if(X0 < LCD_1IN28_SpanStart[y])
+            X0 = LCD_1IN28_SpanStart[y];
+        if(X1 > LCD_1IN28_SpanEnd[y])
+            X1 = LCD_1IN28_SpanEnd[y];
+#endif
+        if(X0 >= X1)
+            continue;
+        LCD_1IN28_Stats.Diff_Pixels += X1 - X0;
+        if(!LCD_1IN28_DiffRow(Front + Row, Back + Row, X0, X1, &X0, &X1))
+            continue;
+        LCD_1IN28_Stats.Diff_Changed += X1 - X0;
+
+        if(Win != NULL) {
+            UWORD NX0 = X0 < Win->Xstart ? X0 : Win->Xstart;
+            UWORD NX1 = X1 > Win->Xend ? X1 : Win->Xend;
+            UDOUBLE Pixels = (UDOUBLE)(NX1 - NX0) * (y + 1 - Win->Ystart);
+            UDOUBLE Grow = (Pixels - (UDOUBLE)(Win->Xend - Win->Xstart) * (Win->Yend - Win->Ystart)) * 2;
+            if(Pixels <= LCD_1IN28_StageSize &&
+               Grow <= LCD_1IN28_WINDOW_SETUP + (UDOUBLE)(X1 - X0) * 2) {
+                Win->Xstart = NX0;
+                Win->Xend = NX1;
+                Win->Yend = y + 1;
+                continue;
+            }
+        }
+
+        Win = &LCD_1IN28_Plan[Count++];
+        Win->Xstart = X0;
+        Win->Ystart = y;
+        Win->Xend = X1;
+        Win->Yend = y + 1;
+    }
+
+    LCD_1IN28_Stats.Flushes++;
+    for(i = 0; i < Count; i++) {
+        LCD_1IN28_WINDOW *Plan = &LCD_1IN28_Plan[i];
+        UWORD *Stage = LCD_1IN28_Stage[i & 1];
+        UWORD W = Plan->Xend - Plan->Xstart;
+        UWORD *Dst = Stage;
+
+        for(y = Plan->Ystart; y < Plan->Yend; y++) {
+            LCD_1IN28_CopyPixels(Dst, Back + (UDOUBLE)y * LCD_1IN28_WIDTH + Plan->Xstart, W);
+            Dst += W;
+        }
+        // The previous window goes out of the other buffer meanwhile, the
+        // one before it used this buffer and is done by now
+        DEV_SPI_Wait_Idle();
+        LCD_1IN28_QueueWindow(Plan->Xstart, Plan->Ystart, Plan->Xend, Plan->Yend, Stage,
+                              i == Count - 1 ? Arg : NULL);
+    }
+    return Count;
+}
+
+/******************************************************************************
+function :	Wait until every queued window has been sent
+******************************************************************************/
+void LCD_1IN28_Wait(void)
+{
+    DEV_SPI_Wait_Idle();
+}
 
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
     LCD_1IN28_SetWindows(X,Y,X,Y);
+    if(LCD_1IN28_Colmod == LCD_1IN28_COLOR_444) {
+        UWORD Pixel = ((Color<<8)&0xff00)|(Color>>8);
+        LCD_1IN28_Pack444(&Pixel, (UBYTE *)&Pixel, 1);
+        LCD_1IN28_SendData_8Bit(((UBYTE *)&Pixel)[0]);
+        LCD_1IN28_SendData_8Bit(((UBYTE *)&Pixel)[1]);
+        return;
+    }
     LCD_1IN28_SendData_16Bit(Color);
 }
 
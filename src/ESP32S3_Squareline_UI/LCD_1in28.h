@@ -29,6 +29,27 @@
 #define HORIZONTAL 0
 #define VERTICAL   1
 
+// The glass is a 240 px circle: with LCD_1IN28_ROUND the driver only
+// clocks out pixels inside it
+#define LCD_1IN28_ROUND         1
+// Bytes spent on one window: 0x2A + 4, 0x2B + 4, 0x2C
+#define LCD_1IN28_WINDOW_SETUP  11
+
+// Pixel formats on the bus, the value is the COLMOD parameter.
+// 444 packs two pixels into three bytes, a quarter less than 565
+#define LCD_1IN28_COLOR_565     0x05
+#define LCD_1IN28_COLOR_444     0x03
+
+// Byte order of the RGB565 pixels handed to the driver. The panel takes
+// them high byte first; swapped ones (LVGL without LV_COLOR_16_SWAP) are
+// turned on the copies the driver makes on the way to the bus
+#define LCD_1IN28_ORDER_PANEL   0
+#define LCD_1IN28_ORDER_SWAPPED 1
+
+// Solid fills stream one small pattern buffer over and over instead of a
+// framebuffer. Even, and a multiple of 2 px = 3 bytes in 444 mode
+#define LCD_1IN28_FILL_PIXELS   1920
+
 typedef struct{
 	UWORD WIDTH;
 	UWORD HEIGHT;
@@ -36,6 +57,35 @@ typedef struct{
 }LCD_1IN28_ATTRIBUTES;
 extern LCD_1IN28_ATTRIBUTES LCD_1IN28;
 
+// Commands and parameters collected into one buffer and queued together,
+// consecutive bytes with the same DC level form one segment
+#define LCD_1IN28_CMDLIST_SIZE  32
+
+typedef struct{
+	UBYTE Data[LCD_1IN28_CMDLIST_SIZE];
+	UBYTE Seg[LCD_1IN28_CMDLIST_SIZE];  // DEV_SPI_SEG_DC | length
+	UBYTE Len;
+	UBYTE SegCount;
+}LCD_1IN28_CMDLIST;
+
+// Bus traffic since the last LCD_1IN28_ResetStats
+typedef struct{
+	UDOUBLE Flushes;        // async window requests
+	UDOUBLE Windows;        // CASET/RASET/RAMWR windows opened
+	UDOUBLE Setup_Bytes;    // command and parameter bytes
+	UDOUBLE Setup_Segs;     // DC runs, one SPI transaction each
+	UDOUBLE Skipped_Cmds;   // CASET/RASET left out, window edge unchanged
+	UDOUBLE Pixel_Bytes;
+	UDOUBLE Batches;        // LCD_1IN28_Batch_Submit calls that sent something
+	UDOUBLE Fills;          // LCD_1IN28_FillWindows_Async calls
+	UDOUBLE Diff_Pixels;    // framebuffer pixels compared by LCD_1IN28_DisplayDiff_Async
+	UDOUBLE Diff_Changed;   // of those, pixels in changed spans
+	UDOUBLE Copy_Bytes;     // pixel bytes read plus written by copies and byte swaps
+}LCD_1IN28_STATS;
+
+// Windows collected by LCD_1IN28_Batch_Add until the next submit
+#define LCD_1IN28_BATCH_WINDOWS 32
+
 /********************************************************************************
 function:
 			Macro definition variable name
@@ -46,4 +96,33 @@ void LCD_1IN28_Display(UWORD *Image);
 void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+void LCD_1IN28_DisplayWindows_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image, void *Arg);
+void LCD_1IN28_Wait(void);
+
+void LCD_1IN28_CmdList_Init(LCD_1IN28_CMDLIST *List);
+void LCD_1IN28_CmdList_Add(LCD_1IN28_CMDLIST *List, UBYTE Cmd, const UBYTE *Param, UBYTE Len);
+void LCD_1IN28_CmdList_Window(LCD_1IN28_CMDLIST *List, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void LCD_1IN28_CmdList_Submit(const LCD_1IN28_CMDLIST *List);
+
+void LCD_1IN28_Batch_Init(UWORD *Buffer, UDOUBLE Size);
+UBYTE LCD_1IN28_Batch_Add(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Image);
+UBYTE LCD_1IN28_Batch_Submit(void *Arg);
+
+void LCD_1IN28_GetStats(LCD_1IN28_STATS *Stats);
+void LCD_1IN28_ResetStats(void);
+
+void LCD_1IN28_GetSpan(UWORD Y, UWORD *Xstart, UWORD *Xend);
+UWORD LCD_1IN28_DisplayWindows_Round_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image, void *Arg);
+
+UWORD LCD_1IN28_FillWindows_Async(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, void *Arg);
+
+void LCD_1IN28_Diff_Init(UWORD *Stage1, UWORD *Stage2, UDOUBLE Size);
+UWORD LCD_1IN28_DisplayDiff_Async(const UWORD *Front, const UWORD *Back, const UWORD *RowStart, const UWORD *RowEnd, void *Arg);
+
+void LCD_1IN28_SetColorMode(UBYTE Mode);
+UBYTE LCD_1IN28_GetColorMode(void);
+void LCD_1IN28_SetByteOrder(UBYTE Order);
+UBYTE LCD_1IN28_GetByteOrder(void);
+void LCD_1IN28_Pack444(const UWORD *Src, UBYTE *Dst, UDOUBLE Pixels);
 #endif
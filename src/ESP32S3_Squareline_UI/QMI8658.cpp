@@ -1,9 +1,8 @@
 
 //#include "stdafx.h"
 #include "QMI8658.h"
+#include "I2C_Bus.h"
 
-#define QMI8658_SLAVE_ADDR_L 0x6a
-#define QMI8658_SLAVE_ADDR_H 0x6b
 #define QMI8658_printf printf
 
 #define QMI8658_UINT_MG_DPS
@@ -38,7 +37,7 @@ unsigned char QMI8658_write_reg(unsigned char reg, unsigned char value)
 
 	while ((!ret) && (retry++ < 5))
 	{
-		DEV_I2C_Write_Byte(QMI8658_slave_addr, reg, value);
+		ret = I2C_Bus_Write(QMI8658_slave_addr, reg, &value, 1, I2C_BUS_PRIO_IMU) == 0;
 	}
 	return ret;
 }
@@ -57,11 +56,8 @@ unsigned char QMI8658_write_regs(unsigned char reg, unsigned char *value, unsign
 
 unsigned char QMI8658_read_reg(unsigned char reg, unsigned char *buf, unsigned short len)
 {
-	unsigned char ret = 0;
-	unsigned int retry = 0;
-	DEV_I2C_Read_nByte(QMI8658_slave_addr, reg, buf, len);
-
-	return ret;
+	// Through the bus task, touch reads go first
+	return I2C_Bus_Read(QMI8658_slave_addr, reg, buf, len, I2C_BUS_PRIO_IMU);
 }
 
 #if 0
@@ -409,12 +405,24 @@ void QMI8658_read_xyz(float acc[3], float gyro[3], unsigned int *tim_count)
 void QMI8658_read_xyz_raw(short raw_acc_xyz[3], short raw_gyro_xyz[3], unsigned int *tim_count)
 {
 	unsigned char buf_reg[12];
+	unsigned char buf[3];
+	I2C_TXN txn[2];
+
+	// Queued together, the bus reads the timestamp and the sample in one go
+	memset(txn, 0, sizeof(txn));
+	txn[0].Addr = txn[1].Addr = QMI8658_slave_addr;
+	txn[0].Prio = txn[1].Prio = I2C_BUS_PRIO_IMU;
+	txn[0].Reg = QMI8658Register_Ax_L; // 0x19, 25
+	txn[0].Buf = buf_reg;
+	txn[0].Len = 12;
+	txn[1].Reg = QMI8658Register_Timestamp_L; // 0x18	24
+	txn[1].Buf = buf;
+	txn[1].Len = 3;
+	I2C_Bus_Run(txn, tim_count ? 2 : 1);
 
 	if (tim_count)
 	{
-		unsigned char buf[3];
 		unsigned int timestamp;
-		QMI8658_read_reg(QMI8658Register_Timestamp_L, buf, 3); // 0x18	24
 		timestamp = (unsigned int)(((unsigned int)buf[2] << 16) | ((unsigned int)buf[1] << 8) | buf[0]);
 		if (timestamp > imu_timestamp)
 			imu_timestamp = timestamp;
@@ -423,7 +431,6 @@ void QMI8658_read_xyz_raw(short raw_acc_xyz[3], short raw_gyro_xyz[3], unsigned
 
 		*tim_count = imu_timestamp;
 	}
-	QMI8658_read_reg(QMI8658Register_Ax_L, buf_reg, 12); // 0x19, 25
 
 	raw_acc_xyz[0] = (short)((unsigned short)(buf_reg[1] << 8) | (buf_reg[0]));
 	raw_acc_xyz[1] = (short)((unsigned short)(buf_reg[3] << 8) | (buf_reg[2]));
@@ -532,6 +539,12 @@ void QMI8658_Config_apply(struct QMI8658Config const *config)
 	QMI8658_enableSensors(fisSensors);
 }
 
+// The address QMI8658_init() found the chip at
+unsigned char QMI8658_get_addr(void)
+{
+	return QMI8658_slave_addr;
+}
+
 unsigned char QMI8658_init(void)
 {
 	unsigned char QMI8658_chip_id = 0x00;
@@ -13,6 +13,9 @@
 #define ONE_G (9.807f)
 #endif
 
+#define QMI8658_SLAVE_ADDR_L 0x6a
+#define QMI8658_SLAVE_ADDR_H 0x6b
+
 #define QMI8658_CTRL7_DISABLE_ALL (0x0)
 #define QMI8658_CTRL7_ACC_ENABLE (0x1)
 #define QMI8658_CTRL7_GYR_ENABLE (0x2)
@@ -30,6 +33,27 @@
 #define QMI8658_CONFIG_AEMAG_ENABLE (QMI8658_CONFIG_AE_ENABLE | QMI8658_CONFIG_MAG_ENABLE)
 
 #define QMI8658_STATUS1_CMD_DONE (0x01)
+#define QMI8658_STATUSINT_CMD_DONE (0x80)
+
+#define QMI8658_CTRL1_FIFO_INT1 (0x04)
+#define QMI8658_CTRL1_INT1_ENABLE (0x08)
+#define QMI8658_CTRL1_INT2_ENABLE (0x10)
+#define QMI8658_CTRL7_DRDY_DISABLE (0x20)
+
+#define QMI8658_FIFO_MODE_BYPASS (0x00)
+#define QMI8658_FIFO_MODE_FIFO (0x01)
+#define QMI8658_FIFO_MODE_STREAM (0x02)
+#define QMI8658_FIFO_SIZE_16 (0x00 << 2)
+#define QMI8658_FIFO_SIZE_32 (0x01 << 2)
+#define QMI8658_FIFO_SIZE_64 (0x02 << 2)
+#define QMI8658_FIFO_SIZE_128 (0x03 << 2)
+#define QMI8658_FIFO_RD_MODE (0x80)
+
+#define QMI8658_FIFO_STATUS_FULL (0x80)
+#define QMI8658_FIFO_STATUS_WTM (0x40)
+#define QMI8658_FIFO_STATUS_OVFLOW (0x20)
+#define QMI8658_FIFO_STATUS_NOT_EMPTY (0x10)
+#define QMI8658_FIFO_STATUS_COUNT_H (0x03)
 #define QMI8658_STATUS1_WAKEUP_EVENT (0x04)
 
 enum QMI8658Register
@@ -72,12 +96,16 @@ enum QMI8658Register
     QMI8658Register_Cal4_L,
     /*! \brief Calibration register 4 least significant byte. */
     QMI8658Register_Cal4_H,
+    /*! \brief FIFO watermark level, in samples. */
+    QMI8658Register_FifoWtmTh = 19,
     /*! \brief FIFO control register. */
-    QMI8658Register_FifoCtrl = 19,
+    QMI8658Register_FifoCtrl, // 20
+    /*! \brief FIFO sample count least significant byte, in 2 byte words. */
+    QMI8658Register_FifoCount, // 21
+    /*! \brief FIFO status register, sample count most significant bits. */
+    QMI8658Register_FifoStatus, // 22
     /*! \brief FIFO data register. */
-    QMI8658Register_FifoData, // 20
-    /*! \brief FIFO status register. */
-    QMI8658Register_FifoStatus, // 21
+    QMI8658Register_FifoData, // 23
     /*! \brief Output data overrun and availability. */
     QMI8658Register_StatusInt = 45,
     /*! \brief Output data overrun and availability. */
@@ -224,6 +252,8 @@ enum QMI8658_Ctrl9Command
     QMI8658_Ctrl9_Cmd_NOP = 0X00,
     QMI8658_Ctrl9_Cmd_GyroBias = 0X01,
     QMI8658_Ctrl9_Cmd_Rqst_Sdi_Mod = 0X03,
+    QMI8658_Ctrl9_Cmd_Rst_Fifo = 0X04,
+    QMI8658_Ctrl9_Cmd_Req_Fifo = 0X05,
     QMI8658_Ctrl9_Cmd_WoM_Setting = 0x08,
     QMI8658_Ctrl9_Cmd_AccelHostDeltaOffset = 0x09,
     QMI8658_Ctrl9_Cmd_GyroHostDeltaOffset = 0x0A,
@@ -474,6 +504,7 @@ enum QMI8658_WakeOnMotionThreshold
 extern unsigned char QMI8658_write_reg(unsigned char reg, unsigned char value);
 extern unsigned char QMI8658_read_reg(unsigned char reg, unsigned char *buf, unsigned short len);
 extern unsigned char QMI8658_init(void);
+extern unsigned char QMI8658_get_addr(void);
 extern void QMI8658_Config_apply(struct QMI8658Config const *config);
 extern void QMI8658_enableSensors(unsigned char enableFlags);
 extern void QMI8658_read_acc_xyz(float acc_xyz[3]);
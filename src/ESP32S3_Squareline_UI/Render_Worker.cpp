@@ -0,0 +1,138 @@
+/*****************************************************************************
+* | File      	:   Render_Worker.cpp
+* | Function    :   Render worker threads drawing stripes of LVGL refreshes
+* | Info        :
+*                Every worker has its own job slot and wake up semaphore,
+*                LVGL starts at most one stripe on a worker per part and
+*                waits for all of them, so a slot is never overwritten
+*                while it is drawn. The locks are binary semaphores.
+******************************************************************************/
+#include "Render_Worker.h"
+
+#if LV_USE_REFR_STRIPES
+
+typedef struct{
+	void (*Job)(void *Arg);
+	void *Arg;
+	DEV_Sem Work;
+}RENDER_SLOT;
+
+static RENDER_SLOT Render_Slot[RENDER_WORKER_MAX];
+static DEV_Sem Render_Done = NULL;     // finished stripes
+static DEV_Sem Render_Lock[_LV_REFR_STRIPES_LOCK_NUM];
+static UBYTE Render_Pending = 0;
+
+static UBYTE Render_Started = 0;
+static lv_refr_stripes_t Render_Stripes;
+
+static void Render_Worker_Start(uint8_t Worker, void (*Job)(void *Arg), void *Arg)
+{
+    Render_Slot[Worker].Job = Job;
+    Render_Slot[Worker].Arg = Arg;
+    Render_Pending++;
+    DEV_Sem_Give(Render_Slot[Worker].Work);
+}
+
+// Barrier before the flush: every started stripe is drawn when this returns
+static void Render_Worker_Wait(void)
+{
+    while(Render_Pending) {
+        DEV_Sem_Take(Render_Done);
+        Render_Pending--;
+    }
+}
+
+static void Render_Worker_Lock(lv_refr_stripes_lock_t Lock)
+{
+    DEV_Sem_Take(Render_Lock[Lock]);
+}
+
+static void Render_Worker_Unlock(lv_refr_stripes_lock_t Lock)
+{
+    DEV_Sem_Give(Render_Lock[Lock]);
+}
+
+static void Render_Worker_Thread(void *Arg)
+{
+    RENDER_SLOT *slot = (RENDER_SLOT *)Arg;
+    for(;;) {
+        DEV_Sem_Take(slot->Work);
+        slot->Job(slot->Arg);
+        DEV_Sem_Give(Render_Done);
+    }
+}
+
+/******************************************************************************
+function:	Start the workers and let LVGL draw its refreshes in stripes
+parameter:
+    Workers  : threads to start, 1..RENDER_WORKER_MAX (one per spare core)
+    Core     : core they run on, ignored on the host
+    Min_Rows : thinnest stripe, RENDER_WORKER_MIN_ROWS
+Info:
+    Call once, after lv_init() and before the first refresh. Returns 0 on
+    success; on failure LVGL draws on its own task as before.
+******************************************************************************/
+UBYTE Render_Worker_Init(UBYTE Workers, UBYTE Core, UWORD Min_Rows)
+{
+    UBYTE i;
+
+    if(Workers < 1 || Workers > RENDER_WORKER_MAX)
+        return 1;
+
+    Render_Done = DEV_Sem_Create(0);
+    if(Render_Done == NULL)
+        return 1;
+    for(i = 0; i < _LV_REFR_STRIPES_LOCK_NUM; i++) {
+        Render_Lock[i] = DEV_Sem_Create(1);
+        if(Render_Lock[i] == NULL)
+            return 1;
+    }
+
+    for(i = 0; i < Workers; i++) {
+        Render_Slot[i].Work = DEV_Sem_Create(0);
+        if(Render_Slot[i].Work == NULL || DEV_Thread_Create(Render_Worker_Thread, &Render_Slot[i], Core))
+            break;
+    }
+    if(i == 0)
+        return 1;
+
+    Render_Started = i;
+    Render_Stripes.min_rows = Min_Rows;
+    Render_Stripes.start_cb = Render_Worker_Start;
+    Render_Stripes.wait_cb = Render_Worker_Wait;
+    Render_Stripes.lock_cb = Render_Worker_Lock;
+    Render_Stripes.unlock_cb = Render_Worker_Unlock;
+    Render_Worker_Enable(i);
+    return 0;
+}
+
+/******************************************************************************
+function:	Choose how many of the started workers draw stripes
+parameter:
+    Workers : 0 draws on the LVGL task only, the workers keep waiting
+Info:
+    Only between refreshes, not while LVGL renders.
+******************************************************************************/
+void Render_Worker_Enable(UBYTE Workers)
+{
+    if(Workers > Render_Started)
+        Workers = Render_Started;
+    Render_Stripes.workers = Workers;
+    lv_refr_set_stripes(Workers ? &Render_Stripes : NULL);
+}
+
+void Render_Worker_GetStats(RENDER_WORKER_STATS *Stats)
+{
+    lv_refr_stripes_stats_t st;
+    lv_refr_get_stripes_stats(&st);
+    Stats->Split = st.split;
+    Stats->Whole = st.whole;
+    Stats->Stripes = st.stripes;
+}
+
+void Render_Worker_ResetStats(void)
+{
+    lv_refr_reset_stripes_stats();
+}
+
+#endif
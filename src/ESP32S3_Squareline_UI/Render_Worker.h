@@ -0,0 +1,37 @@
+/*****************************************************************************
+* | File      	:   Render_Worker.h
+* | Function    :   Render worker threads drawing stripes of LVGL refreshes
+* | Info        :
+*                LVGL cuts every part it refreshes into horizontal stripes.
+*                The LVGL task draws the first one, each worker draws one
+*                of the others with its own draw context into its own rows
+*                of the draw buffer, and the LVGL task waits for all of
+*                them before the part is flushed. Built on the
+*                DEV_Thread/DEV_Sem API: tasks on the other core on the
+*                board, pthreads on the host. Needs LV_USE_REFR_STRIPES.
+******************************************************************************/
+#ifndef __RENDER_WORKER_H
+#define __RENDER_WORKER_H
+
+#include "DEV_Config.h"
+#include <lvgl.h>
+
+// Up to three workers, LVGL cuts a part into at most four stripes
+#define RENDER_WORKER_MAX       (LV_REFR_STRIPES_MAX - 1)
+
+// Parts whose stripes would be thinner than this stay on the LVGL task,
+// handing a few rows over costs more than drawing them there
+#define RENDER_WORKER_MIN_ROWS  (6)
+
+typedef struct{
+	UDOUBLE Split;      // parts drawn in stripes
+	UDOUBLE Whole;      // parts too thin to split
+	UDOUBLE Stripes;    // stripes drawn by the workers
+}RENDER_WORKER_STATS;
+
+UBYTE Render_Worker_Init(UBYTE Workers, UBYTE Core, UWORD Min_Rows);
+void Render_Worker_Enable(UBYTE Workers);
+
+void Render_Worker_GetStats(RENDER_WORKER_STATS *Stats);
+void Render_Worker_ResetStats(void);
+#endif
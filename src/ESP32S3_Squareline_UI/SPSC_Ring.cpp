@@ -0,0 +1,72 @@
+/*****************************************************************************
+* | File      	:   SPSC_Ring.cpp
+* | Function    :   Lock-free indexes of a one producer, one consumer ring
+* | Info        :
+*                Head and Tail count up and wrap at 2^32; the slot is the
+*                count modulo Size, a power of two, so Head - Tail is the
+*                number of entries in the ring even after they wrapped.
+******************************************************************************/
+#include "SPSC_Ring.h"
+
+void SPSC_Ring_Init(SPSC_RING *Ring)
+{
+    memset(Ring, 0, sizeof(SPSC_RING));
+}
+
+/******************************************************************************
+function:	Find the slot of the next push, from the producer thread only
+parameter:
+    Size : slots of the ring, a power of two
+    Slot : where the entry goes; SPSC_Ring_Publish() hands it over
+return:
+    0 on success, 1 if the ring is full and the push was dropped
+******************************************************************************/
+UBYTE SPSC_Ring_Claim(SPSC_RING *Ring, UDOUBLE Size, UDOUBLE *Slot)
+{
+    UDOUBLE head = __atomic_load_n(&Ring->Head, __ATOMIC_RELAXED);
+    UDOUBLE tail = __atomic_load_n(&Ring->Tail, __ATOMIC_ACQUIRE);
+
+    if(head - tail >= Size) {
+        __atomic_store_n(&Ring->Dropped, Ring->Dropped + 1, __ATOMIC_RELAXED);
+        return 1;
+    }
+    *Slot = head & (Size - 1);
+    return 0;
+}
+
+// The claimed slot is written, the consumer may take it
+void SPSC_Ring_Publish(SPSC_RING *Ring)
+{
+    __atomic_store_n(&Ring->Head, Ring->Head + 1, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************
+function:	Find the oldest entry, from the consumer thread only
+parameter:
+    Size : slots of the ring, a power of two
+    Slot : where it is; SPSC_Ring_Release() gives it back
+return:
+    0 on success, 1 if the ring is empty
+******************************************************************************/
+UBYTE SPSC_Ring_Peek(SPSC_RING *Ring, UDOUBLE Size, UDOUBLE *Slot)
+{
+    UDOUBLE tail = __atomic_load_n(&Ring->Tail, __ATOMIC_RELAXED);
+    UDOUBLE head = __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE);
+
+    if(head == tail)
+        return 1;
+    *Slot = tail & (Size - 1);
+    return 0;
+}
+
+// The peeked slot is read, the producer may fill it again
+void SPSC_Ring_Release(SPSC_RING *Ring)
+{
+    __atomic_store_n(&Ring->Tail, Ring->Tail + 1, __ATOMIC_RELEASE);
+}
+
+// Entries waiting, exact on the consumer side; the producer may add more meanwhile
+UDOUBLE SPSC_Ring_Count(SPSC_RING *Ring)
+{
+    return __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE) - __atomic_load_n(&Ring->Tail, __ATOMIC_ACQUIRE);
+}
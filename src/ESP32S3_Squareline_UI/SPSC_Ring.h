@@ -0,0 +1,30 @@
+/*****************************************************************************
+* | File      	:   SPSC_Ring.h
+* | Function    :   Lock-free indexes of a one producer, one consumer ring
+* | Info        :
+*                One thread pushes, one other thread pops, without a lock:
+*                each index is only stored by its own side, with release
+*                order after the slot is written or read, and loaded with
+*                acquire order by the other side. A push to a full ring is
+*                dropped and counted, the entries in it stay in order.
+*                The caller keeps the slots, an array of Size entries,
+*                and fills or reads the slot it is handed in place.
+******************************************************************************/
+#ifndef __SPSC_RING_H
+#define __SPSC_RING_H
+
+#include "DEV_Config.h"
+
+typedef struct{
+	UDOUBLE Head;           // entries pushed, only the producer stores it
+	UDOUBLE Tail;           // entries popped, only the consumer stores it
+	UDOUBLE Dropped;        // pushes to a full ring, only the producer stores it
+}SPSC_RING;
+
+void SPSC_Ring_Init(SPSC_RING *Ring);
+UBYTE SPSC_Ring_Claim(SPSC_RING *Ring, UDOUBLE Size, UDOUBLE *Slot);
+void SPSC_Ring_Publish(SPSC_RING *Ring);
+UBYTE SPSC_Ring_Peek(SPSC_RING *Ring, UDOUBLE Size, UDOUBLE *Slot);
+void SPSC_Ring_Release(SPSC_RING *Ring);
+UDOUBLE SPSC_Ring_Count(SPSC_RING *Ring);
+#endif
@@ -0,0 +1,181 @@
+/*****************************************************************************
+* | File      	:   Step_Counter.c
+* | Function    :   Step counting on raw accelerometer samples
+* | Info        :
+*                Per sample: three 16 x 16 bit squares, shifted to Q14 g^2
+*                and clamped to 8 g^2, so every product of the filters
+*                fits 32 bits. Two one-pole low-passes and a one-pole
+*                baseline subtracted from them make the band-pass. A peak
+*                is the sample before the band-passed value turns down,
+*                its amplitude is measured from the lowest value since the
+*                last step. The steps of a run are held back until
+*                STEP_COUNTER_CONFIRM came at a steady cadence, then all
+*                count; from there every step on cadence counts at once.
+******************************************************************************/
+#include "Step_Counter.h"
+
+#include <string.h>
+
+#define STEP_COUNTER_ONE_G2     (1 << 14)               // 1 g^2 in Q14
+#define STEP_COUNTER_CLAMP      (8 * STEP_COUNTER_ONE_G2)
+#define STEP_COUNTER_Q          12
+
+/******************************************************************************
+function:	One-pole coefficient for a corner frequency, Q12
+Info:
+    1 - exp(-w / fs) as w / (fs + w), w = 2 pi fc; always below one, close
+    enough for corners well under the sample rate.
+******************************************************************************/
+static uint16_t Step_Counter_Coeff(uint32_t Fc_mHz, uint32_t Rate_mHz)
+{
+    uint64_t w = (uint64_t)Fc_mHz * 6283 / 1000;
+
+    return (uint16_t)((w << STEP_COUNTER_Q) / (Rate_mHz + w));
+}
+
+/******************************************************************************
+function:	Set up a counter
+parameter:
+    Sc        : counter, all of it is set
+    Rate_mHz  : sample rate of the data given to Step_Counter_Process()
+    Lsb_Per_G : of the accelerometer's range, 4096 at 8 g
+******************************************************************************/
+void Step_Counter_Init(STEP_COUNTER *Sc, uint32_t Rate_mHz, uint32_t Lsb_Per_G)
+{
+    uint64_t g2 = (uint64_t)Lsb_Per_G * Lsb_Per_G;
+    uint8_t shift = 0;
+
+    while((g2 >> shift) > STEP_COUNTER_ONE_G2)
+        shift++;
+
+    memset(Sc, 0, sizeof(STEP_COUNTER));
+    Sc->Shift = shift;
+    Sc->A_Lo = Step_Counter_Coeff(STEP_COUNTER_LP_MHZ, Rate_mHz);
+    Sc->A_Hi = Step_Counter_Coeff(STEP_COUNTER_HP_MHZ, Rate_mHz);
+    Sc->Min_Gap = (uint32_t)((uint64_t)Rate_mHz * STEP_COUNTER_MIN_MS / 1000000);
+    Sc->Max_Gap = (uint32_t)((uint64_t)Rate_mHz * STEP_COUNTER_MAX_MS / 1000000);
+    Sc->Env = 2 * STEP_COUNTER_MIN_AMP;
+}
+
+/******************************************************************************
+function:	A peak of the band-passed magnitude
+return:
+    steps it made count
+******************************************************************************/
+static uint32_t Step_Counter_Peak(STEP_COUNTER *Sc, int32_t Peak, uint32_t At)
+{
+    int32_t amp = Peak - Sc->Valley, thr = Sc->Env >> 1;
+    uint32_t gap = At - Sc->Last_Step, steps = 0;
+
+    Sc->Peaks++;
+    if(thr < STEP_COUNTER_MIN_AMP)
+        thr = STEP_COUNTER_MIN_AMP;
+    if(amp < thr) {
+        // Noise between steps, or steps getting softer
+        Sc->Low_Peaks++;
+        Sc->Env -= Sc->Env >> 4;
+        return 0;
+    }
+    if(Sc->Pending > 0 && gap < Sc->Min_Gap) {
+        // A bounce of the same step
+        Sc->Off_Cadence++;
+        return 0;
+    }
+
+    if(Sc->Pending == 0 || gap > Sc->Max_Gap) {
+        // First step of a run
+        if(Sc->Walking || Sc->Pending > 1)
+            Sc->Off_Cadence++;
+        Sc->Walking = 0;
+        Sc->Pending = 1;
+        Sc->Env >>= 1;
+    } else if(Sc->Pending == 1) {
+        Sc->Gap = gap;
+        Sc->Pending = 2;
+    } else if(gap > Sc->Gap + (Sc->Gap >> 2) || gap + (Sc->Gap >> 2) < Sc->Gap) {
+        // Off the cadence: this one starts the run again, it counts
+        // with the run if one follows
+        Sc->Off_Cadence++;
+        Sc->Walking = 0;
+        Sc->Pending = 1;
+    } else {
+        Sc->Gap = Sc->Gap - (Sc->Gap >> 2) + (gap >> 2);
+        if(Sc->Walking) {
+            steps = 1;
+        } else if(++Sc->Pending >= STEP_COUNTER_CONFIRM) {
+            steps = Sc->Pending;
+            Sc->Walking = 1;
+        }
+    }
+
+    // A tap does not raise the threshold over the steps after it
+    if(amp > 4 * Sc->Env + STEP_COUNTER_MIN_AMP)
+        amp = 4 * Sc->Env + STEP_COUNTER_MIN_AMP;
+    Sc->Env += (amp - Sc->Env) >> 2;
+    Sc->Last_Step = At;
+    Sc->Valley = Peak;
+    Sc->Steps += steps;
+    return steps;
+}
+
+/******************************************************************************
+function:	Count the steps in a block of samples
+parameter:
+    Sc    : counter
+    Acc   : raw x, y, z samples, oldest first
+    Count : samples in Acc, any number
+return:
+    steps counted in this call; a run's first steps count when it is
+    confirmed, in the call that completes it
+******************************************************************************/
+uint32_t Step_Counter_Process(STEP_COUNTER *Sc, const int16_t (*Acc)[3], uint32_t Count)
+{
+    int32_t lp1 = Sc->Lp1, lp2 = Sc->Lp2, base = Sc->Base, prev = Sc->Prev, valley = Sc->Valley, y;
+    int32_t a_lo = Sc->A_Lo, a_hi = Sc->A_Hi;
+    uint32_t steps = 0, n = Sc->N, i;
+    uint8_t rising = Sc->Rising, shift = Sc->Shift;
+
+    if(Count == 0)
+        return 0;
+    if(!Sc->Primed) {
+        // Start settled on the first sample, not on a step from zero
+        int32_t x = Acc[0][0], yy = Acc[0][1], z = Acc[0][2];
+        uint32_t m = ((uint32_t)(x * x) + (uint32_t)(yy * yy) + (uint32_t)(z * z)) >> Sc->Shift;
+        lp1 = lp2 = base = m > STEP_COUNTER_CLAMP ? STEP_COUNTER_CLAMP : (int32_t)m;
+        Sc->Primed = 1;
+    }
+
+    for(i = 0; i < Count; i++) {
+        int32_t x = Acc[i][0], yy = Acc[i][1], z = Acc[i][2];
+        uint32_t m = ((uint32_t)(x * x) + (uint32_t)(yy * yy) + (uint32_t)(z * z)) >> shift;
+        int32_t v = m > STEP_COUNTER_CLAMP ? STEP_COUNTER_CLAMP : (int32_t)m;
+
+        lp1 += ((v - lp1) * a_lo) >> STEP_COUNTER_Q;
+        lp2 += ((lp1 - lp2) * a_lo) >> STEP_COUNTER_Q;
+        base += ((lp2 - base) * a_hi) >> STEP_COUNTER_Q;
+        y = lp2 - base;
+
+        if(y > prev) {
+            rising = 1;
+        } else if(y < prev && rising) {
+            // Rare: the state lives in locals in between
+            rising = 0;
+            Sc->Valley = valley;
+            steps += Step_Counter_Peak(Sc, prev, n - 1);
+            valley = Sc->Valley;
+        }
+        if(y < valley)
+            valley = y;
+        prev = y;
+        n++;
+    }
+
+    Sc->Lp1 = lp1;
+    Sc->Lp2 = lp2;
+    Sc->Base = base;
+    Sc->Prev = prev;
+    Sc->Valley = valley;
+    Sc->Rising = rising;
+    Sc->N = n;
+    return steps;
+}
@@ -0,0 +1,71 @@
+/*****************************************************************************
+* | File      	:   Step_Counter.h
+* | Function    :   Step counting on raw accelerometer samples
+* | Info        :
+*                Integer only and in plain C, so the same code runs on the
+*                board and in the host benchmark. Takes the QMI8658's raw
+*                int16 samples in blocks of any length at a sample rate
+*                given once: the squared magnitude (no square root) goes
+*                through a band-pass around walking cadence, its peaks
+*                count against a threshold that follows the recent step
+*                amplitude, and a step only counts as part of a run of
+*                steps at a walking cadence, so taps and arm movements
+*                do not. Filter corners and cadence limits are in time,
+*                not samples: the result does not depend on the rate.
+******************************************************************************/
+#ifndef __STEP_COUNTER_H
+#define __STEP_COUNTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STEP_COUNTER_LP_MHZ         4000    // low-pass corner, above running cadence
+#define STEP_COUNTER_HP_MHZ         500     // high-pass corner, takes out gravity and tilt
+#define STEP_COUNTER_MIN_MS         250     // fastest step, 4 steps a second
+#define STEP_COUNTER_MAX_MS         2000    // slowest step, a longer gap ends a walk
+#define STEP_COUNTER_CONFIRM        8       // steps at a steady cadence before a walk counts
+                                            // steady: each within 1/4 of the run's average
+#define STEP_COUNTER_MIN_AMP        1600    // smallest step, ~0.1 g^2 peak to valley
+
+typedef struct{
+	// Set by Step_Counter_Init()
+	uint8_t Shift;              // squared magnitude to Q14 g^2
+	uint16_t A_Lo;              // filter coefficients, Q12
+	uint16_t A_Hi;
+	uint32_t Min_Gap;           // cadence limits in samples
+	uint32_t Max_Gap;
+
+	// Filter
+	int32_t Lp1;                // Q14 g^2
+	int32_t Lp2;
+	int32_t Base;
+	int32_t Prev;               // last band-passed value
+	uint8_t Rising;
+	uint8_t Primed;             // the filter started from the first sample
+
+	// Peaks
+	int32_t Valley;             // lowest value since the last step
+	int32_t Env;                // step amplitude, follows the accepted peaks
+	uint32_t N;                 // samples since Step_Counter_Init()
+	uint32_t Last_Step;         // sample of the last accepted peak
+	uint32_t Gap;               // samples between the steps of this run, averaged
+	uint8_t Pending;            // steps of a run not yet confirmed
+	uint8_t Walking;
+
+	// Counters
+	uint32_t Steps;
+	uint32_t Peaks;             // local maxima of the band-passed magnitude
+	uint32_t Low_Peaks;         // below the threshold
+	uint32_t Off_Cadence;       // too soon after a step, off the run's cadence or a run broken off
+}STEP_COUNTER;
+
+void Step_Counter_Init(STEP_COUNTER *Sc, uint32_t Rate_mHz, uint32_t Lsb_Per_G);
+uint32_t Step_Counter_Process(STEP_COUNTER *Sc, const int16_t (*Acc)[3], uint32_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,188 @@
+/*****************************************************************************
+* | File      	:   Touch_Reader.cpp
+* | Function    :   Interrupt driven touch reads off the UI thread
+* | Info        :
+*                The interrupt only stamps its time and gives a semaphore.
+*                The reader thread runs at DEV_THREAD_PRIORITY_IO, so it
+*                reads as soon as the interrupt returns, and is the only
+*                producer of the ring; LVGL's read callback on the loop()
+*                task is the only consumer. A finger counts as lifted when
+*                the controller reports the lift or sends nothing for
+*                Release_ms, like the old polling did after one period.
+*
+*                Each counter of the stats is only stored by the side that
+*                counts it: the interrupt, the reader thread (and the
+*                ring's drops) or the read callback. The stats calls run
+*                on the LVGL task, so they clear the read callback's
+*                counters and keep a base for the others.
+******************************************************************************/
+#include "Touch_Reader.h"
+
+static TOUCH_RING Touch_Reader_Ring;
+static DEV_Sem Touch_Reader_Wake = NULL;
+static TOUCH_READ_FUNC Touch_Reader_Func = NULL;
+static TOUCH_NOTIFY_FUNC Touch_Reader_Notify = NULL;
+static volatile UDOUBLE Touch_Reader_Irq_us = 0;    // time of the last interrupt
+static UDOUBLE Touch_Reader_Release_ms = 30;
+
+// What LVGL was given last
+static TOUCH_SAMPLE Touch_Reader_Last;
+static UBYTE Touch_Reader_Down = 0;
+static UDOUBLE Touch_Reader_Last_ms = 0;
+
+static TOUCH_READER_STATS Touch_Reader_Stats;
+static TOUCH_READER_STATS Touch_Reader_Base;        // the other sides' counts at the last reset
+
+#if LV_USE_INDEV_HW_GESTURE
+/******************************************************************************
+function:	The LVGL direction of a CST816S swipe
+Info:
+    The controller's up is towards y = 0, like LV_DIR_TOP. Taps are left
+    to LVGL: its clicks come from the press and release it sees anyway.
+******************************************************************************/
+static lv_dir_t Touch_Reader_Gesture_Dir(UBYTE Gesture)
+{
+    switch(Gesture) {
+    case TOUCH_GESTURE_SWIPE_UP:
+        return LV_DIR_TOP;
+    case TOUCH_GESTURE_SWIPE_DOWN:
+        return LV_DIR_BOTTOM;
+    case TOUCH_GESTURE_SWIPE_LEFT:
+        return LV_DIR_LEFT;
+    case TOUCH_GESTURE_SWIPE_RIGHT:
+        return LV_DIR_RIGHT;
+    default:
+        return LV_DIR_NONE;
+    }
+}
+#endif
+
+static void Touch_Reader_Thread(void *Arg)
+{
+    TOUCH_SAMPLE s;
+    UDOUBLE t0;
+
+    (void)Arg;
+    for(;;) {
+        DEV_Sem_Take(Touch_Reader_Wake);
+        memset(&s, 0, sizeof(s));
+        s.Us = __atomic_load_n(&Touch_Reader_Irq_us, __ATOMIC_RELAXED);
+        t0 = DEV_Micros();
+        if(Touch_Reader_Func(&s)) {
+            DEV_Count(&Touch_Reader_Stats.Errors, 1);
+            continue;
+        }
+        DEV_Count(&Touch_Reader_Stats.Read_us, DEV_Micros() - t0);
+        DEV_Count(&Touch_Reader_Stats.Reads, 1);
+        // A full ring counts the drop itself
+        if(Touch_Ring_Push(&Touch_Reader_Ring, &s) == 0 && Touch_Reader_Notify)
+            Touch_Reader_Notify();
+    }
+}
+
+/******************************************************************************
+function:	Start the reader thread
+parameter:
+    Read       : reads the controller, e.g. CST816S::read_touch()
+    Notify     : wakes the UI thread when a sample is waiting, can be NULL
+    Core       : CPU of the reader thread
+    Release_ms : time without a sample after which the finger counts as lifted
+Info:
+    Returns 0 on success; on failure nothing is read, the caller keeps
+    reading the controller itself. Hand Touch_Reader_Wake_ISR() to the
+    touch interrupt and Touch_Reader_Read() to the LVGL input device.
+******************************************************************************/
+UBYTE Touch_Reader_Init(TOUCH_READ_FUNC Read, TOUCH_NOTIFY_FUNC Notify, UBYTE Core, UDOUBLE Release_ms)
+{
+    if(Read == NULL || Touch_Reader_Wake != NULL)
+        return 1;
+    Touch_Ring_Init(&Touch_Reader_Ring);
+    Touch_Reader_Func = Read;
+    Touch_Reader_Notify = Notify;
+    Touch_Reader_Release_ms = Release_ms;
+    Touch_Reader_Wake = DEV_Sem_Create(0);
+    if(Touch_Reader_Wake == NULL)
+        return 1;
+    if(DEV_Thread_Create_Priority(Touch_Reader_Thread, NULL, Core, DEV_THREAD_PRIORITY_IO)) {
+        Touch_Reader_Func = NULL;
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	Touch interrupt: stamp the time and wake the reader thread
+******************************************************************************/
+void DEV_ISR_ATTR Touch_Reader_Wake_ISR(void)
+{
+    if(Touch_Reader_Wake == NULL)
+        return;
+    __atomic_store_n(&Touch_Reader_Irq_us, DEV_Micros(), __ATOMIC_RELAXED);
+    DEV_Count(&Touch_Reader_Stats.Interrupts, 1);
+    DEV_Sem_Give_ISR(Touch_Reader_Wake);
+}
+
+/******************************************************************************
+function:	LVGL read callback: the oldest sample of the ring
+Info:
+    Sets continue_reading while more samples wait, so LVGL takes all of
+    them in one read instead of one per read period. Without a new sample
+    the last point is kept until Release_ms passed.
+******************************************************************************/
+void Touch_Reader_Read(lv_indev_drv_t *Drv, lv_indev_data_t *Data)
+{
+    TOUCH_SAMPLE s;
+
+    (void)Drv;
+    if(Touch_Ring_Pop(&Touch_Reader_Ring, &s) == 0) {
+        UDOUBLE latency = DEV_Micros() - s.Us;
+        Touch_Reader_Stats.Samples++;
+        Touch_Reader_Stats.Latency_us += latency;
+        if(latency > Touch_Reader_Stats.Max_Latency_us)
+            Touch_Reader_Stats.Max_Latency_us = latency;
+        Touch_Reader_Last = s;
+        Touch_Reader_Down = s.Event != 1;
+        Touch_Reader_Last_ms = lv_tick_get();
+        Data->continue_reading = Touch_Ring_Count(&Touch_Reader_Ring) > 0;
+#if LV_USE_INDEV_HW_GESTURE
+        Data->gesture_dir = Touch_Reader_Gesture_Dir(s.Gesture);
+        Data->long_pressed = s.Gesture == TOUCH_GESTURE_LONG_PRESS;
+        if(Data->gesture_dir != LV_DIR_NONE || Data->long_pressed)
+            Touch_Reader_Stats.Gestures++;
+#endif
+    } else if(Touch_Reader_Down && lv_tick_elaps(Touch_Reader_Last_ms) > Touch_Reader_Release_ms) {
+        Touch_Reader_Down = 0;
+    }
+    Data->point.x = Touch_Reader_Last.X;
+    Data->point.y = Touch_Reader_Last.Y;
+    Data->state = Touch_Reader_Down ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+}
+
+/******************************************************************************
+function:	Counts since the last reset
+Info:
+    Call on the LVGL task, like Touch_Reader_ResetStats(). A read that
+    ends meanwhile may be in Reads but not yet in Read_us.
+******************************************************************************/
+void Touch_Reader_GetStats(TOUCH_READER_STATS *Stats)
+{
+    memcpy(Stats, &Touch_Reader_Stats, sizeof(TOUCH_READER_STATS));
+    Stats->Interrupts = DEV_Count_Since(&Touch_Reader_Stats.Interrupts, Touch_Reader_Base.Interrupts);
+    Stats->Reads = DEV_Count_Since(&Touch_Reader_Stats.Reads, Touch_Reader_Base.Reads);
+    Stats->Read_us = DEV_Count_Since(&Touch_Reader_Stats.Read_us, Touch_Reader_Base.Read_us);
+    Stats->Errors = DEV_Count_Since(&Touch_Reader_Stats.Errors, Touch_Reader_Base.Errors);
+    Stats->Dropped = DEV_Count_Since(&Touch_Reader_Ring.Index.Dropped, Touch_Reader_Base.Dropped);
+}
+
+void Touch_Reader_ResetStats(void)
+{
+    Touch_Reader_Base.Interrupts = DEV_Count_Since(&Touch_Reader_Stats.Interrupts, 0);
+    Touch_Reader_Base.Reads = DEV_Count_Since(&Touch_Reader_Stats.Reads, 0);
+    Touch_Reader_Base.Read_us = DEV_Count_Since(&Touch_Reader_Stats.Read_us, 0);
+    Touch_Reader_Base.Errors = DEV_Count_Since(&Touch_Reader_Stats.Errors, 0);
+    Touch_Reader_Base.Dropped = DEV_Count_Since(&Touch_Reader_Ring.Index.Dropped, 0);
+    Touch_Reader_Stats.Samples = 0;
+    Touch_Reader_Stats.Gestures = 0;
+    Touch_Reader_Stats.Latency_us = 0;
+    Touch_Reader_Stats.Max_Latency_us = 0;
+}
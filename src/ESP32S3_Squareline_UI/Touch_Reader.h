@@ -0,0 +1,55 @@
+/*****************************************************************************
+* | File      	:   Touch_Reader.h
+* | Function    :   Interrupt driven touch reads off the UI thread
+* | Info        :
+*                The touch interrupt wakes a reader thread of its own,
+*                which reads the controller over I2C and pushes the sample
+*                into a Touch_Ring. LVGL's read callback only takes the
+*                samples from the ring, so the UI thread never waits on
+*                the bus, and every sample the controller reported reaches
+*                LVGL, not just the latest at each 30 ms read.
+*                With LV_USE_INDEV_HW_GESTURE the swipes and long presses
+*                the CST816S recognized go to LVGL with the samples, see
+*                gesture_src of lv_indev_drv_t.
+******************************************************************************/
+#ifndef __TOUCH_READER_H
+#define __TOUCH_READER_H
+
+#include "DEV_Config.h"
+#include "Touch_Ring.h"
+#include <lvgl.h>
+
+// CST816S gesture IDs, TOUCH_SAMPLE.Gesture
+#define TOUCH_GESTURE_NONE          0x00
+#define TOUCH_GESTURE_SWIPE_UP      0x01
+#define TOUCH_GESTURE_SWIPE_DOWN    0x02
+#define TOUCH_GESTURE_SWIPE_LEFT    0x03
+#define TOUCH_GESTURE_SWIPE_RIGHT   0x04
+#define TOUCH_GESTURE_CLICK         0x05
+#define TOUCH_GESTURE_DOUBLE_CLICK  0x0B
+#define TOUCH_GESTURE_LONG_PRESS    0x0C
+
+// Reads the controller into Sample, returns 0 on success
+typedef UBYTE (*TOUCH_READ_FUNC)(TOUCH_SAMPLE *Sample);
+// A sample is waiting; called from the reader thread
+typedef void (*TOUCH_NOTIFY_FUNC)(void);
+
+typedef struct{
+	UDOUBLE Interrupts;
+	UDOUBLE Reads;              // controller reads by the reader thread
+	UDOUBLE Read_us;            // time they took, none of it on the UI thread
+	UDOUBLE Errors;             // failed reads
+	UDOUBLE Samples;            // given to LVGL
+	UDOUBLE Gestures;           // samples with a swipe or long press for LVGL
+	UDOUBLE Dropped;            // read while the ring was full
+	UDOUBLE Latency_us;         // from the interrupt to LVGL, all samples
+	UDOUBLE Max_Latency_us;
+}TOUCH_READER_STATS;
+
+UBYTE Touch_Reader_Init(TOUCH_READ_FUNC Read, TOUCH_NOTIFY_FUNC Notify, UBYTE Core, UDOUBLE Release_ms);
+void DEV_ISR_ATTR Touch_Reader_Wake_ISR(void);
+void Touch_Reader_Read(lv_indev_drv_t *Drv, lv_indev_data_t *Data);
+
+void Touch_Reader_GetStats(TOUCH_READER_STATS *Stats);
+void Touch_Reader_ResetStats(void);
+#endif
@@ -0,0 +1,55 @@
+/*****************************************************************************
+* | File      	:   Touch_Ring.cpp
+* | Function    :   Lock-free ring of touch samples
+* | Info        :
+*                The samples are copied in and out of the slots SPSC_Ring
+*                hands over.
+******************************************************************************/
+#include "Touch_Ring.h"
+
+#if (TOUCH_RING_SIZE & (TOUCH_RING_SIZE - 1)) != 0
+#error "TOUCH_RING_SIZE must be a power of two"
+#endif
+
+void Touch_Ring_Init(TOUCH_RING *Ring)
+{
+    memset(Ring, 0, sizeof(TOUCH_RING));
+}
+
+/******************************************************************************
+function:	Add a sample, from the producer thread only
+return:
+    0 on success, 1 if the ring is full and the sample was dropped
+******************************************************************************/
+UBYTE Touch_Ring_Push(TOUCH_RING *Ring, const TOUCH_SAMPLE *Sample)
+{
+    UDOUBLE slot;
+
+    if(SPSC_Ring_Claim(&Ring->Index, TOUCH_RING_SIZE, &slot))
+        return 1;
+    Ring->Buf[slot] = *Sample;
+    SPSC_Ring_Publish(&Ring->Index);
+    return 0;
+}
+
+/******************************************************************************
+function:	Take the oldest sample, from the consumer thread only
+return:
+    0 on success, 1 if the ring is empty
+******************************************************************************/
+UBYTE Touch_Ring_Pop(TOUCH_RING *Ring, TOUCH_SAMPLE *Sample)
+{
+    UDOUBLE slot;
+
+    if(SPSC_Ring_Peek(&Ring->Index, TOUCH_RING_SIZE, &slot))
+        return 1;
+    *Sample = Ring->Buf[slot];
+    SPSC_Ring_Release(&Ring->Index);
+    return 0;
+}
+
+// Samples waiting, exact on the consumer side; the producer may add more meanwhile
+UDOUBLE Touch_Ring_Count(TOUCH_RING *Ring)
+{
+    return SPSC_Ring_Count(&Ring->Index);
+}
@@ -0,0 +1,35 @@
+/*****************************************************************************
+* | File      	:   Touch_Ring.h
+* | Function    :   Lock-free ring of touch samples
+* | Info        :
+*                One thread pushes, one other thread pops, through the
+*                indexes of an SPSC_Ring. A push to a full ring is dropped
+*                and counted in Index.Dropped, the samples in it stay in
+*                order.
+******************************************************************************/
+#ifndef __TOUCH_RING_H
+#define __TOUCH_RING_H
+
+#include "SPSC_Ring.h"
+
+#define TOUCH_RING_SIZE     16      // samples, a power of two
+
+typedef struct{
+	UWORD X;
+	UWORD Y;
+	UBYTE Gesture;          // CST816S gesture ID, 0 = none
+	UBYTE Points;           // fingers down
+	UBYTE Event;            // 0 = down, 1 = up, 2 = contact
+	UDOUBLE Us;             // time of the interrupt that reported it
+}TOUCH_SAMPLE;
+
+typedef struct{
+	TOUCH_SAMPLE Buf[TOUCH_RING_SIZE];
+	SPSC_RING Index;
+}TOUCH_RING;
+
+void Touch_Ring_Init(TOUCH_RING *Ring);
+UBYTE Touch_Ring_Push(TOUCH_RING *Ring, const TOUCH_SAMPLE *Sample);
+UBYTE Touch_Ring_Pop(TOUCH_RING *Ring, TOUCH_SAMPLE *Sample);
+UDOUBLE Touch_Ring_Count(TOUCH_RING *Ring);
+#endif
@@ -0,0 +1,226 @@
+/*****************************************************************************
+* | File      	:   UI_Binding.cpp
+* | Function    :   Change detecting value bindings for the SquareLine widgets
+* | Info        :
+*                The setters and the flush share one lock. The flush only
+*                takes the new values under it; formatting and the LVGL
+*                calls run after it is given back, so a setter on another
+*                task never waits for LVGL.
+******************************************************************************/
+#include "UI_Binding.h"
+
+static UI_BINDING UI_Bindings[UI_BINDING_MAX];
+static UBYTE UI_Binding_Count = 0;
+static volatile UBYTE UI_Binding_Dirty = 0;    // any binding set since the last flush
+
+static DEV_Sem UI_Binding_Lock = NULL;
+static UI_BINDING_STATS UI_Binding_Stats;
+
+static void UI_Binding_Take(void)
+{
+    if(UI_Binding_Lock)
+        DEV_Sem_Take(UI_Binding_Lock);
+}
+
+static void UI_Binding_Give(void)
+{
+    if(UI_Binding_Lock)
+        DEV_Sem_Give(UI_Binding_Lock);
+}
+
+/******************************************************************************
+function:	Create the lock shared by the setters and the flush
+Info:
+    Call once, before any task sets a value. Returns 0 on success; without
+    the lock the bindings may only be set from the LVGL task.
+******************************************************************************/
+UBYTE UI_Binding_Init(void)
+{
+    if(UI_Binding_Lock == NULL)
+        UI_Binding_Lock = DEV_Sem_Create(1);
+    return UI_Binding_Lock == NULL;
+}
+
+static UI_BINDING *UI_Binding_New(lv_obj_t **Obj, UBYTE Kind, const char *Format)
+{
+    UI_BINDING *bind;
+
+    if(UI_Binding_Count >= UI_BINDING_MAX)
+        return NULL;
+    bind = &UI_Bindings[UI_Binding_Count++];
+    memset(bind, 0, sizeof(UI_BINDING));
+    bind->Obj = Obj;
+    bind->Kind = Kind;
+    bind->Format = Format;
+    return bind;
+}
+
+/******************************************************************************
+function:	Bind a value to a SquareLine widget
+parameter:
+    Obj    : address of the SquareLine global, e.g. &ui_LabelStepCount
+    Format : printf format of the integer, e.g. "%d"
+Info:
+    Call from the LVGL task. Returns NULL when all UI_BINDING_MAX bindings
+    are taken. Nothing is shown until the first value is set; a screen that
+    is created again gets the last value at the next flush.
+******************************************************************************/
+UI_BINDING *UI_Binding_Label_Int(lv_obj_t **Obj, const char *Format)
+{
+    return UI_Binding_New(Obj, UI_BINDING_LABEL_INT, Format);
+}
+
+UI_BINDING *UI_Binding_Label_Text(lv_obj_t **Obj)
+{
+    return UI_Binding_New(Obj, UI_BINDING_LABEL_TEXT, NULL);
+}
+
+UI_BINDING *UI_Binding_Arc(lv_obj_t **Obj)
+{
+    return UI_Binding_New(Obj, UI_BINDING_ARC, NULL);
+}
+
+/******************************************************************************
+function:	Set the value of a binding, from any task
+parameter:
+    Bind  : binding from UI_Binding_Label_Int() or UI_Binding_Arc()
+    Value : new value, shown at the next flush if it differs
+******************************************************************************/
+void UI_Binding_Set_Int(UI_BINDING *Bind, int32_t Value)
+{
+    UI_Binding_Take();
+    UI_Binding_Stats.Sets++;
+    if(Bind->Valid && Bind->Value == Value) {
+        UI_Binding_Stats.Unchanged++;
+    } else {
+        if(Bind->Dirty)
+            UI_Binding_Stats.Coalesced++;
+        Bind->Value = Value;
+        Bind->Valid = 1;
+        Bind->Dirty = 1;
+        UI_Binding_Dirty = 1;
+    }
+    UI_Binding_Give();
+}
+
+/******************************************************************************
+function:	Set the text of a binding, from any task
+parameter:
+    Bind : binding from UI_Binding_Label_Text()
+    Text : new text, cut to UI_BINDING_TEXT_MAX - 1 characters
+******************************************************************************/
+void UI_Binding_Set_Text(UI_BINDING *Bind, const char *Text)
+{
+    UI_Binding_Take();
+    UI_Binding_Stats.Sets++;
+    if(Bind->Valid && strncmp(Bind->Text, Text, UI_BINDING_TEXT_MAX - 1) == 0) {
+        UI_Binding_Stats.Unchanged++;
+    } else {
+        if(Bind->Dirty)
+            UI_Binding_Stats.Coalesced++;
+        strncpy(Bind->Text, Text, UI_BINDING_TEXT_MAX - 1);
+        Bind->Text[UI_BINDING_TEXT_MAX - 1] = '\0';
+        Bind->Valid = 1;
+        Bind->Dirty = 1;
+        UI_Binding_Dirty = 1;
+    }
+    UI_Binding_Give();
+}
+
+// The widget is gone with its screen: the next one needs the value again
+static void UI_Binding_Deleted(lv_event_t *e)
+{
+    UI_BINDING *bind = (UI_BINDING *)lv_event_get_user_data(e);
+    if(bind->Shown_Obj == lv_event_get_target(e))
+        bind->Shown_Obj = NULL;
+}
+
+static void UI_Binding_Apply(UI_BINDING *Bind, lv_obj_t *Obj)
+{
+    char text[UI_BINDING_TEXT_MAX];
+
+    switch(Bind->Kind) {
+    case UI_BINDING_LABEL_INT:
+        snprintf(text, sizeof(text), Bind->Format, (int)Bind->Shown_Value);
+        lv_label_set_text(Obj, text);
+        break;
+    case UI_BINDING_LABEL_TEXT:
+        lv_label_set_text(Obj, Bind->Shown_Text);
+        break;
+    case UI_BINDING_ARC:
+        lv_arc_set_value(Obj, (int16_t)Bind->Shown_Value);
+        break;
+    }
+}
+
+/******************************************************************************
+function:	Show the values set since the last flush
+Info:
+    Call on the LVGL task once per frame, before lv_timer_handler(). A
+    binding whose widget does not exist keeps its value for later.
+******************************************************************************/
+void UI_Binding_Flush(void)
+{
+    UBYTE i;
+
+    UI_Binding_Dirty = 0;
+    for(i = 0; i < UI_Binding_Count; i++) {
+        UI_BINDING *bind = &UI_Bindings[i];
+        lv_obj_t *obj = *bind->Obj;
+        UBYTE apply = 0;
+
+        if(obj == NULL)
+            continue;
+
+        UI_Binding_Take();
+        if(bind->Valid && (bind->Dirty || obj != bind->Shown_Obj)) {
+            if(bind->Kind == UI_BINDING_LABEL_TEXT) {
+                apply = obj != bind->Shown_Obj || strcmp(bind->Shown_Text, bind->Text) != 0;
+                memcpy(bind->Shown_Text, bind->Text, UI_BINDING_TEXT_MAX);
+            } else {
+                apply = obj != bind->Shown_Obj || bind->Shown_Value != bind->Value;
+                bind->Shown_Value = bind->Value;
+            }
+            // Set and set back before this frame
+            if(apply)
+                UI_Binding_Stats.Applied++;
+            else
+                UI_Binding_Stats.Unchanged++;
+            bind->Dirty = 0;
+        }
+        UI_Binding_Give();
+
+        if(!apply)
+            continue;
+
+        if(obj != bind->Shown_Obj) {
+            lv_obj_add_event_cb(obj, UI_Binding_Deleted, LV_EVENT_DELETE, bind);
+            bind->Shown_Obj = obj;
+        }
+        UI_Binding_Apply(bind, obj);
+    }
+}
+
+/******************************************************************************
+function:	Whether a value waits for the next flush
+Info:
+    The refresh governor keeps the next frame due while this is set.
+******************************************************************************/
+UBYTE UI_Binding_Pending(void)
+{
+    return UI_Binding_Dirty;
+}
+
+void UI_Binding_GetStats(UI_BINDING_STATS *Stats)
+{
+    UI_Binding_Take();
+    *Stats = UI_Binding_Stats;
+    UI_Binding_Give();
+}
+
+void UI_Binding_ResetStats(void)
+{
+    UI_Binding_Take();
+    memset(&UI_Binding_Stats, 0, sizeof(UI_Binding_Stats));
+    UI_Binding_Give();
+}
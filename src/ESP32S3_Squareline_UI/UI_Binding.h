@@ -0,0 +1,59 @@
+/*****************************************************************************
+* | File      	:   UI_Binding.h
+* | Function    :   Change detecting value bindings for the SquareLine widgets
+* | Info        :
+*                A binding ties a value to a SquareLine global such as
+*                ui_LabelStepCount or ui_Arc1. Any task may set the value;
+*                it only marks the binding dirty. UI_Binding_Flush() runs
+*                once per frame on the LVGL task and touches a widget only
+*                when its value really changed, so unchanged values are
+*                neither formatted nor invalidated and several sets between
+*                two frames cost one widget update.
+******************************************************************************/
+#ifndef __UI_BINDING_H
+#define __UI_BINDING_H
+
+#include "DEV_Config.h"
+#include <lvgl.h>
+
+#define UI_BINDING_MAX      8
+#define UI_BINDING_TEXT_MAX 32      // text bindings, including the '\0'
+
+#define UI_BINDING_LABEL_INT    0   // integer shown on a label with a printf format
+#define UI_BINDING_LABEL_TEXT   1   // string shown on a label
+#define UI_BINDING_ARC          2   // integer set as the arc value
+
+typedef struct{
+	lv_obj_t **Obj;             // SquareLine global, NULL while its screen is not loaded
+	const char *Format;         // UI_BINDING_LABEL_INT only
+	UBYTE Kind;
+	UBYTE Valid;                // set at least once, until then the SquareLine default stays
+	UBYTE Dirty;                // set since the last flush
+	int32_t Value;              // last value set
+	char Text[UI_BINDING_TEXT_MAX];
+	lv_obj_t *Shown_Obj;        // widget showing Shown_Value/Shown_Text, NULL if none
+	int32_t Shown_Value;
+	char Shown_Text[UI_BINDING_TEXT_MAX];
+}UI_BINDING;
+
+typedef struct{
+	UDOUBLE Sets;               // values set
+	UDOUBLE Unchanged;          // sets and flushes that left the widget as it was
+	UDOUBLE Coalesced;          // values replaced before a frame showed them
+	UDOUBLE Applied;            // widget updates, each one an invalidation
+}UI_BINDING_STATS;
+
+UBYTE UI_Binding_Init(void);
+UI_BINDING *UI_Binding_Label_Int(lv_obj_t **Obj, const char *Format);
+UI_BINDING *UI_Binding_Label_Text(lv_obj_t **Obj);
+UI_BINDING *UI_Binding_Arc(lv_obj_t **Obj);
+
+void UI_Binding_Set_Int(UI_BINDING *Bind, int32_t Value);
+void UI_Binding_Set_Text(UI_BINDING *Bind, const char *Text);
+
+void UI_Binding_Flush(void);
+UBYTE UI_Binding_Pending(void);
+
+void UI_Binding_GetStats(UI_BINDING_STATS *Stats);
+void UI_Binding_ResetStats(void);
+#endif
@@ -0,0 +1,453 @@
+/*****************************************************************************
+* | File      	:   UI_Screens.cpp
+* | Function    :   Lifecycle of the SquareLine screens
+* | Info        :
+*                A screen's footprint is the LVGL heap in use after its
+*                build minus before, and again what its delete gives back.
+*                Only the screens a gesture of the shown screen opens are
+*                preloaded, the one taken most often first; a preload only
+*                evicts screens no gesture of the shown screen opens.
+*                Every screen built here gets a gesture callback that runs
+*                before SquareLine's; for a linked gesture it changes the
+*                screen itself and stops the event, so _ui_screen_change()
+*                is left to the buttons. Everything runs on the LVGL task.
+******************************************************************************/
+#include "UI_Screens.h"
+#include "UI_Transition.h"
+#include "DEV_Config.h"
+
+static UI_SCREEN UI_Screens[UI_SCREENS_MAX];
+static UBYTE UI_Screens_Count = 0;
+static UDOUBLE UI_Screens_Budget = 0;
+static UI_SCREENS_STATS UI_Screens_Stats;
+
+/******************************************************************************
+function:	Forget all screens and set the memory budget
+parameter:
+    Budget : LVGL heap the screens not marked Keep may take together, in
+             bytes; screens marked Keep count against it too
+******************************************************************************/
+void UI_Screens_Init(uint32_t Budget)
+{
+    memset(UI_Screens, 0, sizeof(UI_Screens));
+    UI_Screens_Count = 0;
+    UI_Screens_Budget = Budget;
+    UI_Screens_ResetStats();
+}
+
+/******************************************************************************
+function:	Put a SquareLine screen under the manager
+parameter:
+    Obj     : address of the screen's global, e.g. &ui_Screen4
+    Init    : its ui_ScreenN_screen_init
+    Destroy : its ui_ScreenN_screen_destroy
+    Name    : for the stats
+    Keep    : 1 never evicts it, e.g. the screen others go back to
+Info:
+    Call before UI_Screens_Start(). Returns 0 on success, 1 when all
+    UI_SCREENS_MAX screens are taken.
+******************************************************************************/
+uint8_t UI_Screens_Add(lv_obj_t **Obj, UI_SCREEN_FUNC Init, UI_SCREEN_FUNC Destroy, const char *Name, uint8_t Keep)
+{
+    UI_SCREEN *scr;
+
+    if(UI_Screens_Count >= UI_SCREENS_MAX)
+        return 1;
+    scr = &UI_Screens[UI_Screens_Count++];
+    memset(scr, 0, sizeof(UI_SCREEN));
+    scr->Obj = Obj;
+    scr->Init = Init;
+    scr->Destroy = Destroy;
+    scr->Name = Name;
+    scr->Keep = Keep;
+    return 0;
+}
+
+static int UI_Screens_Find(lv_obj_t **Obj)
+{
+    int i;
+    for(i = 0; i < UI_Screens_Count; i++) {
+        if(UI_Screens[i].Obj == Obj)
+            return i;
+    }
+    return -1;
+}
+
+// The managed screen that is this LVGL screen, -1 if none is
+static int UI_Screens_Find_Shown(lv_obj_t *Scr)
+{
+    int i;
+    if(Scr == NULL)
+        return -1;
+    for(i = 0; i < UI_Screens_Count; i++) {
+        if(*UI_Screens[i].Obj == Scr)
+            return i;
+    }
+    return -1;
+}
+
+/******************************************************************************
+function:	Add a gesture of one screen that opens another
+parameter:
+    From : screen whose gesture it is, e.g. &ui_Screen1
+    To   : screen it opens
+    Dir  : LV_DIR_* of the gesture
+    Anim : LV_SCR_LOAD_ANIM_* of the change
+    Time : ms of the animation
+Info:
+    The same as the _ui_screen_change() call of From's SquareLine event
+    handler for that gesture. Link the gestures of a screen in the order
+    they are expected to be used; the changes actually taken reorder
+    them. Returns 0 on success, 1 if a screen is not added or From has
+    UI_SCREENS_LINKS links.
+******************************************************************************/
+uint8_t UI_Screens_Link(lv_obj_t **From, lv_obj_t **To, lv_dir_t Dir, lv_scr_load_anim_t Anim, uint32_t Time)
+{
+    int from = UI_Screens_Find(From);
+    int to = UI_Screens_Find(To);
+    UI_SCREEN *scr;
+
+    if(from < 0 || to < 0)
+        return 1;
+    scr = &UI_Screens[from];
+    if(scr->Links >= UI_SCREENS_LINKS)
+        return 1;
+    scr->Next[scr->Links] = (UBYTE)to;
+    scr->Next_Dir[scr->Links] = (UBYTE)Dir;
+    scr->Next_Anim[scr->Links] = (UBYTE)Anim;
+    scr->Next_Time[scr->Links] = (UWORD)Time;
+    scr->Next_Hits[scr->Links] = 0;
+    scr->Links++;
+    return 0;
+}
+
+// LVGL heap in use and free, both tiers of LV_USE_MEM_TIER together;
+// with another LV_MEM_CUSTOM allocator nothing can be measured
+static void UI_Screens_Heap(UDOUBLE *Used, UDOUBLE *Free)
+{
+#if LV_MEM_CUSTOM == 0 || LV_USE_MEM_TIER
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    *Used = mon.total_size - mon.free_size;
+    *Free = mon.free_size;
+#else
+    *Used = 0;
+    *Free = UINT32_MAX;
+#endif
+}
+
+static UDOUBLE UI_Screens_Resident(void)
+{
+    UDOUBLE bytes = 0;
+    int i;
+    for(i = 0; i < UI_Screens_Count; i++) {
+        if(*UI_Screens[i].Obj)
+            bytes += UI_Screens[i].Bytes;
+    }
+    return bytes;
+}
+
+/******************************************************************************
+function:	Change screens on a linked gesture
+Info:
+    Runs before the SquareLine handler of the screen, as that one does:
+    waits for the release and changes screens. Other gestures go on to
+    SquareLine.
+******************************************************************************/
+static void UI_Screens_Gesture(lv_event_t *E)
+{
+    UI_SCREEN *scr = (UI_SCREEN *)lv_event_get_user_data(E);
+    lv_indev_t *indev = lv_event_get_indev(E);
+    lv_dir_t dir;
+    UBYTE l;
+
+    if(indev == NULL)
+        return;
+    dir = lv_indev_get_gesture_dir(indev);
+    for(l = 0; l < scr->Links; l++) {
+        UI_SCREEN *next = &UI_Screens[scr->Next[l]];
+
+        if(scr->Next_Dir[l] != dir)
+            continue;
+        lv_indev_wait_release(indev);
+        lv_event_stop_processing(E);
+        UI_Screens_Change(next->Obj, (lv_scr_load_anim_t)scr->Next_Anim[l], scr->Next_Time[l], 0, next->Init);
+        return;
+    }
+}
+
+// Put the gesture callback on a built screen that has none yet
+static void UI_Screens_Watch(UI_SCREEN *Scr)
+{
+    lv_obj_t *obj = *Scr->Obj;
+
+    if(obj == NULL || Scr->Links == 0 || lv_obj_get_event_user_data(obj, UI_Screens_Gesture))
+        return;
+    lv_obj_add_event_cb(obj, UI_Screens_Gesture, (lv_event_code_t)(LV_EVENT_GESTURE | LV_EVENT_PREPROCESS), Scr);
+}
+
+static void UI_Screens_Build(UI_SCREEN *Scr)
+{
+    UDOUBLE used, used_after, free;
+    UDOUBLE t0;
+
+    UI_Screens_Heap(&used, &free);
+    t0 = DEV_Micros();
+    Scr->Init();
+    Scr->Build_us = DEV_Micros() - t0;
+    UI_Screens_Heap(&used_after, &free);
+    if(used_after > used)
+        Scr->Bytes = used_after - used;
+    UI_Screens_Watch(Scr);
+}
+
+// A screen built elsewhere is measured by what its delete gives back
+static void UI_Screens_Delete(UI_SCREEN *Scr)
+{
+    UDOUBLE used, used_after, free;
+
+    UI_Screens_Heap(&used, &free);
+    Scr->Destroy();
+    UI_Screens_Heap(&used_after, &free);
+    if(used > used_after)
+        Scr->Bytes = used - used_after;
+}
+
+static UBYTE UI_Screens_Is_Next(int From, int To)
+{
+    UBYTE l;
+    if(From < 0)
+        return 0;
+    for(l = 0; l < UI_Screens[From].Links; l++) {
+        if(UI_Screens[From].Next[l] == To)
+            return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	Evict screens until the resident ones and Need fit the budget
+parameter:
+    Need      : bytes about to be built
+    Shown     : screen shown after this, kept with its gestures' screens
+                as long as others can go
+    Protect   : screen that must stay, -1 if none
+    Only_Cold : 1 never evicts a screen a gesture of Shown opens
+return:
+    1 if everything fits
+Info:
+    The active screen and the one an animation is leaving stay. Screens
+    no gesture of Shown opens go first, then the longest unused.
+******************************************************************************/
+static UBYTE UI_Screens_Trim(UDOUBLE Need, int Shown, int Protect, UBYTE Only_Cold)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+
+    while(UI_Screens_Resident() + Need > UI_Screens_Budget) {
+        int victim = -1;
+        UBYTE victim_cold = 0;
+        int i;
+
+        for(i = 0; i < UI_Screens_Count; i++) {
+            UI_SCREEN *scr = &UI_Screens[i];
+            UBYTE cold;
+
+            if(scr->Keep || *scr->Obj == NULL || i == Shown || i == Protect)
+                continue;
+            if(*scr->Obj == lv_disp_get_scr_act(disp) || *scr->Obj == disp->prev_scr)
+                continue;
+            cold = !UI_Screens_Is_Next(Shown, i);
+            if(Only_Cold && !cold)
+                continue;
+            if(victim < 0 || cold > victim_cold ||
+               (cold == victim_cold && scr->Used_ms < UI_Screens[victim].Used_ms)) {
+                victim = i;
+                victim_cold = cold;
+            }
+        }
+        if(victim < 0)
+            return 0;
+        UI_Screens_Delete(&UI_Screens[victim]);
+        UI_Screens_Stats.Evictions++;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function:	Run SquareLine's ui_init() and take over the screens it built
+parameter:
+    Ui_Init : ui_init
+Info:
+    Call after UI_Screens_Add() and UI_Screens_Link(), in the place of
+    ui_init(). ui_init() builds more screens than the one it loads; those
+    not marked Keep are deleted again, which measures them, and come back
+    by UI_Screens_Idle() or on first use. The rest of the heap ui_init()
+    took is counted for the screen it loaded.
+******************************************************************************/
+void UI_Screens_Start(UI_SCREEN_FUNC Ui_Init)
+{
+    UDOUBLE used, used_after, free;
+    int shown, i;
+
+    UI_Screens_Heap(&used, &free);
+    Ui_Init();
+    UI_Screens_Heap(&used_after, &free);
+
+    shown = UI_Screens_Find_Shown(lv_scr_act());
+    for(i = 0; i < UI_Screens_Count; i++) {
+        UI_SCREEN *scr = &UI_Screens[i];
+
+        if(*scr->Obj == NULL || i == shown)
+            continue;
+        if(scr->Keep) {
+            UI_Screens_Watch(scr);
+            continue;
+        }
+        UI_Screens_Delete(scr);
+        used_after = used_after > scr->Bytes ? used_after - scr->Bytes : used;
+    }
+    if(shown >= 0) {
+        if(used_after > used)
+            UI_Screens[shown].Bytes = used_after - used;
+        UI_Screens[shown].Used_ms = lv_tick_get();
+        UI_Screens_Watch(&UI_Screens[shown]);
+    }
+}
+
+/******************************************************************************
+function:	Change screens, in the place of SquareLine's _ui_screen_change()
+parameter:
+    Obj   : address of the screen's global, e.g. &ui_Screen1
+    Anim  : LV_SCR_LOAD_ANIM_*
+    Time  : ms of the animation
+    Delay : ms before it starts
+    Init  : its ui_ScreenN_screen_init
+Info:
+    Ends a snapshot animation still running, builds the screen through
+    UI_Screens_Use() and loads it with UI_Transition_Load().
+******************************************************************************/
+void UI_Screens_Change(lv_obj_t **Obj, lv_scr_load_anim_t Anim, uint32_t Time, uint32_t Delay, UI_SCREEN_FUNC Init)
+{
+    UI_Transition_Finish();
+    UI_Screens_Use(Obj, Init);
+    UI_Transition_Load(*Obj, Anim, Time, Delay);
+}
+
+/******************************************************************************
+function:	Make sure a screen is built before it is loaded
+parameter:
+    Obj  : address of the screen's global
+    Init : its ui_ScreenN_screen_init, used as is for a screen not added
+Info:
+    Called by UI_Screens_Change(). Counts the change for the
+    gesture that led from the active screen to this one, builds the
+    screen if it is not, and evicts others if that went over the budget.
+******************************************************************************/
+void UI_Screens_Use(lv_obj_t **Obj, UI_SCREEN_FUNC Init)
+{
+    int i = UI_Screens_Find(Obj);
+    int from;
+    UI_SCREEN *scr;
+    UBYTE l;
+
+    if(i < 0) {
+        if(*Obj == NULL)
+            Init();
+        return;
+    }
+    scr = &UI_Screens[i];
+
+    from = UI_Screens_Find_Shown(lv_scr_act());
+    if(from >= 0) {
+        for(l = 0; l < UI_Screens[from].Links; l++) {
+            if(UI_Screens[from].Next[l] == i && UI_Screens[from].Next_Hits[l] < 0xFFFF)
+                UI_Screens[from].Next_Hits[l]++;
+        }
+    }
+
+    if(*Obj) {
+        UI_Screens_Stats.Hits++;
+        UI_Screens_Watch(scr);
+    } else {
+        UI_Screens_Trim(scr->Bytes, i, i, 0);
+        UI_Screens_Build(scr);
+        UI_Screens_Stats.Builds++;
+        UI_Screens_Stats.Build_us += scr->Build_us;
+    }
+    scr->Used_ms = lv_tick_get();
+    UI_Screens_Trim(0, i, i, 0);
+}
+
+/******************************************************************************
+function:	Preload one screen a gesture of the shown screen may open
+return:
+    1 if a screen was built, call again at the next idle frame for more
+Info:
+    Call on the LVGL task when nothing is drawn, animated or touched: a
+    build takes a few ms and the first frame of a screen that was just
+    built is not faster. The gesture taken most often goes first. A
+    screen is only preloaded if it fits the budget after evicting
+    screens no gesture of the shown screen opens, and if the LVGL heap
+    keeps UI_SCREENS_HEAP_RESERVE free besides.
+******************************************************************************/
+uint8_t UI_Screens_Idle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    int shown = UI_Screens_Find_Shown(lv_disp_get_scr_act(disp));
+    int best = -1;
+    UDOUBLE used, free;
+    UI_SCREEN *from, *scr;
+    UBYTE l;
+
+    if(shown < 0 || disp->prev_scr)
+        return 0;
+    from = &UI_Screens[shown];
+    for(l = 0; l < from->Links; l++) {
+        if(*UI_Screens[from->Next[l]].Obj)
+            continue;
+        if(best < 0 || from->Next_Hits[l] > from->Next_Hits[best])
+            best = l;
+    }
+    if(best < 0)
+        return 0;
+    scr = &UI_Screens[from->Next[best]];
+
+    if(!UI_Screens_Trim(scr->Bytes, shown, -1, 1))
+        return 0;
+    UI_Screens_Heap(&used, &free);
+    if(free < scr->Bytes + UI_SCREENS_HEAP_RESERVE)
+        return 0;
+
+    UI_Screens_Build(scr);
+    UI_Screens_Stats.Preloads++;
+
+    // Bigger than it was the last time: it goes again if nothing else can
+    if(!UI_Screens_Trim(0, shown, -1, 1)) {
+        UI_Screens_Delete(scr);
+        UI_Screens_Stats.Evictions++;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function:	Footprint, build time and links of a screen
+parameter:
+    Index : 0 for the first screen added
+return:
+    NULL past the last screen
+******************************************************************************/
+const UI_SCREEN *UI_Screens_Get(uint8_t Index)
+{
+    return Index < UI_Screens_Count ? &UI_Screens[Index] : NULL;
+}
+
+void UI_Screens_GetStats(UI_SCREENS_STATS *Stats)
+{
+    memcpy(Stats, &UI_Screens_Stats, sizeof(UI_SCREENS_STATS));
+    Stats->Resident_Bytes = UI_Screens_Resident();
+}
+
+void UI_Screens_ResetStats(void)
+{
+    memset(&UI_Screens_Stats, 0, sizeof(UI_SCREENS_STATS));
+}
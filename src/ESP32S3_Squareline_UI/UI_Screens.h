@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:   UI_Screens.h
+* | Function    :   Lifecycle of the SquareLine screens
+* | Info        :
+*                The SquareLine files stay as exported: the manager runs
+*                ui_init() and takes over the screens it built, and the
+*                gestures of each screen it builds change screens through
+*                UI_Screens_Change() before SquareLine's handler would
+*                call _ui_screen_change(). It measures the LVGL heap and
+*                the time each build takes, builds the screens a gesture
+*                is likely to open next while the UI is idle, and deletes
+*                screens that are not shown when the resident ones would
+*                exceed a memory budget.
+*
+*                The SquareLine files are C, so this header is C too.
+******************************************************************************/
+#ifndef __UI_SCREENS_H
+#define __UI_SCREENS_H
+
+#include <lvgl.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_SCREENS_MAX      8
+#define UI_SCREENS_LINKS    4       // screens one gesture map can open
+#define UI_SCREENS_HEAP_RESERVE (8 * 1024)  // LVGL heap a preload leaves free
+
+typedef void (*UI_SCREEN_FUNC)(void);
+
+typedef struct{
+	lv_obj_t **Obj;             // SquareLine global, NULL while not built
+	UI_SCREEN_FUNC Init;        // ui_ScreenN_screen_init
+	UI_SCREEN_FUNC Destroy;     // ui_ScreenN_screen_destroy
+	const char *Name;
+	uint8_t Keep;               // never evicted
+	uint8_t Links;
+	uint8_t Next[UI_SCREENS_LINKS];        // screens its gestures open, most likely first
+	uint8_t Next_Dir[UI_SCREENS_LINKS];    // LV_DIR_* of each gesture
+	uint8_t Next_Anim[UI_SCREENS_LINKS];   // LV_SCR_LOAD_ANIM_* it loads with
+	uint16_t Next_Time[UI_SCREENS_LINKS];  // ms of the animation
+	uint16_t Next_Hits[UI_SCREENS_LINKS];  // changes taken to each of them
+	uint32_t Bytes;             // LVGL heap it takes, 0 until built or deleted once
+	uint32_t Build_us;          // time of its last build
+	uint32_t Used_ms;           // when it was last changed to, 0 if never
+}UI_SCREEN;
+
+typedef struct{
+	uint32_t Builds;            // built while a screen change waited on it
+	uint32_t Build_us;          // time those builds took
+	uint32_t Preloads;          // built while idle
+	uint32_t Hits;              // screen changes that found the screen built
+	uint32_t Evictions;         // screens deleted to stay in the budget
+	uint32_t Resident_Bytes;    // LVGL heap of the screens built now
+}UI_SCREENS_STATS;
+
+void UI_Screens_Init(uint32_t Budget);
+uint8_t UI_Screens_Add(lv_obj_t **Obj, UI_SCREEN_FUNC Init, UI_SCREEN_FUNC Destroy, const char *Name, uint8_t Keep);
+uint8_t UI_Screens_Link(lv_obj_t **From, lv_obj_t **To, lv_dir_t Dir, lv_scr_load_anim_t Anim, uint32_t Time);
+
+void UI_Screens_Start(UI_SCREEN_FUNC Ui_Init);
+void UI_Screens_Change(lv_obj_t **Obj, lv_scr_load_anim_t Anim, uint32_t Time, uint32_t Delay, UI_SCREEN_FUNC Init);
+void UI_Screens_Use(lv_obj_t **Obj, UI_SCREEN_FUNC Init);
+uint8_t UI_Screens_Idle(void);
+
+const UI_SCREEN *UI_Screens_Get(uint8_t Index);
+void UI_Screens_GetStats(UI_SCREENS_STATS *Stats);
+void UI_Screens_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
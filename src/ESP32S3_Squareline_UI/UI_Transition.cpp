@@ -0,0 +1,264 @@
+/*****************************************************************************
+* | File      	:   UI_Transition.cpp
+* | Function    :   Screen load animations from snapshots
+* | Info        :
+*                The two snapshots are RGB565 bitmaps of the whole screen
+*                in buffers the sketch gives, in PSRAM on the ESP32-S3.
+*                While they are shown, a screen of their own is the active
+*                one; the new screen is loaded when the animation ends,
+*                with the events lv_scr_load() sends. The animations are
+*                set up as lv_scr_load_anim() does, so the frames of a move
+*                are the same as live ones.
+******************************************************************************/
+#include "UI_Transition.h"
+#include "DEV_Config.h"
+
+static void *UI_Transition_Buf[2];
+static UDOUBLE UI_Transition_Size = 0;
+static lv_img_dsc_t UI_Transition_Img[2];       // old screen, new screen
+static lv_obj_t *UI_Transition_Scr = NULL;      // screen showing them, NULL when none
+static lv_obj_t *UI_Transition_Target = NULL;
+static UI_TRANSITION_STATS UI_Transition_Stats;
+
+/******************************************************************************
+function:	Give the snapshot buffers
+parameter:
+    Buf1 : bitmap of the old screen
+    Buf2 : bitmap of the new screen
+    Size : bytes of each, at least width * height * sizeof(lv_color_t)
+Info:
+    NULL buffers, or a build without LV_USE_SNAPSHOT, leave every load to
+    lv_scr_load_anim().
+******************************************************************************/
+void UI_Transition_Init(void *Buf1, void *Buf2, uint32_t Size)
+{
+    UI_Transition_Finish();
+    UI_Transition_Buf[0] = Buf1;
+    UI_Transition_Buf[1] = Buf2;
+    UI_Transition_Size = (Buf1 && Buf2) ? Size : 0;
+}
+
+// An animation runs on the object or one of its children
+static UBYTE UI_Transition_Animating(lv_obj_t *Obj)
+{
+    uint32_t i;
+
+    if(lv_anim_get(Obj, NULL))
+        return 1;
+    for(i = 0; i < lv_obj_get_child_cnt(Obj); i++) {
+        if(UI_Transition_Animating(lv_obj_get_child(Obj, i)))
+            return 1;
+    }
+    return 0;
+}
+
+static void UI_Transition_X(void *Obj, int32_t V)
+{
+    lv_obj_set_x((lv_obj_t *)Obj, V);
+}
+
+static void UI_Transition_Y(void *Obj, int32_t V)
+{
+    lv_obj_set_y((lv_obj_t *)Obj, V);
+}
+
+static void UI_Transition_Opa(void *Obj, int32_t V)
+{
+    lv_obj_set_style_opa((lv_obj_t *)Obj, V, 0);
+}
+
+static void UI_Transition_Ready(lv_anim_t *A)
+{
+    (void)A;
+    UI_Transition_Finish();
+}
+
+static lv_obj_t *UI_Transition_Image(lv_obj_t *Parent, const lv_img_dsc_t *Img)
+{
+    lv_obj_t *img = lv_img_create(Parent);
+    lv_obj_remove_style_all(img);
+    lv_img_set_src(img, Img);
+    return img;
+}
+
+// Values and callbacks of lv_scr_load_anim(); returns 1 if the old screen is drawn on top
+static UBYTE UI_Transition_Anims(lv_scr_load_anim_t Anim, lv_anim_t *New, lv_anim_t *Old, lv_coord_t W, lv_coord_t H)
+{
+    switch(Anim) {
+    case LV_SCR_LOAD_ANIM_OVER_LEFT:
+        lv_anim_set_exec_cb(New, UI_Transition_X);
+        lv_anim_set_values(New, W, 0);
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_RIGHT:
+        lv_anim_set_exec_cb(New, UI_Transition_X);
+        lv_anim_set_values(New, -W, 0);
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_TOP:
+        lv_anim_set_exec_cb(New, UI_Transition_Y);
+        lv_anim_set_values(New, H, 0);
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_BOTTOM:
+        lv_anim_set_exec_cb(New, UI_Transition_Y);
+        lv_anim_set_values(New, -H, 0);
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_LEFT:
+        lv_anim_set_exec_cb(New, UI_Transition_X);
+        lv_anim_set_values(New, W, 0);
+        lv_anim_set_exec_cb(Old, UI_Transition_X);
+        lv_anim_set_values(Old, 0, -W);
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_RIGHT:
+        lv_anim_set_exec_cb(New, UI_Transition_X);
+        lv_anim_set_values(New, -W, 0);
+        lv_anim_set_exec_cb(Old, UI_Transition_X);
+        lv_anim_set_values(Old, 0, W);
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_TOP:
+        lv_anim_set_exec_cb(New, UI_Transition_Y);
+        lv_anim_set_values(New, H, 0);
+        lv_anim_set_exec_cb(Old, UI_Transition_Y);
+        lv_anim_set_values(Old, 0, -H);
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_BOTTOM:
+        lv_anim_set_exec_cb(New, UI_Transition_Y);
+        lv_anim_set_values(New, -H, 0);
+        lv_anim_set_exec_cb(Old, UI_Transition_Y);
+        lv_anim_set_values(Old, 0, H);
+        break;
+    case LV_SCR_LOAD_ANIM_FADE_IN:
+        lv_anim_set_exec_cb(New, UI_Transition_Opa);
+        lv_anim_set_values(New, LV_OPA_TRANSP, LV_OPA_COVER);
+        break;
+    case LV_SCR_LOAD_ANIM_FADE_OUT:
+        lv_anim_set_exec_cb(Old, UI_Transition_Opa);
+        lv_anim_set_values(Old, LV_OPA_COVER, LV_OPA_TRANSP);
+        return 1;
+    case LV_SCR_LOAD_ANIM_OUT_LEFT:
+        lv_anim_set_exec_cb(Old, UI_Transition_X);
+        lv_anim_set_values(Old, 0, -W);
+        return 1;
+    case LV_SCR_LOAD_ANIM_OUT_RIGHT:
+        lv_anim_set_exec_cb(Old, UI_Transition_X);
+        lv_anim_set_values(Old, 0, W);
+        return 1;
+    case LV_SCR_LOAD_ANIM_OUT_TOP:
+        lv_anim_set_exec_cb(Old, UI_Transition_Y);
+        lv_anim_set_values(Old, 0, -H);
+        return 1;
+    case LV_SCR_LOAD_ANIM_OUT_BOTTOM:
+        lv_anim_set_exec_cb(Old, UI_Transition_Y);
+        lv_anim_set_values(Old, 0, H);
+        return 1;
+    default:
+        break;
+    }
+    return 0;
+}
+
+static void UI_Transition_Live(lv_obj_t *Scr, lv_scr_load_anim_t Anim, uint32_t Time, uint32_t Delay)
+{
+    UI_Transition_Stats.Live++;
+    lv_scr_load_anim(Scr, Anim, Time, Delay, false);
+}
+
+/******************************************************************************
+function:	Load a screen with an animation, from snapshots if it can
+parameter:
+    Scr   : screen to load, built
+    Anim  : LV_SCR_LOAD_ANIM_*
+    Time  : length of the animation in ms
+    Delay : ms before it starts
+Info:
+    Takes the place of lv_scr_load_anim(Scr, Anim, Time, Delay, false).
+    Loads with a delay, without an animation and while lv_scr_load_anim()
+    still runs are left to it. A screen with an animation of its own,
+    e.g. a spinner or a scrolling label, is drawn live so it keeps moving.
+******************************************************************************/
+void UI_Transition_Load(lv_obj_t *Scr, lv_scr_load_anim_t Anim, uint32_t Time, uint32_t Delay)
+{
+#if LV_USE_SNAPSHOT
+    lv_disp_t *disp = lv_obj_get_disp(Scr);
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+    lv_coord_t h = lv_disp_get_ver_res(disp);
+    lv_obj_t *old, *img_old, *img_new;
+    lv_anim_t a_new, a_old;
+
+    UI_Transition_Finish();
+    old = lv_disp_get_scr_act(disp);
+    if(UI_Transition_Size == 0 || Anim == LV_SCR_LOAD_ANIM_NONE || Time == 0 || Delay != 0 ||
+       old == NULL || old == Scr || disp->prev_scr || (disp->scr_to_load && disp->scr_to_load != old)) {
+        UI_Transition_Live(Scr, Anim, Time, Delay);
+        return;
+    }
+    if(UI_Transition_Animating(old) || UI_Transition_Animating(Scr)) {
+        UI_Transition_Stats.Busy++;
+        lv_scr_load_anim(Scr, Anim, Time, Delay, false);
+        return;
+    }
+    if(lv_snapshot_take_to_buf(old, LV_IMG_CF_TRUE_COLOR, &UI_Transition_Img[0], UI_Transition_Buf[0],
+                               UI_Transition_Size) != LV_RES_OK ||
+       lv_snapshot_take_to_buf(Scr, LV_IMG_CF_TRUE_COLOR, &UI_Transition_Img[1], UI_Transition_Buf[1],
+                               UI_Transition_Size) != LV_RES_OK ||
+       UI_Transition_Img[0].header.w != w || UI_Transition_Img[0].header.h != h ||
+       UI_Transition_Img[1].header.w != w || UI_Transition_Img[1].header.h != h) {
+        UI_Transition_Live(Scr, Anim, Time, Delay);
+        return;
+    }
+
+    lv_anim_init(&a_new);
+    lv_anim_init(&a_old);
+    UI_Transition_Scr = lv_obj_create(NULL);
+    lv_obj_remove_style_all(UI_Transition_Scr);
+    lv_obj_clear_flag(UI_Transition_Scr, LV_OBJ_FLAG_SCROLLABLE);
+    if(UI_Transition_Anims(Anim, &a_new, &a_old, w, h)) {
+        img_new = UI_Transition_Image(UI_Transition_Scr, &UI_Transition_Img[1]);
+        img_old = UI_Transition_Image(UI_Transition_Scr, &UI_Transition_Img[0]);
+    } else {
+        img_old = UI_Transition_Image(UI_Transition_Scr, &UI_Transition_Img[0]);
+        img_new = UI_Transition_Image(UI_Transition_Scr, &UI_Transition_Img[1]);
+    }
+    UI_Transition_Target = Scr;
+    lv_scr_load(UI_Transition_Scr);
+
+    lv_anim_set_var(&a_new, img_new);
+    lv_anim_set_time(&a_new, Time);
+    lv_anim_set_ready_cb(&a_new, UI_Transition_Ready);
+    lv_anim_set_var(&a_old, img_old);
+    lv_anim_set_time(&a_old, Time);
+    lv_anim_start(&a_new);
+    lv_anim_start(&a_old);
+    UI_Transition_Stats.Snapshots++;
+#else
+    UI_Transition_Live(Scr, Anim, Time, Delay);
+#endif
+}
+
+/******************************************************************************
+function:	End a running snapshot animation at once
+Info:
+    Loads its screen, unless another one was loaded meanwhile. Called
+    before every screen change, so the screen manager never sees the
+    screen being loaded as unused.
+******************************************************************************/
+void UI_Transition_Finish(void)
+{
+    lv_obj_t *scr = UI_Transition_Scr;
+
+    if(scr == NULL)
+        return;
+    UI_Transition_Scr = NULL;
+    if(lv_scr_act() == scr)
+        lv_scr_load(UI_Transition_Target);
+    UI_Transition_Target = NULL;
+    lv_obj_del(scr);
+}
+
+void UI_Transition_GetStats(UI_TRANSITION_STATS *Stats)
+{
+    memcpy(Stats, &UI_Transition_Stats, sizeof(UI_TRANSITION_STATS));
+}
+
+void UI_Transition_ResetStats(void)
+{
+    memset(&UI_Transition_Stats, 0, sizeof(UI_TRANSITION_STATS));
+}
@@ -0,0 +1,42 @@
+/*****************************************************************************
+* | File      	:   UI_Transition.h
+* | Function    :   Screen load animations from snapshots
+* | Info        :
+*                lv_scr_load_anim() moves or fades the two screens
+*                themselves, so every frame of the animation draws both
+*                object trees again. UI_Transition_Load() draws each
+*                screen once into a bitmap with lv_snapshot and animates
+*                two images of them on a screen of its own instead, with
+*                the same positions and opacities. The screens are only
+*                drawn live when one of them animates itself.
+*
+*                The SquareLine files are C, so this header is C too.
+******************************************************************************/
+#ifndef __UI_TRANSITION_H
+#define __UI_TRANSITION_H
+
+#include <lvgl.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct{
+	uint32_t Snapshots;         // animated from snapshots
+	uint32_t Live;              // left to lv_scr_load_anim(): off, no animation or a delay
+	uint32_t Busy;              // drawn live because a screen animates itself
+}UI_TRANSITION_STATS;
+
+void UI_Transition_Init(void *Buf1, void *Buf2, uint32_t Size);
+void UI_Transition_Load(lv_obj_t *Scr, lv_scr_load_anim_t Anim, uint32_t Time, uint32_t Delay);
+void UI_Transition_Finish(void);
+
+void UI_Transition_GetStats(UI_TRANSITION_STATS *Stats);
+void UI_Transition_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+/*****************************************************************************
+* | File      	:   Arduino.h
+* | Function    :   Host stand-in for the Arduino core header
+* | Info        :
+*                The vendored lv_conf.h takes its tick from millis() in
+*                Arduino.h. Host tools that build LVGL put this directory
+*                first on the include path and define millis() themselves.
+******************************************************************************/
+#ifndef __ARDUINO_HOST_H
+#define __ARDUINO_HOST_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t millis(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
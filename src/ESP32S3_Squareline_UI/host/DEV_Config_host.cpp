@@ -0,0 +1,338 @@
+/*****************************************************************************
+* | File      	:   DEV_Config_host.cpp
+* | Function    :   Host implementation of the DEV_Config interface
+* | Info        :
+*                Stands in for DEV_Config.cpp when the drivers are built on
+*                a PC (DEV_HOST). Every SPI write goes to the GC9A01 mock
+*                with the current DC level; queued writes complete at once
+*                and call the done callback like the DEV_SPI_DMA 0 path.
+*                I2C goes to a simulated bus: devices attached with
+*                DEV_I2C_Sim_Attach answer, every transfer sleeps for the
+*                time its bits take at the current clock, and reads from
+*                anything else return zeros. Delays return immediately,
+*                DEV_Micros() reads the monotonic clock.
+*                Threads and semaphores are pthreads, the core and the
+*                priority are ignored.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "GC9A01_Mock.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+static DEV_SPI_Done_Callback spi_done_cb = NULL;
+static uint8_t dc_level = 0;
+
+/**
+ * GPIO read and write
+ **/
+void DEV_Digital_Write(uint16_t Pin, uint8_t Value)
+{
+    if (Pin == LCD_DC_PIN) {
+        dc_level = Value ? 1 : 0;
+    }
+}
+
+uint8_t DEV_Digital_Read(uint16_t Pin)
+{
+    (void)Pin;
+    return 0;
+}
+
+void DEV_GPIO_Mode(uint16_t Pin, uint16_t Mode)
+{
+    (void)Pin;
+    (void)Mode;
+}
+
+void DEV_KEY_Config(uint16_t Pin)
+{
+    (void)Pin;
+}
+
+uint16_t DEC_ADC_Read(void)
+{
+    return 0;
+}
+
+/**
+ * SPI
+ **/
+void DEV_SPI_WriteByte(uint8_t Value)
+{
+    GC9A01_Mock_Write(&Value, 1, dc_level);
+}
+
+void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
+{
+    while (Len > 0) {
+        uint32_t n = Len > DEV_SPI_MAX_TRANSFER ? DEV_SPI_MAX_TRANSFER : Len;
+        GC9A01_Mock_Write(pData, n, dc_level);
+        pData += n;
+        Len -= n;
+    }
+}
+
+void DEV_SPI_Queue_nByte(const uint8_t *pData, uint32_t Len, uint8_t Dc, void *Arg)
+{
+    while (Len > 0) {
+        uint32_t n = Len > DEV_SPI_MAX_TRANSFER ? DEV_SPI_MAX_TRANSFER : Len;
+        GC9A01_Mock_Write(pData, n, Dc);
+        pData += n;
+        Len -= n;
+    }
+    dc_level = Dc;
+    if (Arg != NULL && spi_done_cb != NULL) {
+        spi_done_cb(Arg);
+    }
+}
+
+void DEV_SPI_Queue_Seq(const uint8_t *pData, const uint8_t *pSeg, uint8_t Count)
+{
+    for (uint8_t i = 0; i < Count; i++) {
+        uint32_t Len = pSeg[i] & DEV_SPI_SEG_LEN;
+        uint8_t Dc = (pSeg[i] & DEV_SPI_SEG_DC) ? 1 : 0;
+        // Same split as the DMA path, segments over DEV_SPI_SEG_MAX go out in pieces
+        while (Len > 0) {
+            uint32_t n = Len > DEV_SPI_SEG_MAX ? DEV_SPI_SEG_MAX : Len;
+            GC9A01_Mock_Write(pData, n, Dc);
+            pData += n;
+            Len -= n;
+        }
+        dc_level = Dc;
+    }
+}
+
+void DEV_SPI_Wait_Idle(void)
+{
+}
+
+void DEV_SPI_Set_Done_Callback(DEV_SPI_Done_Callback Callback)
+{
+    spi_done_cb = Callback;
+}
+
+/**
+ * I2C
+ **/
+#define DEV_I2C_SIM_DEVICES 4
+
+typedef struct {
+    uint8_t addr;
+    DEV_I2C_Sim_Func func;
+    void *arg;
+    uint32_t max_hz;
+} DEV_I2C_Sim_Device;
+
+static DEV_I2C_Sim_Device i2c_sim[DEV_I2C_SIM_DEVICES];
+static uint8_t i2c_sim_count = 0;
+static uint32_t i2c_hz = 400000;
+
+void DEV_I2C_Sim_Attach(uint8_t Addr, DEV_I2C_Sim_Func Func, void *Arg, uint32_t Max_Hz)
+{
+    if (i2c_sim_count < DEV_I2C_SIM_DEVICES) {
+        i2c_sim[i2c_sim_count].addr = Addr;
+        i2c_sim[i2c_sim_count].func = Func;
+        i2c_sim[i2c_sim_count].arg = Arg;
+        i2c_sim[i2c_sim_count].max_hz = Max_Hz;
+        i2c_sim_count++;
+    }
+}
+
+// Sleep the wire time: 9 clocks a byte with its ACK, start and stop
+static void DEV_I2C_Sim_Wire(uint32_t Bits)
+{
+    struct timespec ts;
+    uint64_t ns = (uint64_t)Bits * 1000000000ULL / i2c_hz;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ns += ts.tv_nsec;
+    ts.tv_sec += ns / 1000000000ULL;
+    ts.tv_nsec = ns % 1000000000ULL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0) {
+    }
+}
+
+uint8_t DEV_I2C_Transfer(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len, uint8_t Write)
+{
+    DEV_I2C_Sim_Device *dev = NULL;
+
+    for (uint8_t i = 0; i < i2c_sim_count; i++) {
+        if (i2c_sim[i].addr == addr) {
+            dev = &i2c_sim[i];
+        }
+    }
+    // Address and register, then the data; a read addresses the device twice
+    DEV_I2C_Sim_Wire(Write ? (2 + Len) * 9 + 2 : (3 + Len) * 9 + 4);
+    if (dev == NULL || i2c_hz > dev->max_hz) {
+        if (!Write) {
+            memset(pData, 0, Len);
+        }
+        return 1;
+    }
+    return dev->func(reg, pData, Len, Write, dev->arg);
+}
+
+void DEV_I2C_Set_Clock(uint32_t Hz)
+{
+    i2c_hz = Hz;
+}
+
+void DEV_I2C_Write_Byte(uint8_t addr, uint8_t reg, uint8_t Value)
+{
+    DEV_I2C_Transfer(addr, reg, &Value, 1, 1);
+}
+
+void DEV_I2C_Write_nByte(uint8_t addr, uint8_t *pData, uint32_t Len)
+{
+    (void)addr;
+    (void)pData;
+    (void)Len;
+}
+
+void DEV_I2C_Write_Register(uint8_t addr, uint8_t reg, uint16_t value)
+{
+    (void)addr;
+    (void)reg;
+    (void)value;
+}
+
+uint8_t DEV_I2C_Read_Byte(uint8_t addr, uint8_t reg)
+{
+    uint8_t value;
+
+    DEV_I2C_Transfer(addr, reg, &value, 1, 0);
+    return value;
+}
+
+void DEV_I2C_Read_Register(uint8_t addr, uint8_t reg, uint16_t *value)
+{
+    (void)addr;
+    (void)reg;
+    *value = 0;
+}
+
+void DEV_I2C_Read_nByte(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len)
+{
+    DEV_I2C_Transfer(addr, reg, pData, Len, 0);
+}
+
+void DEV_SET_PWM(uint8_t Value)
+{
+    (void)Value;
+}
+
+/**
+ * Threads
+ **/
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t count;
+} DEV_Host_Sem;
+
+typedef struct {
+    DEV_Thread_Func func;
+    void *arg;
+} DEV_Host_Thread;
+
+static void *DEV_Thread_Start(void *p)
+{
+    DEV_Host_Thread t = *(DEV_Host_Thread *)p;
+    free(p);
+    t.func(t.arg);
+    return NULL;
+}
+
+uint8_t DEV_Thread_Create(DEV_Thread_Func Func, void *Arg, uint8_t Core)
+{
+    return DEV_Thread_Create_Priority(Func, Arg, Core, DEV_THREAD_PRIORITY);
+}
+
+uint8_t DEV_Thread_Create_Priority(DEV_Thread_Func Func, void *Arg, uint8_t Core, uint8_t Priority)
+{
+    (void)Core;
+    (void)Priority;
+    DEV_Host_Thread *t = (DEV_Host_Thread *)malloc(sizeof(DEV_Host_Thread));
+    pthread_t id;
+
+    if (t == NULL) {
+        return 1;
+    }
+    t->func = Func;
+    t->arg = Arg;
+    if (pthread_create(&id, NULL, DEV_Thread_Start, t) != 0) {
+        free(t);
+        return 1;
+    }
+    pthread_detach(id);
+    return 0;
+}
+
+DEV_Sem DEV_Sem_Create(uint32_t Initial)
+{
+    DEV_Host_Sem *s = (DEV_Host_Sem *)malloc(sizeof(DEV_Host_Sem));
+    if (s != NULL) {
+        pthread_mutex_init(&s->lock, NULL);
+        pthread_cond_init(&s->cond, NULL);
+        s->count = Initial;
+    }
+    return s;
+}
+
+void DEV_Sem_Give(DEV_Sem Sem)
+{
+    DEV_Host_Sem *s = (DEV_Host_Sem *)Sem;
+    pthread_mutex_lock(&s->lock);
+    s->count++;
+    pthread_cond_signal(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+}
+
+void DEV_Sem_Give_ISR(DEV_Sem Sem)
+{
+    DEV_Sem_Give(Sem);
+}
+
+void DEV_Sem_Take(DEV_Sem Sem)
+{
+    DEV_Host_Sem *s = (DEV_Host_Sem *)Sem;
+    pthread_mutex_lock(&s->lock);
+    while (s->count == 0) {
+        pthread_cond_wait(&s->cond, &s->lock);
+    }
+    s->count--;
+    pthread_mutex_unlock(&s->lock);
+}
+
+/**
+ * delay x ms
+ **/
+void DEV_Delay_ms(uint32_t xms)
+{
+    (void)xms;
+}
+
+void DEV_Delay_us(uint32_t xus)
+{
+    (void)xus;
+}
+
+uint32_t DEV_Micros(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+uint8_t DEV_Module_Init(void)
+{
+    GC9A01_Mock_Reset();
+    dc_level = 0;
+    return 0;
+}
+
+void DEV_Module_Exit(void)
+{
+}
@@ -0,0 +1,257 @@
+/*****************************************************************************
+* | File      	:   GC9A01_Mock.cpp
+* | Function    :   Host model of the GC9A01 panel behind the SPI bus
+* | Info        :
+*                Understands what LCD_1in28.cpp relies on: CASET/RASET
+*                windows, RAMWR/RAMWRC pixel streams, COLMOD 16/12/18 bit
+*                and MADCTL. Every other command just has its parameters
+*                counted.
+******************************************************************************/
+#include "GC9A01_Mock.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static uint16_t Mock_Fb[GC9A01_MOCK_WIDTH * GC9A01_MOCK_HEIGHT];
+static GC9A01_MOCK_STATS Mock_Stats;
+static uint64_t Mock_Bits = 0;
+
+static uint32_t Mock_Clock_Hz = 80000000;
+static uint32_t Mock_Trans_ns = 0;
+
+// Decoder state
+static uint8_t Mock_Cmd = 0;
+static uint8_t Mock_Param[4];
+static uint8_t Mock_Param_Idx = 0;
+static uint8_t Mock_Mem_Write = 0;
+static uint8_t Mock_Pend[3];
+static uint8_t Mock_Pend_Len = 0;
+static uint8_t Mock_Colmod = 0x66;     // power on default, 18 bit
+static uint8_t Mock_Madctl = 0x00;
+static uint16_t Mock_Xs = 0, Mock_Xe = GC9A01_MOCK_WIDTH - 1;
+static uint16_t Mock_Ys = 0, Mock_Ye = GC9A01_MOCK_HEIGHT - 1;
+static uint16_t Mock_X = 0, Mock_Y = 0;
+static uint8_t Mock_Wrapped = 0;
+static int Mock_Last_Dc = -1;
+
+/******************************************************************************
+function:	Power-on state: black framebuffer, full window, counters cleared
+******************************************************************************/
+void GC9A01_Mock_Reset(void)
+{
+    memset(Mock_Fb, 0, sizeof(Mock_Fb));
+    Mock_Cmd = 0;
+    Mock_Param_Idx = 0;
+    Mock_Mem_Write = 0;
+    Mock_Pend_Len = 0;
+    Mock_Colmod = 0x66;
+    Mock_Madctl = 0x00;
+    Mock_Xs = 0;
+    Mock_Xe = GC9A01_MOCK_WIDTH - 1;
+    Mock_Ys = 0;
+    Mock_Ye = GC9A01_MOCK_HEIGHT - 1;
+    Mock_X = Mock_Y = 0;
+    Mock_Wrapped = 0;
+    Mock_Last_Dc = -1;
+    GC9A01_Mock_Reset_Stats();
+}
+
+/******************************************************************************
+function:	Bus model used for the wire time estimate
+parameter:
+    Clock_Hz          : SPI clock
+    Trans_Overhead_ns : idle time added per transaction (DC/CS setup,
+                        driver and DMA start), 0 for the raw bit time
+******************************************************************************/
+void GC9A01_Mock_Set_Clock(uint32_t Clock_Hz, uint32_t Trans_Overhead_ns)
+{
+    Mock_Clock_Hz = Clock_Hz;
+    Mock_Trans_ns = Trans_Overhead_ns;
+}
+
+static void GC9A01_Mock_Store(uint16_t Color)
+{
+    if(Mock_Wrapped)
+        Mock_Stats.Overruns++;
+    if(Mock_X < GC9A01_MOCK_WIDTH && Mock_Y < GC9A01_MOCK_HEIGHT)
+        Mock_Fb[Mock_Y * GC9A01_MOCK_WIDTH + Mock_X] = Color;
+    Mock_Stats.Pixels++;
+
+    if(++Mock_X > Mock_Xe) {
+        Mock_X = Mock_Xs;
+        if(++Mock_Y > Mock_Ye) {
+            Mock_Y = Mock_Ys;
+            Mock_Wrapped = 1;
+        }
+    }
+}
+
+static uint16_t GC9A01_Mock_From444(uint8_t R, uint8_t G, uint8_t B)
+{
+    return ((R << 1 | R >> 3) << 11) | ((G << 2 | G >> 2) << 5) | (B << 1 | B >> 3);
+}
+
+static void GC9A01_Mock_Pixel_Byte(uint8_t Value)
+{
+    Mock_Pend[Mock_Pend_Len++] = Value;
+
+    switch(Mock_Colmod & 0x07) {
+    case 0x03:  // 12 bit, two pixels in three bytes, each stored once complete
+        if(Mock_Pend_Len == 2) {
+            GC9A01_Mock_Store(GC9A01_Mock_From444(Mock_Pend[0] >> 4, Mock_Pend[0] & 0x0F, Mock_Pend[1] >> 4));
+        } else if(Mock_Pend_Len == 3) {
+            GC9A01_Mock_Store(GC9A01_Mock_From444(Mock_Pend[1] & 0x0F, Mock_Pend[2] >> 4, Mock_Pend[2] & 0x0F));
+            Mock_Pend_Len = 0;
+        }
+        break;
+    case 0x06:  // 18 bit, one byte per channel, top 6 bits used
+        if(Mock_Pend_Len == 3) {
+            GC9A01_Mock_Store(((Mock_Pend[0] >> 3) << 11) | ((Mock_Pend[1] >> 2) << 5) | (Mock_Pend[2] >> 3));
+            Mock_Pend_Len = 0;
+        }
+        break;
+    default:    // 16 bit, big endian RGB565
+        if(Mock_Pend_Len == 2) {
+            GC9A01_Mock_Store(Mock_Pend[0] << 8 | Mock_Pend[1]);
+            Mock_Pend_Len = 0;
+        }
+        break;
+    }
+}
+
+static void GC9A01_Mock_Command(uint8_t Cmd)
+{
+    Mock_Stats.Commands++;
+    Mock_Stats.Cmd_Count[Cmd]++;
+    Mock_Cmd = Cmd;
+    Mock_Param_Idx = 0;
+    Mock_Pend_Len = 0;
+    Mock_Mem_Write = 0;
+
+    if(Cmd == 0x2C) {           // RAMWR restarts at the window origin
+        Mock_X = Mock_Xs;
+        Mock_Y = Mock_Ys;
+        Mock_Wrapped = 0;
+        Mock_Mem_Write = 1;
+        Mock_Stats.Windows++;
+    } else if(Cmd == 0x3C) {    // RAMWRC carries on where it stopped
+        Mock_Mem_Write = 1;
+    }
+}
+
+static void GC9A01_Mock_Param(uint8_t Value)
+{
+    Mock_Stats.Param_Bytes++;
+    if(Mock_Param_Idx < sizeof(Mock_Param))
+        Mock_Param[Mock_Param_Idx] = Value;
+    Mock_Param_Idx++;
+
+    switch(Mock_Cmd) {
+    case 0x2A:
+        if(Mock_Param_Idx == 4) {
+            Mock_Xs = Mock_Param[0] << 8 | Mock_Param[1];
+            Mock_Xe = Mock_Param[2] << 8 | Mock_Param[3];
+        }
+        break;
+    case 0x2B:
+        if(Mock_Param_Idx == 4) {
+            Mock_Ys = Mock_Param[0] << 8 | Mock_Param[1];
+            Mock_Ye = Mock_Param[2] << 8 | Mock_Param[3];
+        }
+        break;
+    case 0x3A:
+        if(Mock_Param_Idx == 1)
+            Mock_Colmod = Value;
+        break;
+    case 0x36:
+        if(Mock_Param_Idx == 1)
+            Mock_Madctl = Value;
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function:	One bus transaction
+parameter:
+    pData : bytes clocked out
+    Len   : number of bytes
+    Dc    : level of the DC line while they were sent
+******************************************************************************/
+void GC9A01_Mock_Write(const uint8_t *pData, uint32_t Len, uint8_t Dc)
+{
+    uint32_t i;
+
+    Mock_Stats.Transactions++;
+    if(Mock_Last_Dc >= 0 && Mock_Last_Dc != Dc)
+        Mock_Stats.Dc_Toggles++;
+    Mock_Last_Dc = Dc;
+    Mock_Bits += (uint64_t)Len * 8;
+
+    for(i = 0; i < Len; i++) {
+        if(!Dc) {
+            GC9A01_Mock_Command(pData[i]);
+        } else if(Mock_Mem_Write) {
+            Mock_Stats.Pixel_Bytes++;
+            GC9A01_Mock_Pixel_Byte(pData[i]);
+        } else {
+            GC9A01_Mock_Param(pData[i]);
+        }
+    }
+}
+
+/******************************************************************************
+function:	Panel contents as RGB565 in host byte order
+******************************************************************************/
+const uint16_t *GC9A01_Mock_Framebuffer(void)
+{
+    return Mock_Fb;
+}
+
+uint8_t GC9A01_Mock_Colmod(void)
+{
+    return Mock_Colmod;
+}
+
+uint8_t GC9A01_Mock_Madctl(void)
+{
+    return Mock_Madctl;
+}
+
+void GC9A01_Mock_Get_Stats(GC9A01_MOCK_STATS *Stats)
+{
+    *Stats = Mock_Stats;
+    Stats->Wire_ns = Mock_Bits * 1000000000ull / Mock_Clock_Hz +
+                     (uint64_t)Mock_Stats.Transactions * Mock_Trans_ns;
+}
+
+void GC9A01_Mock_Reset_Stats(void)
+{
+    memset(&Mock_Stats, 0, sizeof(Mock_Stats));
+    Mock_Bits = 0;
+}
+
+/******************************************************************************
+function:	Write the framebuffer as a binary PPM
+******************************************************************************/
+int GC9A01_Mock_Save_PPM(const char *Path)
+{
+    FILE *f = fopen(Path, "wb");
+    uint32_t i;
+
+    if(f == NULL)
+        return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", GC9A01_MOCK_WIDTH, GC9A01_MOCK_HEIGHT);
+    for(i = 0; i < GC9A01_MOCK_WIDTH * GC9A01_MOCK_HEIGHT; i++) {
+        uint16_t c = Mock_Fb[i];
+        uint8_t rgb[3];
+        rgb[0] = (c >> 11) << 3 | (c >> 13);
+        rgb[1] = ((c >> 5) & 0x3F) << 2 | ((c >> 9) & 0x03);
+        rgb[2] = (c & 0x1F) << 3 | ((c >> 2) & 0x07);
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return 0;
+}
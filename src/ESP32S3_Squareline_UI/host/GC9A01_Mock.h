@@ -0,0 +1,43 @@
+/*****************************************************************************
+* | File      	:   GC9A01_Mock.h
+* | Function    :   Host model of the GC9A01 panel behind the SPI bus
+* | Info        :
+*                Decodes the command stream written by LCD_1in28.cpp into a
+*                240x240 framebuffer and counts what went over the wire.
+*                Pixels are stored in the addressed (CASET/RASET) space,
+*                MADCTL mirroring is recorded but not applied.
+******************************************************************************/
+#ifndef __GC9A01_MOCK_H
+#define __GC9A01_MOCK_H
+
+#include <stdint.h>
+
+#define GC9A01_MOCK_WIDTH   240
+#define GC9A01_MOCK_HEIGHT  240
+
+typedef struct{
+	uint32_t Transactions;      // writes handed to the bus
+	uint32_t Dc_Toggles;        // DC level changes between transactions
+	uint32_t Commands;          // bytes sent with DC low
+	uint32_t Cmd_Count[256];    // per opcode
+	uint64_t Param_Bytes;       // DC high bytes outside RAMWR
+	uint64_t Pixel_Bytes;       // DC high bytes after RAMWR
+	uint64_t Pixels;            // pixels stored
+	uint32_t Windows;           // RAMWR commands
+	uint32_t Overruns;          // pixels that wrapped past the window end
+	uint64_t Wire_ns;           // estimated time on the bus
+}GC9A01_MOCK_STATS;
+
+void GC9A01_Mock_Reset(void);
+void GC9A01_Mock_Set_Clock(uint32_t Clock_Hz, uint32_t Trans_Overhead_ns);
+void GC9A01_Mock_Write(const uint8_t *pData, uint32_t Len, uint8_t Dc);
+
+const uint16_t *GC9A01_Mock_Framebuffer(void);
+uint8_t GC9A01_Mock_Colmod(void);
+uint8_t GC9A01_Mock_Madctl(void);
+
+void GC9A01_Mock_Get_Stats(GC9A01_MOCK_STATS *Stats);
+void GC9A01_Mock_Reset_Stats(void);
+int GC9A01_Mock_Save_PPM(const char *Path);
+
+#endif
@@ -0,0 +1,91 @@
+/*****************************************************************************
+* | File      	:   LVGL_Bench.cpp
+* | Function    :   Host LVGL display shared by the bench tools
+* | Info        :
+*                Registers the display the way setup() does, with a flush
+*                that completes at once instead of waiting for the panel.
+******************************************************************************/
+#include "LVGL_Bench.h"
+
+#include <string.h>
+#include <time.h>
+
+static lv_disp_draw_buf_t Bench_Draw_Buf;
+static lv_color_t Bench_Buf1[LVGL_BENCH_BUF_PX];
+static lv_color_t Bench_Buf2[LVGL_BENCH_BUF_PX];
+static lv_disp_drv_t Bench_Disp_Drv;
+static lv_color_t Bench_Frame[LVGL_BENCH_WIDTH * LVGL_BENCH_HEIGHT];
+static unsigned long Bench_Rendered_Px = 0;
+
+static void Bench_Flush(lv_disp_drv_t *Drv, const lv_area_t *Area, lv_color_t *Px)
+{
+    lv_coord_t w = lv_area_get_width(Area);
+    lv_coord_t y;
+    for(y = Area->y1; y <= Area->y2; y++) {
+        memcpy(&Bench_Frame[y * LVGL_BENCH_WIDTH + Area->x1], Px, w * sizeof(lv_color_t));
+        Px += w;
+    }
+    Bench_Rendered_Px += lv_area_get_size(Area);
+    lv_disp_flush_ready(Drv);
+}
+
+/******************************************************************************
+function:	lv_init() and the display
+return:
+    the registered display, its driver holds the draw context
+******************************************************************************/
+lv_disp_t *LVGL_Bench_Init(void)
+{
+    lv_init();
+    lv_disp_draw_buf_init(&Bench_Draw_Buf, Bench_Buf1, Bench_Buf2, LVGL_BENCH_BUF_PX);
+    lv_disp_drv_init(&Bench_Disp_Drv);
+    Bench_Disp_Drv.hor_res = LVGL_BENCH_WIDTH;
+    Bench_Disp_Drv.ver_res = LVGL_BENCH_HEIGHT;
+    Bench_Disp_Drv.flush_cb = Bench_Flush;
+    Bench_Disp_Drv.draw_buf = &Bench_Draw_Buf;
+    return lv_disp_drv_register(&Bench_Disp_Drv);
+}
+
+/******************************************************************************
+function:	What the flushes have written so far, row by row
+******************************************************************************/
+const lv_color_t *LVGL_Bench_Frame(void)
+{
+    return Bench_Frame;
+}
+
+/******************************************************************************
+function:	FNV-1a of the frame, to compare runs without keeping every frame
+******************************************************************************/
+uint32_t LVGL_Bench_Frame_Hash(void)
+{
+    const uint8_t *p = (const uint8_t *)Bench_Frame;
+    uint32_t h = 2166136261u;
+    size_t i;
+    for(i = 0; i < sizeof(Bench_Frame); i++)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+/******************************************************************************
+function:	Pixels flushed since the last reset
+******************************************************************************/
+unsigned long LVGL_Bench_Rendered_Px(void)
+{
+    return Bench_Rendered_Px;
+}
+
+void LVGL_Bench_Reset_Rendered_Px(void)
+{
+    Bench_Rendered_Px = 0;
+}
+
+/******************************************************************************
+function:	Monotonic time for the measurements
+******************************************************************************/
+double LVGL_Bench_Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   LVGL_Bench.h
+* | Function    :   Host LVGL display shared by the bench tools
+* | Info        :
+*                A 240x240 LVGL display with the sketch's two 240x24 draw
+*                buffers. Its flush copies every area into a full frame
+*                and counts the pixels, so the tools can compare what
+*                different runs put on the screen.
+*                The tools still define millis() themselves.
+******************************************************************************/
+#ifndef __LVGL_BENCH_H
+#define __LVGL_BENCH_H
+
+#include "lvgl.h"
+
+#include <stdint.h>
+
+#define LVGL_BENCH_WIDTH    240
+#define LVGL_BENCH_HEIGHT   240
+#define LVGL_BENCH_BUF_PX   (LVGL_BENCH_WIDTH * LVGL_BENCH_HEIGHT / 10)
+
+lv_disp_t *LVGL_Bench_Init(void);
+
+const lv_color_t *LVGL_Bench_Frame(void);
+uint32_t LVGL_Bench_Frame_Hash(void);
+
+unsigned long LVGL_Bench_Rendered_Px(void);
+void LVGL_Bench_Reset_Rendered_Px(void);
+
+double LVGL_Bench_Now_us(void);
+
+#endif
@@ -0,0 +1,149 @@
+/*****************************************************************************
+* | File      	:   arc_bench.cpp
+* | Function    :   Host check and benchmark of arc value updates
+* | Info        :
+*                Builds arcs like ui_Arc_Steps (0..1000, 160x160) and
+*                ui_Arc1 (0..60, 150x150) with the step label in the middle
+*                on a 240x240 display with the sketch's 240x24 buffers.
+*                After every lv_arc_set_value() only the invalidated areas
+*                are rendered; the frame must then be the same as a full
+*                redraw. Prints the best time of 5 runs and the pixels
+*                rendered per update.
+*
+*                usage: arc_bench [-n updates]
+*                  -n  updates per scenario (default 1000)
+*
+*                Exits with 1 if an update leaves stale pixels.
+******************************************************************************/
+#include "LVGL_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static lv_color_t Frame_Full[LVGL_BENCH_WIDTH * LVGL_BENCH_HEIGHT];
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+// The incremental frame against a redraw of the whole screen
+static int Check_Frame(void)
+{
+    memcpy(Frame_Full, LVGL_Bench_Frame(), sizeof(Frame_Full));
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    return memcmp(Frame_Full, LVGL_Bench_Frame(), sizeof(Frame_Full)) != 0;
+}
+
+typedef struct {
+    const char *Name;
+    lv_coord_t Size;
+    int16_t Max;
+    int Step;           // value change per update, 0: random values
+    int Label;          // also change the label in the middle
+} ARC_SCENARIO;
+
+static const ARC_SCENARIO Scenarios[] = {
+    {"steps", 160, 1000, 1, 0},
+    {"steps+label", 160, 1000, 1, 1},
+    {"countdown", 150, 60, -1, 1},
+    {"random", 160, 1000, 0, 0},
+};
+
+/******************************************************************************
+function:	Run the updates of a scenario, checked or timed
+parameter:
+    Sc      : scenario
+    Updates : number of lv_arc_set_value() calls
+    Check   : 1 compares every frame with a full redraw, 0 measures
+    Us      : time per update when measuring
+return:
+    number of frames that differed
+******************************************************************************/
+static int Run(const ARC_SCENARIO *Sc, int Updates, int Check, double *Us)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *arc = lv_arc_create(scr);
+    lv_obj_set_size(arc, Sc->Size, Sc->Size);
+    lv_obj_align(arc, LV_ALIGN_CENTER, 0, -10);
+    lv_arc_set_range(arc, 0, Sc->Max);
+    lv_arc_set_value(arc, Sc->Step < 0 ? Sc->Max : 0);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_48, 0);
+    lv_obj_align(label, LV_ALIGN_CENTER, 0, -10);
+    lv_label_set_text(label, "0");
+    lv_scr_load(scr);
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+
+    int value = lv_arc_get_value(arc);
+    int bad = 0;
+    int i;
+    srand(1);
+    LVGL_Bench_Reset_Rendered_Px();
+    double t0 = LVGL_Bench_Now_us();
+    for(i = 0; i < Updates; i++) {
+        if(Sc->Step)
+            value = (value + Sc->Step + Sc->Max + 1) % (Sc->Max + 1);
+        else
+            value = rand() % (Sc->Max + 1);
+        if(Sc->Label) {
+            char text[8];
+            snprintf(text, sizeof(text), "%d", value);
+            lv_label_set_text(label, text);
+        }
+        lv_arc_set_value(arc, value);
+        lv_refr_now(NULL);
+        if(Check && Check_Frame()) {
+            if(!bad)
+                printf("  %s: stale pixels after value %d\n", Sc->Name, value);
+            bad++;
+        }
+    }
+    *Us = (LVGL_Bench_Now_us() - t0) / Updates;
+
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_scr_load(blank);
+    lv_obj_del(scr);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    int updates = 1000;
+    int fail = 0;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            updates = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n updates]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    LVGL_Bench_Init();
+
+    printf("%-12s %10s %9s  %s\n", "scenario", "us/update", "px/update", "check");
+    for(i = 0; i < (int)(sizeof(Scenarios) / sizeof(Scenarios[0])); i++) {
+        double us, best = 1e9;
+        int bad = Run(&Scenarios[i], updates, 1, &us);
+        int r;
+        // Best of a few runs, a PC is rarely quiet
+        for(r = 0; r < 5; r++) {
+            Run(&Scenarios[i], updates, 0, &us);
+            if(us < best)
+                best = us;
+        }
+        printf("%-12s %10.1f %9lu  %s\n", Scenarios[i].Name, best, LVGL_Bench_Rendered_Px() / updates, bad ? "FAIL" : "ok");
+        fail |= bad != 0;
+    }
+
+    return fail;
+}
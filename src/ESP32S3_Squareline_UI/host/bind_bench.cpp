@@ -0,0 +1,239 @@
+/*****************************************************************************
+* | File      	:   bind_bench.cpp
+* | Function    :   Host check and benchmark of the UI bindings
+* | Info        :
+*                Replays loop()'s updates on a copy of Screen5 (step label
+*                and arc) and Screen3 (countdown label and arc) for a few
+*                minutes of simulated time: steps are read every 50 ms,
+*                the countdown ticks every second and a frame is rendered
+*                every 33 ms. Runs once with the widgets set directly on
+*                every read and once through UI_Binding. Every frame must
+*                be the same in both runs, including after the screens are
+*                deleted and created again as SquareLine does.
+*
+*                usage: bind_bench [-s seconds]
+*                  -s  simulated time (default 300)
+*
+*                Exits with 1 if a frame differs.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "UI_Binding.h"
+#include "LVGL_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FRAME_MS    33
+#define STEP_MS     50
+#define COUNT_MS    1000
+
+// The SquareLine globals the sketch binds to
+static lv_obj_t *ui_Screen3 = NULL;
+static lv_obj_t *ui_time1 = NULL;
+static lv_obj_t *ui_Arc1 = NULL;
+static lv_obj_t *ui_Screen5 = NULL;
+static lv_obj_t *ui_LabelStepCount = NULL;
+static lv_obj_t *ui_Arc_Steps = NULL;
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static lv_obj_t *Arc(lv_obj_t *Scr, lv_coord_t Size, int16_t Max, lv_coord_t X)
+{
+    lv_obj_t *arc = lv_arc_create(Scr);
+    lv_obj_set_size(arc, Size, Size);
+    lv_obj_align(arc, LV_ALIGN_CENTER, X, 0);
+    lv_arc_set_range(arc, 0, Max);
+    lv_arc_set_value(arc, Max / 2);
+    return arc;
+}
+
+static lv_obj_t *Label(lv_obj_t *Scr, const char *Text, lv_coord_t X)
+{
+    lv_obj_t *label = lv_label_create(Scr);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_48, 0);
+    lv_obj_align(label, LV_ALIGN_CENTER, X, 0);
+    lv_label_set_text(label, Text);
+    return label;
+}
+
+// Both watch faces side by side on one screen, so both are always drawn
+static void Screens_Create(void)
+{
+    ui_Screen5 = lv_obj_create(NULL);
+    ui_Arc_Steps = Arc(ui_Screen5, 110, 1000, -60);
+    ui_LabelStepCount = Label(ui_Screen5, "0", -60);
+    ui_Screen3 = lv_obj_create(ui_Screen5);
+    lv_obj_remove_style_all(ui_Screen3);
+    lv_obj_set_size(ui_Screen3, LVGL_BENCH_WIDTH, LVGL_BENCH_HEIGHT);
+    ui_Arc1 = Arc(ui_Screen3, 110, 60, 60);
+    ui_time1 = Label(ui_Screen3, "60", 60);
+    lv_scr_load(ui_Screen5);
+}
+
+static void Screens_Delete(void)
+{
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_scr_load(blank);
+    lv_obj_del(ui_Screen5);
+    ui_Screen3 = ui_time1 = ui_Arc1 = NULL;
+    ui_Screen5 = ui_LabelStepCount = ui_Arc_Steps = NULL;
+}
+
+// Walking at about two steps a second, with a few pauses
+static int Steps_At(uint32_t Ms)
+{
+    uint32_t walked = Ms % 60000 < 45000 ? Ms % 60000 : 45000;
+    return (Ms / 60000) * 90 + walked / 500;
+}
+
+typedef struct {
+    double Us;              // per simulated second
+    unsigned long Px;
+    unsigned long Frames;
+    unsigned long Updates;  // widget updates
+} BIND_RESULT;
+
+/******************************************************************************
+function:	Replay the updates of loop() over simulated time
+parameter:
+    Seconds : simulated time
+    Bound   : 0 sets the widgets on every read, 1 goes through UI_Binding
+    Hashes  : frame hashes, written by the direct run, checked by the bound one
+    Res     : time, rendered pixels, frames and widget updates
+return:
+    number of frames that differed
+******************************************************************************/
+static int Run(int Seconds, int Bound, uint32_t *Hashes, BIND_RESULT *Res)
+{
+    static UI_BINDING *Bind_Steps = NULL, *Bind_Steps_Arc = NULL;
+    static UI_BINDING *Bind_Time = NULL, *Bind_Time_Arc = NULL;
+    uint32_t end = (uint32_t)Seconds * 1000;
+    uint32_t ms;
+    int countdown = 60;
+    int bad = 0;
+
+    if(Bound && Bind_Steps == NULL) {
+        Bind_Steps = UI_Binding_Label_Int(&ui_LabelStepCount, "%d");
+        Bind_Steps_Arc = UI_Binding_Arc(&ui_Arc_Steps);
+        Bind_Time = UI_Binding_Label_Int(&ui_time1, "%d");
+        Bind_Time_Arc = UI_Binding_Arc(&ui_Arc1);
+    }
+
+    Screens_Create();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    memset(Res, 0, sizeof(BIND_RESULT));
+    LVGL_Bench_Reset_Rendered_Px();
+    double t0 = LVGL_Bench_Now_us();
+    for(ms = 0; ms < end; ms++) {
+        // Leave the screens for a while every minute
+        if(ms % 60000 == 30000)
+            Screens_Delete();
+        if(ms % 60000 == 32000)
+            Screens_Create();
+
+        if(ms % COUNT_MS == 0) {
+            if(--countdown < 0)
+                countdown = 60;
+            if(Bound) {
+                UI_Binding_Set_Int(Bind_Time, countdown);
+                UI_Binding_Set_Int(Bind_Time_Arc, countdown);
+            } else if(ui_time1 != NULL) {
+                char text[4];
+                snprintf(text, sizeof(text), "%d", countdown);
+                lv_label_set_text(ui_time1, text);
+                lv_arc_set_value(ui_Arc1, countdown);
+                Res->Updates += 2;
+            }
+        }
+
+        if(ms % STEP_MS == 0) {
+            int steps = Steps_At(ms);
+            int arc = steps % 1000;
+            if(arc == 0 && steps > 0)
+                arc = 1000;
+            if(Bound) {
+                UI_Binding_Set_Int(Bind_Steps, steps);
+                UI_Binding_Set_Int(Bind_Steps_Arc, arc);
+            } else if(ui_LabelStepCount != NULL) {
+                char text[10];
+                snprintf(text, sizeof(text), "%d", steps);
+                lv_label_set_text(ui_LabelStepCount, text);
+                lv_arc_set_value(ui_Arc_Steps, arc);
+                Res->Updates += 2;
+            }
+        }
+
+        if(ms % FRAME_MS == 0) {
+            if(Bound)
+                UI_Binding_Flush();
+            lv_refr_now(NULL);
+            if(!Bound)
+                Hashes[Res->Frames] = LVGL_Bench_Frame_Hash();
+            else if(Hashes[Res->Frames] != LVGL_Bench_Frame_Hash()) {
+                if(!bad)
+                    printf("  frame at %u ms differs\n", (unsigned)ms);
+                bad++;
+            }
+            Res->Frames++;
+        }
+    }
+    Res->Us = (LVGL_Bench_Now_us() - t0) / Seconds;
+    Res->Px = LVGL_Bench_Rendered_Px();
+
+    Screens_Delete();
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = 300;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-s") && i + 1 < argc)
+            seconds = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-s seconds]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(seconds < 1)
+        seconds = 1;
+
+    LVGL_Bench_Init();
+
+    if(UI_Binding_Init()) {
+        printf("UI_Binding_Init failed\n");
+        return 1;
+    }
+
+    uint32_t *hashes = (uint32_t *)malloc((seconds * 1000 / FRAME_MS + 1) * sizeof(uint32_t));
+    BIND_RESULT direct, bound;
+    UI_BINDING_STATS st;
+
+    Run(seconds, 0, hashes, &direct);
+    UI_Binding_ResetStats();
+    int bad = Run(seconds, 1, hashes, &bound);
+    UI_Binding_GetStats(&st);
+    bound.Updates = st.Applied;
+    free(hashes);
+
+    printf("%d s simulated, %lu frames\n", seconds, direct.Frames);
+    printf("%-8s %8s %10s %10s  %s\n", "run", "updates", "kpx", "us/s", "check");
+    printf("%-8s %8lu %10lu %10.1f\n", "direct", direct.Updates, direct.Px / 1000, direct.Us);
+    printf("%-8s %8lu %10lu %10.1f  %s\n", "binding", bound.Updates, bound.Px / 1000, bound.Us,
+           bad ? "FAIL" : "ok");
+    printf("binding: %lu sets, %lu unchanged, %lu coalesced, %lu applied\n",
+           (unsigned long)st.Sets, (unsigned long)st.Unchanged,
+           (unsigned long)st.Coalesced, (unsigned long)st.Applied);
+
+    return bad != 0;
+}
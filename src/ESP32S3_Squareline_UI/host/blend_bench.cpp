@@ -0,0 +1,285 @@
+/*****************************************************************************
+* | File      	:   blend_bench.cpp
+* | Function    :   Host check and benchmark of the LVGL blend kernels
+* | Info        :
+*                Built against the vendored LVGL with the sketch's
+*                lv_conf.h (RGB565, bytes swapped). Every kernel table is
+*                run next to the reference one on the same random buffers,
+*                all opacities, odd widths and every alignment of the
+*                destination, source and mask, and the whole buffers are
+*                compared afterwards. Then each kernel blends a 240x24 area
+*                (one draw buffer of the sketch) and the pixel rate is
+*                printed.
+*
+*                usage: blend_bench [-n rounds]
+*                  -n  blends per kernel in the timing runs (default 2000)
+*
+*                Exits with 1 if any kernel differs from the reference.
+******************************************************************************/
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRIDE  256
+#define ROWS    32
+#define AREA_W  240
+#define AREA_H  24
+
+typedef struct {
+    const char *Name;
+    const lv_draw_sw_blend_kernels_t *Kernels;
+} BENCH_TABLE;
+
+static const BENCH_TABLE Tables[] = {
+    {"swar", &lv_draw_sw_blend_kernels_swar},
+};
+#define TABLE_COUNT (sizeof(Tables) / sizeof(Tables[0]))
+
+// Room for offsets of up to 7 pixels in front of every area
+static lv_color_t Dest_Ref[STRIDE * ROWS + 8];
+static lv_color_t Dest_Test[STRIDE * ROWS + 8];
+static lv_color_t Src[STRIDE * ROWS + 8];
+static lv_opa_t Mask[STRIDE * ROWS + 8];
+static uint32_t Seed = 1;
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1103515245u + 12345u;
+    return Seed >> 8;
+}
+
+static lv_color_t Rand_Color(void)
+{
+    lv_color_t c;
+    c.full = (uint16_t)Rand();
+    return c;
+}
+
+// Destination contents, the kinds a UI really has under a blend
+enum {
+    DEST_RANDOM,    // every pixel different
+    DEST_PALETTE,   // runs of a few colors
+    DEST_BLACK,     // all black
+    DEST_BLACK_THEN,// black rows, then random
+    DEST_KINDS
+};
+
+static void Fill_Dest(int Kind)
+{
+    lv_color_t palette[4] = {Rand_Color(), Rand_Color(), lv_color_black(), Rand_Color()};
+    uint32_t i, n = sizeof(Dest_Ref) / sizeof(Dest_Ref[0]);
+
+    for(i = 0; i < n; i++) {
+        switch(Kind) {
+        case DEST_RANDOM:
+            Dest_Ref[i] = Rand_Color();
+            break;
+        case DEST_PALETTE:
+            Dest_Ref[i] = palette[(i / (1 + Rand() % 7)) & 3];
+            break;
+        case DEST_BLACK:
+            Dest_Ref[i] = lv_color_black();
+            break;
+        default:
+            Dest_Ref[i] = i < STRIDE * 2 + 37 ? lv_color_black() : Rand_Color();
+            break;
+        }
+    }
+    memcpy(Dest_Test, Dest_Ref, sizeof(Dest_Ref));
+}
+
+static void Fill_Src_Mask(void)
+{
+    uint32_t i, n = sizeof(Src) / sizeof(Src[0]);
+    for(i = 0; i < n; i++)
+        Src[i] = Rand_Color();
+
+    // Runs of transparent and opaque with anti-aliased edges between them
+    i = 0;
+    while(i < n) {
+        uint32_t run = 1 + Rand() % 12;
+        uint32_t kind = Rand() % 3;
+        for(; run && i < n; run--, i++)
+            Mask[i] = kind == 0 ? (lv_opa_t)LV_OPA_TRANSP : kind == 1 ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)Rand();
+    }
+}
+
+static int Compare(const char *Table, const char *Op, int W, int H, int Off, int Opa)
+{
+    uint32_t i, n = sizeof(Dest_Ref) / sizeof(Dest_Ref[0]);
+    for(i = 0; i < n; i++) {
+        if(Dest_Ref[i].full != Dest_Test[i].full) {
+            printf("  %s %s w %d h %d offset %d opa %d: pixel %u is 0x%04x, reference 0x%04x\n",
+                   Table, Op, W, H, Off, Opa, i, Dest_Test[i].full, Dest_Ref[i].full);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************
+function:	Run one table against the reference kernels
+parameter:
+    Table : kernels to check
+return:
+    number of cases that differed
+******************************************************************************/
+static int Check_Table(const BENCH_TABLE *Table)
+{
+    const lv_draw_sw_blend_kernels_t *ref = &lv_draw_sw_blend_kernels_ref;
+    const lv_draw_sw_blend_kernels_t *k = Table->Kernels;
+    static const int widths[] = {1, 2, 3, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 129, 240};
+    int bad = 0;
+    int wi, off, soff, kind, opa;
+
+    for(wi = 0; wi < (int)(sizeof(widths) / sizeof(widths[0])); wi++) {
+        int w = widths[wi];
+        int h = w < 8 ? 20 : 3;
+        for(off = 0; off < 8; off++) {
+            lv_color_t color = Rand_Color();
+
+            Fill_Dest(DEST_RANDOM);
+            ref->fill(Dest_Ref + off, STRIDE, w, h, color);
+            k->fill(Dest_Test + off, STRIDE, w, h, color);
+            bad += Compare(Table->Name, "fill", w, h, off, 255);
+
+            for(soff = 0; soff < 8; soff++) {
+                Fill_Src_Mask();
+                Fill_Dest(DEST_RANDOM);
+                ref->copy(Dest_Ref + off, STRIDE, Src + soff, STRIDE - 3, w, h);
+                k->copy(Dest_Test + off, STRIDE, Src + soff, STRIDE - 3, w, h);
+                bad += Compare(Table->Name, "copy", w, h, off * 8 + soff, 255);
+
+                Fill_Dest(DEST_PALETTE);
+                ref->fill_mask(Dest_Ref + off, STRIDE, w, h, color, Mask + soff, STRIDE - 5);
+                k->fill_mask(Dest_Test + off, STRIDE, w, h, color, Mask + soff, STRIDE - 5);
+                bad += Compare(Table->Name, "fill_mask", w, h, off * 8 + soff, 255);
+            }
+
+            // Every opacity the blend functions hand to the _opa kernels
+            for(opa = LV_OPA_MIN + 1; opa < LV_OPA_MAX; opa++) {
+                soff = opa & 7;
+                Fill_Src_Mask();
+                Fill_Dest(DEST_RANDOM);
+                ref->copy_opa(Dest_Ref + off, STRIDE, Src + soff, STRIDE, w, h, opa);
+                k->copy_opa(Dest_Test + off, STRIDE, Src + soff, STRIDE, w, h, opa);
+                bad += Compare(Table->Name, "copy_opa", w, h, off * 8 + soff, opa);
+
+                // Taller, so narrow areas get past FILL_OPA_MIN_PX too
+                for(kind = 0; kind < DEST_KINDS; kind++) {
+                    int fh = w < 8 ? ROWS - 1 : 8;
+                    Fill_Dest(kind);
+                    ref->fill_opa(Dest_Ref + off, STRIDE, w, fh, color, opa);
+                    k->fill_opa(Dest_Test + off, STRIDE, w, fh, color, opa);
+                    bad += Compare(Table->Name, "fill_opa", w, fh, off, opa);
+                }
+            }
+        }
+    }
+    return bad;
+}
+
+static double Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/******************************************************************************
+function:	Blend one 240x24 area Rounds times with an operation of a table
+parameter:
+    K      : kernels
+    Op     : 0 fill, 1 fill_opa, 2 fill_opa over one color, 3 fill_mask,
+             4 copy, 5 copy_opa, 6 copy_opa at 50%
+    Rounds : repetitions
+return:
+    pixels per microsecond (Mpx/s)
+******************************************************************************/
+static double Time_Op(const lv_draw_sw_blend_kernels_t *K, int Op, int Rounds)
+{
+    lv_color_t color = lv_color_hex(0x3080C0);
+    double t0, t1;
+    int i;
+
+    Fill_Dest(Op == 2 ? DEST_BLACK : DEST_RANDOM);
+    t0 = Now_us();
+    for(i = 0; i < Rounds; i++) {
+        switch(Op) {
+        case 0: K->fill(Dest_Test, STRIDE, AREA_W, AREA_H, color); break;
+        case 1:
+            // Fresh random pixels, the blend feeds on its own output otherwise
+            memcpy(Dest_Test, Dest_Ref, STRIDE * AREA_H * sizeof(lv_color_t));
+            K->fill_opa(Dest_Test, STRIDE, AREA_W, AREA_H, color, LV_OPA_60);
+            break;
+        case 2: K->fill_opa(Dest_Test, STRIDE, AREA_W, AREA_H, color, LV_OPA_60); break;
+        case 3: K->fill_mask(Dest_Test, STRIDE, AREA_W, AREA_H, color, Mask, STRIDE); break;
+        case 4: K->copy(Dest_Test, STRIDE, Src, STRIDE, AREA_W, AREA_H); break;
+        case 5: K->copy_opa(Dest_Test, STRIDE, Src, STRIDE, AREA_W, AREA_H, LV_OPA_70); break;
+        default: K->copy_opa(Dest_Test, STRIDE, Src, STRIDE, AREA_W, AREA_H, LV_OPA_50); break;
+        }
+    }
+    t1 = Now_us();
+
+    // The copy in case 1 is timed too, take it out again
+    if(Op == 1) {
+        double c0 = Now_us();
+        for(i = 0; i < Rounds; i++)
+            memcpy(Dest_Test, Dest_Ref, STRIDE * AREA_H * sizeof(lv_color_t));
+        t1 -= Now_us() - c0;
+    }
+    return (double)AREA_W * AREA_H * Rounds / (t1 > t0 ? t1 - t0 : 1);
+}
+
+int main(int argc, char **argv)
+{
+    static const char *ops[] = {"fill", "fill_opa", "fill_opa_bg", "fill_mask", "copy", "copy_opa", "copy_opa50"};
+    int rounds = 2000;
+    int fail = 0;
+    uint32_t t;
+    int i, op;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            rounds = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("RGB565%s\n", LV_COLOR_16_SWAP ? ", bytes swapped" : "");
+    for(t = 0; t < TABLE_COUNT; t++) {
+        int bad = Check_Table(&Tables[t]);
+        printf("check %-6s %s\n", Tables[t].Name, bad ? "FAIL" : "ok");
+        fail |= bad != 0;
+    }
+
+    Fill_Src_Mask();
+    printf("%-12s %8s", "Mpx/s", "ref");
+    for(t = 0; t < TABLE_COUNT; t++)
+        printf(" %12s", Tables[t].Name);
+    printf("\n");
+    for(op = 0; op < (int)(sizeof(ops) / sizeof(ops[0])); op++) {
+        double ref = Time_Op(&lv_draw_sw_blend_kernels_ref, op, rounds);
+        printf("%-12s %8.1f", ops[op], ref);
+        for(t = 0; t < TABLE_COUNT; t++) {
+            double r = Time_Op(Tables[t].Kernels, op, rounds);
+            printf(" %7.1f %3.1fx", r, r / ref);
+        }
+        printf("\n");
+    }
+
+    return fail;
+}
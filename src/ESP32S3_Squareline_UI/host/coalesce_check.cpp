@@ -0,0 +1,289 @@
+/*****************************************************************************
+* | File      	:   coalesce_check.cpp
+* | Function    :   Host replay of dirty area traces through Area_Coalesce
+* | Info        :
+*                Every refresh of a trace is a list of LVGL dirty areas as
+*                my_refr_timer finds them. Each one is coalesced with the
+*                sketch's COALESCE_WINDOW_COST and checked: every pixel of
+*                the areas handed in is in an area handed out, the areas
+*                out stay inside the bounding box of those in, there are
+*                no more of them and their bus cost is not higher. For the
+*                built-in traces the areas and pixels left must also match
+*                the counts below, so a change of the merging shows up.
+*
+*                Built in: a countdown tick and a step update (label and
+*                arc segment), a time label drawn digit by digit, a list
+*                scrolling by thin rows, and random small areas.
+*
+*                usage: coalesce_check [-f log] [-444]
+*                  -f    replay the "AREAS:" lines of a serial log of the
+*                        sketch built with COALESCE_TRACE 1 instead
+*                  -444  cost pixels at 1.5 bytes (LCD_1IN28_COLOR_444);
+*                        the built-in counts are for 565 and not checked
+*
+*                Exits with 1 if a refresh fails a check or a count differs.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "Area_Coalesce.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W   LCD_1IN28_WIDTH
+#define H   LCD_1IN28_HEIGHT
+
+// The sketch's cost of a window besides its pixels
+#define COALESCE_WINDOW_COST    (LCD_1IN28_WINDOW_SETUP + 6 * 16)
+
+#define TRACE_MAX_REFRS     64
+
+typedef struct{
+	const char *Name;
+	uint16_t Refrs;
+	uint16_t Count[TRACE_MAX_REFRS];
+	lv_area_t Areas[TRACE_MAX_REFRS][LV_INV_BUF_SIZE];
+	// Expected after coalescing, 565
+	UDOUBLE Want_Areas;
+	UDOUBLE Want_Pixels;
+}TRACE;
+
+typedef struct{
+	UDOUBLE Areas_In, Areas_Out;
+	UDOUBLE Pixels_In, Pixels_Out;
+	UDOUBLE Cost_In, Cost_Out;
+	uint32_t Bad;
+}RESULT;
+
+static UBYTE Colmod = LCD_1IN28_COLOR_565;
+static UBYTE Covered[H][W];
+
+extern "C" uint32_t millis(void)
+{
+    return 0;
+}
+
+static void Add(TRACE *T, lv_coord_t X1, lv_coord_t Y1, lv_coord_t X2, lv_coord_t Y2)
+{
+    uint16_t r = T->Refrs - 1;
+    if(T->Count[r] < LV_INV_BUF_SIZE)
+        lv_area_set(&T->Areas[r][T->Count[r]++], X1, Y1, X2, Y2);
+}
+
+static void Refr(TRACE *T)
+{
+    if(T->Refrs < TRACE_MAX_REFRS)
+        T->Count[T->Refrs++] = 0;
+}
+
+/******************************************************************************
+function:	Coalesce one refresh and check it
+******************************************************************************/
+static void Run_Refr(const lv_area_t *In, uint16_t Count, RESULT *Res)
+{
+    lv_area_t out[LV_INV_BUF_SIZE], box;
+    uint16_t n, i;
+    UDOUBLE cost_in = 0, cost_out = 0;
+
+    if(Count == 0)
+        return;
+    memcpy(out, In, Count * sizeof(lv_area_t));
+    n = Area_Coalesce(out, Count, COALESCE_WINDOW_COST, Colmod);
+
+    memset(Covered, 0, sizeof(Covered));
+    box = In[0];
+    for(i = 0; i < Count; i++) {
+        _lv_area_join(&box, &box, &In[i]);
+        cost_in += Area_Coalesce_Cost(&In[i], COALESCE_WINDOW_COST, Colmod);
+        Res->Pixels_In += lv_area_get_size(&In[i]);
+    }
+    for(i = 0; i < n; i++) {
+        const lv_area_t *a = &out[i];
+        if(!_lv_area_is_in(a, &box, 0))
+            Res->Bad++;
+        cost_out += Area_Coalesce_Cost(a, COALESCE_WINDOW_COST, Colmod);
+        Res->Pixels_Out += lv_area_get_size(a);
+        for(lv_coord_t y = LV_MAX(a->y1, 0); y <= LV_MIN(a->y2, H - 1); y++)
+            for(lv_coord_t x = LV_MAX(a->x1, 0); x <= LV_MIN(a->x2, W - 1); x++)
+                Covered[y][x] = 1;
+    }
+    for(i = 0; i < Count; i++) {
+        const lv_area_t *a = &In[i];
+        for(lv_coord_t y = LV_MAX(a->y1, 0); y <= LV_MIN(a->y2, H - 1); y++)
+            for(lv_coord_t x = LV_MAX(a->x1, 0); x <= LV_MIN(a->x2, W - 1); x++)
+                if(!Covered[y][x])
+                    Res->Bad++;
+    }
+    if(n > Count || n == 0 || cost_out > cost_in)
+        Res->Bad++;
+
+    Res->Areas_In += Count;
+    Res->Areas_Out += n;
+    Res->Cost_In += cost_in;
+    Res->Cost_Out += cost_out;
+}
+
+static int Report(const char *Name, uint16_t Refrs, const RESULT *Res, int Mismatch)
+{
+    printf("%-10s %6u %6lu %6lu %9lu %9lu %9lu %9lu  %s\n", Name, Refrs,
+           (unsigned long)Res->Areas_In, (unsigned long)Res->Areas_Out,
+           (unsigned long)Res->Pixels_In, (unsigned long)Res->Pixels_Out,
+           (unsigned long)Res->Cost_In, (unsigned long)Res->Cost_Out,
+           Res->Bad || Mismatch ? "FAIL" : "ok");
+    if(Res->Bad)
+        printf("  %u pixels or areas wrong\n", Res->Bad);
+    if(Mismatch)
+        printf("  areas or pixels left differ from the expected counts\n");
+    return Res->Bad || Mismatch ? 1 : 0;
+}
+
+static int Run_Trace(const TRACE *T, int Check_Counts)
+{
+    RESULT res;
+    int mismatch;
+
+    memset(&res, 0, sizeof(res));
+    for(uint16_t r = 0; r < T->Refrs; r++)
+        Run_Refr(T->Areas[r], T->Count[r], &res);
+    mismatch = Check_Counts && (res.Areas_Out != T->Want_Areas || res.Pixels_Out != T->Want_Pixels);
+    return Report(T->Name, T->Refrs, &res, mismatch);
+}
+
+/******************************************************************************
+function:	Build the built-in traces
+******************************************************************************/
+static TRACE Traces[5];
+
+static void Build_Traces(void)
+{
+    TRACE *t;
+    uint32_t seed = 12345;
+
+    memset(Traces, 0, sizeof(Traces));
+
+    // Screen3 countdown: the digits and the end of the arc indicator, too
+    // far apart to share a window
+    t = &Traces[0];
+    t->Name = "countdown";
+    for(int s = 0; s < 10; s++) {
+        Refr(t);
+        Add(t, 98, 101, 139, 129);
+        Add(t, 166 - s, 52 + s * 3, 193 - s, 84 + s * 3);
+    }
+    t->Want_Areas = 20;
+    t->Want_Pixels = 10 * (42 * 29 + 28 * 33);
+
+    // Screen5 steps: the count label inside the arc and the arc's knob,
+    // which overlaps the label's box
+    t = &Traces[1];
+    t->Name = "steps";
+    for(int s = 0; s < 10; s++) {
+        Refr(t);
+        Add(t, 88, 92, 152, 128);
+        Add(t, 140, 100 + s, 160, 120 + s);
+    }
+    t->Want_Areas = 10;
+    t->Want_Pixels = 10 * 73 * 37 + 73;      // the last knob reaches a row lower
+
+    // A time label whose digits are invalidated one by one, 2 px apart:
+    // the gaps cost less than the windows
+    t = &Traces[2];
+    t->Name = "digits";
+    for(int s = 0; s < 10; s++) {
+        Refr(t);
+        for(int d = 0; d < 5; d++)
+            Add(t, 80 + d * 17, 108, 94 + d * 17, 131);
+    }
+    t->Want_Areas = 10;
+    t->Want_Pixels = 10 * 83 * 24;
+
+    // A narrow list scrolling in 2 px rows with 1 px between them
+    t = &Traces[3];
+    t->Name = "stripes";
+    for(int s = 0; s < 10; s++) {
+        Refr(t);
+        for(int r = 0; r < 12; r++)
+            Add(t, 100, 60 + r * 3, 139, 61 + r * 3);
+    }
+    t->Want_Areas = 10;
+    t->Want_Pixels = 10 * 40 * 35;
+
+    // Small areas anywhere, for the coverage checks
+    t = &Traces[4];
+    t->Name = "random";
+    for(int s = 0; s < TRACE_MAX_REFRS; s++) {
+        Refr(t);
+        for(int k = 0; k < 1 + s % 12; k++) {
+            seed = seed * 1103515245 + 12345;
+            lv_coord_t x = (seed >> 8) % 220, y = (seed >> 16) % 220;
+            seed = seed * 1103515245 + 12345;
+            Add(t, x, y, x + (seed >> 8) % 40, y + (seed >> 16) % 30);
+        }
+    }
+    t->Want_Areas = 393;
+    t->Want_Pixels = 123291;
+}
+
+/******************************************************************************
+function:	Replay the AREAS: lines of a serial log, one refresh each
+******************************************************************************/
+static int Run_Log(const char *Path)
+{
+    FILE *f = fopen(Path, "r");
+    char line[2048];
+    RESULT res;
+    uint16_t refrs = 0;
+
+    if(f == NULL) {
+        fprintf(stderr, "cannot open %s\n", Path);
+        return 1;
+    }
+    memset(&res, 0, sizeof(res));
+    while(fgets(line, sizeof(line), f)) {
+        lv_area_t areas[LV_INV_BUF_SIZE];
+        uint16_t n = 0;
+        char *p = strstr(line, "AREAS:");
+        int x1, y1, x2, y2, used;
+
+        if(p == NULL)
+            continue;
+        p += 6;
+        while(n < LV_INV_BUF_SIZE && sscanf(p, " %d,%d,%d,%d%n", &x1, &y1, &x2, &y2, &used) == 4) {
+            lv_area_set(&areas[n++], x1, y1, x2, y2);
+            p += used;
+        }
+        Run_Refr(areas, n, &res);
+        refrs++;
+    }
+    fclose(f);
+    return Report(Path, refrs, &res, 0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *log = NULL;
+    int fail = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-f") && i + 1 < argc)
+            log = argv[++i];
+        else if(!strcmp(argv[i], "-444"))
+            Colmod = LCD_1IN28_COLOR_444;
+        else {
+            fprintf(stderr, "usage: %s [-f log] [-444]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("window cost %d B, %s\n", COALESCE_WINDOW_COST,
+           Colmod == LCD_1IN28_COLOR_444 ? "444" : "565");
+    printf("%-10s %6s %6s %6s %9s %9s %9s %9s\n", "trace", "refrs", "in", "out",
+           "px in", "px out", "bus B in", "bus B out");
+    if(log != NULL)
+        return Run_Log(log);
+
+    Build_Traces();
+    for(unsigned t = 0; t < sizeof(Traces) / sizeof(Traces[0]); t++)
+        fail |= Run_Trace(&Traces[t], Colmod == LCD_1IN28_COLOR_565);
+    return fail;
+}
@@ -0,0 +1,231 @@
+/*****************************************************************************
+* | File      	:   flush_bench.cpp
+* | Function    :   Host count of the bytes moved per display flush
+* | Info        :
+*                Replays the flushes of a full frame and of a widget update
+*                (bands of at most one draw buffer, as LVGL hands them to
+*                my_disp_flush) through three flush paths and counts the
+*                pixel bytes each moves after LVGL has rendered them:
+*                read plus written by copies and byte swaps, and read by
+*                the bus.
+*
+*                  before   the original flush: swap every pixel into a
+*                           240x240 frame, send it with the blocking
+*                           LCD_1IN28_DisplayWindows
+*                  panel    LV_COLOR_16_SWAP 1, the sketch's setting: the
+*                           batch and circle path, nothing to swap
+*                  swapped  LV_COLOR_16_SWAP 0, an export without the swap:
+*                           the same path, the driver swaps the bytes
+*
+*                usage: flush_bench
+*
+*                Exits with 1 if a path left wrong pixels on the panel,
+*                swapped moves more bytes than before or panel more than
+*                swapped.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+#include "GC9A01_Mock.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define W   LCD_1IN28_WIDTH
+#define H   LCD_1IN28_HEIGHT
+// The sketch's draw buffers, a tenth of the screen
+#define DRAW_PIXELS (W * H / 10)
+
+typedef struct{
+	UWORD Xstart, Ystart, Xend, Yend;   // end exclusive
+}AREA;
+
+typedef struct{
+	const char *Name;
+	const AREA *Areas;
+	int Count;
+}TRACE;
+
+// Whole screen, e.g. a screen load
+static const AREA Frame_Areas[] = {
+	{0, 0, W, H},
+};
+// Time label, countdown arc, steps and balance labels: odd widths and
+// positions leave rows that do not start on a word
+static const AREA Widget_Areas[] = {
+	{89, 101, 151, 131},
+	{30, 30, 210, 210},
+	{83, 160, 157, 183},
+	{41, 62, 199, 89},
+	{117, 17, 124, 26},
+};
+
+static const TRACE Traces[] = {
+	{"frame", Frame_Areas, sizeof(Frame_Areas) / sizeof(Frame_Areas[0])},
+	{"widgets", Widget_Areas, sizeof(Widget_Areas) / sizeof(Widget_Areas[0])},
+};
+#define TRACE_COUNT (int)(sizeof(Traces) / sizeof(Traces[0]))
+
+enum { PATH_BEFORE, PATH_PANEL, PATH_SWAPPED, PATH_COUNT };
+static const char *Path_Names[PATH_COUNT] = {"before", "panel", "swapped"};
+
+static UWORD Draw_Buf[DRAW_PIXELS];
+static UWORD Frame[W * H];
+static UWORD Batch[W * 16];
+static uint64_t Tool_Copy_Bytes = 0;
+
+static void Bench_Done(void *Arg)
+{
+    (void)Arg;
+}
+
+// Test pattern, every pixel differs from its neighbours
+static UWORD Pattern(UWORD X, UWORD Y)
+{
+    return (UWORD)((X * 7 + Y * 131) ^ (Y << 8) ^ 0x0841);
+}
+
+// Render a band into the draw buffer in the byte order of the path
+static void Render(const AREA *A, int Path)
+{
+    UWORD *p = Draw_Buf;
+    for(UWORD y = A->Ystart; y < A->Yend; y++)
+        for(UWORD x = A->Xstart; x < A->Xend; x++) {
+            UWORD c = Pattern(x, y);
+            *p++ = Path == PATH_PANEL ? (UWORD)((c >> 8) | (c << 8)) : c;
+        }
+}
+
+/******************************************************************************
+function:	Hand one rendered band to the flush of a path
+parameter:
+    A    : band, fits the draw buffer
+    Last : last band of the refresh, the batch goes out with it
+Info:
+	The batch and circle path is my_disp_flush in partial mode.
+******************************************************************************/
+static void Flush(const AREA *A, int Last, int Path)
+{
+    UWORD w = A->Xend - A->Xstart;
+
+    if(Path == PATH_BEFORE) {
+        for(UWORD y = A->Ystart; y < A->Yend; y++) {
+            const UWORD *src = Draw_Buf + (UDOUBLE)(y - A->Ystart) * w;
+            UWORD *dst = Frame + (UDOUBLE)y * W + A->Xstart;
+            for(UWORD x = 0; x < w; x++)
+                dst[x] = (UWORD)((src[x] >> 8) | (src[x] << 8));
+        }
+        Tool_Copy_Bytes += (uint64_t)w * (A->Yend - A->Ystart) * 4;
+        LCD_1IN28_DisplayWindows(A->Xstart, A->Ystart, A->Xend, A->Yend, Frame);
+        return;
+    }
+
+    if(LCD_1IN28_Batch_Add(A->Xstart, A->Ystart, A->Xend, A->Yend, Draw_Buf)) {
+        if(Last)
+            LCD_1IN28_Batch_Submit(NULL);
+    } else {
+        LCD_1IN28_Batch_Submit(NULL);
+        LCD_1IN28_DisplayWindows_Round_Async(A->Xstart, A->Ystart, A->Xend, A->Yend, Draw_Buf, NULL);
+    }
+    // LVGL waits for the flush before it renders into the buffer again
+    LCD_1IN28_Wait();
+}
+
+// Visible pixels of the trace that the panel does not show right
+static uint32_t Check(const TRACE *T)
+{
+    const uint16_t *fb = GC9A01_Mock_Framebuffer();
+    uint32_t bad = 0;
+
+    for(int i = 0; i < T->Count; i++) {
+        const AREA *A = &T->Areas[i];
+        for(UWORD y = A->Ystart; y < A->Yend; y++) {
+            UWORD xs, xe;
+            LCD_1IN28_GetSpan(y, &xs, &xe);
+            for(UWORD x = A->Xstart; x < A->Xend; x++) {
+                if(LCD_1IN28_ROUND && (x < xs || x >= xe))
+                    continue;
+                if(fb[y * W + x] != Pattern(x, y))
+                    bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+/******************************************************************************
+function:	Run a trace through a path
+parameter:
+    Moved : bytes copied plus bytes on the bus
+return:
+    wrong pixels on the panel
+******************************************************************************/
+static uint32_t Run(const TRACE *T, int Path, uint64_t *Moved)
+{
+    LCD_1IN28_STATS st;
+    GC9A01_MOCK_STATS ms;
+    uint64_t pixels = 0;
+    uint32_t bad;
+
+    LCD_1IN28_SetByteOrder(Path == PATH_SWAPPED ? LCD_1IN28_ORDER_SWAPPED : LCD_1IN28_ORDER_PANEL);
+    LCD_1IN28_Clear(0x0000);
+    LCD_1IN28_ResetStats();
+    GC9A01_Mock_Reset_Stats();
+    Tool_Copy_Bytes = 0;
+
+    for(int i = 0; i < T->Count; i++) {
+        const AREA *A = &T->Areas[i];
+        UWORD rows = DRAW_PIXELS / (A->Xend - A->Xstart);
+        for(UWORD y = A->Ystart; y < A->Yend; y += rows) {
+            AREA band = {A->Xstart, y, A->Xend, (UWORD)(y + rows < A->Yend ? y + rows : A->Yend)};
+            Render(&band, Path);
+            Flush(&band, i == T->Count - 1 && band.Yend == A->Yend, Path);
+            pixels += (uint64_t)(band.Xend - band.Xstart) * (band.Yend - band.Ystart);
+        }
+    }
+    LCD_1IN28_Wait();
+
+    LCD_1IN28_GetStats(&st);
+    GC9A01_Mock_Get_Stats(&ms);
+    bad = Check(T);
+    *Moved = Tool_Copy_Bytes + st.Copy_Bytes + ms.Pixel_Bytes;
+    printf("%-8s %-8s %8llu %10llu %10llu %10llu %6.2f  %s\n",
+           T->Name, Path_Names[Path], (unsigned long long)pixels,
+           (unsigned long long)(Tool_Copy_Bytes + st.Copy_Bytes),
+           (unsigned long long)ms.Pixel_Bytes, (unsigned long long)*Moved,
+           pixels ? (double)*Moved / pixels : 0.0, bad ? "FAIL" : "ok");
+    if(bad)
+        printf("  %u wrong pixels\n", bad);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    int fail = 0;
+
+    if(argc > 1) {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return 2;
+    }
+
+    DEV_Module_Init();
+    DEV_SPI_Set_Done_Callback(Bench_Done);
+    LCD_1IN28_Init(HORIZONTAL);
+    LCD_1IN28_Batch_Init(Batch, sizeof(Batch) / sizeof(Batch[0]));
+
+    printf("%-8s %-8s %8s %10s %10s %10s %6s\n", "trace", "path", "pixels",
+           "copied B", "bus B", "moved B", "B/px");
+    for(int t = 0; t < TRACE_COUNT; t++) {
+        uint64_t moved[PATH_COUNT];
+        for(int p = 0; p < PATH_COUNT; p++)
+            fail |= Run(&Traces[t], p, &moved[p]) != 0;
+        if(moved[PATH_SWAPPED] > moved[PATH_BEFORE]) {
+            printf("  swapped moves more than before\n");
+            fail = 1;
+        }
+        if(moved[PATH_PANEL] > moved[PATH_SWAPPED]) {
+            printf("  panel moves more than swapped\n");
+            fail = 1;
+        }
+    }
+    return fail;
+}
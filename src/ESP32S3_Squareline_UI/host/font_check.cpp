@@ -0,0 +1,150 @@
+/*****************************************************************************
+* | File      	:   font_check.cpp
+* | Function    :   Host check of the Montserrat subsets
+* | Info        :
+*                Compares every ui_font_montserrat_*.c made by
+*                font_subset.py with LVGL's whole font of the same size:
+*                each glyph the subset has must have the same descriptor,
+*                bitmap and kerning against every other glyph it has, and
+*                every other letter must come from the fallback font, never
+*                from a wrong glyph of the subset.
+*
+*                usage: font_check
+*
+*                Exits with 1 on the first size that differs.
+******************************************************************************/
+#include "lvgl.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+// LVGL's whole fonts, each in its own namespace next to the subset
+#undef LV_FONT_MONTSERRAT_12
+#define LV_FONT_MONTSERRAT_12 1
+namespace full_12 {
+#include "font/lv_font_montserrat_12.c"
+}
+#undef LV_FONT_MONTSERRAT_18
+#define LV_FONT_MONTSERRAT_18 1
+namespace full_18 {
+#include "font/lv_font_montserrat_18.c"
+}
+#undef LV_FONT_MONTSERRAT_20
+#define LV_FONT_MONTSERRAT_20 1
+namespace full_20 {
+#include "font/lv_font_montserrat_20.c"
+}
+#undef LV_FONT_MONTSERRAT_24
+#define LV_FONT_MONTSERRAT_24 1
+namespace full_24 {
+#include "font/lv_font_montserrat_24.c"
+}
+#undef LV_FONT_MONTSERRAT_48
+#define LV_FONT_MONTSERRAT_48 1
+namespace full_48 {
+#include "font/lv_font_montserrat_48.c"
+}
+
+typedef struct {
+    int Size;
+    const lv_font_t *Subset;
+    const lv_font_t *Full;
+} FONT_PAIR;
+
+static const FONT_PAIR Fonts[] = {
+    {12, &lv_font_montserrat_12, &full_12::lv_font_montserrat_12},
+    {18, &lv_font_montserrat_18, &full_18::lv_font_montserrat_18},
+    {20, &lv_font_montserrat_20, &full_20::lv_font_montserrat_20},
+    {24, &lv_font_montserrat_24, &full_24::lv_font_montserrat_24},
+    {48, &lv_font_montserrat_48, &full_48::lv_font_montserrat_48},
+};
+
+// Letters in the whole fonts: ASCII, degree, bullet and the symbols
+static std::vector<uint32_t> Letters(const lv_font_t *Full)
+{
+    std::vector<uint32_t> out;
+    lv_font_glyph_dsc_t g;
+    uint32_t c;
+    for(c = 0x20; c < 0xF900; c++) {
+        if(Full->get_glyph_dsc(Full, &g, c, 0))
+            out.push_back(c);
+    }
+    return out;
+}
+
+static int Check(const FONT_PAIR *F)
+{
+    std::vector<uint32_t> all = Letters(F->Full);
+    std::vector<uint32_t> kept;
+    lv_font_glyph_dsc_t s, f;
+    size_t i, j;
+
+    if(F->Subset->line_height != F->Full->line_height || F->Subset->base_line != F->Full->base_line) {
+        printf("  %d px: line height or base line differ\n", F->Size);
+        return 1;
+    }
+
+    for(i = 0; i < all.size(); i++) {
+        uint32_t c = all[i];
+        if(!lv_font_get_glyph_dsc(F->Subset, &s, c, 0)) {
+            printf("  %d px: U+%04X found nowhere\n", F->Size, (unsigned)c);
+            return 1;
+        }
+        if(s.resolved_font != F->Subset) {
+            // Missing: drawn from the fallback, which must really have it
+            if(s.resolved_font != LV_FONT_DEFAULT) {
+                printf("  %d px: U+%04X not from the fallback\n", F->Size, (unsigned)c);
+                return 1;
+            }
+            continue;
+        }
+        F->Full->get_glyph_dsc(F->Full, &f, c, 0);
+        if(s.adv_w != f.adv_w || s.box_w != f.box_w || s.box_h != f.box_h ||
+           s.ofs_x != f.ofs_x || s.ofs_y != f.ofs_y) {
+            printf("  %d px: U+%04X descriptor differs\n", F->Size, (unsigned)c);
+            return 1;
+        }
+        size_t bytes = ((size_t)f.box_w * f.box_h * f.bpp + 7) / 8;
+        if(bytes && memcmp(lv_font_get_glyph_bitmap(F->Subset, c), lv_font_get_glyph_bitmap(F->Full, c), bytes)) {
+            printf("  %d px: U+%04X bitmap differs\n", F->Size, (unsigned)c);
+            return 1;
+        }
+        kept.push_back(c);
+    }
+
+    for(i = 0; i < kept.size(); i++) {
+        for(j = 0; j < kept.size(); j++) {
+            F->Subset->get_glyph_dsc(F->Subset, &s, kept[i], kept[j]);
+            F->Full->get_glyph_dsc(F->Full, &f, kept[i], kept[j]);
+            if(s.adv_w != f.adv_w) {
+                printf("  %d px: kerning of U+%04X U+%04X differs\n", F->Size, (unsigned)kept[i], (unsigned)kept[j]);
+                return 1;
+            }
+        }
+    }
+
+    printf("lv_font_montserrat_%-4d %3u of %3u glyphs, the rest from the fallback\n",
+           F->Size, (unsigned)kept.size(), (unsigned)all.size());
+    return 0;
+}
+
+int main(void)
+{
+    int fail = 0;
+    size_t i;
+
+    lv_init();
+    for(i = 0; i < sizeof(Fonts) / sizeof(Fonts[0]); i++) {
+        fail |= Check(&Fonts[i]);
+    }
+    return fail;
+}
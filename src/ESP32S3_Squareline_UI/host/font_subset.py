@@ -0,0 +1,569 @@
+#!/usr/bin/env python3
+"""Build the Montserrat sizes the UI uses as glyph subsets.
+
+Scans ui_*.c and the sketch's .ino for the fonts set on labels and the
+texts they get, adds the run time glyphs from font_subset.txt and writes
+ui_font_montserrat_<size>.c into the sketch with only those glyphs, cut
+from LVGL's own lv_font_montserrat_<size>.c. The subsets keep LVGL's
+names, so SquareLine's code uses them as it is; lv_conf.h turns the
+sizes off in LVGL and declares them with LV_FONT_CUSTOM_DECLARE.
+
+usage: font_subset.py [--check]
+  --check  write nothing, exit with 1 if a generated file is out of date
+
+Prints the flash each font takes before and after. Exits with 1 when
+lv_conf.h does not match, or a label of a subset font gets text that is
+neither a literal nor listed in font_subset.txt.
+"""
+import glob
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SKETCH = os.path.dirname(HERE)
+LVGL = os.path.join(SKETCH, '..', '..', 'libraries', 'lvgl', 'src')
+SPEC = os.path.join(SKETCH, 'font_subset.txt')
+OUT_FMT = os.path.join(SKETCH, 'ui_font_montserrat_%d.c')
+
+SIZES = range(8, 50, 2)
+ASCII = range(0x20, 0x7F)
+
+# Flash per entry on the ESP32, see lv_font_fmt_txt.h
+GLYPH_DSC_BYTES = 8
+CMAP_BYTES = 20
+
+
+def fail(msg):
+    sys.stderr.write('font_subset: %s\n' % msg)
+    sys.exit(1)
+
+
+def read(path):
+    with open(path, encoding='utf-8', errors='replace') as f:
+        return f.read()
+
+
+# ---------------------------------------------------------------- symbols
+
+def load_symbols():
+    symbols = {}
+    text = read(os.path.join(LVGL, 'font', 'lv_symbol_def.h'))
+    for name, lit in re.findall(r'#define\s+(LV_SYMBOL_\w+)\s+("(?:[^"\\]|\\.)*")', text):
+        symbols[name] = c_string(lit)
+    return symbols
+
+
+def c_string(lit):
+    """Code points of one C string literal, quotes included."""
+    out = bytearray()
+    s = lit[1:-1]
+    i = 0
+    while i < len(s):
+        c = s[i]
+        if c != '\\':
+            out += c.encode('utf-8')
+            i += 1
+            continue
+        e = s[i + 1]
+        if e == 'x':
+            m = re.match(r'[0-9a-fA-F]{1,2}', s[i + 2:])
+            out.append(int(m.group(0), 16))
+            i += 2 + len(m.group(0))
+        elif e in '01234567':
+            m = re.match(r'[0-7]{1,3}', s[i + 1:])
+            out.append(int(m.group(0), 8))
+            i += 1 + len(m.group(0))
+        else:
+            out += {'n': b'\n', 't': b'\t', 'r': b'\r'}.get(e, e.encode('utf-8'))
+            i += 2
+    return {ord(c) for c in out.decode('utf-8', errors='replace') if ord(c) >= 0x20}
+
+
+# ---------------------------------------------------------------- sources
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    return re.sub(r'//[^\n]*', ' ', text)
+
+
+def calls(text, func):
+    """Argument lists of every call of func, split at top level commas."""
+    for m in re.finditer(r'\b%s\s*\(' % func, text):
+        i, depth, arg, args, quote = m.end(), 1, '', [], None
+        while depth:
+            c = text[i]
+            if quote:
+                arg += c
+                if c == '\\':
+                    arg += text[i + 1]
+                    i += 1
+                elif c == quote:
+                    quote = None
+            elif c in '"\'':
+                quote = c
+                arg += c
+            elif c in '([{':
+                depth += 1
+                arg += c
+            elif c in ')]}':
+                depth -= 1
+                if depth:
+                    arg += c
+            elif c == ',' and depth == 1:
+                args.append(arg.strip())
+                arg = ''
+            else:
+                arg += c
+            i += 1
+        args.append(arg.strip())
+        yield args
+
+
+def text_arg(arg, symbols):
+    """Code points of a text argument, None if it is not a literal."""
+    cps = set()
+    for tok in re.findall(r'"(?:[^"\\]|\\.)*"|\S+', arg):
+        if tok.startswith('"'):
+            cps |= c_string(tok)
+        elif tok in symbols:
+            cps |= symbols[tok]
+        else:
+            return None
+    return cps
+
+
+def format_glyphs(fmt):
+    """Glyphs an integer printed with a printf format may need."""
+    cps = set(map(ord, '-0123456789'))
+    cps |= {c for c in c_string(fmt) if c != ord('%')}
+    return cps - set(map(ord, 'dilu'))
+
+
+def scan_sources(symbols):
+    files = sorted(glob.glob(os.path.join(SKETCH, 'ui*.c')) + glob.glob(os.path.join(SKETCH, '*.ino')))
+    fonts, parents, texts, runtime = {}, {}, {}, {}
+    for path in files:
+        text = strip_comments(read(path))
+        for obj, parent in re.findall(r'(\w+)\s*=\s*lv_\w+_create\s*\(\s*(\w+)', text):
+            parents[obj] = parent
+        for args in calls(text, 'lv_obj_set_style_text_font'):
+            m = re.match(r'&\s*lv_font_montserrat_(\d+)$', args[1])
+            if m:
+                fonts.setdefault(args[0], set()).add(int(m.group(1)))
+        for func in ('lv_label_set_text', 'lv_textarea_set_placeholder_text', 'lv_textarea_set_text'):
+            for args in calls(text, func):
+                cps = text_arg(args[1], symbols)
+                if cps is None:
+                    runtime.setdefault(args[0], os.path.basename(path))
+                else:
+                    texts.setdefault(args[0], set()).update(cps)
+        for args in calls(text, 'UI_Binding_Label_Int'):
+            obj = args[0].lstrip('&').strip()
+            texts.setdefault(obj, set()).update(format_glyphs(args[1]))
+        for args in calls(text, 'UI_Binding_Label_Text'):
+            runtime.setdefault(args[0].lstrip('&').strip(), os.path.basename(path))
+    return fonts, parents, texts, runtime
+
+
+def font_of(obj, fonts, parents, seen=()):
+    """Sizes a label is drawn with; text_font is inherited from the parent."""
+    if obj in fonts:
+        return fonts[obj]
+    if obj in parents and obj not in seen:
+        return font_of(parents[obj], fonts, parents, seen + (obj,))
+    return set()
+
+
+def read_spec(symbols):
+    full, extra = set(), {}
+    for n, line in enumerate(read(SPEC).splitlines(), 1):
+        words = line.split('#', 1)[0].split()
+        if not words:
+            continue
+        if words[0] == 'full':
+            full |= {int(w) for w in words[1:]}
+            continue
+        cps = set()
+        for w in words[1:]:
+            if w == 'ascii':
+                cps |= set(ASCII)
+            elif w in symbols:
+                cps |= symbols[w]
+            elif re.match(r'^.-.$', w):
+                cps |= set(range(ord(w[0]), ord(w[2]) + 1))
+            else:
+                cps |= set(map(ord, w))
+        if not cps:
+            fail('%s:%d: no glyphs for %s' % (SPEC, n, words[0]))
+        extra.setdefault(words[0], set()).update(cps)
+    if not full:
+        fail('%s: no full size, LV_FONT_DEFAULT needs one' % SPEC)
+    return full, extra
+
+
+# ---------------------------------------------------------------- fonts
+
+def array(text, name):
+    m = re.search(r'\b%s\[\]\s*=\s*\{(.*?)\};' % name, text, re.S)
+    if not m:
+        fail('no %s[] in the font' % name)
+    return m.group(1)
+
+
+def field(text, name):
+    m = re.search(r'\.%s\s*=\s*(-?\d+)' % name, text)
+    if not m:
+        fail('no .%s in the font' % name)
+    return int(m.group(1))
+
+
+class Font:
+    """One of LVGL's lv_font_conv outputs, as far as the subset needs it."""
+
+    def __init__(self, size):
+        self.size = size
+        self.path = os.path.join(LVGL, 'font', 'lv_font_montserrat_%d.c' % size)
+        text = read(self.path)
+        self.opts = re.search(r'\* Opts: (.*)', text).group(1)
+
+        self.cps, self.bitmaps = [], []
+        for part in re.split(r'/\* U\+([0-9A-F]+) ".*?" \*/', array(text, 'glyph_bitmap'))[1:]:
+            if len(self.cps) == len(self.bitmaps):
+                self.cps.append(int(part, 16))
+            else:
+                self.bitmaps.append([int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]+', part)])
+
+        self.dsc = []
+        for m in re.finditer(r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), '
+                             r'\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}',
+                             array(text, 'glyph_dsc')):
+            self.dsc.append([int(v) for v in m.groups()])
+        self.dsc = self.dsc[1:]        # id 0 is reserved
+
+        # Glyph ids follow the code points, check it on the bitmap offsets
+        if len(self.dsc) != len(self.cps):
+            fail('%s: %d glyphs, %d bitmaps' % (self.path, len(self.dsc), len(self.cps)))
+        ofs = 0
+        for d, b in zip(self.dsc, self.bitmaps):
+            if d[0] != ofs:
+                fail('%s: bitmaps are not in glyph order' % self.path)
+            ofs += len(b)
+        if self.cps != sorted(self.cps):
+            fail('%s: glyphs are not sorted' % self.path)
+
+        if field(text, 'bitmap_format') != 0 or field(text, 'kern_classes') != 1:
+            fail('%s: only plain bitmaps with kern classes are supported' % self.path)
+        num = lambda s: [int(v) for v in re.findall(r'-?\d+', s)]
+        self.kern_left = num(array(text, 'kern_left_class_mapping'))
+        self.kern_right = num(array(text, 'kern_right_class_mapping'))
+        self.kern_values = num(array(text, 'kern_class_values'))
+        self.left_cnt = field(text, 'left_class_cnt')
+        self.right_cnt = field(text, 'right_class_cnt')
+        self.kern_scale = field(text, 'kern_scale')
+        self.bpp = field(text, 'bpp')
+        self.cmap_num = field(text, 'cmap_num')
+        self.sparse = sum(int(v) for v in re.findall(r'\.list_length = (\d+)', text))
+        self.line_height = field(text, 'line_height')
+        self.base_line = field(text, 'base_line')
+        self.underline_position = field(text, 'underline_position')
+        self.underline_thickness = field(text, 'underline_thickness')
+
+    def flash(self):
+        return (sum(map(len, self.bitmaps)) + GLYPH_DSC_BYTES * (len(self.dsc) + 1) +
+                CMAP_BYTES * self.cmap_num + 2 * self.sparse +
+                len(self.kern_left) + len(self.kern_right) + len(self.kern_values))
+
+
+def cmaps_of(cps):
+    """Runs of 8 and more code points as FORMAT0_TINY, the rest in between
+    as SPARSE_TINY. Ranges don't overlap, LVGL takes the first that fits."""
+    runs, i = [], 0
+    while i < len(cps):
+        j = i
+        while j + 1 < len(cps) and cps[j + 1] == cps[j] + 1:
+            j += 1
+        runs.append(cps[i:j + 1])
+        i = j + 1
+    cmaps, rest, gid = [], [], 1
+    for run in runs + [None]:
+        if run is not None and len(run) < 8:
+            rest += run
+            continue
+        if rest:
+            cmaps.append(('SPARSE_TINY', rest[0], rest[-1] - rest[0] + 1, gid, [c - rest[0] for c in rest]))
+            gid += len(rest)
+            rest = []
+        if run is not None:
+            cmaps.append(('FORMAT0_TINY', run[0], len(run), gid, None))
+            gid += len(run)
+    return cmaps
+
+
+def hex_lines(values, fmt, indent='    ', per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(fmt % v for v in values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def glyph_list(cps):
+    parts, i = [], 0
+    while i < len(cps):
+        j = i
+        while j + 1 < len(cps) and cps[j + 1] == cps[j] + 1:
+            j += 1
+        name = lambda c: chr(c) if 0x21 <= c < 0x7F else 'U+%04X' % c
+        parts.append(name(cps[i]) if i == j else '%s-%s' % (name(cps[i]), name(cps[j])))
+        i = j + 1
+    return ' '.join(parts)
+
+
+def subset(font, want, fallback):
+    """C source of the font with the wanted glyphs, and its flash size."""
+    missing = sorted(want - set(font.cps))
+    if missing:
+        fail('lv_font_montserrat_%d has no %s' % (font.size, glyph_list(missing)))
+    keep = [i for i, c in enumerate(font.cps) if c in want]
+    cps = [font.cps[i] for i in keep]
+
+    # Kern classes: only the ones the kept glyphs use, renumbered
+    left = sorted({font.kern_left[i + 1] for i in keep} - {0})
+    right = sorted({font.kern_right[i + 1] for i in keep} - {0})
+    lmap = {c: n + 1 for n, c in enumerate(left)}
+    rmap = {c: n + 1 for n, c in enumerate(right)}
+    kern_left = [0] + [lmap.get(font.kern_left[i + 1], 0) for i in keep]
+    kern_right = [0] + [rmap.get(font.kern_right[i + 1], 0) for i in keep]
+    kern_values = [font.kern_values[(l - 1) * font.right_cnt + (r - 1)] for l in left for r in right]
+    if not kern_values:
+        kern_values = [0]
+
+    bitmap, dsc, ofs = [], [], 0
+    for i in keep:
+        c = font.cps[i]
+        bitmap.append('    /* U+%04X "%s" */' % (c, chr(c) if 0x20 <= c < 0x7F and c != 0x22 and c != 0x5C else ''))
+        if font.bitmaps[i]:
+            bitmap.append(hex_lines(font.bitmaps[i], '0x%x') + ',')
+        bitmap.append('')
+        d = font.dsc[i]
+        dsc.append('    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}'
+                   % (ofs, d[1], d[2], d[3], d[4], d[5]))
+        ofs += len(font.bitmaps[i])
+
+    cmaps = cmaps_of(cps)
+    lists, entries = [], []
+    for n, (kind, start, length, gid, ulist) in enumerate(cmaps):
+        if ulist:
+            lists.append('static const uint16_t unicode_list_%d[] = {\n%s\n};\n' % (n, hex_lines(ulist, '0x%x')))
+        entries.append('    {\n'
+                       '        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n'
+                       '        .unicode_list = %s, .glyph_id_ofs_list = NULL, .list_length = %d, '
+                       '.type = LV_FONT_FMT_TXT_CMAP_%s\n'
+                       '    }' % (start, length, gid, 'unicode_list_%d' % n if ulist else 'NULL',
+                                  len(ulist) if ulist else 0, kind))
+
+    size = (ofs + GLYPH_DSC_BYTES * (len(keep) + 1) + CMAP_BYTES * len(cmaps) +
+            sum(2 * len(c[4]) for c in cmaps if c[4]) + len(kern_left) + len(kern_right) + len(kern_values))
+
+    name = 'lv_font_montserrat_%d' % font.size
+    guard = 'LV_FONT_MONTSERRAT_%d' % font.size
+    src = '''/*******************************************************************************
+ * Size: %(size)d px
+ * Bpp: %(bpp)d
+ * Subset of LVGL's %(name)s.c made by host/font_subset.py from the
+ * texts of the UI and font_subset.txt. Do not edit, run the script again.
+ * Glyphs: %(glyphs)s
+ * Opts: %(opts)s
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*Only when LVGL doesn't build the whole font (lv_conf.h)*/
+#if !%(guard)s
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+%(bitmap)s};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+%(dsc)s
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+%(lists)s
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+%(cmaps)s
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+%(kern_left)s
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+%(kern_right)s
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+%(kern_values)s
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = %(left_cnt)d,
+    .right_class_cnt     = %(right_cnt)d,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = %(kern_scale)d,
+    .cmap_num = %(cmap_num)d,
+    .bpp = %(bpp)d,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t %(name)s = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = %(line_height)d,          /*The maximum line height required by the font*/
+    .base_line = %(base_line)d,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = %(underline_position)d,
+    .underline_thickness = %(underline_thickness)d,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_%(fallback)d     /*Glyphs the subset doesn't have*/
+};
+
+#endif /*#if !%(guard)s*/
+''' % dict(size=font.size, bpp=font.bpp, name=name, guard=guard, glyphs=glyph_list(cps), opts=font.opts,
+           bitmap='\n'.join(bitmap), dsc=',\n'.join(dsc), lists='\n'.join(lists), cmaps=',\n'.join(entries),
+           kern_left=hex_lines(kern_left, '%d'), kern_right=hex_lines(kern_right, '%d'),
+           kern_values=hex_lines(kern_values, '%d'), left_cnt=max(len(left), 1), right_cnt=max(len(right), 1),
+           kern_scale=font.kern_scale, cmap_num=len(cmaps), line_height=font.line_height,
+           base_line=font.base_line, underline_position=font.underline_position,
+           underline_thickness=font.underline_thickness, fallback=fallback)
+    return src, size, len(cps), len(font.cps)
+
+
+# ---------------------------------------------------------------- main
+
+def check_conf(full, subsets):
+    conf = read(os.path.join(LVGL, 'lv_conf.h')).replace('\\\n', ' ')
+    bad = []
+    for size in SIZES:
+        m = re.search(r'^#define\s+LV_FONT_MONTSERRAT_%d\s+(\d)' % size, conf, re.M)
+        on = m is not None and m.group(1) == '1'
+        if on != (size in full):
+            bad.append('LV_FONT_MONTSERRAT_%d %d' % (size, size in full))
+    m = re.search(r'^#define\s+LV_FONT_CUSTOM_DECLARE\s*(.*)', conf, re.M)
+    declared = set(map(int, re.findall(r'LV_FONT_DECLARE\(lv_font_montserrat_(\d+)\)', m.group(1) if m else '')))
+    if declared != set(subsets):
+        bad.append('LV_FONT_CUSTOM_DECLARE ' + ' '.join('LV_FONT_DECLARE(lv_font_montserrat_%d)' % s
+                                                        for s in sorted(subsets)))
+    if bad:
+        fail('lv_conf.h needs:\n  #define ' + '\n  #define '.join(bad))
+
+
+def main():
+    check = '--check' in sys.argv[1:]
+    if any(a != '--check' for a in sys.argv[1:]):
+        sys.stderr.write(__doc__)
+        return 2
+
+    symbols = load_symbols()
+    full, extra = read_spec(symbols)
+    fonts, parents, texts, runtime = scan_sources(symbols)
+
+    want = {}
+    for obj in set(fonts) | set(texts) | set(runtime) | set(extra):
+        for size in font_of(obj, fonts, parents) - full:
+            if obj in runtime and obj not in extra:
+                fail('%s (%s) gets text at run time in %s, list its glyphs in font_subset.txt'
+                     % (obj, 'lv_font_montserrat_%d' % size, runtime[obj]))
+            want.setdefault(size, {0x20}).update(texts.get(obj, set()) | extra.get(obj, set()))
+    for size in sorted(fonts_used(fonts) - full - set(want)):
+        want[size] = {0x20}
+
+    check_conf(full, want)
+
+    stale = []
+    print('%-24s %7s %9s %9s' % ('font', 'glyphs', 'full B', 'subset B'))
+    before = after = 0
+    for size in sorted(want):
+        font = Font(size)
+        src, nbytes, kept, total = subset(font, want[size], min(full))
+        path = OUT_FMT % size
+        old = read(path) if os.path.exists(path) else None
+        if old != src:
+            stale.append(os.path.basename(path))
+            if not check:
+                with open(path, 'w', encoding='utf-8') as f:
+                    f.write(src)
+        before += font.flash()
+        after += nbytes
+        print('%-24s %3d/%-3d %9d %9d' % ('lv_font_montserrat_%d' % size, kept, total, font.flash(), nbytes))
+    for path in sorted(glob.glob(OUT_FMT.replace('%d', '*'))):
+        if int(re.search(r'_(\d+)\.c$', path).group(1)) not in want:
+            stale.append(os.path.basename(path))
+            if not check:
+                os.remove(path)
+    for size in sorted(full):
+        print('%-24s %7s %9d %9s' % ('lv_font_montserrat_%d' % size, 'all', Font(size).flash(), 'full'))
+    print('subset fonts: %d B instead of %d B, %d B less flash' % (after, before, before - after))
+    unused = [s for s in SIZES if s not in want and s not in full]
+    print('not built: %s (never linked, the UI doesn\'t use them)' % ' '.join(map(str, unused)))
+
+    if stale:
+        if check:
+            fail('out of date, run host/font_subset.py: ' + ' '.join(stale))
+        print('written: ' + ' '.join(stale))
+    return 0
+
+
+def fonts_used(fonts):
+    return set().union(*fonts.values()) if fonts else set()
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,202 @@
+/*****************************************************************************
+* | File      	:   glyph_bench.cpp
+* | Function    :   Host check and benchmark of LVGL's glyph cache
+* | Info        :
+*                Renders the watch's counters for a number of frames: the
+*                step count in 48 px, the countdown in 24 px and a balance
+*                in 14 px, all changing every frame. Runs three times:
+*                  decoded  every glyph decoded from its bitmap, the cache
+*                           is filled up with pinned glyphs of an unused
+*                           font so nothing else fits
+*                  cached   the least recently drawn glyphs are kept
+*                  pinned   the digits are pinned as in setup()
+*                Every frame must be the same in all runs. The time spent
+*                in lv_draw_sw_letter() is measured on its own.
+*
+*                usage: glyph_bench [-n frames]
+*                  -n  frames per run (default 2000)
+*
+*                Exits with 1 if a frame differs.
+******************************************************************************/
+#include "LVGL_Bench.h"
+#include "draw/sw/lv_draw_sw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double Letter_Us;
+static unsigned long Letters;
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+// Times every letter the labels draw
+static void Timed_Letter(lv_draw_ctx_t *Ctx, const lv_draw_label_dsc_t *Dsc, const lv_point_t *Pos, uint32_t Letter)
+{
+    double t0 = LVGL_Bench_Now_us();
+    lv_draw_sw_letter(Ctx, Dsc, Pos, Letter);
+    Letter_Us += LVGL_Bench_Now_us() - t0;
+    Letters++;
+}
+
+// A font of 1 px glyphs the labels never use, to fill the cache with
+static bool Filler_Dsc(const lv_font_t *Font, lv_font_glyph_dsc_t *G, uint32_t Letter, uint32_t Next)
+{
+    (void)Font;
+    (void)Letter;
+    (void)Next;
+    memset(G, 0, sizeof(lv_font_glyph_dsc_t));
+    G->adv_w = 1;
+    G->box_w = 1;
+    G->box_h = 1;
+    G->bpp = 8;
+    return true;
+}
+
+static const uint8_t *Filler_Bitmap(const lv_font_t *Font, uint32_t Letter)
+{
+    static const uint8_t px = 0xFF;
+    (void)Font;
+    (void)Letter;
+    return &px;
+}
+
+static void Fill_Cache(void)
+{
+    static lv_font_t filler;
+    char text[LV_GLYPH_CACHE_SIZE + 1];
+    int i;
+
+    filler.get_glyph_dsc = Filler_Dsc;
+    filler.get_glyph_bitmap = Filler_Bitmap;
+    filler.line_height = 1;
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++)
+        text[i] = (char)(0x21 + i % 94);
+    text[LV_GLYPH_CACHE_SIZE] = '\0';
+    lv_draw_sw_glyph_cache_pin(&filler, text);
+}
+
+static lv_obj_t *Label(lv_obj_t *Scr, const lv_font_t *Font, lv_coord_t Y)
+{
+    lv_obj_t *label = lv_label_create(Scr);
+    lv_obj_set_style_text_font(label, Font, 0);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_align(label, LV_ALIGN_CENTER, 0, Y);
+    return label;
+}
+
+typedef struct {
+    double Letter_Us;       // per frame, in lv_draw_sw_letter()
+    double Frame_Us;        // per frame, the whole refresh
+    unsigned long Letters;  // per frame
+    lv_draw_sw_glyph_cache_stats_t Cache;
+} GLYPH_RESULT;
+
+/******************************************************************************
+function:	Render the counters for a number of frames
+parameter:
+    Frames  : frames to render
+    Hashes  : frame hashes, written by the first run, checked by the others
+    Check   : 0 writes Hashes, 1 checks them
+    Res     : time, letters and cache statistics
+return:
+    number of frames that differed
+******************************************************************************/
+static int Run(int Frames, uint32_t *Hashes, int Check, GLYPH_RESULT *Res)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_t *steps = Label(scr, &lv_font_montserrat_48, 0);
+    lv_obj_t *countdown = Label(scr, &lv_font_montserrat_24, -70);
+    lv_obj_t *balance = Label(scr, &lv_font_montserrat_14, 60);
+    lv_scr_load(scr);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_reset_glyph_cache_stats();
+    Letter_Us = 0;
+    Letters = 0;
+    int bad = 0;
+    int i;
+    double t0 = LVGL_Bench_Now_us();
+    for(i = 0; i < Frames; i++) {
+        lv_label_set_text_fmt(steps, "%d", 1000 + i * 7);
+        lv_label_set_text_fmt(countdown, "%d", 60 - i % 61);
+        lv_label_set_text_fmt(balance, "%d.%04d SUI", 12 + i / 1000, (i * 37) % 10000);
+        lv_refr_now(NULL);
+        if(!Check)
+            Hashes[i] = LVGL_Bench_Frame_Hash();
+        else if(Hashes[i] != LVGL_Bench_Frame_Hash()) {
+            if(!bad)
+                printf("  frame %d differs\n", i);
+            bad++;
+        }
+    }
+    Res->Frame_Us = (LVGL_Bench_Now_us() - t0) / Frames;
+    Res->Letter_Us = Letter_Us / Frames;
+    Res->Letters = Letters / Frames;
+    lv_draw_sw_get_glyph_cache_stats(&Res->Cache);
+
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_scr_load(blank);
+    lv_obj_del(scr);
+    return bad;
+}
+
+static void Print(const char *Name, const GLYPH_RESULT *Res, const char *Check)
+{
+    const lv_draw_sw_glyph_cache_stats_t *c = &Res->Cache;
+    unsigned long looked_up = c->hit + c->miss;
+    printf("%-8s %8lu %10.1f %10.1f %6.1f%% %7lu %7lu  %s\n", Name, Res->Letters, Res->Letter_Us, Res->Frame_Us,
+           looked_up ? 100.0 * c->hit / looked_up : 0.0, (unsigned long)c->entries, (unsigned long)c->bytes, Check);
+}
+
+int main(int argc, char **argv)
+{
+    int frames = 2000;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n frames]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(frames < 1)
+        frames = 1;
+
+    lv_disp_t *disp = LVGL_Bench_Init();
+    disp->driver->draw_ctx->draw_letter = Timed_Letter;
+
+    uint32_t *hashes = (uint32_t *)malloc(frames * sizeof(uint32_t));
+    GLYPH_RESULT decoded, cached, pinned;
+    int bad_cached, bad_pinned;
+
+    Fill_Cache();
+    Run(frames, hashes, 0, &decoded);
+    lv_draw_sw_glyph_cache_clear(NULL);
+    bad_cached = Run(frames, hashes, 1, &cached);
+    lv_draw_sw_glyph_cache_clear(NULL);
+    lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_48, "0123456789");
+    lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_24, "0123456789");
+    lv_draw_sw_glyph_cache_pin(&lv_font_montserrat_14, "0123456789.");
+    bad_pinned = Run(frames, hashes, 1, &pinned);
+    free(hashes);
+
+    printf("%d frames, cache of %d glyphs in %d B\n", frames, LV_GLYPH_CACHE_SIZE, LV_GLYPH_CACHE_BUDGET);
+    printf("%-8s %8s %10s %10s %7s %7s %7s  %s\n", "run", "letters", "us letters", "us frame", "hits",
+           "glyphs", "bytes", "check");
+    Print("decoded", &decoded, "");
+    Print("cached", &cached, bad_cached ? "FAIL" : "ok");
+    Print("pinned", &pinned, bad_pinned ? "FAIL" : "ok");
+    printf("pinned: %lu glyphs, %lu evicted\n", (unsigned long)pinned.Cache.pinned, (unsigned long)pinned.Cache.evict);
+
+    return bad_cached || bad_pinned;
+}
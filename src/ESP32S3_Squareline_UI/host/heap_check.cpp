@@ -0,0 +1,306 @@
+/*****************************************************************************
+* | File      	:   heap_check.cpp
+* | Function    :   Host stress test of the tiered LVGL heap
+* | Info        :
+*                Runs lv_mem_tier_alloc/free/realloc of lv_conf.h's pools
+*                with random sizes, mostly object and style sized blocks
+*                and some image sized ones, enough to fill the fast pool.
+*                Every block holds a pattern that is checked before it is
+*                freed or moved, and after each 1000 steps both pools are
+*                checked and the used bytes compared with the live blocks.
+*                Blocks must be in the tier of their size unless that one
+*                was full, and every such block must be counted as spilled.
+*                Then a text grows past LV_MEM_TIER_FAST_MAX and shrinks
+*                again, which must move it to the slow pool and back.
+*
+*                Last it builds the five SquareLine screens with the heap
+*                empty again and prints what each pool holds.
+*
+*                usage: heap_check [-n steps] [-s seed]
+*                  -n  random steps (default 200000)
+*                  -s  seed of the sizes and steps (default 1)
+*
+*                Exits with 1 on the first error.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "ui.h"
+#include "misc/lv_tlsf.h"
+#include "LVGL_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define LIVE_MAX    256         // blocks held at once
+#define CHECK_EVERY 1000
+
+// The sketch functions the screens call
+extern "C" {
+int stepCount = 0;
+void executeOfflineSign(void) {}
+void executeSignAndExecute(void) {}
+void resetStepCounter(void) {}
+void reconnectWiFiWithCredentials(const char *ssid, const char *password)
+{
+    (void)ssid;
+    (void)password;
+}
+
+uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+}
+
+typedef struct {
+    uint8_t *P;
+    size_t Size;
+    uint8_t Seed;
+} BLOCK;
+
+static uint32_t Rand_State;
+
+static uint32_t Rand(void)
+{
+    Rand_State ^= Rand_State << 13;
+    Rand_State ^= Rand_State >> 17;
+    Rand_State ^= Rand_State << 5;
+    return Rand_State;
+}
+
+// 70 % objects and styles, 20 % texts and line buffers, 9 % small images, 1 % large ones
+static size_t Rand_Size(void)
+{
+    uint32_t r = Rand() % 100;
+    if(r < 70)
+        return 8 + Rand() % 121;
+    if(r < 90)
+        return 129 + Rand() % (LV_MEM_TIER_FAST_MAX - 128);
+    if(r < 99)
+        return 1024 + Rand() % (7 * 1024);
+    return 8 * 1024 + Rand() % (24 * 1024);
+}
+
+static void Fill(BLOCK *B)
+{
+    size_t i;
+    for(i = 0; i < B->Size; i++)
+        B->P[i] = (uint8_t)(B->Seed + i * 7);
+}
+
+static int Intact(const BLOCK *B, size_t Size)
+{
+    size_t i;
+    for(i = 0; i < Size; i++) {
+        if(B->P[i] != (uint8_t)(B->Seed + i * 7))
+            return 0;
+    }
+    return 1;
+}
+
+static int Tier_Of_Size(size_t Size)
+{
+    return Size > LV_MEM_TIER_FAST_MAX ? LV_MEM_TIER_SLOW : LV_MEM_TIER_FAST;
+}
+
+static uint32_t Spills(void)
+{
+    lv_mem_tier_stats_t st;
+    lv_mem_tier_get_stats(&st);
+    return st.tier[LV_MEM_TIER_FAST].spill_cnt + st.tier[LV_MEM_TIER_SLOW].spill_cnt;
+}
+
+// Pools intact and their used bytes those of the live blocks
+static int Check_Pools(const std::vector<BLOCK> &Live, long Step)
+{
+    lv_mem_tier_stats_t st;
+    size_t bytes[_LV_MEM_TIER_NUM] = {0, 0};
+    size_t i;
+
+    if(lv_mem_tier_test() != LV_RES_OK) {
+        printf("step %ld: pools corrupted\n", Step);
+        return 1;
+    }
+    for(i = 0; i < Live.size(); i++)
+        bytes[lv_mem_tier_of(Live[i].P)] += lv_tlsf_block_size(Live[i].P);
+    lv_mem_tier_get_stats(&st);
+    for(i = 0; i < _LV_MEM_TIER_NUM; i++) {
+        if(st.tier[i].used_size != bytes[i] || st.tier[i].max_used < st.tier[i].used_size) {
+            printf("step %ld: tier %d uses %lu B (peak %lu), the blocks %lu B\n", Step, (int)i,
+                   (unsigned long)st.tier[i].used_size, (unsigned long)st.tier[i].max_used, (unsigned long)bytes[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void Print_Stats(const char *Title)
+{
+    lv_mem_tier_stats_t st;
+    int t;
+
+    lv_mem_tier_get_stats(&st);
+    printf("%s\n", Title);
+    printf("%-5s %8s %8s %8s %7s %8s %8s %9s %5s\n", "tier", "size", "used", "peak", "blocks", "allocs",
+           "spilled", "big free", "frag");
+    for(t = 0; t < _LV_MEM_TIER_NUM; t++) {
+        const lv_mem_tier_info_t *i = &st.tier[t];
+        printf("%-5s %8lu %8lu %8lu %7lu %8lu %8lu %9lu %4u%%\n", t == LV_MEM_TIER_FAST ? "fast" : "slow",
+               (unsigned long)i->total_size, (unsigned long)i->used_size, (unsigned long)i->max_used,
+               (unsigned long)i->used_cnt, (unsigned long)i->alloc_cnt, (unsigned long)i->spill_cnt,
+               (unsigned long)i->free_biggest_size, (unsigned)i->frag_pct);
+    }
+    printf("%lu moved between tiers, %lu failed\n\n", (unsigned long)st.move_cnt, (unsigned long)st.fail_cnt);
+}
+
+/******************************************************************************
+function:	Random allocations, frees and reallocations
+parameter:
+    Steps : number of them
+return:
+    1 on an error
+******************************************************************************/
+static int Stress(long Steps)
+{
+    std::vector<BLOCK> live;
+    uint32_t misplaced = 0, spills0 = Spills();
+    long step;
+    size_t i;
+
+    for(step = 1; step <= Steps; step++) {
+        uint32_t op = Rand() % 10;
+        BLOCK b;
+
+        if(live.size() < LIVE_MAX && (op < 5 || live.empty())) {
+            b.Size = Rand_Size();
+            b.Seed = (uint8_t)Rand();
+            b.P = (uint8_t *)lv_mem_tier_alloc(b.Size);
+            if(b.P == NULL)
+                continue;
+            misplaced += lv_mem_tier_of(b.P) != Tier_Of_Size(b.Size);
+            Fill(&b);
+            live.push_back(b);
+        } else if(op < 8) {
+            i = Rand() % live.size();
+            if(!Intact(&live[i], live[i].Size)) {
+                printf("step %ld: block of %lu B changed\n", step, (unsigned long)live[i].Size);
+                return 1;
+            }
+            lv_mem_tier_free(live[i].P);
+            live[i] = live.back();
+            live.pop_back();
+        } else {
+            size_t size = Rand_Size();
+            i = Rand() % live.size();
+            uint8_t *p = (uint8_t *)lv_mem_tier_realloc(live[i].P, size);
+            if(p == NULL)
+                continue;
+            live[i].P = p;
+            if(!Intact(&live[i], size < live[i].Size ? size : live[i].Size)) {
+                printf("step %ld: realloc to %lu B lost the content\n", step, (unsigned long)size);
+                return 1;
+            }
+            live[i].Size = size;
+            misplaced += lv_mem_tier_of(p) != Tier_Of_Size(size);
+            Fill(&live[i]);
+        }
+
+        if(step % CHECK_EVERY == 0 && Check_Pools(live, step))
+            return 1;
+    }
+
+    if(Spills() - spills0 != misplaced) {
+        printf("%lu blocks outside their tier, %lu counted as spilled\n", (unsigned long)misplaced,
+               (unsigned long)(Spills() - spills0));
+        return 1;
+    }
+    printf("%ld steps, %lu blocks spilled to the other tier\n", Steps, (unsigned long)misplaced);
+    Print_Stats("at the end");
+
+    for(i = 0; i < live.size(); i++)
+        lv_mem_tier_free(live[i].P);
+    live.clear();
+    return Check_Pools(live, step);
+}
+
+// A text growing past the fast pool's limit moves to the slow one and back
+static int Move_Check(void)
+{
+    lv_mem_tier_stats_t st0, st1;
+    BLOCK b;
+
+    lv_mem_tier_get_stats(&st0);
+    b.Size = 64;
+    b.Seed = 0x5a;
+    b.P = (uint8_t *)lv_mem_tier_alloc(b.Size);
+    Fill(&b);
+    b.P = (uint8_t *)lv_mem_tier_realloc(b.P, 4096);
+    if(lv_mem_tier_of(b.P) != LV_MEM_TIER_SLOW || !Intact(&b, 64)) {
+        printf("growing to 4096 B: tier %d, content %s\n", (int)lv_mem_tier_of(b.P), Intact(&b, 64) ? "ok" : "lost");
+        return 1;
+    }
+    b.P = (uint8_t *)lv_mem_tier_realloc(b.P, 32);
+    if(lv_mem_tier_of(b.P) != LV_MEM_TIER_FAST || !Intact(&b, 32)) {
+        printf("shrinking to 32 B: tier %d, content %s\n", (int)lv_mem_tier_of(b.P), Intact(&b, 32) ? "ok" : "lost");
+        return 1;
+    }
+    lv_mem_tier_free(b.P);
+    lv_mem_tier_get_stats(&st1);
+    if(st1.move_cnt - st0.move_cnt != 2) {
+        printf("%lu moves counted instead of 2\n", (unsigned long)(st1.move_cnt - st0.move_cnt));
+        return 1;
+    }
+    printf("growing text moved to the slow tier and back\n\n");
+    return 0;
+}
+
+// The heap the SquareLine screens take in each tier
+static int Screens(void)
+{
+    lv_mem_tier_stats_t st;
+
+    LVGL_Bench_Init();
+
+    ui_init();
+    ui_Screen4_screen_init();
+    ui_Screen5_screen_init();
+    lv_refr_now(NULL);
+
+    Print_Stats("five screens built and drawn");
+    lv_mem_tier_get_stats(&st);
+    if(lv_mem_tier_test() != LV_RES_OK || st.fail_cnt) {
+        printf("screens: pools corrupted or %lu allocations failed\n", (unsigned long)st.fail_cnt);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    long steps = 200000;
+    uint32_t seed = 1;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            steps = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-s") && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else {
+            fprintf(stderr, "usage: %s [-n steps] [-s seed]\n", argv[0]);
+            return 2;
+        }
+    }
+    Rand_State = seed ? seed : 1;
+
+    printf("fast tier %u B up to %u B blocks, slow tier %u B\n\n", (unsigned)LV_MEM_TIER_FAST_SIZE,
+           (unsigned)LV_MEM_TIER_FAST_MAX, (unsigned)LV_MEM_TIER_SLOW_SIZE);
+    if(Stress(steps) || Move_Check())
+        return 1;
+    lv_mem_tier_reset_stats();
+    return Screens();
+}
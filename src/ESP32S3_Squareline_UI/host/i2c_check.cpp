@@ -0,0 +1,371 @@
+/*****************************************************************************
+* | File      	:   i2c_check.cpp
+* | Function    :   Host check of the shared I2C bus
+* | Info        :
+*                I2C_Bus on the simulated bus of DEV_Config_host: a touch
+*                controller and an IMU are register files, the IMU with a
+*                FIFO port, and every transfer takes its wire time.
+*
+*                First without the bus task, then with it: reads of every
+*                length and offset, writes, and FIFO reads across chunks
+*                must give the register contents. Reads of one device
+*                queued together must go out as one transfer when they are
+*                close, and as two when they are not. A device given a
+*                clock above the one it takes must fail, one that takes it
+*                must be faster.
+*
+*                Then the bus is kept busy with back-to-back IMU FIFO
+*                bursts while touch reads come every period, once at the
+*                touch priority and once at the IMU's, as if there was no
+*                arbitration. The prioritized touch reads must wait less
+*                and the bursts must have let them in between chunks.
+*                Prints the touch latency of both and the bus utilization.
+*
+*                usage: i2c_check [-n touches] [-b burst_bytes] [-p period_us]
+*                  -n  touch reads of each run (default 200)
+*                  -b  bytes of an IMU FIFO burst (default 192)
+*                  -p  time between touch reads (default 2000)
+*
+*                Exits with 1 on the first error.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "I2C_Bus.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TOUCH_ADDR      0x15
+#define IMU_ADDR        0x6a
+#define FAST_ADDR       0x6b        // takes Fast-mode Plus
+#define FIFO_REG        20
+#define TOUCH_LEN       6
+#define BURST_MAX       1024
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static double Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void Sleep_us(long Us)
+{
+    struct timespec ts = {Us / 1000000, (Us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * Simulated devices
+ **/
+typedef struct {
+    UBYTE Regs[256];
+    UBYTE Fifo;             // has a FIFO port at FIFO_REG
+    UDOUBLE Fifo_Next;      // counts the bytes read from it
+} SIM_DEV;
+
+static SIM_DEV Touch_Dev, Imu_Dev, Fast_Dev;
+
+static uint8_t Sim_Func(uint8_t Reg, uint8_t *pData, uint32_t Len, uint8_t Write, void *Arg)
+{
+    SIM_DEV *d = (SIM_DEV *)Arg;
+
+    for(uint32_t i = 0; i < Len; i++) {
+        UBYTE r = (UBYTE)(Reg + i);
+        if(Write)
+            d->Regs[r] = pData[i];
+        else if(d->Fifo && Reg == FIFO_REG)
+            pData[i] = (UBYTE)d->Fifo_Next++;
+        else
+            pData[i] = d->Regs[r];
+    }
+    return 0;
+}
+
+static void Sim_Init(SIM_DEV *D, UBYTE Seed)
+{
+    memset(D, 0, sizeof(SIM_DEV));
+    for(int i = 0; i < 256; i++)
+        D->Regs[i] = (UBYTE)(i * 7 + Seed);
+}
+
+/**
+ * Contents
+ **/
+static int Data_Check(const char *Mode)
+{
+    UBYTE buf[256], val[3] = {0xA5, 0x5A, 0xC3};
+
+    // Lengths around the chunk size, from offsets that wrap past 255 never
+    for(int len = 1; len <= 100; len += 11) {
+        for(int reg = 0; reg + len <= 256; reg += 37) {
+            memset(buf, 0xEE, sizeof(buf));
+            if(I2C_Bus_Read(IMU_ADDR, (UBYTE)reg, buf, (UWORD)len, I2C_BUS_PRIO_IMU) ||
+                memcmp(buf, &Imu_Dev.Regs[reg], len)) {
+                printf("%s: read of %d bytes at %d wrong\n", Mode, len, reg);
+                return 1;
+            }
+        }
+    }
+    if(I2C_Bus_Write(TOUCH_ADDR, 0xA5, val, 3, I2C_BUS_PRIO_TOUCH) ||
+        I2C_Bus_Read(TOUCH_ADDR, 0xA5, buf, 3, I2C_BUS_PRIO_TOUCH) || memcmp(buf, val, 3)) {
+        printf("%s: write did not read back\n", Mode);
+        return 1;
+    }
+    // A FIFO port gives the next bytes to every chunk
+    I2C_TXN t;
+    UDOUBLE first = Imu_Dev.Fifo_Next;
+    memset(&t, 0, sizeof(t));
+    t.Addr = IMU_ADDR;
+    t.Reg = FIFO_REG;
+    t.Flags = I2C_TXN_FIFO;
+    t.Prio = I2C_BUS_PRIO_IMU;
+    t.Buf = buf;
+    t.Len = 3 * I2C_BUS_CHUNK + 5;
+    if(I2C_Bus_Run(&t, 1)) {
+        printf("%s: FIFO read failed\n", Mode);
+        return 1;
+    }
+    for(int i = 0; i < t.Len; i++) {
+        if(buf[i] != (UBYTE)(first + i)) {
+            printf("%s: FIFO byte %d is %d instead of %d\n", Mode, i, buf[i], (UBYTE)(first + i));
+            return 1;
+        }
+    }
+    if(I2C_Bus_Read(0x42, 0, buf, 1, I2C_BUS_PRIO_IMU) == 0) {
+        printf("%s: a missing device answered\n", Mode);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Merging
+ **/
+static int Merge_Read(UBYTE Reg0, UBYTE Len0, UBYTE Reg1, UBYTE Len1, UDOUBLE Transfers)
+{
+    I2C_BUS_STATS before, after;
+    UBYTE a[32], b[32];
+    I2C_TXN t[2];
+
+    memset(t, 0, sizeof(t));
+    t[0].Addr = t[1].Addr = IMU_ADDR;
+    t[0].Prio = t[1].Prio = I2C_BUS_PRIO_IMU;
+    t[0].Reg = Reg0;
+    t[0].Buf = a;
+    t[0].Len = Len0;
+    t[1].Reg = Reg1;
+    t[1].Buf = b;
+    t[1].Len = Len1;
+    I2C_Bus_GetStats(&before);
+    if(I2C_Bus_Run(t, 2) || memcmp(a, &Imu_Dev.Regs[Reg0], Len0) || memcmp(b, &Imu_Dev.Regs[Reg1], Len1)) {
+        printf("merge: reads at %d and %d wrong\n", Reg0, Reg1);
+        return 1;
+    }
+    I2C_Bus_GetStats(&after);
+    if(after.Transfers - before.Transfers != Transfers) {
+        printf("merge: reads at %d+%d and %d+%d took %lu transfers instead of %lu\n", Reg0, Len0, Reg1, Len1,
+               (unsigned long)(after.Transfers - before.Transfers), (unsigned long)Transfers);
+        return 1;
+    }
+    return 0;
+}
+
+static int Merge_Check(void)
+{
+    // The QMI8658 sample after its timestamp, two temperature registers between
+    if(Merge_Read(53, 12, 48, 3, 1))
+        return 1;
+    if(Merge_Read(0, 4, 4, 4, 1) || Merge_Read(8, 4, 0, 4, 1))
+        return 1;
+    // Too far apart, too long together
+    if(Merge_Read(0, 4, 30, 4, 2) || Merge_Read(40, 20, 60, 20, 2))
+        return 1;
+    printf("merge: close reads of one device in one transfer\n");
+    return 0;
+}
+
+/**
+ * Clocks
+ **/
+static double Timed_Read(UBYTE Addr, UWORD Len, UBYTE *Status)
+{
+    UBYTE buf[256];
+    double t0 = Now_us();
+
+    *Status = I2C_Bus_Read(Addr, 0, buf, Len, I2C_BUS_PRIO_IMU);
+    return Now_us() - t0;
+}
+
+static int Clock_Check(void)
+{
+    I2C_BUS_STATS st;
+    UBYTE status;
+    double slow = 1e9, fast = 1e9;
+
+    I2C_Bus_Set_Clock(FAST_ADDR, I2C_BUS_FAST_PLUS_HZ);
+    for(int i = 0; i < 5; i++) {
+        double t = Timed_Read(IMU_ADDR, 128, &status);
+        slow = t < slow ? t : slow;
+        t = Timed_Read(FAST_ADDR, 128, &status);
+        if(status) {
+            printf("clock: Fast-mode Plus device failed at %d Hz\n", I2C_BUS_FAST_PLUS_HZ);
+            return 1;
+        }
+        fast = t < fast ? t : fast;
+    }
+    if(fast >= slow) {
+        printf("clock: 128 bytes at 1 MHz took %.0f us, at 400 kHz %.0f us\n", fast, slow);
+        return 1;
+    }
+    I2C_Bus_Set_Clock(TOUCH_ADDR, I2C_BUS_FAST_PLUS_HZ);
+    Timed_Read(TOUCH_ADDR, 4, &status);
+    I2C_Bus_Set_Clock(TOUCH_ADDR, I2C_BUS_DEFAULT_HZ);
+    if(status == 0) {
+        printf("clock: a 400 kHz device answered at 1 MHz\n");
+        return 1;
+    }
+    I2C_Bus_GetStats(&st);
+    if(st.Clock_Switches == 0 || st.Errors == 0) {
+        printf("clock: %lu clock switches, %lu errors counted\n",
+               (unsigned long)st.Clock_Switches, (unsigned long)st.Errors);
+        return 1;
+    }
+    printf("clock: 128 bytes in %.0f us at 400 kHz, %.0f us at 1 MHz\n", slow, fast);
+    return 0;
+}
+
+/**
+ * Touch under IMU load
+ **/
+static I2C_TXN Burst[2];
+static UBYTE Burst_Buf[2][BURST_MAX];
+static volatile int Streaming = 0;
+static int Outstanding = 0;
+
+// On the bus task: queue the finished burst again at once
+static void Burst_Done(I2C_TXN *Txn)
+{
+    if(__atomic_load_n(&Streaming, __ATOMIC_ACQUIRE))
+        I2C_Bus_Submit(Txn, 1);
+    else
+        __atomic_sub_fetch(&Outstanding, 1, __ATOMIC_ACQ_REL);
+}
+
+static int Load_Run(const char *Name, UBYTE Touch_Prio, int Touches, UWORD Burst_Len, long Period,
+                    double *Mean, double *Max, I2C_BUS_STATS *Stats)
+{
+    UBYTE buf[TOUCH_LEN];
+    double sum = 0, max = 0;
+
+    for(int i = 0; i < 2; i++) {
+        memset(&Burst[i], 0, sizeof(I2C_TXN));
+        Burst[i].Addr = IMU_ADDR;
+        Burst[i].Reg = FIFO_REG;
+        Burst[i].Flags = I2C_TXN_FIFO;
+        Burst[i].Prio = I2C_BUS_PRIO_IMU;
+        Burst[i].Buf = Burst_Buf[i];
+        Burst[i].Len = Burst_Len;
+        Burst[i].Done = Burst_Done;
+    }
+    __atomic_store_n(&Streaming, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&Outstanding, 2, __ATOMIC_RELEASE);
+    I2C_Bus_ResetStats();
+    I2C_Bus_Submit(Burst, 2);
+
+    for(int i = 0; i < Touches; i++) {
+        Sleep_us(Period);
+        double t0 = Now_us();
+        if(I2C_Bus_Read(TOUCH_ADDR, 0x00, buf, TOUCH_LEN, Touch_Prio) || memcmp(buf, Touch_Dev.Regs, TOUCH_LEN)) {
+            printf("%s: touch read %d wrong\n", Name, i);
+            return 1;
+        }
+        double t = Now_us() - t0;
+        sum += t;
+        max = t > max ? t : max;
+    }
+    I2C_Bus_GetStats(Stats);
+    __atomic_store_n(&Streaming, 0, __ATOMIC_RELEASE);
+    while(__atomic_load_n(&Outstanding, __ATOMIC_ACQUIRE) > 0)
+        Sleep_us(100);
+
+    *Mean = sum / Touches;
+    *Max = max;
+    printf("%-11s touch read %6.0f us avg %6.0f us max, bus %3lu%% busy, %lu bursts, %lu preempted\n", Name,
+           *Mean, *Max, (unsigned long)(Stats->Elapsed_us ? (uint64_t)Stats->Busy_us * 100 / Stats->Elapsed_us : 0),
+           (unsigned long)Stats->Done[I2C_BUS_PRIO_IMU], (unsigned long)Stats->Preempted);
+    return 0;
+}
+
+static int Load_Check(int Touches, UWORD Burst_Len, long Period)
+{
+    I2C_BUS_STATS fifo, prio;
+    double fifo_mean, fifo_max, prio_mean, prio_max;
+
+    if(Load_Run("no priority", I2C_BUS_PRIO_IMU, Touches, Burst_Len, Period, &fifo_mean, &fifo_max, &fifo) ||
+        Load_Run("prioritized", I2C_BUS_PRIO_TOUCH, Touches, Burst_Len, Period, &prio_mean, &prio_max, &prio))
+        return 1;
+    if(prio_mean >= fifo_mean) {
+        printf("load: prioritized touch reads waited %.0f us, %.0f us without priority\n", prio_mean, fifo_mean);
+        return 1;
+    }
+    if(Burst_Len > I2C_BUS_CHUNK && prio.Preempted == 0) {
+        printf("load: no burst let a touch read in between its chunks\n");
+        return 1;
+    }
+    if(prio.Busy_us == 0 || prio.Busy_us > prio.Elapsed_us || prio.Errors) {
+        printf("load: %lu us busy of %lu us, %lu errors\n", (unsigned long)prio.Busy_us,
+               (unsigned long)prio.Elapsed_us, (unsigned long)prio.Errors);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int touches = 200;
+    long burst = 192, period = 2000;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            touches = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-b") && i + 1 < argc)
+            burst = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-p") && i + 1 < argc)
+            period = atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n touches] [-b burst_bytes] [-p period_us]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(touches < 1)
+        touches = 1;
+    if(burst < 1 || burst > BURST_MAX)
+        burst = 192;
+
+    Sim_Init(&Touch_Dev, 1);
+    Sim_Init(&Imu_Dev, 3);
+    Sim_Init(&Fast_Dev, 5);
+    Imu_Dev.Fifo = 1;
+    DEV_I2C_Sim_Attach(TOUCH_ADDR, Sim_Func, &Touch_Dev, I2C_BUS_DEFAULT_HZ);
+    DEV_I2C_Sim_Attach(IMU_ADDR, Sim_Func, &Imu_Dev, I2C_BUS_DEFAULT_HZ);
+    DEV_I2C_Sim_Attach(FAST_ADDR, Sim_Func, &Fast_Dev, I2C_BUS_FAST_PLUS_HZ);
+
+    if(Data_Check("direct"))
+        return 1;
+    if(I2C_Bus_Init(0)) {
+        printf("bus task failed to start\n");
+        return 1;
+    }
+    if(Data_Check("task") || Merge_Check() || Clock_Check())
+        return 1;
+    return Load_Check(touches, (UWORD)burst, period);
+}
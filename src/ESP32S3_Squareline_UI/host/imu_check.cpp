@@ -0,0 +1,432 @@
+/*****************************************************************************
+* | File      	:   imu_check.cpp
+* | Function    :   Host check of the QMI8658 FIFO acquisition
+* | Info        :
+*                IMU_Fifo on the simulated I2C bus, with a simulated
+*                QMI8658: its FIFO in stream mode, the CTRL9 handshake,
+*                FIFO read mode and the watermark interrupt, which rises
+*                when the level reaches the watermark and stays high until
+*                a drain takes it below.
+*
+*                IMU_Fifo_Init() must set the accelerometer alone to the
+*                step counting rate and the FIFO to the watermark. Then a
+*                thread of its own puts numbered samples into the FIFO at a
+*                fixed period while this one takes the blocks like loop():
+*                every sample must arrive once and in order, with block
+*                times that advance, and IMU_Fifo_Poll() must bring the
+*                rest below the watermark. Then the FIFO is overrun with
+*                the interrupt disconnected, and loop() stops taking blocks
+*                until the ring is full: both losses must be flagged on
+*                the next block, and the samples after them must be right.
+*                Prints the bus bytes and wakeups per sample next to the
+*                old 50 ms register polling.
+*
+*                usage: imu_check [-n samples] [-p period_us]
+*                  -n  samples of the streaming test (default 2000)
+*                  -p  time between samples (default 500, the chip's 16000)
+*
+*                Exits with 1 on the first error.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "I2C_Bus.h"
+#include "IMU_Fifo.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#define IMU_ADDR        QMI8658_SLAVE_ADDR_H
+#define FIFO_SAMPLES    64          // IMU_FIFO_SIZE
+#define POLL_BYTES      15          // timestamp and the 12 sample bytes at 48..64, merged
+#define POLL_PERIOD_MS  50
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static void Sleep_us(long Us)
+{
+    struct timespec ts = {Us / 1000000, (Us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * Simulated QMI8658
+ **/
+typedef struct {
+    pthread_mutex_t Lock;
+    UBYTE Regs[128];
+    UBYTE Fifo[FIFO_SAMPLES][IMU_FIFO_SAMPLE_BYTES];
+    UDOUBLE Head;           // samples in, the FIFO holds Head - Tail
+    UDOUBLE Tail;
+    UBYTE Byte;             // next byte of the sample at Tail
+    UBYTE Overflow;         // until the status is read
+    UBYTE Cmd_Done;
+    UBYTE Irq_Connected;
+    UDOUBLE Bad_Reads;      // data port read outside read mode
+} SIM_IMU;
+
+static SIM_IMU Imu;
+
+static UDOUBLE Sim_Level(void)
+{
+    return Imu.Head - Imu.Tail;
+}
+
+// From the test's thread, while the bus task reads the FIFO
+static UDOUBLE Sim_Level_Locked(void)
+{
+    UDOUBLE n;
+
+    pthread_mutex_lock(&Imu.Lock);
+    n = Sim_Level();
+    pthread_mutex_unlock(&Imu.Lock);
+    return n;
+}
+
+static UBYTE Sim_Read_Reg(UBYTE Reg)
+{
+    UDOUBLE words = (Sim_Level() * IMU_FIFO_SAMPLE_BYTES - Imu.Byte) / 2;
+    UBYTE v;
+
+    switch(Reg) {
+    case QMI8658Register_FifoCount:
+        return (UBYTE)words;
+    case QMI8658Register_FifoStatus:
+        v = (UBYTE)((words >> 8) & QMI8658_FIFO_STATUS_COUNT_H);
+        if(Sim_Level() > 0)
+            v |= QMI8658_FIFO_STATUS_NOT_EMPTY;
+        if(Sim_Level() >= Imu.Regs[QMI8658Register_FifoWtmTh])
+            v |= QMI8658_FIFO_STATUS_WTM;
+        if(Imu.Overflow)
+            v |= QMI8658_FIFO_STATUS_OVFLOW;
+        Imu.Overflow = 0;
+        return v;
+    case QMI8658Register_StatusInt:
+        return Imu.Cmd_Done ? QMI8658_STATUSINT_CMD_DONE : 0;
+    default:
+        return Imu.Regs[Reg & 0x7F];
+    }
+}
+
+static uint8_t Sim_Func(uint8_t Reg, uint8_t *pData, uint32_t Len, uint8_t Write, void *Arg)
+{
+    (void)Arg;
+    pthread_mutex_lock(&Imu.Lock);
+    for(uint32_t i = 0; i < Len; i++) {
+        UBYTE r = (UBYTE)(Reg + i);
+        if(Write) {
+            Imu.Regs[r & 0x7F] = pData[i];
+            if(r == QMI8658Register_Ctrl9) {
+                if(pData[i] == QMI8658_Ctrl9_Cmd_Req_Fifo) {
+                    Imu.Regs[QMI8658Register_FifoCtrl] |= QMI8658_FIFO_RD_MODE;
+                    Imu.Cmd_Done = 1;
+                } else if(pData[i] == QMI8658_Ctrl9_Cmd_Rst_Fifo) {
+                    Imu.Tail = Imu.Head;
+                    Imu.Byte = 0;
+                    Imu.Cmd_Done = 1;
+                } else if(pData[i] == QMI8658_Ctrl9_Cmd_NOP) {
+                    Imu.Cmd_Done = 0;
+                }
+            }
+        } else if(Reg == QMI8658Register_FifoData) {
+            // The data port does not advance the register
+            if(!(Imu.Regs[QMI8658Register_FifoCtrl] & QMI8658_FIFO_RD_MODE) || Sim_Level() == 0) {
+                Imu.Bad_Reads++;
+                pData[i] = 0;
+                continue;
+            }
+            pData[i] = Imu.Fifo[Imu.Tail % FIFO_SAMPLES][Imu.Byte];
+            if(++Imu.Byte == IMU_FIFO_SAMPLE_BYTES) {
+                Imu.Byte = 0;
+                Imu.Tail++;
+            }
+        } else {
+            pData[i] = Sim_Read_Reg(r);
+        }
+    }
+    pthread_mutex_unlock(&Imu.Lock);
+    return 0;
+}
+
+static void Sample_Of(UDOUBLE N, short Acc[3])
+{
+    Acc[0] = (short)N;
+    Acc[1] = (short)(N * 7);
+    Acc[2] = (short)~N;
+}
+
+// One sample from the sensor, at the watermark the interrupt rises
+static void Sim_Push(UDOUBLE N)
+{
+    short acc[3];
+    UBYTE rise = 0;
+
+    Sample_Of(N, acc);
+    pthread_mutex_lock(&Imu.Lock);
+    if(Imu.Regs[QMI8658Register_Ctrl7] & QMI8658_CTRL7_ACC_ENABLE) {
+        // Stream mode: a full FIFO loses its oldest sample
+        if(Sim_Level() == FIFO_SAMPLES) {
+            Imu.Tail++;
+            Imu.Byte = 0;
+            Imu.Overflow = 1;
+        }
+        UBYTE *s = Imu.Fifo[Imu.Head % FIFO_SAMPLES];
+        for(int a = 0; a < 3; a++) {
+            s[2 * a] = (UBYTE)acc[a];
+            s[2 * a + 1] = (UBYTE)((unsigned short)acc[a] >> 8);
+        }
+        Imu.Head++;
+        rise = Sim_Level() == Imu.Regs[QMI8658Register_FifoWtmTh] && Imu.Irq_Connected;
+    }
+    pthread_mutex_unlock(&Imu.Lock);
+    if(rise)
+        IMU_Fifo_Wake_ISR();
+}
+
+/**
+ * Consumer
+ **/
+static UDOUBLE Expected = 0;        // number of the next sample
+static UDOUBLE Received = 0;        // samples in blocks
+static UDOUBLE Last_Us = 0;
+
+static int Take_Blocks(const char *Mode, int Lost_Expected)
+{
+    IMU_BLOCK b;
+    int blocks = 0;
+
+    while(IMU_Fifo_Read(&b) == 0) {
+        short acc[3];
+        if(b.Count == 0 || b.Count > IMU_BLOCK_MAX || b.Period_us != IMU_FIFO_PERIOD_US) {
+            printf("%s: block of %u samples, %lu us apart\n", Mode, b.Count, (unsigned long)b.Period_us);
+            return 1;
+        }
+        if(b.Seq != Received || (b.Overflow != 0) != (Lost_Expected && blocks == 0)) {
+            printf("%s: block at %lu after %lu samples, overflow %d\n", Mode,
+                   (unsigned long)b.Seq, (unsigned long)Received, b.Overflow);
+            return 1;
+        }
+        if(Received > 0 && (int32_t)(b.Us - Last_Us) <= 0) {
+            printf("%s: block time went from %lu to %lu us\n", Mode, (unsigned long)Last_Us, (unsigned long)b.Us);
+            return 1;
+        }
+        // After a loss the samples go on from the first one the FIFO still had
+        if(b.Overflow)
+            Expected += (unsigned short)(b.Acc[0][0] - (short)Expected);
+        for(UWORD i = 0; i < b.Count; i++, Expected++) {
+            Sample_Of(Expected, acc);
+            if(memcmp(acc, b.Acc[i], sizeof(acc))) {
+                printf("%s: sample %lu is %d %d %d\n", Mode, (unsigned long)Expected,
+                       b.Acc[i][0], b.Acc[i][1], b.Acc[i][2]);
+                return 1;
+            }
+        }
+        Received += b.Count;
+        Last_Us = b.Us;
+        blocks++;
+    }
+    return 0;
+}
+
+/**
+ * Configuration
+ **/
+static int Config_Check(void)
+{
+    UBYTE ctrl2 = Imu.Regs[QMI8658Register_Ctrl2], ctrl7 = Imu.Regs[QMI8658Register_Ctrl7];
+
+    if(ctrl2 != ((UBYTE)IMU_FIFO_RANGE | (UBYTE)IMU_FIFO_ODR) ||
+       ctrl7 != (QMI8658_CTRL7_ACC_ENABLE | QMI8658_CTRL7_DRDY_DISABLE)) {
+        printf("config: CTRL2 0x%02x, CTRL7 0x%02x\n", ctrl2, ctrl7);
+        return 1;
+    }
+    if(Imu.Regs[QMI8658Register_FifoWtmTh] != IMU_FIFO_WATERMARK ||
+       Imu.Regs[QMI8658Register_FifoCtrl] != (QMI8658_FIFO_MODE_STREAM | IMU_FIFO_SIZE)) {
+        printf("config: watermark %d, FIFO_CTRL 0x%02x\n", Imu.Regs[QMI8658Register_FifoWtmTh],
+               Imu.Regs[QMI8658Register_FifoCtrl]);
+        return 1;
+    }
+    if((Imu.Regs[QMI8658Register_Ctrl1] & (QMI8658_CTRL1_INT2_ENABLE | QMI8658_CTRL1_FIFO_INT1)) != QMI8658_CTRL1_INT2_ENABLE ||
+       (Imu.Regs[QMI8658Register_Ctrl1] & 0x60) != 0x60) {
+        printf("config: CTRL1 0x%02x\n", Imu.Regs[QMI8658Register_Ctrl1]);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Streaming
+ **/
+typedef struct {
+    UDOUBLE First;
+    UDOUBLE Count;
+    long Period;
+} PRODUCER;
+
+static volatile int Produced = 0;
+
+static void *Producer_Thread(void *Arg)
+{
+    PRODUCER *p = (PRODUCER *)Arg;
+
+    for(UDOUBLE i = 0; i < p->Count; i++) {
+        Sleep_us(p->Period);
+        Sim_Push(p->First + i);
+    }
+    __atomic_store_n(&Produced, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static int Wait_For(UDOUBLE Samples, const char *Mode, int Lost)
+{
+    UDOUBLE start = Received;
+
+    for(int i = 0; i < 5000 && Received < Samples; i++) {
+        // Only the first block after a loss says so
+        if(Take_Blocks(Mode, Lost && Received == start))
+            return 1;
+        Sleep_us(1000);
+    }
+    if(Received != Samples) {
+        printf("%s: %lu of %lu samples arrived\n", Mode, (unsigned long)Received, (unsigned long)Samples);
+        return 1;
+    }
+    return 0;
+}
+
+static int Stream_Check(UDOUBLE N, long Period)
+{
+    PRODUCER p = {0, N, Period};
+    pthread_t id;
+    IMU_FIFO_STATS st;
+    I2C_BUS_STATS bs;
+
+    IMU_Fifo_ResetStats();
+    I2C_Bus_ResetStats();
+    pthread_create(&id, NULL, Producer_Thread, &p);
+    while(!__atomic_load_n(&Produced, __ATOMIC_ACQUIRE)) {
+        if(Take_Blocks("stream", 0))
+            return 1;
+        Sleep_us(1000);
+    }
+    pthread_join(id, NULL);
+    // The rest is below the watermark, no interrupt comes for it
+    Sleep_us(100000);
+    if(Take_Blocks("stream", 0))
+        return 1;
+    if(Received + IMU_FIFO_WATERMARK <= N) {
+        printf("stream: %lu of %lu samples before the poll\n", (unsigned long)Received, (unsigned long)N);
+        return 1;
+    }
+    IMU_Fifo_Poll();
+    if(Wait_For(N, "stream", 0))
+        return 1;
+
+    IMU_Fifo_GetStats(&st);
+    I2C_Bus_GetStats(&bs);
+    if(st.Errors || st.Dropped || st.Overflows || Imu.Bad_Reads || st.Samples != N) {
+        printf("stream: %lu errors, %lu dropped, %lu overflows, %lu bad reads, %lu samples\n",
+               (unsigned long)st.Errors, (unsigned long)st.Dropped, (unsigned long)st.Overflows,
+               (unsigned long)Imu.Bad_Reads, (unsigned long)st.Samples);
+        return 1;
+    }
+    // The old polling read one sample of 1000 Hz every 50 ms
+    printf("stream: %lu samples in %lu blocks from %lu interrupts, %.1f bus bytes and %.3f wakeups per sample,"
+           " drain %lu us avg\n", (unsigned long)N, (unsigned long)st.Blocks, (unsigned long)st.Interrupts,
+           (double)st.Bytes / N, (double)st.Drains / N, (unsigned long)(st.Drains ? st.Drain_us / st.Drains : 0));
+    printf("polling:   %d bus bytes and 1 wakeup per sample, %d of %d samples read\n", POLL_BYTES,
+           1000 / POLL_PERIOD_MS, 1000);
+    printf("bus:       %lu transfers for %lu samples\n", (unsigned long)bs.Transfers, (unsigned long)N);
+    return 0;
+}
+
+/**
+ * Losses
+ **/
+static int Loss_Check(void)
+{
+    UDOUBLE next = Expected;
+    IMU_FIFO_STATS st;
+
+    // Overrun with the interrupt lost: the poll finds the newest FIFO_SAMPLES
+    Imu.Irq_Connected = 0;
+    for(int i = 0; i < FIFO_SAMPLES + 10; i++)
+        Sim_Push(next++);
+    Imu.Irq_Connected = 1;
+    IMU_Fifo_Poll();
+    if(Wait_For(Received + FIFO_SAMPLES, "overrun", 1))
+        return 1;
+
+    // loop() stops taking blocks: the ring fills, one more is dropped
+    IMU_Fifo_ResetStats();
+    for(int b = 0; b <= IMU_FIFO_BLOCKS; b++) {
+        for(int i = 0; i < IMU_FIFO_WATERMARK; i++)
+            Sim_Push(next++);
+        for(int i = 0; i < 1000 && Sim_Level_Locked() != 0; i++)
+            Sleep_us(1000);
+    }
+    // The drain still leaves read mode after the FIFO is empty
+    for(int i = 0; i < 1000; i++) {
+        IMU_Fifo_GetStats(&st);
+        if(st.Dropped)
+            break;
+        Sleep_us(1000);
+    }
+    if(st.Dropped != 1) {
+        printf("ring: %lu blocks dropped instead of 1\n", (unsigned long)st.Dropped);
+        return 1;
+    }
+    if(Wait_For(Received + IMU_FIFO_BLOCKS * IMU_FIFO_WATERMARK, "ring", 0))
+        return 1;
+    // The dropped block's samples count, the next block says they are lost
+    Received += IMU_FIFO_WATERMARK;
+    for(int i = 0; i < IMU_FIFO_WATERMARK; i++)
+        Sim_Push(next++);
+    if(Wait_For(Received + IMU_FIFO_WATERMARK, "after drop", 1))
+        return 1;
+    printf("losses: FIFO overrun and full ring flagged on the next block\n");
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    UDOUBLE n = 2000;
+    long period = 500;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            n = strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-p") && i + 1 < argc)
+            period = atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n samples] [-p period_us]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(n < IMU_FIFO_WATERMARK)
+        n = IMU_FIFO_WATERMARK;
+
+    pthread_mutex_init(&Imu.Lock, NULL);
+    Imu.Regs[QMI8658Register_WhoAmI] = 0x05;
+    Imu.Regs[QMI8658Register_Ctrl1] = 0x60;       // as QMI8658_init() leaves it
+    Imu.Regs[QMI8658Register_Ctrl7] = QMI8658_CONFIG_ACCGYR_ENABLE;
+    Imu.Irq_Connected = 1;
+    DEV_I2C_Sim_Attach(IMU_ADDR, Sim_Func, NULL, I2C_BUS_DEFAULT_HZ);
+    if(I2C_Bus_Init(0)) {
+        printf("bus task failed to start\n");
+        return 1;
+    }
+    if(IMU_Fifo_Init(IMU_ADDR, NULL, 0)) {
+        printf("IMU_Fifo_Init failed\n");
+        return 1;
+    }
+    if(Config_Check() || Stream_Check(n, period))
+        return 1;
+    return Loss_Check();
+}
@@ -0,0 +1,421 @@
+/*****************************************************************************
+* | File      	:   lcd_bench.cpp
+* | Function    :   Host benchmark of the LCD_1in28 transfer paths
+* | Info        :
+*                Runs LCD_1in28.cpp against the GC9A01 mock, prints the bus
+*                traffic and estimated wire time of each scenario and checks
+*                what landed in the panel framebuffer.
+*
+*                usage: lcd_bench [-c clock_hz] [-g overhead_ns] [-o dir]
+*                  -c  SPI clock for the wire time (default DEV_SPI_FREQ_HZ)
+*                  -g  idle time added per transaction (default 0)
+*                  -o  write the framebuffer of each scenario as dir/NAME.ppm
+*
+*                The 444 scenarios run the same frames over the 12 bit bus
+*                format; pack444 checks the packing kernel against a per
+*                pixel reference and the color error against RGB565.
+*
+*                cmdlist checks that every DC run of a command list is one
+*                transaction, parameter runs over 4 bytes too.
+*
+*                The diff scenarios show a full frame, then frames that
+*                change only in places, through LCD_1IN28_DisplayDiff_Async
+*                with every row marked dirty.
+*
+*                Exits with 1 if any scenario left wrong pixels on the panel.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+#include "GC9A01_Mock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W   LCD_1IN28_WIDTH
+#define H   LCD_1IN28_HEIGHT
+
+static UWORD Image[W * H];
+static UWORD Batch[W * 16];
+static UWORD Stage[2][W * 24];
+// Front and back frame of the diff scenarios, word aligned
+static UDOUBLE Frame_Words[2][W * H / 2];
+static UWORD *Front = (UWORD *)Frame_Words[0];
+static UWORD *Back = (UWORD *)Frame_Words[1];
+static UWORD Row_Start[H], Row_End[H];
+static const char *Out_Dir = NULL;
+static int Done_Calls = 0;
+// Panel runs COLMOD 0x03, pixels arrive cut to 4 bits per channel
+static int Expect_444 = 0;
+
+static void Bench_Done(void *Arg)
+{
+    (void)Arg;
+    Done_Calls++;
+}
+
+// Test pattern, every pixel differs from its neighbours
+static UWORD Pattern(UWORD X, UWORD Y)
+{
+    return (UWORD)((X * 7 + Y * 131) ^ (Y << 8));
+}
+
+// Pixels of a window packed row after row in panel (big endian) order
+static void Fill_Packed(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UWORD *p = Image;
+    for(UWORD y = Ystart; y < Yend; y++)
+        for(UWORD x = Xstart; x < Xend; x++) {
+            UWORD c = Pattern(x, y);
+            *p++ = (c >> 8) | (c << 8);
+        }
+}
+
+// RGB565 as the panel shows it after the 444 round trip
+static UWORD To444(UWORD C)
+{
+    UWORD r = C >> 12, g = (C >> 7) & 0x0F, b = (C >> 1) & 0x0F;
+    return ((r << 1 | r >> 3) << 11) | ((g << 2 | g >> 2) << 5) | (b << 1 | b >> 3);
+}
+
+static int Visible(UWORD X, UWORD Y)
+{
+    UWORD xs, xe;
+    LCD_1IN28_GetSpan(Y, &xs, &xe);
+    return X >= xs && X < xe;
+}
+
+/******************************************************************************
+function:	Count framebuffer pixels that differ from what the window should show
+parameter:
+    Round : only pixels inside the circle have to match
+    Color : expected color, or -1 for the test pattern
+******************************************************************************/
+static uint32_t Check_Window(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, int Round, long Color)
+{
+    const uint16_t *fb = GC9A01_Mock_Framebuffer();
+    uint32_t bad = 0;
+
+    for(UWORD y = Ystart; y < Yend; y++)
+        for(UWORD x = Xstart; x < Xend; x++) {
+            UWORD want = Color < 0 ? Pattern(x, y) : (UWORD)Color;
+            if(Expect_444)
+                want = To444(want);
+            if(Round && !Visible(x, y))
+                continue;
+            if(fb[y * W + x] != want)
+                bad++;
+        }
+    return bad;
+}
+
+static void Begin(void)
+{
+    GC9A01_Mock_Reset_Stats();
+    LCD_1IN28_ResetStats();
+    Done_Calls = 0;
+}
+
+static int End(const char *Name, uint32_t Bad)
+{
+    GC9A01_MOCK_STATS st;
+    GC9A01_Mock_Get_Stats(&st);
+
+    printf("%-16s %7u %6u %6u %6u %8llu %9llu %9llu %9.1f  %s\n",
+           Name, st.Windows, st.Transactions, st.Dc_Toggles, st.Commands,
+           (unsigned long long)st.Param_Bytes, (unsigned long long)st.Pixel_Bytes,
+           (unsigned long long)(st.Commands + st.Param_Bytes + st.Pixel_Bytes),
+           st.Wire_ns / 1000.0, Bad ? "FAIL" : "ok");
+    if(Bad)
+        printf("  %u wrong pixels\n", Bad);
+    if(st.Overruns)
+        printf("  %u pixels past the window end\n", st.Overruns);
+
+    if(Out_Dir != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.ppm", Out_Dir, Name);
+        if(GC9A01_Mock_Save_PPM(path) != 0)
+            printf("  could not write %s\n", path);
+    }
+    return Bad ? 1 : 0;
+}
+
+/******************************************************************************
+function:	Send Back against Front with every row dirty, then make it the front
+parameter:
+    Name : scenario
+    Sent : windows LCD_1IN28_DisplayDiff_Async must queue, -1 = any but 0
+Info:
+	The panel has to show Back afterwards (the circle with LCD_1IN28_ROUND).
+******************************************************************************/
+static int Run_Diff(const char *Name, int Sent)
+{
+    const uint16_t *fb = GC9A01_Mock_Framebuffer();
+    LCD_1IN28_STATS st;
+    uint32_t bad = 0;
+    UWORD *t;
+
+    for(UWORD y = 0; y < H; y++) {
+        Row_Start[y] = 0;
+        Row_End[y] = W;
+    }
+    Begin();
+    UWORD n = LCD_1IN28_DisplayDiff_Async(Front, Back, Row_Start, Row_End, Image);
+    if(Sent < 0 ? n == 0 : n != Sent)
+        bad++;
+    if(Done_Calls != (n ? 1 : 0))
+        bad++;
+    for(UWORD y = 0; y < H; y++)
+        for(UWORD x = 0; x < W; x++) {
+            UWORD c = Back[y * W + x];
+            if(LCD_1IN28_ROUND && !Visible(x, y))
+                continue;
+            if(fb[y * W + x] != (UWORD)((c >> 8) | (c << 8)))
+                bad++;
+        }
+
+    LCD_1IN28_GetStats(&st);
+    int fail = End(Name, bad);
+    printf("  %u windows, %lu of %lu compared pixels changed\n", n,
+           (unsigned long)st.Diff_Changed, (unsigned long)st.Diff_Pixels);
+
+    t = Front;
+    Front = Back;
+    Back = t;
+    memcpy(Back, Front, W * H * 2);
+    return fail;
+}
+
+/******************************************************************************
+function:	Check LCD_1IN28_Pack444 and report the color error of 444
+Info:
+	Every RGB565 value goes through the kernel once out of place and once
+	in place, odd and even lengths, and must match a plain per pixel
+	packing. The error is measured on 8 bit channels between RGB565 and
+	RGB444 as the panel expands them, and has to stay under one 4 bit step.
+******************************************************************************/
+static int Check_Pack444(void)
+{
+    static UWORD src[65536 + 1];
+    static UBYTE ref[(65536 + 1) * 3 / 2 + 1];
+    static UBYTE out[(65536 + 1) * 3 / 2 + 1];
+    static UWORD tmp[65536 + 1];
+    uint32_t bad = 0, n;
+    double sum[3] = {0, 0, 0};
+    int max[3] = {0, 0, 0};
+
+    for(n = 0; n < 65536; n++)
+        src[n] = (UWORD)((n >> 8) | (n << 8));     // panel byte order
+    src[65536] = 0x5AA5;
+
+    // Reference: nibbles one pixel at a time
+    memset(ref, 0, sizeof(ref));
+    for(n = 0; n < 65537; n++) {
+        UWORD c = (src[n] >> 8) | (src[n] << 8);
+        UBYTE nib[3] = {(UBYTE)(c >> 12), (UBYTE)((c >> 7) & 0x0F), (UBYTE)((c >> 1) & 0x0F)};
+        for(int k = 0; k < 3; k++) {
+            uint32_t bit = n * 12 + k * 4;
+            ref[bit / 8] |= (bit & 4) ? nib[k] : nib[k] << 4;
+        }
+    }
+
+    for(uint32_t len = 65536; len <= 65537; len++) {
+        uint32_t bytes = (len * 3 + 1) / 2;
+        memset(out, 0, sizeof(out));
+        LCD_1IN28_Pack444(src, out, len);
+        if(memcmp(out, ref, bytes))
+            bad++;
+        memcpy(tmp, src, len * 2);
+        LCD_1IN28_Pack444(tmp, (UBYTE *)tmp, len);
+        if(memcmp(tmp, ref, bytes))
+            bad++;
+    }
+
+    for(n = 0; n < 65536; n++) {
+        UWORD q = To444((UWORD)n);
+        int a[3] = {(int)(n >> 11), (int)((n >> 5) & 0x3F), (int)(n & 0x1F)};
+        int b[3] = {q >> 11, (q >> 5) & 0x3F, q & 0x1F};
+        for(int k = 0; k < 3; k++) {
+            int bits = k == 1 ? 6 : 5;
+            int e = abs((a[k] * 255 + ((1 << bits) - 1) / 2) / ((1 << bits) - 1) -
+                        (b[k] * 255 + ((1 << bits) - 1) / 2) / ((1 << bits) - 1));
+            sum[k] += e;
+            if(e > max[k])
+                max[k] = e;
+        }
+    }
+    printf("pack444: max error R %d G %d B %d, mean %.2f %.2f %.2f (8 bit)  %s\n",
+           max[0], max[1], max[2], sum[0] / 65536, sum[1] / 65536, sum[2] / 65536,
+           bad ? "FAIL" : "ok");
+    for(int k = 0; k < 3; k++)
+        if(max[k] >= 17)
+            bad++;
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t clock_hz = DEV_SPI_FREQ_HZ;
+    uint32_t overhead_ns = 0;
+    int fail = 0;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-c") && i + 1 < argc)
+            clock_hz = strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-g") && i + 1 < argc)
+            overhead_ns = strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-o") && i + 1 < argc)
+            Out_Dir = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-c clock_hz] [-g overhead_ns] [-o dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    DEV_Module_Init();
+    GC9A01_Mock_Set_Clock(clock_hz, overhead_ns);
+    DEV_SPI_Set_Done_Callback(Bench_Done);
+    LCD_1IN28_Batch_Init(Batch, sizeof(Batch) / sizeof(Batch[0]));
+    LCD_1IN28_Diff_Init(Stage[0], Stage[1], sizeof(Stage[0]) / sizeof(Stage[0][0]));
+
+    printf("SPI clock %u Hz, %u ns per transaction\n", clock_hz, overhead_ns);
+    printf("%-16s %7s %6s %6s %6s %8s %9s %9s %9s\n", "scenario", "windows", "trans",
+           "dc", "cmds", "params", "pixel B", "total B", "wire us");
+
+    // Init sequence
+    Begin();
+    LCD_1IN28_Init(HORIZONTAL);
+    fail |= End("init", GC9A01_Mock_Colmod() == 0x05 ? 0 : 1);
+
+    // The init gamma again as a command list: every DC run, 6 parameter
+    // bytes too, is one transaction
+    {
+        static const UBYTE gamma1[6] = {0x45, 0x09, 0x08, 0x08, 0x26, 0x2A};
+        static const UBYTE gamma2[6] = {0x43, 0x70, 0x72, 0x36, 0x37, 0x6F};
+        LCD_1IN28_CMDLIST list;
+        GC9A01_MOCK_STATS st;
+
+        Begin();
+        LCD_1IN28_CmdList_Init(&list);
+        LCD_1IN28_CmdList_Add(&list, 0xF0, gamma1, 6);
+        LCD_1IN28_CmdList_Add(&list, 0xF1, gamma2, 6);
+        LCD_1IN28_CmdList_Submit(&list);
+        GC9A01_Mock_Get_Stats(&st);
+        fail |= End("cmdlist", st.Transactions != 4 || st.Param_Bytes != 12);
+    }
+
+    // Clear to red
+    Begin();
+    LCD_1IN28_Clear(0xF800);
+    fail |= End("clear", Check_Window(0, 0, W, H, LCD_1IN28_ROUND, 0xF800));
+
+    // Solid band straight from the fill pattern, nothing rendered
+    Begin();
+    LCD_1IN28_FillWindows_Async(0, 40, W, 200, 0x001F, Image);
+    fail |= End("fill_band", Check_Window(0, 40, W, 200, LCD_1IN28_ROUND, 0x001F) +
+                             Check_Window(0, 0, W, 40, LCD_1IN28_ROUND, 0xF800) + (Done_Calls != 1));
+
+    // Full frame as one rectangle
+    Begin();
+    Fill_Packed(0, 0, W, H);
+    LCD_1IN28_DisplayWindows_Async(0, 0, W, H, Image, Image);
+    fail |= End("frame_rect", Check_Window(0, 0, W, H, 0, -1) + (Done_Calls != 1));
+
+    // Full frame, visible circle only
+    Begin();
+    LCD_1IN28_Clear(0x0000);
+    Begin();
+    Fill_Packed(0, 0, W, H);
+    LCD_1IN28_DisplayWindows_Round_Async(0, 0, W, H, Image, Image);
+    fail |= End("frame_round", Check_Window(0, 0, W, H, 1, -1) + (Done_Calls != 1));
+
+    // A 64x24 label redrawn ten times in place
+    Begin();
+    for(i = 0; i < 10; i++) {
+        Fill_Packed(88, 108, 152, 132);
+        LCD_1IN28_DisplayWindows_Async(88, 108, 152, 132, Image, Image);
+    }
+    fail |= End("label_x10", Check_Window(88, 108, 152, 132, 0, -1) + (Done_Calls != 10));
+
+    // Six small areas of one refresh in a single batch (fits the 240x16 staging)
+    {
+        static const UWORD areas[6][4] = {
+            {104, 20, 136, 36}, {30, 100, 62, 116}, {170, 100, 202, 116},
+            {104, 200, 136, 216}, {60, 60, 92, 76}, {150, 150, 182, 166},
+        };
+        uint32_t bad = 0;
+
+        Begin();
+        for(i = 0; i < 6; i++) {
+            Fill_Packed(areas[i][0], areas[i][1], areas[i][2], areas[i][3]);
+            if(!LCD_1IN28_Batch_Add(areas[i][0], areas[i][1], areas[i][2], areas[i][3], Image))
+                bad++;
+        }
+        LCD_1IN28_Batch_Submit(Image);
+        for(i = 0; i < 6; i++)
+            bad += Check_Window(areas[i][0], areas[i][1], areas[i][2], areas[i][3], LCD_1IN28_ROUND, -1);
+        fail |= End("batch_6", bad + (Done_Calls != 1));
+    }
+
+    // Frame diff: a black panel gets the whole pattern, then a 40x40 block
+    // and a few scattered pixels change, then nothing does
+    Begin();
+    LCD_1IN28_Clear(0x0000);
+    memset(Front, 0, W * H * 2);
+    for(UWORD y = 0; y < H; y++)
+        for(UWORD x = 0; x < W; x++) {
+            UWORD c = Pattern(x, y);
+            Back[y * W + x] = (c >> 8) | (c << 8);
+        }
+    fail |= Run_Diff("diff_frame", -1);
+
+    for(UWORD y = 100; y < 140; y++)
+        for(UWORD x = 61; x < 101; x++)
+            Back[y * W + x] ^= 0x1F00;
+    Back[30 * W + 120] ^= 0x00F8;
+    Back[31 * W + 121] ^= 0x00F8;
+    Back[200 * W + 160] ^= 0x00F8;
+    fail |= Run_Diff("diff_block", -1);
+
+    fail |= Run_Diff("diff_none", 0);
+
+    // The same frames with two pixels in three bytes
+    Begin();
+    LCD_1IN28_SetColorMode(LCD_1IN28_COLOR_444);
+    Expect_444 = 1;
+    fail |= End("colmod_444", GC9A01_Mock_Colmod() == LCD_1IN28_COLOR_444 ? 0 : 1);
+
+    Begin();
+    LCD_1IN28_Clear(0x07E0);
+    fail |= End("clear_444", Check_Window(0, 0, W, H, LCD_1IN28_ROUND, 0x07E0));
+
+    Begin();
+    Fill_Packed(0, 0, W, H);
+    LCD_1IN28_DisplayWindows_Async(0, 0, W, H, Image, Image);
+    fail |= End("frame_rect_444", Check_Window(0, 0, W, H, 0, -1) + (Done_Calls != 1));
+
+    Begin();
+    LCD_1IN28_Clear(0x0000);
+    Begin();
+    Fill_Packed(0, 0, W, H);
+    LCD_1IN28_DisplayWindows_Round_Async(0, 0, W, H, Image, Image);
+    fail |= End("frame_round_444", Check_Window(0, 0, W, H, 1, -1) + (Done_Calls != 1));
+
+    // Odd width, the blocking path carries the odd pixel across rows
+    Begin();
+    for(UWORD y = 101; y < 124; y++)
+        for(UWORD x = 77; x < 154; x++) {
+            UWORD c = Pattern(x, y);
+            Image[y * W + x] = (c >> 8) | (c << 8);
+        }
+    LCD_1IN28_DisplayWindows(77, 101, 154, 124, Image);
+    fail |= End("window_odd_444", Check_Window(77, 101, 154, 124, LCD_1IN28_ROUND, -1));
+
+    LCD_1IN28_SetColorMode(LCD_1IN28_COLOR_565);
+    Expect_444 = 0;
+    printf("\n");
+    fail |= Check_Pack444();
+
+    return fail;
+}
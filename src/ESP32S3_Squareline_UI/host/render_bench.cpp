@@ -0,0 +1,351 @@
+/*****************************************************************************
+* | File      	:   render_bench.cpp
+* | Function    :   Host check and benchmark of the render workers
+* | Info        :
+*                Renders a few LVGL screens through a 240x240 display with
+*                the sketch's 240x24 draw buffers, once on the main thread
+*                only and then with 1..RENDER_WORKER_MAX workers drawing
+*                stripes of every part (pthreads). Every frame of a checked
+*                run must be identical to the single thread one; a timed
+*                run without the checks shows the scaling.
+*
+*                With fewer cores than threads the workers only add their
+*                handoffs, so a probe run draws the stripes of each part
+*                one after the other on a single worker and times them.
+*                Its longest stripe per part, or the time all of them held
+*                the locks if that is longer, is what a part would take
+*                with a core for every stripe: "cores" is the speedup
+*                that leaves if a handoff were free, "handoff" what one
+*                costs on this host (a few us on the board, where a part
+*                takes about 50 times longer to draw than here).
+*
+*                usage: render_bench [-n frames] [-r min_rows]
+*                  -n  frames per screen and worker count (default 200)
+*                  -r  thinnest stripe (RENDER_WORKER_MIN_ROWS)
+*
+*                Exits with 1 if any frame differs.
+******************************************************************************/
+#include "LVGL_Bench.h"
+#include "DEV_Config.h"
+#include "Render_Worker.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define W       LVGL_BENCH_WIDTH
+#define H       LVGL_BENCH_HEIGHT
+
+// Image drawn with and without opacity
+#define IMG_W   160
+#define IMG_H   120
+static lv_color_t Img_Px[IMG_W * IMG_H];
+static lv_img_dsc_t Img;
+
+// Probe: the stripes of a part run one by one on one thread and are timed
+typedef struct{
+	void (*Job)(void *Arg);
+	void *Arg;
+}PROBE_JOB;
+
+static PROBE_JOB Probe_Job[RENDER_WORKER_MAX];
+static UBYTE Probe_Queued = 0;
+static DEV_Sem Probe_Work = NULL;
+static DEV_Sem Probe_Done = NULL;
+static double Probe_Mark = 0;       // the caller starts its own stripe
+static double Probe_Stripe_us = 0;  // last stripe on the probe thread
+static double Probe_Sum_us = 0;     // all stripes, one after the other
+static double Probe_Path_us = 0;    // the longest stripe of every part
+static double Probe_Handoff_us = 0; // waking the probe thread and back
+static double Probe_Locked_us = 0;  // the stripes of this part held a lock
+static double Probe_Lock_t0 = 0;
+static UBYTE Probe_Lock_Depth = 0;
+static lv_refr_stripes_t Probe;
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static lv_obj_t *Panel(lv_obj_t *Parent, lv_coord_t X, lv_coord_t Y, lv_coord_t Wd, lv_coord_t Ht,
+                       uint32_t Color, lv_opa_t Opa, lv_coord_t Radius)
+{
+    lv_obj_t *o = lv_obj_create(Parent);
+    lv_obj_remove_style_all(o);
+    lv_obj_set_pos(o, X, Y);
+    lv_obj_set_size(o, Wd, Ht);
+    lv_obj_set_style_bg_color(o, lv_color_hex(Color), 0);
+    lv_obj_set_style_bg_opa(o, Opa, 0);
+    lv_obj_set_style_radius(o, Radius, 0);
+    return o;
+}
+
+// Solid and translucent panels, rounded corners, text
+static void Screen_Panels(lv_obj_t *Scr)
+{
+    lv_obj_set_style_bg_color(Scr, lv_color_hex(0x102030), 0);
+    Panel(Scr, 0, 0, W, 120, 0x204060, LV_OPA_COVER, 0);
+    Panel(Scr, 20, 60, 200, 120, 0xC04020, LV_OPA_60, 0);
+    Panel(Scr, 40, 100, 160, 120, 0x20C040, LV_OPA_COVER, 30);
+    Panel(Scr, 0, 150, W, 90, 0x4040F0, LV_OPA_30, 20);
+    lv_obj_t *l = lv_label_create(Scr);
+    lv_label_set_text(l, "12:34");
+    lv_obj_set_style_text_font(l, &lv_font_montserrat_48, 0);
+    lv_obj_center(l);
+}
+
+// Image plain and at 50 % and 70 % over a panel
+static void Screen_Images(lv_obj_t *Scr)
+{
+    lv_obj_set_style_bg_color(Scr, lv_color_black(), 0);
+    Panel(Scr, 0, 80, W, 80, 0xF0F0F0, LV_OPA_COVER, 0);
+    lv_obj_t *i = lv_img_create(Scr);
+    lv_img_set_src(i, &Img);
+    lv_obj_set_pos(i, 0, 0);
+    i = lv_img_create(Scr);
+    lv_img_set_src(i, &Img);
+    lv_obj_set_pos(i, 80, 60);
+    lv_obj_set_style_img_opa(i, LV_OPA_50, 0);
+    i = lv_img_create(Scr);
+    lv_img_set_src(i, &Img);
+    lv_obj_set_pos(i, 20, 120);
+    lv_obj_set_style_img_opa(i, LV_OPA_70, 0);
+}
+
+// Round watch face: a full circle, an arc and a shadowed button
+static void Screen_Round(lv_obj_t *Scr)
+{
+    lv_obj_set_style_bg_color(Scr, lv_color_hex(0x000000), 0);
+    Panel(Scr, 0, 0, W, H, 0x303030, LV_OPA_COVER, LV_RADIUS_CIRCLE);
+    lv_obj_t *a = lv_arc_create(Scr);
+    lv_obj_set_size(a, 220, 220);
+    lv_obj_center(a);
+    lv_arc_set_value(a, 70);
+    lv_obj_t *b = lv_btn_create(Scr);
+    lv_obj_set_size(b, 120, 50);
+    lv_obj_center(b);
+    lv_obj_t *l = lv_label_create(b);
+    lv_label_set_text(l, "Start");
+    lv_obj_center(l);
+}
+
+// A translucent group drawn through a layer, a keyboard, whose button
+// matrix switches its own state while it draws, and a rotated image with a
+// border, which moves its coordinates while it draws. The stripes take
+// turns on these two, and on the screen, the parent of the image
+static void Screen_Layers(lv_obj_t *Scr)
+{
+    lv_obj_set_style_bg_color(Scr, lv_color_hex(0x202020), 0);
+    lv_obj_t *g = Panel(Scr, 10, 10, 220, 100, 0x808080, LV_OPA_COVER, 16);
+    lv_obj_set_style_opa(g, LV_OPA_70, 0);
+    Panel(g, 10, 10, 90, 80, 0xE03030, LV_OPA_COVER, 8);
+    Panel(g, 60, 30, 140, 60, 0x3030E0, LV_OPA_80, 8);
+    lv_obj_t *l = lv_label_create(g);
+    lv_label_set_text(l, "Layer");
+    lv_obj_align(l, LV_ALIGN_TOP_RIGHT, -10, 6);
+    lv_obj_t *k = lv_keyboard_create(Scr);
+    lv_obj_set_size(k, W, 120);
+    lv_obj_t *i = lv_img_create(Scr);
+    lv_img_set_src(i, &Img);
+    lv_obj_set_pos(i, 120, 40);
+    lv_img_set_zoom(i, 128);
+    lv_img_set_angle(i, 300);
+    lv_obj_set_style_border_width(i, 2, 0);
+    lv_obj_set_style_border_color(i, lv_color_hex(0xFFFF00), 0);
+}
+
+static void Render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static void Probe_Start(uint8_t Worker, void (*Job)(void *Arg), void *Arg)
+{
+    Probe_Job[Worker].Job = Job;
+    Probe_Job[Worker].Arg = Arg;
+    Probe_Queued++;
+    Probe_Mark = LVGL_Bench_Now_us();
+}
+
+static void Probe_Wait(void)
+{
+    double t0 = LVGL_Bench_Now_us();
+    double longest = t0 - Probe_Mark;
+    UBYTE i;
+
+    Probe_Sum_us += longest;
+    for(i = 0; i < Probe_Queued; i++) {
+        DEV_Sem_Give(Probe_Work);
+        DEV_Sem_Take(Probe_Done);
+        Probe_Handoff_us -= Probe_Stripe_us;
+        Probe_Sum_us += Probe_Stripe_us;
+        if(Probe_Stripe_us > longest)
+            longest = Probe_Stripe_us;
+    }
+    Probe_Handoff_us += LVGL_Bench_Now_us() - t0;
+    if(Probe_Locked_us > longest)
+        longest = Probe_Locked_us;
+    Probe_Path_us += longest;
+    Probe_Locked_us = 0;
+    Probe_Queued = 0;
+}
+
+// Nothing else draws while a stripe is timed, only the time under the
+// locks is summed: the stripes would wait for each other there
+static void Probe_Lock(lv_refr_stripes_lock_t Lock)
+{
+    (void)Lock;
+    if(Probe_Lock_Depth++ == 0)
+        Probe_Lock_t0 = LVGL_Bench_Now_us();
+}
+
+static void Probe_Unlock(lv_refr_stripes_lock_t Lock)
+{
+    (void)Lock;
+    if(--Probe_Lock_Depth == 0)
+        Probe_Locked_us += LVGL_Bench_Now_us() - Probe_Lock_t0;
+}
+
+static void Probe_Thread(void *Arg)
+{
+    UBYTE i = 0;
+    (void)Arg;
+    for(;;) {
+        double t0;
+
+        DEV_Sem_Take(Probe_Work);
+        t0 = LVGL_Bench_Now_us();
+        Probe_Job[i].Job(Probe_Job[i].Arg);
+        Probe_Stripe_us = LVGL_Bench_Now_us() - t0;
+        i = (i + 1) % Probe_Queued;
+        DEV_Sem_Give(Probe_Done);
+    }
+}
+
+// Time per frame with a core for every stripe and free handoffs
+static double Probe_Frame_us(UBYTE Workers, UWORD Min_Rows, int Frames)
+{
+    double t0, us;
+    int i;
+
+    Probe.workers = Workers;
+    Probe.min_rows = Min_Rows;
+    lv_refr_set_stripes(&Probe);
+    Probe_Sum_us = Probe_Path_us = Probe_Handoff_us = 0;
+    t0 = LVGL_Bench_Now_us();
+    for(i = 0; i < Frames; i++)
+        Render();
+    us = LVGL_Bench_Now_us() - t0;
+    lv_refr_set_stripes(NULL);
+    return (us - Probe_Sum_us + Probe_Path_us - Probe_Handoff_us) / Frames;
+}
+
+static void (*const Screens[])(lv_obj_t *Scr) = {Screen_Panels, Screen_Images, Screen_Round, Screen_Layers};
+static const char *Screen_Names[] = {"panels", "images", "round", "layers"};
+
+int main(int argc, char **argv)
+{
+    int frames = 200;
+    UWORD min_rows = RENDER_WORKER_MIN_ROWS;
+    int fail = 0;
+    int i, s, w;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+            min_rows = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n frames] [-r min_rows]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    LVGL_Bench_Init();
+
+    for(i = 0; i < IMG_W * IMG_H; i++)
+        Img_Px[i] = lv_color_make((i % IMG_W) * 255 / IMG_W, (i / IMG_W) * 255 / IMG_H, (i * 7) & 0xFF);
+    Img.header.cf = LV_IMG_CF_TRUE_COLOR;
+    Img.header.w = IMG_W;
+    Img.header.h = IMG_H;
+    Img.data_size = sizeof(Img_Px);
+    Img.data = (const uint8_t *)Img_Px;
+
+    if(Render_Worker_Init(RENDER_WORKER_MAX, 0, min_rows)) {
+        printf("Render_Worker_Init failed\n");
+        return 1;
+    }
+
+    Probe_Work = DEV_Sem_Create(0);
+    Probe_Done = DEV_Sem_Create(0);
+    if(Probe_Work == NULL || Probe_Done == NULL || DEV_Thread_Create(Probe_Thread, NULL, 0)) {
+        printf("Probe thread failed\n");
+        return 1;
+    }
+    Probe.start_cb = Probe_Start;
+    Probe.wait_cb = Probe_Wait;
+    Probe.lock_cb = Probe_Lock;
+    Probe.unlock_cb = Probe_Unlock;
+
+    printf("%d frames per run, stripes of %u rows and up\n", frames, (unsigned)min_rows);
+    printf("%-8s %7s %9s %7s %7s %7s %7s %7s %7s  %s\n", "screen", "workers", "us/frame", "speedup",
+           "cores", "handoff", "split", "whole", "stripes", "check");
+    for(s = 0; s < (int)(sizeof(Screens) / sizeof(Screens[0])); s++) {
+        lv_obj_t *scr = lv_obj_create(NULL);
+        uint32_t ref = 0;
+        double base = 0;
+
+        Screens[s](scr);
+        lv_scr_load(scr);
+
+        for(w = 0; w <= RENDER_WORKER_MAX; w++) {
+            RENDER_WORKER_STATS st;
+            double t0, us, cores_us, handoff_us = 0;
+            int bad = 0;
+
+            Render_Worker_Enable(w);
+            Render();
+            if(w == 0)
+                ref = LVGL_Bench_Frame_Hash();
+
+            // Every frame of a checked run, a race would show in a few only
+            for(i = 0; i < frames; i++) {
+                Render();
+                if(LVGL_Bench_Frame_Hash() != ref)
+                    bad = 1;
+            }
+
+            Render_Worker_ResetStats();
+            t0 = LVGL_Bench_Now_us();
+            for(i = 0; i < frames; i++)
+                Render();
+            us = (LVGL_Bench_Now_us() - t0) / frames;
+            Render_Worker_GetStats(&st);
+            if(w == 0)
+                base = us;
+
+            if(w) {
+                Render_Worker_Enable(0);
+                cores_us = Probe_Frame_us(w, min_rows, frames);
+                if(LVGL_Bench_Frame_Hash() != ref)
+                    bad = 1;
+                if(st.Stripes)
+                    handoff_us = Probe_Handoff_us / st.Stripes;
+            }
+            else {
+                cores_us = us;
+            }
+
+            printf("%-8s %7d %9.1f %6.2fx %6.2fx %7.1f %7lu %7lu %7lu  %s\n", Screen_Names[s], w, us, base / us,
+                   base / cores_us, handoff_us, (unsigned long)st.Split / frames, (unsigned long)st.Whole / frames,
+                   (unsigned long)st.Stripes / frames, bad ? "FAIL" : "ok");
+            fail |= bad;
+        }
+    }
+
+    return fail;
+}
@@ -0,0 +1,345 @@
+/*****************************************************************************
+* | File      	:   screen_bench.cpp
+* | Function    :   Host check and benchmark of the screen manager
+* | Info        :
+*                Builds the SquareLine screens of the sketch and replays a
+*                session of gestures from Screen1 and back, with the same
+*                screen changes as ui_event_Screen1 and the other screens.
+*                Between two gestures the UI is idle for a few frames. Runs
+*                once as SquareLine does without the manager (Screen1 to 3
+*                built by ui_init(), the rest on first use by
+*                _ui_screen_change(), nothing ever deleted), then through
+*                UI_Screens with the budget of the sketch, with a budget
+*                that fits two screens besides Screen1 and with none. The
+*                managed runs send each gesture to the shown screen as the
+*                touch input does, so the manager's gesture callback must
+*                take it. Every screen change must show the same frame in
+*                all runs.
+*
+*                usage: screen_bench [-n gestures] [-b budget]
+*                  -n  gestures from Screen1 (default 500)
+*                  -b  budget of the second run in bytes (default 20480)
+*
+*                Exits with 1 if a frame differs or a gesture is not taken.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "UI_Screens.h"
+#include "ui.h"
+#include "LVGL_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_MS    16
+#define IDLE_FRAMES 8
+
+static lv_indev_drv_t Indev_Drv;
+static lv_indev_t *Indev;
+static uint32_t Sim_Ms;
+static double Idle_Us;
+
+// The sketch functions the screens call
+extern "C" {
+int stepCount = 0;
+void executeOfflineSign(void) {}
+void executeSignAndExecute(void) {}
+void resetStepCounter(void) {}
+void reconnectWiFiWithCredentials(const char *ssid, const char *password)
+{
+    (void)ssid;
+    (void)password;
+}
+
+uint32_t millis(void)
+{
+    return Sim_Ms;
+}
+}
+
+static uint32_t Heap_Used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+// Screen1's gestures and how often each is taken, and the way back,
+// as the SquareLine handlers change screens
+typedef struct {
+    lv_obj_t **Obj;
+    void (*Init)(void);
+    lv_dir_t Dir;
+    lv_scr_load_anim_t Anim;
+    lv_dir_t Back_Dir;
+    lv_scr_load_anim_t Back;
+    uint32_t Back_Time;
+    int Weight;
+} GESTURE;
+
+static const GESTURE Gestures[] = {
+    {&ui_Screen5, ui_Screen5_screen_init, LV_DIR_LEFT, LV_SCR_LOAD_ANIM_MOVE_LEFT,
+     LV_DIR_RIGHT, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 100, 40},
+    {&ui_Screen3, ui_Screen3_screen_init, LV_DIR_TOP, LV_SCR_LOAD_ANIM_MOVE_TOP,
+     LV_DIR_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 150, 30},
+    {&ui_Screen2, ui_Screen2_screen_init, LV_DIR_RIGHT, LV_SCR_LOAD_ANIM_MOVE_RIGHT,
+     LV_DIR_LEFT, LV_SCR_LOAD_ANIM_MOVE_LEFT, 100, 20},
+    {&ui_Screen4, ui_Screen4_screen_init, LV_DIR_BOTTOM, LV_SCR_LOAD_ANIM_MOVE_BOTTOM,
+     LV_DIR_TOP, LV_SCR_LOAD_ANIM_MOVE_TOP, 100, 10},
+};
+#define GESTURES    (int)(sizeof(Gestures) / sizeof(Gestures[0]))
+
+// Registered as setup() does
+static void Screens_Add(uint32_t Budget)
+{
+    int i;
+
+    UI_Screens_Init(Budget);
+    UI_Screens_Add(&ui_Screen1, ui_Screen1_screen_init, ui_Screen1_screen_destroy, "Screen1", 1);
+    UI_Screens_Add(&ui_Screen2, ui_Screen2_screen_init, ui_Screen2_screen_destroy, "Screen2", 0);
+    UI_Screens_Add(&ui_Screen3, ui_Screen3_screen_init, ui_Screen3_screen_destroy, "Screen3", 0);
+    UI_Screens_Add(&ui_Screen4, ui_Screen4_screen_init, ui_Screen4_screen_destroy, "Screen4", 0);
+    UI_Screens_Add(&ui_Screen5, ui_Screen5_screen_init, ui_Screen5_screen_destroy, "Screen5", 0);
+    for(i = 0; i < GESTURES; i++)
+        UI_Screens_Link(&ui_Screen1, Gestures[i].Obj, Gestures[i].Dir, Gestures[i].Anim, 100);
+    for(i = 0; i < GESTURES; i++)
+        UI_Screens_Link(Gestures[i].Obj, &ui_Screen1, Gestures[i].Back_Dir, Gestures[i].Back, Gestures[i].Back_Time);
+}
+
+// Never pressed; only carries the gestures sent below
+static void Bench_Read(lv_indev_drv_t *Drv, lv_indev_data_t *Data)
+{
+    (void)Drv;
+    Data->state = LV_INDEV_STATE_RELEASED;
+}
+
+/******************************************************************************
+function:	Change screens
+parameter:
+    Mode : 0 calls _ui_screen_change() as the SquareLine handler would,
+           1 sends the gesture to the shown screen
+return:
+    1 if the gesture did not load To
+******************************************************************************/
+static int Change(int Mode, lv_obj_t **To, void (*Init)(void), lv_dir_t Dir, lv_scr_load_anim_t Anim, uint32_t Time)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+
+    if(!Mode) {
+        _ui_screen_change(To, Anim, Time, 0, Init);
+        return 0;
+    }
+    Indev->proc.types.pointer.gesture_dir = Dir;
+    lv_event_send(lv_scr_act(), LV_EVENT_GESTURE, Indev);
+    return *To == NULL || (disp->scr_to_load != *To && lv_scr_act() != *To);
+}
+
+// Frames until the screen load animation is over, then its frame
+static uint32_t Settle(void)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    do {
+        Sim_Ms += FRAME_MS;
+        lv_timer_handler();
+    } while(disp->prev_scr || lv_anim_count_running());
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    return LVGL_Bench_Frame_Hash();
+}
+
+static void Idle(int Managed)
+{
+    int i;
+    for(i = 0; i < IDLE_FRAMES; i++) {
+        Sim_Ms += FRAME_MS;
+        lv_timer_handler();
+        if(Managed) {
+            double t0 = LVGL_Bench_Now_us();
+            UI_Screens_Idle();
+            Idle_Us += LVGL_Bench_Now_us() - t0;
+        }
+    }
+}
+
+typedef struct {
+    double Wait_us;         // in the gesture handlers, building screens
+    double Max_us;          // longest gesture
+    double Idle_us;         // in UI_Screens_Idle()
+    uint32_t Peak_Bytes;    // LVGL heap in use, most
+    UI_SCREENS_STATS Stats;
+} SCREEN_RESULT;
+
+/******************************************************************************
+function:	Replay a session of gestures
+parameter:
+    Gestures_n : gestures from Screen1, each followed by the way back
+    Mode       : 0 SquareLine without the manager, 1 through UI_Screens
+    Budget     : UI_Screens budget
+    Hashes     : frame after each change, written by mode 0, checked by 1
+    Res        : time waited, heap and manager statistics
+return:
+    number of frames that differed
+******************************************************************************/
+static int Run(int Gestures_n, int Mode, uint32_t Budget, uint32_t *Hashes, SCREEN_RESULT *Res)
+{
+    uint32_t seed = 12345;
+    int bad = 0;
+    int n, i;
+
+    memset(Res, 0, sizeof(SCREEN_RESULT));
+    Idle_Us = 0;
+    if(Mode)
+        Screens_Add(Budget);
+    else
+        UI_Screens_Init(0);
+    Sim_Ms = 1;
+    if(Mode)
+        UI_Screens_Start(ui_init);
+    else
+        ui_init();
+    Settle();
+
+    for(n = 0; n < Gestures_n; n++) {
+        double t0, us;
+        int pick, w;
+
+        Idle(Mode);
+
+        seed = seed * 1103515245u + 12345u;
+        pick = (seed >> 16) % 100;
+        for(i = 0, w = 0; i < GESTURES - 1; i++) {
+            w += Gestures[i].Weight;
+            if(pick < w)
+                break;
+        }
+        const GESTURE *g = &Gestures[i];
+
+        t0 = LVGL_Bench_Now_us();
+        if(Change(Mode, g->Obj, g->Init, g->Dir, g->Anim, 100)) {
+            if(!bad)
+                printf("  gesture %d not taken\n", n);
+            bad++;
+        }
+        us = LVGL_Bench_Now_us() - t0;
+        Res->Wait_us += us;
+        if(us > Res->Max_us)
+            Res->Max_us = us;
+        if(Heap_Used() > Res->Peak_Bytes)
+            Res->Peak_Bytes = Heap_Used();
+        uint32_t h = Settle();
+        if(!Mode)
+            Hashes[2 * n] = h;
+        else if(Hashes[2 * n] != h) {
+            if(!bad)
+                printf("  gesture %d differs\n", n);
+            bad++;
+        }
+
+        Idle(Mode);
+        t0 = LVGL_Bench_Now_us();
+        if(Change(Mode, &ui_Screen1, ui_Screen1_screen_init, g->Back_Dir, g->Back, g->Back_Time)) {
+            if(!bad)
+                printf("  way back %d not taken\n", n);
+            bad++;
+        }
+        Res->Wait_us += LVGL_Bench_Now_us() - t0;
+        h = Settle();
+        if(!Mode)
+            Hashes[2 * n + 1] = h;
+        else if(Hashes[2 * n + 1] != h) {
+            if(!bad)
+                printf("  way back %d differs\n", n);
+            bad++;
+        }
+    }
+    UI_Screens_GetStats(&Res->Stats);
+    Res->Idle_us = Idle_Us;
+
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_scr_load(blank);
+    ui_Screen1_screen_destroy();
+    ui_Screen2_screen_destroy();
+    ui_Screen3_screen_destroy();
+    ui_Screen4_screen_destroy();
+    ui_Screen5_screen_destroy();
+    lv_obj_del(ui____initial_actions0);
+    return bad;
+}
+
+static void Print(const char *Name, uint32_t Budget, const SCREEN_RESULT *Res, int Gestures_n, const char *Check)
+{
+    const UI_SCREENS_STATS *s = &Res->Stats;
+    printf("%-10s %7lu %7.1f %7.1f %7lu %7lu %7lu %7lu %7lu  %s\n", Name, (unsigned long)Budget,
+           Res->Wait_us / Gestures_n, Res->Max_us, (unsigned long)s->Builds, (unsigned long)s->Preloads,
+           (unsigned long)s->Evictions, (unsigned long)s->Resident_Bytes, (unsigned long)Res->Peak_Bytes, Check);
+}
+
+int main(int argc, char **argv)
+{
+    int gestures = 500;
+    uint32_t budget = 20 * 1024;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            gestures = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-b") && i + 1 < argc)
+            budget = (uint32_t)atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n gestures] [-b budget]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(gestures < 1)
+        gestures = 1;
+
+    LVGL_Bench_Init();
+    lv_indev_drv_init(&Indev_Drv);
+    Indev_Drv.type = LV_INDEV_TYPE_POINTER;
+    Indev_Drv.read_cb = Bench_Read;
+    Indev = lv_indev_drv_register(&Indev_Drv);
+
+    uint32_t *hashes = (uint32_t *)malloc(2 * gestures * sizeof(uint32_t));
+    SCREEN_RESULT plain, managed, tight, none;
+    int bad_managed, bad_tight, bad_none;
+
+    Run(gestures, 0, 0, hashes, &plain);
+    bad_managed = Run(gestures, 1, budget, hashes, &managed);
+
+    // Footprints measured by the managed run: Screen1 and the two biggest others
+    uint32_t bytes[UI_SCREENS_MAX];
+    uint32_t tight_budget = 0;
+    const UI_SCREEN *scr;
+    int n = 0;
+    printf("%-8s %7s %9s\n", "screen", "bytes", "build us");
+    while((scr = UI_Screens_Get(n)) != NULL) {
+        printf("%-8s %7lu %9lu\n", scr->Name, (unsigned long)scr->Bytes, (unsigned long)scr->Build_us);
+        bytes[n++] = scr->Bytes;
+    }
+    tight_budget = bytes[0];
+    for(i = 0; i < 2; i++) {
+        int j, big = 1;
+        for(j = 2; j < n; j++) {
+            if(bytes[j] > bytes[big])
+                big = j;
+        }
+        tight_budget += bytes[big];
+        bytes[big] = 0;
+    }
+
+    bad_tight = Run(gestures, 1, tight_budget, hashes, &tight);
+    bad_none = Run(gestures, 1, 0, hashes, &none);
+    free(hashes);
+
+    printf("\n%d gestures from Screen1 and back\n", gestures);
+    printf("%-10s %7s %7s %7s %7s %7s %7s %7s %7s  %s\n", "run", "budget", "us wait", "us max", "builds",
+           "preload", "evicted", "B kept", "B peak", "check");
+    Print("squareline", 0, &plain, gestures, "");
+    Print("managed", budget, &managed, gestures, bad_managed ? "FAIL" : "ok");
+    Print("tight", tight_budget, &tight, gestures, bad_tight ? "FAIL" : "ok");
+    Print("none", 0, &none, gestures, bad_none ? "FAIL" : "ok");
+    printf("managed: %lu changes found the screen built, %.1f us idle per gesture\n",
+           (unsigned long)managed.Stats.Hits, managed.Idle_us / gestures);
+
+    return bad_managed || bad_tight || bad_none;
+}
@@ -0,0 +1,327 @@
+/*****************************************************************************
+* | File      	:   step_bench.cpp
+* | Function    :   Accuracy and speed of the step counter
+* | Info        :
+*                Synthesizes wrist accelerometer recordings with a known
+*                number of steps: walks at several cadences and
+*                strengths, a walk with stops, and recordings without a
+*                step (at rest, tilting the arm, random taps and bumps).
+*                Each step is a vertical acceleration cycle with a
+*                harmonic, sideways sway, cadence jitter and sensor noise,
+*                on gravity in a tilted orientation, as raw 8 g samples.
+*                Step_Counter takes them in 32 sample FIFO blocks at 20,
+*                62.5 and 100 Hz; the float detector loop() used before
+*                takes every third sample of 62.5 Hz (~20 Hz, as it was
+*                tuned for) and every sample of 62.5 Hz. Then both run over
+*                the same samples in a tight loop for their ns per sample.
+*
+*                usage: step_bench [-s seconds] [-r repeats]
+*                  -s  length of each recording (default 120)
+*                  -r  passes over the recordings for the timing (default 20)
+*
+*                Exits with 1 when Step_Counter is off by more than 3% (and
+*                2 steps) on a walk, or counts more than 3 steps on a
+*                recording without steps.
+******************************************************************************/
+#include "Step_Counter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <vector>
+
+#define LSB_PER_G       4096        // QMI8658 at 8 g, as IMU_FIFO_RANGE
+#define BLOCK           32          // IMU_FIFO_WATERMARK
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static double Now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * Recordings
+ **/
+static uint32_t Rng = 12345;
+
+static double Uniform(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 17;
+    Rng ^= Rng << 5;
+    return (Rng >> 8) / 16777216.0;
+}
+
+static double Gauss(void)
+{
+    double u = Uniform() + 1e-12, v = Uniform();
+    return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+typedef enum {
+    KIND_WALK,      // steps all the way
+    KIND_STOPS,     // walk 20 s, stand 10 s
+    KIND_REST,      // noise only
+    KIND_TILT,      // slow arm rotation
+    KIND_TAPS,      // single bumps at random times, 1.5 s apart on average
+} KIND;
+
+typedef struct {
+    const char *Name;
+    KIND Kind;
+    double Cadence;     // steps per second
+    double Amp;         // vertical acceleration of a step, g
+} RECORDING;
+
+static const RECORDING Recordings[] = {
+    {"walk 1.8 Hz 0.25 g", KIND_WALK, 1.8, 0.25},
+    {"slow 1.2 Hz 0.12 g", KIND_WALK, 1.2, 0.12},
+    {"brisk 2.2 Hz 0.40 g", KIND_WALK, 2.2, 0.40},
+    {"run 2.9 Hz 0.90 g", KIND_WALK, 2.9, 0.90},
+    {"walk with stops", KIND_STOPS, 1.8, 0.25},
+    {"at rest", KIND_REST, 0, 0},
+    {"tilting the arm", KIND_TILT, 0, 0},
+    {"taps and bumps", KIND_TAPS, 0, 0.6},
+};
+#define RECORDINGS  (int)(sizeof(Recordings) / sizeof(Recordings[0]))
+
+typedef struct {
+    std::vector<int16_t> Acc;   // x, y, z
+    uint32_t Steps;
+} SAMPLES;
+
+static int16_t Raw(double G)
+{
+    double v = G * LSB_PER_G;
+    if(v > 32767) v = 32767;
+    if(v < -32768) v = -32768;
+    return (int16_t)lrint(v);
+}
+
+// The motion sampled at Rate
+static void Synthesize(const RECORDING *R, double Seconds, double Rate, uint32_t Seed, SAMPLES *S)
+{
+    double phase = 0, period = R->Cadence > 0 ? 1 / R->Cadence : 1, next_tap = 1;
+    double tap_left = 0, tap_amp = 0;
+    uint32_t n = (uint32_t)(Seconds * Rate);
+
+    Rng = Seed;
+    // Watch on the wrist: gravity mostly along z, tilted
+    double tilt = 0.3 + 0.4 * Uniform(), turn = 2 * M_PI * Uniform();
+
+    S->Acc.resize(n * 3);
+    S->Steps = 0;
+    for(uint32_t i = 0; i < n; i++) {
+        double t = i / Rate, a_v = 0, a_s = 0;
+        int moving = R->Kind == KIND_WALK || (R->Kind == KIND_STOPS && fmod(t, 30) < 20);
+
+        if(moving) {
+            double last = phase;
+            phase += 1 / (Rate * period);
+            if(phase >= 1) {
+                // A new step, each a little longer or shorter
+                phase -= 1;
+                last -= 1;
+                period = (1 + 0.06 * Gauss()) / R->Cadence;
+            }
+            // A step is counted at its peak, a walk may stop after it
+            if(last < 0.25 && phase >= 0.25)
+                S->Steps++;
+            a_v = R->Amp * (sin(2 * M_PI * phase) + 0.3 * sin(4 * M_PI * phase + 1));
+            a_s = 0.3 * R->Amp * sin(M_PI * phase + (S->Steps & 1) * M_PI);
+        } else {
+            phase = 0;
+        }
+        if(R->Kind == KIND_TILT)
+            tilt = 0.6 + 0.5 * sin(2 * M_PI * 0.2 * t) + 0.2 * sin(2 * M_PI * 0.07 * t);
+        if(R->Kind == KIND_TAPS) {
+            if(t >= next_tap) {
+                tap_left = 0.08;
+                tap_amp = R->Amp * (0.5 + Uniform());
+                // At random: intervals with an exponential distribution
+                next_tap = t + 0.2 - 1.5 * log(Uniform() + 1e-12);
+            }
+            if(tap_left > 0) {
+                a_v = tap_amp * sin(M_PI * tap_left / 0.08);
+                tap_left -= 1 / Rate;
+            }
+        }
+
+        // Gravity plus the step along it, the sway across it
+        double ux = sin(tilt) * cos(turn), uy = sin(tilt) * sin(turn), uz = cos(tilt);
+        double vx = -sin(turn), vy = cos(turn);
+        double g = 1 + a_v;
+        S->Acc[i * 3 + 0] = Raw(g * ux + a_s * vx + 0.003 * Gauss());
+        S->Acc[i * 3 + 1] = Raw(g * uy + a_s * vy + 0.003 * Gauss());
+        S->Acc[i * 3 + 2] = Raw(g * uz + 0.003 * Gauss());
+    }
+}
+
+/**
+ * The float detector loop() ran before, on mg and millis()
+ **/
+typedef struct {
+    float Last_Mag;
+    int Detected;
+    unsigned long Last_Step;
+    uint32_t Steps;
+} FLOAT_DETECTOR;
+
+static void Float_Step(FLOAT_DETECTOR *D, const float Acc[3], unsigned long Ms)
+{
+    const unsigned long cooldown = 300;
+    const float threshold = 0.8;
+    float mag = sqrtf(Acc[0] * Acc[0] + Acc[1] * Acc[1] + Acc[2] * Acc[2]);
+    float change = mag - D->Last_Mag;
+
+    if(change > threshold && !D->Detected) {
+        if(Ms - D->Last_Step > cooldown) {
+            D->Detected = 1;
+            D->Steps++;
+            D->Last_Step = Ms;
+        }
+    }
+    if(fabsf(change) < threshold * 0.3f)
+        D->Detected = 0;
+    D->Last_Mag = mag;
+}
+
+static uint32_t Float_Run(const SAMPLES *S, double Rate, int Every)
+{
+    FLOAT_DETECTOR d;
+    uint32_t n = S->Acc.size() / 3;
+
+    memset(&d, 0, sizeof(d));
+    for(uint32_t i = 0; i < n; i += Every) {
+        float acc[3];
+        for(int a = 0; a < 3; a++)
+            acc[a] = S->Acc[i * 3 + a] * 1000.0f / LSB_PER_G;
+        Float_Step(&d, acc, (unsigned long)(i * 1000.0 / Rate));
+    }
+    return d.Steps;
+}
+
+static uint32_t Engine_Run(const SAMPLES *S, double Rate, STEP_COUNTER *Sc)
+{
+    const int16_t (*acc)[3] = (const int16_t (*)[3])S->Acc.data();
+    uint32_t n = S->Acc.size() / 3, steps = 0;
+
+    Step_Counter_Init(Sc, (uint32_t)lrint(Rate * 1000), LSB_PER_G);
+    for(uint32_t i = 0; i < n; i += BLOCK)
+        steps += Step_Counter_Process(Sc, acc + i, n - i < BLOCK ? n - i : BLOCK);
+    return steps;
+}
+
+/**
+ * Accuracy
+ **/
+static const double Rates[] = {20, 62.5, 100};
+#define RATES       3
+
+static int Accuracy(double Seconds)
+{
+    int errors = 0;
+
+    printf("%-22s %6s %8s %8s %8s %10s %8s\n", "recording", "steps", "20 Hz", "62.5 Hz", "100 Hz",
+           "float 21Hz", "62.5 Hz");
+    for(int r = 0; r < RECORDINGS; r++) {
+        const RECORDING *rec = &Recordings[r];
+        uint32_t counted[RATES], truth = 0, f20 = 0, f62 = 0;
+        STEP_COUNTER sc;
+
+        for(int k = 0; k < RATES; k++) {
+            SAMPLES s;
+            Synthesize(rec, Seconds, Rates[k], 1000 + r, &s);
+            counted[k] = Engine_Run(&s, Rates[k], &sc);
+            if(Rates[k] == 62.5) {
+                truth = s.Steps;
+                f20 = Float_Run(&s, Rates[k], 3);
+                f62 = Float_Run(&s, Rates[k], 1);
+            }
+            if(counted[k] != sc.Steps) {
+                printf("%s: %u steps returned, %u in the counter\n", rec->Name, counted[k], sc.Steps);
+                errors++;
+            }
+        }
+        printf("%-22s %6u %8u %8u %8u %10u %8u\n", rec->Name, truth, counted[0], counted[1], counted[2], f20, f62);
+
+        for(int k = 0; k < RATES; k++) {
+            uint32_t off = counted[k] > truth ? counted[k] - truth : truth - counted[k];
+            if(truth ? off > 2 + truth * 3 / 100 : off > 3) {
+                printf("%s at %.1f Hz: %u steps counted of %u\n", rec->Name, Rates[k], counted[k], truth);
+                errors++;
+            }
+        }
+    }
+    return errors != 0;
+}
+
+/**
+ * Speed
+ **/
+static void Speed(double Seconds, int Repeats)
+{
+    std::vector<SAMPLES> all(RECORDINGS);
+    uint64_t samples = 0;
+    volatile uint32_t sink = 0;
+    double t0, engine_ns, float_ns;
+    STEP_COUNTER sc;
+
+    for(int r = 0; r < RECORDINGS; r++) {
+        Synthesize(&Recordings[r], Seconds, 62.5, 1000 + r, &all[r]);
+        samples += all[r].Acc.size() / 3;
+    }
+    samples *= Repeats;
+
+    t0 = Now_ns();
+    for(int p = 0; p < Repeats; p++)
+        for(int r = 0; r < RECORDINGS; r++)
+            sink += Engine_Run(&all[r], 62.5, &sc);
+    engine_ns = (Now_ns() - t0) / samples;
+
+    t0 = Now_ns();
+    for(int p = 0; p < Repeats; p++)
+        for(int r = 0; r < RECORDINGS; r++)
+            sink += Float_Run(&all[r], 62.5, 1);
+    float_ns = (Now_ns() - t0) / samples;
+
+    (void)sink;
+    printf("speed: Step_Counter %.1f ns/sample, float detector %.1f ns/sample (%.1fx), %llu samples\n",
+           engine_ns, float_ns, float_ns / engine_ns, (unsigned long long)samples);
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 120;
+    int repeats = 20;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-s") && i + 1 < argc)
+            seconds = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+            repeats = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-s seconds] [-r repeats]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(seconds < 10)
+        seconds = 10;
+    if(repeats < 1)
+        repeats = 1;
+
+    int err = Accuracy(seconds);
+    Speed(seconds, repeats);
+    return err;
+}
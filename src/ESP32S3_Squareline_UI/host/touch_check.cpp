@@ -0,0 +1,582 @@
+/*****************************************************************************
+* | File      	:   touch_check.cpp
+* | Function    :   Host check of the touch ring and the touch reader
+* | Info        :
+*                First the ring alone: empty, full (the extra sample is
+*                dropped and counted, the others stay), and wrapping its
+*                counters. Then one thread pushes numbered samples as fast
+*                as it can while this one pops them, which must see every
+*                number once and in order.
+*
+*                Then Touch_Reader with a fake controller: recorded touch
+*                streams (a swipe, a tap, a hold that never reports the
+*                lift and a drag with failed reads) are fired as interrupts
+*                from a thread of their own, each read busy-waits like a 6
+*                byte I2C read at 400 kHz, and this thread takes the
+*                samples the way LVGL's read timer does. Every sample read
+*                must arrive once and in order, a failed read must count
+*                as an error and never arrive, the finger must be lifted by
+*                the up event or after the release time, and nothing may
+*                be dropped.
+*
+*                Last the gestures: swipes, a short flick, a tap and a long
+*                press, with the controller's gesture ID in the middle, at
+*                the release or missing, go through Touch_Reader into an
+*                LVGL input device with each gesture_src. The screen must
+*                get the gesture (and when: while pressed or at the
+*                release) and long press each source is expected to give.
+*
+*                usage: touch_check [-n samples] [-p period_ms]
+*                  -n  samples of the two thread ring test (default 1000000)
+*                  -p  period of the simulated read timer (default 5)
+*
+*                Exits with 1 on the first error.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "Touch_Reader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <time.h>
+
+#define READ_US         200     // 6 bytes with address and register at 400 kHz
+#define IRQ_GAP_US      500     // the controller reports faster than LVGL reads
+#define RELEASE_MS      30
+#define STREAM_MAX      64
+
+extern "C" uint32_t millis(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static double Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void Sleep_us(long Us)
+{
+    struct timespec ts = {Us / 1000000, (Us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * The ring alone
+ **/
+static TOUCH_RING Ring;
+
+static TOUCH_SAMPLE Numbered(UDOUBLE N)
+{
+    TOUCH_SAMPLE s;
+    memset(&s, 0, sizeof(s));
+    s.X = (UWORD)N;
+    s.Y = (UWORD)(N >> 16);
+    s.Us = N;
+    return s;
+}
+
+static int Ring_Check(void)
+{
+    TOUCH_SAMPLE s = Numbered(0);
+    UDOUBLE i;
+
+    Touch_Ring_Init(&Ring);
+    if(Touch_Ring_Pop(&Ring, &s) == 0 || Touch_Ring_Count(&Ring) != 0) {
+        printf("ring: empty ring gave a sample\n");
+        return 1;
+    }
+    for(i = 0; i < TOUCH_RING_SIZE; i++) {
+        s = Numbered(i);
+        if(Touch_Ring_Push(&Ring, &s)) {
+            printf("ring: full after %lu samples\n", (unsigned long)i);
+            return 1;
+        }
+    }
+    s = Numbered(999);
+    if(Touch_Ring_Push(&Ring, &s) == 0 || Ring.Index.Dropped != 1) {
+        printf("ring: push to a full ring not dropped\n");
+        return 1;
+    }
+    for(i = 0; i < TOUCH_RING_SIZE; i++) {
+        if(Touch_Ring_Pop(&Ring, &s) || s.Us != i) {
+            printf("ring: sample %lu came out as %lu\n", (unsigned long)i, (unsigned long)s.Us);
+            return 1;
+        }
+    }
+
+    // Counters just below 2^32, the next pushes wrap them
+    Touch_Ring_Init(&Ring);
+    Ring.Index.Head = Ring.Index.Tail = 0xFFFFFFFFu - 3;
+    for(i = 0; i < 10; i++) {
+        s = Numbered(i);
+        Touch_Ring_Push(&Ring, &s);
+    }
+    if(Touch_Ring_Count(&Ring) != 10) {
+        printf("ring: %lu samples after wrapping instead of 10\n", (unsigned long)Touch_Ring_Count(&Ring));
+        return 1;
+    }
+    for(i = 0; i < 10; i++) {
+        if(Touch_Ring_Pop(&Ring, &s) || s.Us != i) {
+            printf("ring: wrapped sample %lu came out as %lu\n", (unsigned long)i, (unsigned long)s.Us);
+            return 1;
+        }
+    }
+    printf("ring: empty, full and wrapped ok\n");
+    return 0;
+}
+
+static UDOUBLE Spsc_N;
+static UDOUBLE Spsc_Full;
+
+static void Spsc_Producer(void *Arg)
+{
+    DEV_Sem done = (DEV_Sem)Arg;
+    UDOUBLE i;
+
+    for(i = 0; i < Spsc_N; i++) {
+        TOUCH_SAMPLE s = Numbered(i);
+        while(Touch_Ring_Push(&Ring, &s)) {
+            Spsc_Full++;
+            sched_yield();      // the host may have one core only
+        }
+    }
+    DEV_Sem_Take(done);     // threads never return
+}
+
+static int Spsc_Check(UDOUBLE N)
+{
+    DEV_Sem done = DEV_Sem_Create(0);
+    TOUCH_SAMPLE s;
+    UDOUBLE next = 0;
+    double t0;
+
+    Touch_Ring_Init(&Ring);
+    Spsc_N = N;
+    t0 = Now_us();
+    if(done == NULL || DEV_Thread_Create(Spsc_Producer, done, 0)) {
+        printf("spsc: no thread\n");
+        return 1;
+    }
+    while(next < N) {
+        if(Touch_Ring_Pop(&Ring, &s)) {
+            sched_yield();
+            continue;
+        }
+        if(s.Us != next || s.X != (UWORD)next || s.Y != (UWORD)(next >> 16)) {
+            printf("spsc: sample %lu came out as %lu\n", (unsigned long)next, (unsigned long)s.Us);
+            return 1;
+        }
+        next++;
+    }
+    printf("spsc: %lu samples in order, %.1f ns each, producer found the ring full %lu times\n\n",
+           (unsigned long)N, (Now_us() - t0) * 1e3 / N, (unsigned long)Spsc_Full);
+    return 0;
+}
+
+/**
+ * The reader with a fake controller
+ **/
+typedef struct {
+    const char *Name;
+    TOUCH_SAMPLE S[STREAM_MAX];
+    UDOUBLE N;
+    UBYTE Lifts;            // ends with an up event
+    UBYTE Fail[STREAM_MAX]; // the controller's read of this report fails
+} STREAM;
+
+static const STREAM *Fake_Stream;
+static UDOUBLE Fake_Irqs;           // interrupts the next Fire gives
+static UDOUBLE Fake_Pos;            // next sample the controller reports
+static UDOUBLE Notified;
+static DEV_Sem Fire;
+
+// A finger from (X0, Y0) to (X1, Y1) in N reports, with an up event or not
+static void Record(STREAM *St, const char *Name, int X0, int Y0, int X1, int Y1, UDOUBLE N, UBYTE Gesture, UBYTE Lifts)
+{
+    UDOUBLE i;
+
+    memset(St, 0, sizeof(STREAM));
+    St->Name = Name;
+    St->N = N;
+    St->Lifts = Lifts;
+    for(i = 0; i < N; i++) {
+        TOUCH_SAMPLE *s = &St->S[i];
+        s->X = (UWORD)(X0 + (X1 - X0) * (int)i / (int)(N > 1 ? N - 1 : 1));
+        s->Y = (UWORD)(Y0 + (Y1 - Y0) * (int)i / (int)(N > 1 ? N - 1 : 1));
+        s->Points = 1;
+        s->Event = i == 0 ? 0 : 2;
+    }
+    if(Lifts) {
+        St->S[N - 1].Event = 1;
+        St->S[N - 1].Points = 0;
+        St->S[N - 1].Gesture = Gesture;
+    }
+}
+
+// Like touch_read_sample() of the sketch with the I2C time spent busy
+static UBYTE Fake_Read(TOUCH_SAMPLE *Sample)
+{
+    double t0 = Now_us();
+    UDOUBLE pos = Fake_Pos++;
+    const TOUCH_SAMPLE *s = &Fake_Stream->S[pos];
+
+    while(Now_us() - t0 < READ_US)
+        ;
+    if(Fake_Stream->Fail[pos]) {
+        // What an unchecked read used to hand on: a random point and gesture
+        Sample->X = Sample->Y = 0xFFFF;
+        Sample->Gesture = TOUCH_GESTURE_SWIPE_UP;
+        return 1;
+    }
+    Sample->X = s->X;
+    Sample->Y = s->Y;
+    Sample->Gesture = s->Gesture;
+    Sample->Points = s->Points;
+    Sample->Event = s->Event;
+    return 0;
+}
+
+static void Fake_Notify(void)
+{
+    __atomic_add_fetch(&Notified, 1, __ATOMIC_RELAXED);
+}
+
+// The touch interrupt: one per report of the stream
+static void Fake_Irq(void *Arg)
+{
+    (void)Arg;
+    for(;;) {
+        UDOUBLE i, n;
+        DEV_Sem_Take(Fire);
+        n = Fake_Irqs;      // the next stream may be set up during the last gap
+        for(i = 0; i < n; i++) {
+            Touch_Reader_Wake_ISR();
+            Sleep_us(IRQ_GAP_US);
+        }
+    }
+}
+
+static double Ui_Us;        // time LVGL's read callback took for the samples
+static UDOUBLE Ui_Samples;
+
+/******************************************************************************
+function:	Fire a stream and read it like LVGL's read timer
+parameter:
+    St     : the stream
+    Period : read timer period in ms
+return:
+    1 on an error
+******************************************************************************/
+static int Play(const STREAM *St, long Period)
+{
+    TOUCH_READER_STATS st;
+    lv_indev_data_t d;
+    UDOUBLE got = 0, reads = 0, next = 0, fails = 0, i;
+    double t0 = Now_us(), last_us = 0, released_us = 0;
+
+    for(i = 0; i < St->N; i++)
+        fails += St->Fail[i];
+    Fake_Stream = St;
+    Fake_Pos = 0;
+    Fake_Irqs = St->N;
+    Touch_Reader_ResetStats();
+    DEV_Sem_Give(Fire);
+
+    for(;;) {
+        Sleep_us(Period * 1000);
+        reads++;
+        do {
+            UDOUBLE before;
+            double c0 = Now_us();
+
+            memset(&d, 0, sizeof(d));
+            Touch_Reader_GetStats(&st);
+            before = st.Samples;
+            Touch_Reader_Read(NULL, &d);
+            Touch_Reader_GetStats(&st);
+            if(st.Samples == before)
+                break;
+
+            Ui_Us += Now_us() - c0;
+            Ui_Samples++;
+            while(next < St->N && St->Fail[next])
+                next++;
+            const TOUCH_SAMPLE *want = &St->S[next++];
+            if(next > St->N || d.point.x != want->X || d.point.y != want->Y ||
+               d.state != (want->Event == 1 ? LV_INDEV_STATE_REL : LV_INDEV_STATE_PR)) {
+                printf("%s: sample %lu is (%d, %d) %s\n", St->Name, (unsigned long)got,
+                       (int)d.point.x, (int)d.point.y, d.state == LV_INDEV_STATE_PR ? "pressed" : "released");
+                return 1;
+            }
+            got++;
+            last_us = Now_us();
+        } while(d.continue_reading);
+
+        if(got == St->N - fails && d.state == LV_INDEV_STATE_REL) {
+            released_us = Now_us();
+            break;
+        }
+        if(Now_us() - t0 > 2e6) {
+            printf("%s: %lu of %lu samples after 2 s, %s\n", St->Name, (unsigned long)got,
+                   (unsigned long)St->N, d.state == LV_INDEV_STATE_PR ? "pressed" : "released");
+            return 1;
+        }
+    }
+
+    Touch_Reader_GetStats(&st);
+    if(st.Dropped || st.Errors != fails || st.Reads != St->N - fails || st.Interrupts != St->N) {
+        printf("%s: %lu irqs, %lu reads, %lu dropped, %lu errors\n", St->Name, (unsigned long)st.Interrupts,
+               (unsigned long)st.Reads, (unsigned long)st.Dropped, (unsigned long)st.Errors);
+        return 1;
+    }
+
+    // Without the up event the finger is lifted after RELEASE_MS
+    double hold_ms = (released_us - last_us) / 1e3;
+    if(!St->Lifts && (hold_ms < RELEASE_MS || hold_ms > RELEASE_MS + 2 * Period + 10)) {
+        printf("%s: released %.1f ms after the last sample, not after %d ms\n", St->Name, hold_ms, RELEASE_MS);
+        return 1;
+    }
+    printf("%-6s %3lu samples in %3lu reads, latency %5lu us avg %5lu max, %s\n", St->Name,
+           (unsigned long)got, (unsigned long)reads, (unsigned long)(st.Latency_us / st.Samples),
+           (unsigned long)st.Max_Latency_us, St->Lifts ? "lifted by the up event" : "released by the timeout");
+    return 0;
+}
+
+static int Reader_Check(long Period)
+{
+    static STREAM swipe, tap, hold, errors;
+
+    Record(&swipe, "swipe", 200, 120, 40, 124, 40, 0x03, 1);
+    Record(&tap, "tap", 120, 120, 121, 120, 3, 0x05, 1);
+    Record(&hold, "hold", 60, 180, 62, 181, 20, 0x00, 0);
+    Record(&errors, "errors", 40, 60, 180, 70, 12, 0x00, 1);
+    errors.Fail[0] = errors.Fail[5] = errors.Fail[6] = 1;
+
+    Fire = DEV_Sem_Create(0);
+    if(Fire == NULL || DEV_Thread_Create(Fake_Irq, NULL, 0)) {
+        printf("reader: no thread\n");
+        return 1;
+    }
+    if(Touch_Reader_Init(Fake_Read, Fake_Notify, 0, RELEASE_MS)) {
+        printf("reader: init failed\n");
+        return 1;
+    }
+    if(Play(&swipe, Period) || Play(&tap, Period) || Play(&hold, Period) || Play(&errors, Period))
+        return 1;
+    if(__atomic_load_n(&Notified, __ATOMIC_RELAXED) != swipe.N + tap.N + hold.N + errors.N - 3) {
+        printf("reader: %lu notifications for %lu samples\n", (unsigned long)Notified,
+               (unsigned long)(swipe.N + tap.N + hold.N + errors.N - 3));
+        return 1;
+    }
+    printf("\nloop() time per sample: %.2f us from the ring, %d us reading the controller itself\n\n",
+           Ui_Us / Ui_Samples, READ_US);
+    return 0;
+}
+
+/**
+ * Gestures through an LVGL input device
+ **/
+#define W       240
+#define H       240
+#define BUF_PX  (W * H / 10)
+
+static lv_disp_draw_buf_t Draw_Buf;
+static lv_color_t Buf1[BUF_PX];
+static lv_disp_drv_t Disp_Drv;
+static lv_indev_drv_t Indev_Drv;
+static lv_indev_t *Indev;
+
+static lv_dir_t Got_Dir;
+static UBYTE Got_At_Release;
+static UDOUBLE Got_Gestures;
+static UDOUBLE Got_Long;
+
+// What a stream must give with one gesture source
+typedef struct {
+    lv_dir_t Dir;
+    UBYTE At_Release;       // sent with the up event, not while pressed
+    UBYTE Long;
+} EXPECT;
+
+static void Gesture_Flush(lv_disp_drv_t *Drv, const lv_area_t *Area, lv_color_t *Px)
+{
+    (void)Area;
+    (void)Px;
+    lv_disp_flush_ready(Drv);
+}
+
+// Like the SquareLine screen handlers
+static void Gesture_Event(lv_event_t *E)
+{
+    lv_indev_t *indev = lv_indev_get_act();
+
+    if(lv_event_get_code(E) == LV_EVENT_GESTURE) {
+        Got_Dir = lv_indev_get_gesture_dir(indev);
+        Got_At_Release = indev->proc.state == LV_INDEV_STATE_RELEASED;
+        Got_Gestures++;
+    } else if(lv_event_get_code(E) == LV_EVENT_LONG_PRESSED) {
+        Got_Long++;
+    }
+}
+
+// A stream whose samples From..N-1 carry the controller's gesture ID
+static void Record_Gesture(STREAM *St, const char *Name, int X0, int Y0, int X1, int Y1, UDOUBLE N,
+                           UBYTE Gesture, UDOUBLE From)
+{
+    UDOUBLE i;
+
+    Record(St, Name, X0, Y0, X1, Y1, N, Gesture, 1);
+    for(i = From; i < N; i++)
+        St->S[i].Gesture = Gesture;
+}
+
+static const char *Dir_Name(lv_dir_t Dir)
+{
+    switch(Dir) {
+    case LV_DIR_LEFT:
+        return "left";
+    case LV_DIR_RIGHT:
+        return "right";
+    case LV_DIR_TOP:
+        return "up";
+    case LV_DIR_BOTTOM:
+        return "down";
+    default:
+        return "none";
+    }
+}
+
+/******************************************************************************
+function:	Fire a stream and let LVGL take all of it in one read
+parameter:
+    St     : the stream, at most TOUCH_RING_SIZE samples
+    Want   : what the screen must get
+    Cost   : adds the time of the read, for all samples
+return:
+    1 on an error
+******************************************************************************/
+static int Gesture_Play(const STREAM *St, const EXPECT *Want, double *Cost)
+{
+    UDOUBLE notified = __atomic_load_n(&Notified, __ATOMIC_RELAXED);
+    double t0 = Now_us();
+    const char *src = Indev_Drv.gesture_src == LV_INDEV_GESTURE_SW ? "sw" :
+                      Indev_Drv.gesture_src == LV_INDEV_GESTURE_HW ? "hw" : "hw_sw";
+
+    Fake_Stream = St;
+    Fake_Pos = 0;
+    Fake_Irqs = St->N;
+    Touch_Reader_ResetStats();
+    DEV_Sem_Give(Fire);
+    // Notified once a sample is in the ring
+    while(__atomic_load_n(&Notified, __ATOMIC_RELAXED) - notified < St->N) {
+        if(Now_us() - t0 > 2e6) {
+            printf("%s: not read after 2 s\n", St->Name);
+            return 1;
+        }
+        Sleep_us(1000);
+    }
+
+    Got_Dir = LV_DIR_NONE;
+    Got_At_Release = 0;
+    Got_Gestures = 0;
+    Got_Long = 0;
+    t0 = Now_us();
+    lv_indev_read_timer_cb(Indev->driver->read_timer);
+    *Cost += Now_us() - t0;
+
+    if(Indev->proc.state != LV_INDEV_STATE_RELEASED || Got_Gestures > 1 || Got_Dir != Want->Dir ||
+       (Got_Gestures && Got_At_Release != Want->At_Release) || Got_Long != Want->Long) {
+        printf("%s, %s: %lu gestures, %s%s, %lu long presses, %s; expected %s%s, %d long presses\n", St->Name, src,
+               (unsigned long)Got_Gestures, Dir_Name(Got_Dir), Got_At_Release ? " at the release" : "",
+               (unsigned long)Got_Long, Indev->proc.state == LV_INDEV_STATE_RELEASED ? "released" : "pressed",
+               Dir_Name(Want->Dir), Want->At_Release ? " at the release" : "", Want->Long);
+        return 1;
+    }
+    return 0;
+}
+
+static int Gesture_Check(void)
+{
+    static const lv_indev_gesture_src_t srcs[] = {LV_INDEV_GESTURE_SW, LV_INDEV_GESTURE_HW, LV_INDEV_GESTURE_HW_SW};
+    static const char *src_names[] = {"LVGL only", "controller only", "controller, else LVGL"};
+    static STREAM st[6];
+    // Per stream, for LV_INDEV_GESTURE_SW, _HW and _HW_SW
+    static const EXPECT want[6][3] = {
+        {{LV_DIR_LEFT, 0, 0}, {LV_DIR_LEFT, 0, 0}, {LV_DIR_LEFT, 0, 0}},
+        {{LV_DIR_TOP, 0, 0}, {LV_DIR_TOP, 1, 0}, {LV_DIR_TOP, 0, 0}},
+        {{LV_DIR_RIGHT, 0, 0}, {LV_DIR_NONE, 0, 0}, {LV_DIR_RIGHT, 0, 0}},
+        {{LV_DIR_NONE, 0, 0}, {LV_DIR_RIGHT, 1, 0}, {LV_DIR_RIGHT, 1, 0}},
+        {{LV_DIR_NONE, 0, 0}, {LV_DIR_NONE, 0, 0}, {LV_DIR_NONE, 0, 0}},
+        {{LV_DIR_NONE, 0, 0}, {LV_DIR_NONE, 0, 1}, {LV_DIR_NONE, 0, 1}},
+    };
+    UDOUBLE i, m, samples = 0;
+
+    Record_Gesture(&st[0], "swipe left, ID on the way", 200, 120, 40, 122, 12, TOUCH_GESTURE_SWIPE_LEFT, 6);
+    Record_Gesture(&st[1], "swipe up, ID at the release", 120, 200, 118, 40, 10, TOUCH_GESTURE_SWIPE_UP, 9);
+    Record_Gesture(&st[2], "swipe right, no ID", 40, 120, 200, 120, 10, TOUCH_GESTURE_NONE, 10);
+    Record_Gesture(&st[3], "short flick right, ID", 110, 120, 140, 120, 6, TOUCH_GESTURE_SWIPE_RIGHT, 5);
+    Record_Gesture(&st[4], "tap", 120, 120, 121, 120, 3, TOUCH_GESTURE_CLICK, 2);
+    Record_Gesture(&st[5], "long press", 80, 80, 80, 81, 8, TOUCH_GESTURE_LONG_PRESS, 4);
+    for(i = 0; i < 6; i++)
+        samples += st[i].N;
+
+    lv_init();
+    lv_disp_draw_buf_init(&Draw_Buf, Buf1, NULL, BUF_PX);
+    lv_disp_drv_init(&Disp_Drv);
+    Disp_Drv.hor_res = W;
+    Disp_Drv.ver_res = H;
+    Disp_Drv.flush_cb = Gesture_Flush;
+    Disp_Drv.draw_buf = &Draw_Buf;
+    lv_disp_drv_register(&Disp_Drv);
+
+    lv_obj_t *scr = lv_scr_act();
+    lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(scr, Gesture_Event, LV_EVENT_ALL, NULL);
+
+    lv_indev_drv_init(&Indev_Drv);
+    Indev_Drv.type = LV_INDEV_TYPE_POINTER;
+    Indev_Drv.read_cb = Touch_Reader_Read;
+    Indev = lv_indev_drv_register(&Indev_Drv);
+    lv_timer_pause(Indev->driver->read_timer);
+
+    for(m = 0; m < 3; m++) {
+        double cost = 0;
+        Indev_Drv.gesture_src = srcs[m];
+        for(i = 0; i < 6; i++) {
+            if(Gesture_Play(&st[i], &want[i][m], &cost))
+                return 1;
+        }
+        printf("gestures from the %-31s ok, %.2f us per sample in LVGL's read\n", src_names[m], cost / samples);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    UDOUBLE n = 1000000;
+    long period = 5;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc)
+            n = strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-p") && i + 1 < argc)
+            period = atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-n samples] [-p period_ms]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(period < 1)
+        period = 1;
+
+    if(Ring_Check() || Spsc_Check(n) || Reader_Check(period))
+        return 1;
+    return Gesture_Check();
+}
@@ -0,0 +1,213 @@
+/*****************************************************************************
+* | File      	:   transition_bench.cpp
+* | Function    :   Host check and benchmark of the snapshot transitions
+* | Info        :
+*                Runs every screen change of the SquareLine handlers twice,
+*                once with lv_scr_load_anim() drawing both screens live and
+*                once through UI_Transition from snapshots, at the 16 ms
+*                frame period loop() uses while a screen loads. Prints the
+*                time per frame, the time the snapshots took and the whole
+*                change for both. A last change runs with a spinner on the
+*                new screen, which must fall back to the live screens.
+*
+*                Moves must show the same frames both ways. A fade blends
+*                the new screen as one image instead of every object on its
+*                own, so only its last frame must be the same.
+*
+*                usage: transition_bench [-r rounds]
+*                  -r  times each change runs, for the average (default 20)
+*
+*                Exits with 1 if a frame differs.
+******************************************************************************/
+#include "DEV_Config.h"
+#include "UI_Screens.h"
+#include "UI_Transition.h"
+#include "ui.h"
+#include "LVGL_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define FRAME_MS    16
+
+static lv_color_t Snap_Old[LVGL_BENCH_WIDTH * LVGL_BENCH_HEIGHT];
+static lv_color_t Snap_New[LVGL_BENCH_WIDTH * LVGL_BENCH_HEIGHT];
+static uint32_t Sim_Ms;
+
+// The sketch functions the screens call
+extern "C" {
+int stepCount = 0;
+void executeOfflineSign(void) {}
+void executeSignAndExecute(void) {}
+void resetStepCounter(void) {}
+void reconnectWiFiWithCredentials(const char *ssid, const char *password)
+{
+    (void)ssid;
+    (void)password;
+}
+
+uint32_t millis(void)
+{
+    return Sim_Ms;
+}
+}
+
+// The screen changes of ui_Screen1.c to ui_Screen5.c
+typedef struct {
+    const char *Name;
+    lv_obj_t **From;
+    lv_obj_t **To;
+    void (*Init)(void);
+    lv_scr_load_anim_t Anim;
+    uint32_t Time;
+} CHANGE;
+
+static const CHANGE Changes[] = {
+    {"1>2 right", &ui_Screen1, &ui_Screen2, ui_Screen2_screen_init, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 100},
+    {"1>5 left", &ui_Screen1, &ui_Screen5, ui_Screen5_screen_init, LV_SCR_LOAD_ANIM_MOVE_LEFT, 100},
+    {"1>3 up", &ui_Screen1, &ui_Screen3, ui_Screen3_screen_init, LV_SCR_LOAD_ANIM_MOVE_TOP, 100},
+    {"1>4 down", &ui_Screen1, &ui_Screen4, ui_Screen4_screen_init, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 100},
+    {"2>1 left", &ui_Screen2, &ui_Screen1, ui_Screen1_screen_init, LV_SCR_LOAD_ANIM_MOVE_LEFT, 100},
+    {"3>1 down", &ui_Screen3, &ui_Screen1, ui_Screen1_screen_init, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 150},
+    {"4>1 up", &ui_Screen4, &ui_Screen1, ui_Screen1_screen_init, LV_SCR_LOAD_ANIM_MOVE_TOP, 100},
+    {"4>1 fade", &ui_Screen4, &ui_Screen1, ui_Screen1_screen_init, LV_SCR_LOAD_ANIM_FADE_ON, 300},
+    {"5>1 right", &ui_Screen5, &ui_Screen1, ui_Screen1_screen_init, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 100},
+};
+#define CHANGES     (int)(sizeof(Changes) / sizeof(Changes[0]))
+
+typedef struct {
+    double Call_us;         // in UI_Screens_Change(), the snapshots
+    double Frames_us;       // rendering the frames of the animation
+    int Frames;
+    std::vector<uint32_t> Hashes;
+} CHANGE_RESULT;
+
+/******************************************************************************
+function:	Run one screen change from a fully drawn screen to its end
+parameter:
+    C   : the change
+    Res : times, frames and the hash of every frame
+******************************************************************************/
+static void Run(const CHANGE *C, CHANGE_RESULT *Res)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    double t0;
+
+    lv_scr_load(*C->From);
+    lv_refr_now(NULL);
+
+    Res->Hashes.clear();
+    t0 = LVGL_Bench_Now_us();
+    UI_Screens_Change(C->To, C->Anim, C->Time, 0, C->Init);
+    Res->Call_us = LVGL_Bench_Now_us() - t0;
+    Res->Frames_us = 0;
+    do {
+        Sim_Ms += FRAME_MS;
+        t0 = LVGL_Bench_Now_us();
+        lv_timer_handler();
+        Res->Frames_us += LVGL_Bench_Now_us() - t0;
+        Res->Hashes.push_back(LVGL_Bench_Frame_Hash());
+    } while(lv_scr_act() != *C->To || disp->prev_scr);
+
+    // The frame the end of the animation invalidated
+    Sim_Ms += FRAME_MS;
+    t0 = LVGL_Bench_Now_us();
+    lv_timer_handler();
+    Res->Frames_us += LVGL_Bench_Now_us() - t0;
+    Res->Hashes.push_back(LVGL_Bench_Frame_Hash());
+    Res->Frames = (int)Res->Hashes.size();
+}
+
+/******************************************************************************
+function:	Run a change live and from snapshots, Rounds times each
+return:
+    1 if a frame that must be the same differs
+******************************************************************************/
+static int Compare(const CHANGE *C, int Rounds, int Busy)
+{
+    CHANGE_RESULT live, snap;
+    double live_us = 0, live_frames_us = 0, snap_us = 0, snap_frames_us = 0, snap_call_us = 0;
+    UI_TRANSITION_STATS st;
+    int same = 0, bad;
+    int r, i;
+
+    for(r = 0; r < Rounds; r++) {
+        UI_Transition_Init(NULL, NULL, 0);
+        Run(C, &live);
+        live_us += live.Call_us + live.Frames_us;
+        live_frames_us += live.Frames_us;
+
+        UI_Transition_Init(Snap_Old, Snap_New, sizeof(Snap_Old));
+        UI_Transition_ResetStats();
+        Run(C, &snap);
+        snap_us += snap.Call_us + snap.Frames_us;
+        snap_frames_us += snap.Frames_us;
+        snap_call_us += snap.Call_us;
+    }
+    UI_Transition_GetStats(&st);
+
+    if(live.Frames == snap.Frames) {
+        for(i = 0; i < live.Frames; i++)
+            same += live.Hashes[i] == snap.Hashes[i];
+    }
+    // The spinner turns on between the two runs, only the fallback counts
+    if(Busy)
+        bad = st.Busy != 1;
+    else if(C->Anim == LV_SCR_LOAD_ANIM_FADE_ON)
+        bad = st.Snapshots != 1 || live.Hashes.back() != snap.Hashes.back();
+    else
+        bad = st.Snapshots != 1 || same != live.Frames;
+
+    printf("%-10s %6d %9.0f %9.0f %9.0f %9.0f %9.0f %5d/%-3d %s\n", C->Name, live.Frames,
+           live_frames_us / Rounds / live.Frames, snap_frames_us / Rounds / snap.Frames, snap_call_us / Rounds,
+           live_us / Rounds, snap_us / Rounds, same, live.Frames,
+           bad ? "FAIL" : (Busy ? "live" : "ok"));
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    int rounds = 20;
+    int bad = 0;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-r") && i + 1 < argc)
+            rounds = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [-r rounds]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(rounds < 1)
+        rounds = 1;
+
+    lv_disp_t *disp = LVGL_Bench_Init();
+    lv_timer_set_period(disp->refr_timer, FRAME_MS);
+    lv_timer_set_period(lv_anim_get_timer(), FRAME_MS);
+
+    // Every screen stays built, so only the animations are compared
+    Sim_Ms = 1;
+    UI_Screens_Init(0);
+    ui_init();
+    ui_Screen4_screen_init();
+    ui_Screen5_screen_init();
+
+    printf("%d rounds, %d ms frames\n", rounds, FRAME_MS);
+    printf("%-10s %6s %9s %9s %9s %9s %9s %9s %s\n", "change", "frames", "us live", "us snap", "us shots",
+           "us live", "us snap", "same", "check");
+    printf("%-10s %6s %9s %9s %9s %9s %9s\n", "", "", "/frame", "/frame", "", "total", "total");
+    for(i = 0; i < CHANGES; i++)
+        bad |= Compare(&Changes[i], rounds, 0);
+
+    // A screen that animates itself is drawn live
+    lv_obj_t *spinner = lv_spinner_create(ui_Screen3, 1000, 60);
+    lv_obj_set_size(spinner, 40, 40);
+    CHANGE busy = Changes[2];
+    busy.Name = "1>3 busy";
+    bad |= Compare(&busy, 1, 1);
+
+    return bad;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Size: 12 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_12.c made by host/font_subset.py from the
+ * texts of the UI and font_subset.txt. Do not edit, run the script again.
+ * Glyphs: U+0020 : D I P S a s
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 12 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_12.c --force-fast-kern-format
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*Only when LVGL doesn't build the whole font (lv_conf.h)*/
+#if !LV_FONT_MONTSERRAT_12
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+003A ":" */
+    0x4e, 0x2, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xa0, 0x4d, 0x0,
+
+    /* U+0044 "D" */
+    0xbf, 0xff, 0xea, 0x30, 0xb, 0x82, 0x23, 0x9f,
+    0x40, 0xb7, 0x0, 0x0, 0x7e, 0xb, 0x70, 0x0,
+    0x0, 0xf3, 0xb7, 0x0, 0x0, 0xe, 0x5b, 0x70,
+    0x0, 0x0, 0xf3, 0xb7, 0x0, 0x0, 0x7e, 0xb,
+    0x82, 0x23, 0x9f, 0x40, 0xbf, 0xff, 0xeb, 0x30,
+    0x0,
+
+    /* U+0049 "I" */
+    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+    0xb7,
+
+    /* U+0050 "P" */
+    0xbf, 0xff, 0xd8, 0x0, 0xb8, 0x22, 0x5d, 0x90,
+    0xb7, 0x0, 0x4, 0xe0, 0xb7, 0x0, 0x3, 0xf0,
+    0xb7, 0x0, 0x2c, 0xa0, 0xbf, 0xff, 0xfa, 0x10,
+    0xb8, 0x22, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0,
+    0xb7, 0x0, 0x0, 0x0,
+
+    /* U+0053 "S" */
+    0x3, 0xcf, 0xeb, 0x31, 0xf7, 0x23, 0x74, 0x4e,
+    0x0, 0x0, 0x1, 0xf9, 0x20, 0x0, 0x2, 0xbf,
+    0xd7, 0x0, 0x0, 0x4, 0xca, 0x0, 0x0, 0x4,
+    0xe5, 0xb4, 0x23, 0xbb, 0x8, 0xdf, 0xea, 0x10,
+
+    /* U+0061 "a" */
+    0x8, 0xdf, 0xc3, 0x0, 0xa4, 0x29, 0xd0, 0x0,
+    0x0, 0x1f, 0x10, 0x8d, 0xee, 0xf2, 0x4e, 0x10,
+    0xf, 0x24, 0xe0, 0x7, 0xf2, 0x9, 0xed, 0x8f,
+    0x20,
+
+    /* U+0073 "s" */
+    0x9, 0xef, 0xc2, 0x6d, 0x22, 0x61, 0x7d, 0x20,
+    0x0, 0x9, 0xfe, 0x91, 0x0, 0x2, 0xc9, 0x56,
+    0x22, 0xb8, 0x4c, 0xfe, 0xa0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 52, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 44, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11, .adv_w = 159, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 52, .adv_w = 60, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 61, .adv_w = 139, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 97, .adv_w = 119, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 129, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 154, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x1a, 0x24, 0x29, 0x30, 0x33, 0x41, 0x53
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 84, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 2, 3, 4, 5, 1, 6,
+    7
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 2, 3, 3, 3, 1, 4,
+    5
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 7,
+    .right_class_cnt     = 5,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_12 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 15,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14     /*Glyphs the subset doesn't have*/
+};
+
+#endif /*#if !LV_FONT_MONTSERRAT_12*/
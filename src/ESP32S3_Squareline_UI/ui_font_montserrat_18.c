@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * Size: 18 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_18.c made by host/font_subset.py from the
+ * texts of the UI and font_subset.txt. Do not edit, run the script again.
+ * Glyphs: U+0020 F S-T W a d-e g i n-p s-t y
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 18 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_18.c --force-fast-kern-format
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*Only when LVGL doesn't build the whole font (lv_conf.h)*/
+#if !LV_FONT_MONTSERRAT_18
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0046 "F" */
+    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xea, 0xaa,
+    0xaa, 0xa7, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xf0, 0x1f, 0xe9, 0x99, 0x99, 0x90,
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
+    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+    0x0,
+
+    /* U+0053 "S" */
+    0x0, 0x29, 0xdf, 0xfd, 0x81, 0x0, 0x3f, 0xfc,
+    0x9a, 0xdf, 0xc0, 0xb, 0xf4, 0x0, 0x0, 0x23,
+    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x61, 0x0,
+    0x0, 0x0, 0x3b, 0xff, 0xfd, 0x70, 0x0, 0x0,
+    0x0, 0x48, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x40, 0x0, 0x0, 0x0, 0x6, 0xf6, 0xb,
+    0x50, 0x0, 0x0, 0xcf, 0x31, 0xdf, 0xeb, 0x9a,
+    0xef, 0x90, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x89, 0xaa, 0xad,
+    0xfb, 0xaa, 0xa5, 0x0, 0x0, 0x9f, 0x20, 0x0,
+    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
+    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
+    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x4f, 0x90, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
+    0x2, 0xf8, 0xe, 0xe0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x8, 0xf3, 0x9, 0xf3, 0x0, 0x0,
+    0x7f, 0xfd, 0x0, 0x0, 0xd, 0xd0, 0x4, 0xf8,
+    0x0, 0x0, 0xcd, 0x8f, 0x20, 0x0, 0x2f, 0x80,
+    0x0, 0xfe, 0x0, 0x2, 0xf8, 0x3f, 0x80, 0x0,
+    0x7f, 0x30, 0x0, 0xaf, 0x30, 0x7, 0xf3, 0xe,
+    0xd0, 0x0, 0xde, 0x0, 0x0, 0x5f, 0x80, 0xc,
+    0xd0, 0x8, 0xf2, 0x2, 0xf9, 0x0, 0x0, 0xf,
+    0xd0, 0x2f, 0x80, 0x3, 0xf7, 0x7, 0xf4, 0x0,
+    0x0, 0xa, 0xf2, 0x7f, 0x30, 0x0, 0xed, 0xc,
+    0xe0, 0x0, 0x0, 0x5, 0xf7, 0xdd, 0x0, 0x0,
+    0x9f, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xfe, 0xf8,
+    0x0, 0x0, 0x3f, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x9, 0xfa,
+    0x0, 0x0,
+
+    /* U+0061 "a" */
+    0x1, 0x7c, 0xff, 0xd6, 0x0, 0x9, 0xfc, 0x99,
+    0xef, 0x80, 0x1, 0x30, 0x0, 0xd, 0xf0, 0x0,
+    0x0, 0x0, 0x9, 0xf2, 0x1, 0x9e, 0xff, 0xff,
+    0xf3, 0xa, 0xf8, 0x43, 0x3a, 0xf3, 0xf, 0xb0,
+    0x0, 0x8, 0xf3, 0xf, 0xb0, 0x0, 0xe, 0xf3,
+    0x9, 0xf9, 0x46, 0xdf, 0xf3, 0x0, 0x8d, 0xfe,
+    0x87, 0xf3,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
+    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x8,
+    0xdf, 0xe8, 0x2f, 0xa0, 0x1d, 0xfd, 0x9b, 0xfd,
+    0xfa, 0xa, 0xf8, 0x0, 0x2, 0xef, 0xa0, 0xfd,
+    0x0, 0x0, 0x6, 0xfa, 0x3f, 0x80, 0x0, 0x0,
+    0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0xf,
+    0xc0, 0x0, 0x0, 0x5f, 0xa0, 0xaf, 0x60, 0x0,
+    0x1e, 0xfa, 0x1, 0xdf, 0xb7, 0x9e, 0xdf, 0xa0,
+    0x0, 0x8d, 0xfe, 0x91, 0xfa,
+
+    /* U+0065 "e" */
+    0x0, 0x8, 0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb,
+    0x8a, 0xfe, 0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb,
+    0x0, 0xfa, 0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0x33, 0xfa, 0x33, 0x33, 0x33,
+    0x30, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0x90, 0x0, 0x9, 0x10, 0x0, 0xdf, 0xda, 0xae,
+    0xf6, 0x0, 0x0, 0x7d, 0xff, 0xc5, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x8, 0xdf, 0xe9, 0x1e, 0xc0, 0x1d, 0xfd,
+    0x9b, 0xfe, 0xec, 0xa, 0xf8, 0x0, 0x1, 0xdf,
+    0xc0, 0xfd, 0x0, 0x0, 0x4, 0xfc, 0x3f, 0x90,
+    0x0, 0x0, 0xf, 0xc3, 0xf8, 0x0, 0x0, 0x0,
+    0xfc, 0xf, 0xd0, 0x0, 0x0, 0x4f, 0xc0, 0xaf,
+    0x80, 0x0, 0x1d, 0xfc, 0x1, 0xdf, 0xd9, 0xaf,
+    0xdf, 0xc0, 0x0, 0x8d, 0xfe, 0x91, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0x90, 0x27, 0x0, 0x0,
+    0xb, 0xf4, 0x7, 0xff, 0xb9, 0xae, 0xfa, 0x0,
+    0x4, 0xae, 0xff, 0xc6, 0x0,
+
+    /* U+0069 "i" */
+    0x6f, 0x69, 0xf9, 0x4, 0x0, 0x0, 0x5f, 0x55,
+    0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
+    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+
+    /* U+006E "n" */
+    0x5f, 0x57, 0xdf, 0xea, 0x10, 0x5f, 0xef, 0xa8,
+    0xcf, 0xd0, 0x5f, 0xf3, 0x0, 0x9, 0xf6, 0x5f,
+    0x90, 0x0, 0x2, 0xf9, 0x5f, 0x60, 0x0, 0x0,
+    0xfa, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50,
+    0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
+    0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0,
+    0x0, 0xfb,
+
+    /* U+006F "o" */
+    0x0, 0x7, 0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd,
+    0x9a, 0xff, 0x50, 0x9, 0xf7, 0x0, 0x2, 0xef,
+    0x10, 0xfd, 0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80,
+    0x0, 0x0, 0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2,
+    0xf9, 0xf, 0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f,
+    0x80, 0x0, 0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf,
+    0xf4, 0x0, 0x0, 0x7d, 0xfe, 0xa3, 0x0,
+
+    /* U+0070 "p" */
+    0x5f, 0x46, 0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfa,
+    0x8a, 0xff, 0x30, 0x5f, 0xf4, 0x0, 0x3, 0xfe,
+    0x5, 0xfa, 0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60,
+    0x0, 0x0, 0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4,
+    0xf7, 0x5f, 0xa0, 0x0, 0x0, 0x9f, 0x45, 0xff,
+    0x50, 0x0, 0x4f, 0xe0, 0x5f, 0xdf, 0xc9, 0xbf,
+    0xf3, 0x5, 0xf5, 0x6d, 0xfe, 0xa2, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5,
+    0xf5, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x1, 0x8d, 0xfe, 0xc7, 0x0, 0xcf, 0xb8, 0xad,
+    0xd0, 0x3f, 0x90, 0x0, 0x1, 0x2, 0xfb, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xb8, 0x40, 0x0, 0x5,
+    0x9c, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0x60,
+    0x50, 0x0, 0x5, 0xf7, 0x5f, 0xea, 0x9a, 0xfe,
+    0x10, 0x6c, 0xef, 0xd9, 0x20,
+
+    /* U+0074 "t" */
+    0x1, 0xfa, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0xbf,
+    0xff, 0xff, 0x55, 0x8f, 0xc7, 0x72, 0x1, 0xfa,
+    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0,
+    0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0,
+    0xf, 0xc0, 0x0, 0x0, 0xbf, 0xa9, 0x90, 0x1,
+    0xbe, 0xe9,
+
+    /* U+0079 "y" */
+    0xd, 0xe0, 0x0, 0x0, 0xc, 0xd0, 0x6, 0xf6,
+    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
+    0x9f, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xfa, 0x0,
+    0x0, 0x2f, 0x90, 0x6, 0xf3, 0x0, 0x0, 0xc,
+    0xf0, 0xd, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
+    0x60, 0x0, 0x0, 0x0, 0xed, 0xae, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
+    0x0, 0x0, 0x1, 0x0, 0x7f, 0x40, 0x0, 0x0,
+    0x1f, 0xaa, 0xfb, 0x0, 0x0, 0x0, 0x19, 0xee,
+    0xa1, 0x0, 0x0, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 65, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 137, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 209, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 339, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 389, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 466, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 521, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 598, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 619, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 669, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 724, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 801, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 846, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 888, .adv_w = 161, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = -4}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x26, 0x33, 0x34, 0x37, 0x41, 0x44, 0x45,
+    0x47, 0x49, 0x4e, 0x4f, 0x50, 0x53, 0x54, 0x59
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 90, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 16, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 2, 1, 3, 4, 5, 7,
+    8, 9, 10, 5, 6, 6, 11, 12,
+    13
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 2, 1, 3, 4, 5, 6,
+    6, 6, 7, 8, 6, 8, 9, 10,
+    11
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 1, 0, -5,
+    -5, -3, -3, -3, 0, 1, -3, 0,
+    3, -2, -8, -16, -4, -4, -11, 1,
+    -10, -4, -4, -2, 0, -16, -16, -4,
+    -10, -17, -1, -5, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, -3, 0,
+    0, -23, -12, -1, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, -28,
+    -6, -4, 0, 0, 0, 0, 0, -3,
+    -5, 0, -24, -2, 0, 0, 0, 0,
+    0, 0, 0, -5, 0, -24, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, -4, -3, -2, 0, -12, 0,
+    -5, -4, 0, 0, -2, 4, -2
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 13,
+    .right_class_cnt     = 11,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_18 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 21,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14     /*Glyphs the subset doesn't have*/
+};
+
+#endif /*#if !LV_FONT_MONTSERRAT_18*/
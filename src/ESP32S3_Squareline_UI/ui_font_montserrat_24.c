@@ -0,0 +1,484 @@
+/*******************************************************************************
+ * Size: 24 px
+ * Bpp: 4
+ * Subset of LVGL's lv_font_montserrat_24.c made by host/font_subset.py from the
+ * texts of the UI and font_subset.txt. Do not edit, run the script again.
+ * Glyphs: U+0020 - 0-9 A C-D M-O S
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 24 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_24.c --force-fast-kern-format
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*Only when LVGL doesn't build the whole font (lv_conf.h)*/
+#if !LV_FONT_MONTSERRAT_24
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+002D "-" */
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0xaf,
+    0xff, 0xff, 0xd0,
+
+    /* U+0030 "0" */
+    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x1, 0xff,
+    0xe7, 0x33, 0x7e, 0xff, 0x10, 0xb, 0xfe, 0x20,
+    0x0, 0x2, 0xef, 0xb0, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x5f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0xe, 0xf7, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0xb,
+    0xfa, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x9, 0xfc,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfd, 0xcf,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xaf, 0xb0,
+    0x0, 0x0, 0x0, 0xb, 0xfa, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0xe, 0xf7, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x5f, 0xf2, 0xb, 0xfe, 0x10, 0x0, 0x2,
+    0xef, 0xb0, 0x1, 0xff, 0xe7, 0x33, 0x7e, 0xff,
+    0x10, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x1, 0x7c, 0xee, 0xc7, 0x10, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf5, 0x11,
+    0x11, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0,
+    0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff,
+    0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50,
+    0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0,
+    0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf,
+    0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf, 0xf5,
+    0x0, 0x0, 0xff, 0x50,
+
+    /* U+0032 "2" */
+    0x0, 0x17, 0xce, 0xfe, 0xc6, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x6f, 0xfc, 0x63,
+    0x35, 0xbf, 0xfa, 0x0, 0x97, 0x0, 0x0, 0x0,
+    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd1,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xc1, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xc2, 0x11, 0x11,
+    0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0033 "3" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1, 0x11, 0x11,
+    0x11, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x15, 0xef,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x81, 0xa1, 0x0, 0x0,
+    0x0, 0x4f, 0xf5, 0x9f, 0xfa, 0x53, 0x34, 0x9f,
+    0xfd, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x49, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x60, 0x0, 0x9d, 0x70, 0x0,
+    0x0, 0x1e, 0xfa, 0x0, 0x0, 0xbf, 0x90, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0xbf, 0x90, 0x0,
+    0x7, 0xff, 0x41, 0x11, 0x11, 0xbf, 0x91, 0x11,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0x81,
+    0x11, 0x11, 0x11, 0x0, 0xd, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x31, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfe, 0xa3, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x26, 0xdf,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x93, 0x0, 0x0,
+    0x0, 0x1e, 0xfa, 0x5f, 0xfb, 0x63, 0x24, 0x7e,
+    0xff, 0x31, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x28, 0xce, 0xfe, 0xc8, 0x10, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0xcf,
+    0xf9, 0x42, 0x23, 0x76, 0x0, 0x8, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xa0, 0x5b, 0xef, 0xd9, 0x30,
+    0x0, 0xbf, 0x9a, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xdf, 0xff, 0xc4, 0x1, 0x4c, 0xff, 0x40, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x8f, 0xf2, 0x0,
+    0x0, 0x0, 0x3f, 0xf1, 0x4f, 0xf4, 0x0, 0x0,
+    0x0, 0x4f, 0xf0, 0xd, 0xfc, 0x0, 0x0, 0x0,
+    0xbf, 0xb0, 0x4, 0xff, 0xc3, 0x0, 0x3b, 0xff,
+    0x30, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0,
+
+    /* U+0037 "7" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xf2,
+    0x11, 0x11, 0x11, 0x8f, 0xf1, 0x4f, 0xf0, 0x0,
+    0x0, 0x0, 0xef, 0x90, 0x4f, 0xf0, 0x0, 0x0,
+    0x5, 0xff, 0x20, 0x2, 0x20, 0x0, 0x0, 0xc,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xd, 0xff,
+    0x71, 0x0, 0x4b, 0xff, 0x40, 0x3f, 0xf5, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x4f, 0xf1, 0x0, 0x0,
+    0x0, 0x9f, 0xc0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0xa, 0xff, 0x72, 0x1, 0x4c, 0xff,
+    0x20, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x4, 0xdf, 0xff, 0xef, 0xff, 0xf8, 0x0, 0x2f,
+    0xfc, 0x40, 0x0, 0x18, 0xff, 0x90, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x6f, 0xf2, 0xdf, 0x80, 0x0,
+    0x0, 0x0, 0xf, 0xf5, 0xdf, 0x80, 0x0, 0x0,
+    0x0, 0x1f, 0xf5, 0xaf, 0xe1, 0x0, 0x0, 0x0,
+    0x8f, 0xf2, 0x3f, 0xfd, 0x51, 0x0, 0x3a, 0xff,
+    0xa0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x17, 0xce, 0xff, 0xd9, 0x40, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x4, 0xae, 0xfe, 0xc7, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x8, 0xff,
+    0x82, 0x0, 0x4c, 0xfe, 0x10, 0x1f, 0xf6, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x3f, 0xf0, 0x0, 0x0,
+    0x0, 0x6f, 0xf1, 0x4f, 0xf0, 0x0, 0x0, 0x0,
+    0x6f, 0xf5, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xcf,
+    0xf8, 0xa, 0xff, 0x82, 0x0, 0x4c, 0xff, 0xf9,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0x9c, 0xfa, 0x0,
+    0x6, 0xbe, 0xfe, 0xa4, 0xd, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x50, 0x0, 0xa7, 0x31, 0x25, 0xcf, 0xf9,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x7b, 0xdf, 0xec, 0x82, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x5d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf7, 0x0, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x8, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
+    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0xa,
+    0xfc, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
+    0x2, 0xff, 0x50, 0x0, 0x0, 0xd, 0xfa, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0xef, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x5f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0,
+    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x50,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x5f, 0xff, 0xb6, 0x43, 0x59, 0xff, 0xf2,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0x0, 0x5f, 0xff, 0xb5, 0x33, 0x49, 0xff, 0xf2,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x50, 0x0,
+
+    /* U+0044 "D" */
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
+    0x0, 0x7f, 0xe1, 0x11, 0x12, 0x36, 0xbf, 0xff,
+    0x40, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xfe, 0x20, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfb, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x77, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xa7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x77, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x7f,
+    0xe1, 0x11, 0x11, 0x35, 0xbf, 0xff, 0x40, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x0,
+
+    /* U+004D "M" */
+    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x67, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf6, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x67, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x7f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x67,
+    0xfd, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0x8e,
+    0xf6, 0x7f, 0xd2, 0xff, 0x40, 0x0, 0x0, 0x5f,
+    0xe0, 0xef, 0x67, 0xfd, 0x8, 0xfd, 0x0, 0x0,
+    0xe, 0xf6, 0xe, 0xf6, 0x7f, 0xd0, 0xe, 0xf7,
+    0x0, 0x8, 0xfc, 0x0, 0xef, 0x67, 0xfd, 0x0,
+    0x5f, 0xf1, 0x1, 0xff, 0x30, 0xe, 0xf6, 0x7f,
+    0xd0, 0x0, 0xbf, 0xa0, 0xaf, 0x90, 0x0, 0xef,
+    0x67, 0xfd, 0x0, 0x2, 0xff, 0x7f, 0xe1, 0x0,
+    0xe, 0xf6, 0x7f, 0xd0, 0x0, 0x8, 0xff, 0xf6,
+    0x0, 0x0, 0xef, 0x67, 0xfd, 0x0, 0x0, 0xe,
+    0xfd, 0x0, 0x0, 0xe, 0xf6, 0x7f, 0xd0, 0x0,
+    0x0, 0x5f, 0x40, 0x0, 0x0, 0xef, 0x67, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x60,
+
+    /* U+004E "N" */
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x7f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xfd,
+    0xfe, 0x20, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x3f,
+    0xfd, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x5f,
+    0xfa, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x8f,
+    0xf7, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0xbf,
+    0xf4, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x1, 0xef,
+    0xe1, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0x3, 0xff,
+    0xc0, 0x7f, 0xf7, 0xfe, 0x0, 0x0, 0x6, 0xff,
+    0xa7, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x9, 0xff,
+    0xdf, 0xf7, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xb6, 0x33,
+    0x5a, 0xff, 0xf7, 0x0, 0x0, 0x3f, 0xfd, 0x30,
+    0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0xd, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x4,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x70, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfc, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf0, 0xdf, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xc, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x9f,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x70, 0xd, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf1, 0x0, 0x3f, 0xfd, 0x30, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5f, 0xff,
+    0xb5, 0x33, 0x59, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0xef,
+    0xe7, 0x21, 0x14, 0x8e, 0xc0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x20, 0x9, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xd9, 0x51, 0x0, 0x0,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x1, 0x59, 0xdf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x5, 0x80, 0x0, 0x0, 0x0,
+    0xc, 0xfb, 0xd, 0xfe, 0x84, 0x21, 0x25, 0xcf,
+    0xf4, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x82, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 103, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 147, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 11, .adv_w = 256, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 130, .adv_w = 142, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 190, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 301, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 412, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 548, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 659, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 778, .adv_w = 230, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 897, .adv_w = 247, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1016, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1135, .adv_w = 281, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1297, .adv_w = 278, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1433, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1578, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1740, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1868, .adv_w = 323, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2030, .adv_w = 238, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd
+};
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x2, 0x3, 0xc, 0xd, 0xe, 0x12
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 14, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 3,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 19, .glyph_id_start = 13,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 2, 3, 0, 4, 5, 6,
+    7, 8, 9, 10, 3, 12, 13, 11,
+    14, 14, 11, 1
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 2, 3, 4, 5, 6, 7,
+    8, 3, 9, 10, 11, 13, 12, 14,
+    14, 14, 12, 1
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 7, 0, -4, 0, -3, 4, 0,
+    -4, 0, -4, 0, 0, 0, 0, 1,
+    3, -7, -5, -8, 3, 0, -4, 0,
+    0, 0, 0, 0, 0, 3, 0, -1,
+    -1, -4, 0, 0, -3, 0, 0, 0,
+    -3, 0, 0, -3, -1, 0, 0, 0,
+    -7, 0, -1, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, -2, -2, 0, -4,
+    -5, 0, 0, 0, 1, 0, -3, 4,
+    0, -10, -1, -5, 0, -1, -18, 4,
+    -3, 4, 0, 0, 0, 0, 0, 0,
+    -2, -2, 0, -2, -5, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 3, 0,
+    -3, -19, -8, 4, 0, -3, -25, -7,
+    0, -7, 0, -7, -25, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 3, 0, -4,
+    -4, -5, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, -7, -3, -16, 0, 4,
+    -6, 0, -19, -2, -5, -4, 5, 0,
+    -1, -1, -8, 4, -3, -1, -10, -4,
+    0, -5, -4, -6, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 14,
+    .right_class_cnt     = 14,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 27,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_14     /*Glyphs the subset doesn't have*/
+};
+
+#endif /*#if !LV_FONT_MONTSERRAT_24*/
@@ -11,36 +11,36 @@
 
 // IMAGE DATA: assets/lock.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_lock_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xA8,0x04,0x62,0xD8,0x24,0x62,0xD8,0x4B,0x62,0xD0,0x5D,0x62,0xD0,0x5E,0x61,0xD8,0x4E,0x81,0xD8,0x27,0xC4,0xB8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xD0,0x2F,0x21,0xE8,0x95,0x00,0xE8,0xE2,0x00,0xE8,0xFE,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xE6,0x41,0xE0,0x99,0x82,0xE0,0x32,
-    0xE7,0xC1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xD8,0x1C,0x20,0xE0,0xA8,0x00,0xE8,0xFC,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x61,0xE8,0xFD,0x62,0xE0,0xAC,0x82,0xD0,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x4A,
-    0x00,0xE8,0xEB,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE0,0xFF,0x41,0xE8,0xFF,0x20,0xE0,0xEE,0x61,0xD8,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE0,0x5B,0x00,0xE8,0xFA,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFB,0x21,0xE0,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xE0,0x44,0x00,0xE8,0xF9,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFE,0x20,0xE8,0xD8,0x20,0xE8,0x97,0x40,0xE0,0x76,0x41,0xE0,0x74,0x40,0xE0,0x90,0x41,0xE8,0xCF,0x41,0xE8,0xFD,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFA,0x42,0xE0,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0xD0,0x16,0x20,0xE8,0xE7,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xC8,0x41,0xD8,0x40,0xC3,0xC0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xC1,0x01,
-    0x62,0xE0,0x31,0x21,0xE8,0xB7,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE8,0xEB,0xA2,0xD0,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE0,0x99,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFE,0x20,0xE8,0x90,0xC3,0xD0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xC0,0x02,0x21,0xE0,0x74,0x00,0xE8,0xFC,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xD8,0x20,0x00,0xE8,0xF8,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0x98,0x41,0xD0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x78,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFB,0x82,0xE0,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x7D,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xD8,0x62,0xD8,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xD1,0x03,0x21,0xE8,0xBE,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0x8D,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE8,0xCC,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xE0,0x3D,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE8,0xDC,0xA3,0xC8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0xD0,0x0C,0x00,0xE8,0xF7,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xF1,0xC4,0xD0,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xC9,0x03,0x21,0xE8,0xDC,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFD,0xE3,0xC8,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xD0,0x28,0x00,0xE8,0xFE,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x20,0xE8,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0xA6,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x61,0xE8,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x62,0xD0,0x39,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0xA7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x8D,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC8,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x41,0xE0,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC8,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x61,0xE0,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xC8,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x40,0xD8,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xC8,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xC8,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x21,0xE0,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xD0,0x3B,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x20,0xE8,0x89,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE0,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xC8,0x3B,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x21,0xE0,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x88,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xE8,0xFF,0x61,0xE8,0xFF,0x61,0xE0,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0xC8,0x02,0x82,0xD0,0x34,0x61,0xD8,0x4C,0x41,0xD8,0x74,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x21,0xE0,0xBE,0x62,0xD8,0x4E,0x61,0xD8,0x4E,
-    0x61,0xD8,0x4E,0x61,0xD8,0x4E,0x81,0xD8,0x4E,0x81,0xD8,0x4E,0x61,0xD8,0x4E,0x81,0xD8,0x4E,0x81,0xD8,0x4E,0x61,0xD8,0x4E,0x61,0xD8,0x4E,0x61,0xD8,0x4E,0x81,0xD8,0x4E,0x81,0xD8,0x4E,0x81,0xD8,0x4E,0x62,0xD8,0x4D,0x21,0xE8,0xAB,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE0,0x86,0x61,0xD8,0x4D,0x62,0xD8,0x3A,0xE2,0xC0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0xC0,0x04,0x21,0xE0,0xAE,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0xC1,0xC2,0xC0,0x0B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xD8,0x50,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x61,0xD8,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,
-    0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xE0,0x6F,0x61,0xE8,0xFF,0x21,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xF0,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x70,0x21,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x6F,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x40,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xF7,0x20,0xE0,0x7F,0x61,0xD8,0x2B,0x41,0xD8,0x27,0x21,0xE8,0x73,0x20,0xE8,0xF0,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFE,0x41,0xE8,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x82,0xE0,0x3D,0x41,0xE8,0xFA,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xCE,0xA3,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xE8,0xB6,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE0,0x8F,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE8,0xCE,0xC4,0xC8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE0,0xB6,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFE,0x41,0xD8,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x3E,0x00,0xE8,0xFB,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xF6,0x82,0xE0,0x55,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x44,0x00,0xE8,0xF1,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x61,0xE0,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE8,0x75,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x41,0xE0,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x75,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x75,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x41,0xE0,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x74,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x41,0xE0,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x74,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x20,0xE8,0xBC,0x65,0xC9,0x03,0xC3,0xC0,0x01,0x20,0xE8,0xA3,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xCB,0x20,0xE8,0xC2,0x00,0xF0,0xFE,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0xFF,0x20,0xE8,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE8,0x70,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xE0,0x70,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x20,0xE8,0xFF,0x20,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,
-    0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE0,0x68,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x21,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x20,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x21,0xE0,0x81,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0xD0,0x1E,0x20,0xE8,0xF0,0x20,0xE8,0xFF,0x21,0xE8,0xFF,0x41,0xE8,0xFF,0x41,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xFF,0x00,0xF0,0xFF,0x00,0xE8,0xF7,0x41,0xD8,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xD8,0x31,0x61,0xE0,0xA5,0x41,0xE8,0xBA,0x61,0xE0,0xBB,0x41,0xE0,0xBB,0x20,0xE0,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBA,0x20,0xE8,0xBA,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBA,
-    0x20,0xE8,0xBA,0x20,0xE8,0xBA,0x20,0xE0,0xBA,0x20,0xE0,0xBB,0x20,0xE0,0xBA,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE8,0xBB,0x20,0xE0,0xAB,0x41,0xD8,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xE4,0x04,0xD8,0x62,0x24,0xD8,0x62,0x4B,0xD0,0x62,0x5D,0xD0,0x62,0x5E,0xD8,0x61,0x4E,0xD8,0x81,0x27,0xB8,0xC4,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x61,0x2F,0xE8,0x21,0x95,0xE8,0x00,0xE2,0xE8,0x00,0xFE,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xE6,0xE0,0x41,0x99,0xE0,0x82,0x32,
+    0xC1,0xE7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x61,0x1C,0xE0,0x20,0xA8,0xE8,0x00,0xFC,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x61,0xFD,0xE0,0x62,0xAC,0xD0,0x82,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x4A,
+    0xE8,0x00,0xEB,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x41,0xFF,0xE0,0x00,0xFF,0xE8,0x41,0xFF,0xE0,0x20,0xEE,0xD8,0x61,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x21,0x5B,0xE8,0x00,0xFA,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFB,0xE0,0x21,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x42,0x44,0xE8,0x00,0xF9,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFE,0xE8,0x20,0xD8,0xE8,0x20,0x97,0xE0,0x40,0x76,0xE0,0x41,0x74,0xE0,0x40,0x90,0xE8,0x41,0xCF,0xE8,0x41,0xFD,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFA,0xE0,0x42,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0xA2,0x16,0xE8,0x20,0xE7,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xC8,0xD8,0x41,0x40,0xC0,0xC3,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA5,0x01,
+    0xE0,0x62,0x31,0xE8,0x21,0xB7,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x20,0xEB,0xD0,0xA2,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x21,0x99,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFE,0xE8,0x20,0x90,0xD0,0xC3,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xE4,0x02,0xE0,0x21,0x74,0xE8,0x00,0xFC,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x81,0x20,0xE8,0x00,0xF8,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0x98,0xD0,0x41,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x78,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFB,0xE0,0x82,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x7D,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xD8,0xD8,0x62,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x05,0x03,0xE8,0x21,0xBE,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0x8D,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x20,0xCC,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x62,0x3D,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x20,0xDC,0xC8,0xA3,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0xC2,0x0C,0xE8,0x00,0xF7,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xF1,0xD0,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x25,0x03,0xE8,0x21,0xDC,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFD,0xC8,0xE3,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x82,0x28,0xE8,0x00,0xFE,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x20,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0xA6,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x61,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xD0,0x62,0x39,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0xA7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x8D,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x82,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x41,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x20,0x89,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x82,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x61,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x89,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x62,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xD8,0x40,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x89,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x61,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x89,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x61,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x21,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x20,0x89,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x62,0x3B,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xE8,0x20,0x89,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE0,0x20,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x62,0x3B,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x21,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x88,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x41,0xFF,0xE8,0x61,0xFF,0xE0,0x61,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xC3,0x02,0xD0,0x82,0x34,0xD8,0x61,0x4C,0xD8,0x41,0x74,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x21,0xBE,0xD8,0x62,0x4E,0xD8,0x61,0x4E,
+    0xD8,0x61,0x4E,0xD8,0x61,0x4E,0xD8,0x81,0x4E,0xD8,0x81,0x4E,0xD8,0x61,0x4E,0xD8,0x81,0x4E,0xD8,0x81,0x4E,0xD8,0x61,0x4E,0xD8,0x61,0x4E,0xD8,0x61,0x4E,0xD8,0x81,0x4E,0xD8,0x81,0x4E,0xD8,0x81,0x4E,0xD8,0x62,0x4D,0xE8,0x21,0xAB,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE0,0x41,0x86,0xD8,0x61,0x4D,0xD8,0x62,0x3A,0xC0,0xE2,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xE3,0x04,0xE0,0x21,0xAE,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0xC1,0xC0,0xC2,0x0B,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x61,0x50,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xD8,0x61,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,
+    0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x6F,0xE8,0x61,0xFF,0xE8,0x21,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x70,0xE8,0x21,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x6F,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x40,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xF7,0xE0,0x20,0x7F,0xD8,0x61,0x2B,0xD8,0x41,0x27,0xE8,0x21,0x73,0xE8,0x20,0xF0,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFE,0xE8,0x41,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xE0,0x82,0x3D,0xE8,0x41,0xFA,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xCE,0xC0,0xA3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x81,0xB6,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x21,0x8F,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x20,0xCE,0xC8,0xC4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x21,0xB6,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFE,0xD8,0x41,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x3E,0xE8,0x00,0xFB,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xF6,0xE0,0x82,0x55,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x44,0xE8,0x00,0xF1,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x61,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x20,0x75,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x41,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x75,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x75,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x41,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x00,0x74,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE0,0x41,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x00,0x74,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x20,0xBC,0xC9,0x65,0x03,0xC0,0xC3,0x01,0xE8,0x20,0xA3,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xCB,0xE8,0x20,0xC2,0xF0,0x00,0xFE,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0xFF,0xE8,0x20,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x70,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x21,0x70,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x21,0x70,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x20,0xFF,0xE8,0x20,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,
+    0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x41,0x68,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xE8,0x21,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x20,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE0,0x21,0x81,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0xC2,0x1E,0xE8,0x20,0xF0,0xE8,0x20,0xFF,0xE8,0x21,0xFF,0xE8,0x41,0xFF,0xE8,0x41,0xFF,0xE8,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xFF,0xF0,0x00,0xFF,0xE8,0x00,0xF7,0xD8,0x41,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x62,0x31,0xE0,0x61,0xA5,0xE8,0x41,0xBA,0xE0,0x61,0xBB,0xE0,0x41,0xBB,0xE0,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBA,0xE8,0x20,0xBA,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBA,
+    0xE8,0x20,0xBA,0xE8,0x20,0xBA,0xE0,0x20,0xBA,0xE0,0x20,0xBB,0xE0,0x20,0xBA,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE8,0x20,0xBB,0xE0,0x20,0xAB,0xD8,0x41,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 const lv_img_dsc_t ui_img_lock_png = {
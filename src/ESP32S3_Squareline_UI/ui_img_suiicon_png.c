@@ -11,46 +11,46 @@
 
 // IMAGE DATA: assets/suiicon.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_suiicon_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x94,0x04,0x49,0x4A,0x32,0x65,0x29,0x65,0xE3,0x18,0x86,0x82,0x10,0x98,0xA3,0x10,0xA5,0x62,0x10,0xAF,0x61,0x08,0xB0,0xA3,0x10,0xAE,0xC3,0x18,0xA8,0xE3,0x18,0x94,0x45,0x29,0x78,0xA7,0x31,0x4A,0xEC,0x5A,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x10,0x84,0x05,0xE7,0x39,0x52,0x24,0x21,0xAD,0xC3,0x18,0xEF,0x63,0x00,0xFF,0xCA,0x21,0xFF,0xCE,0x3A,0xFF,0x51,0x43,0xFF,0x93,0x4B,0xFF,0xD4,0x4B,0xFF,0xD4,0x4B,0xFF,0xB3,0x4B,0xFF,0x72,0x43,0xFF,0x10,0x3B,0xFF,0x4C,0x32,0xFF,0xE5,0x10,0xFF,0x42,0x08,0xFB,0x04,0x21,0xC6,0xA7,0x31,0x77,0xCB,0x5A,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x0A,0x86,0x31,0x70,0xE3,0x18,0xE1,0xC5,0x08,0xFF,0xCE,0x3A,0xFF,0xD4,0x4B,0xFF,0x78,0x5C,0xFF,0xB9,0x5C,0xFF,0x98,0x5C,0xFF,0x57,0x54,0xFF,0x16,0x54,0xFF,0xF5,0x53,0xFF,0xF5,0x4B,0xFF,0x16,0x54,0xFF,0x36,0x54,0xFF,
-    0x78,0x5C,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0x36,0x54,0xFF,0x51,0x43,0xFF,0xA8,0x21,0xFF,0x82,0x10,0xF8,0x45,0x29,0x9D,0x08,0x42,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x55,0xA2,0x18,0xE1,0x88,0x19,0xFF,0x92,0x43,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xF5,0x53,0xFF,0x10,0x3B,0xFF,0xEA,0x29,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x67,0x19,0xFF,0xAE,0x3A,0xFF,0xB3,0x4B,0xFF,0x77,0x5C,0xFF,0xB9,0x5C,0xFF,0x14,0x54,0xFF,0x6D,0x32,0xFF,0x82,0x08,0xF8,0x25,0x29,0x8C,0x8A,0x52,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x18,0x04,0x21,0xB0,0x05,0x11,0xFF,0x72,0x43,0xFF,0xB8,0x5C,0xFF,0x78,0x54,0xFF,0x31,0x43,0xFF,0x46,0x19,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x6D,0x32,0xFF,0xF5,0x53,0xFF,0xB9,0x5C,0xFF,0x15,0x54,0xFF,0x0B,0x2A,0xFF,0xC3,0x18,0xE3,0xC7,0x39,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x43,0xA3,0x10,0xE8,0x6C,0x32,0xFF,0x77,0x5C,0xFF,0x98,0x5C,0xFF,0x10,0x3B,0xFF,0xA3,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x0B,0x2A,0xFF,0x15,0x54,0xFF,0xB9,0x5C,0xFF,0x72,0x4B,0xFF,0xA4,0x10,0xFE,0x45,0x29,0x8E,0x4D,0x6B,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x64,0x62,0x08,0xFA,0x51,0x43,0xFF,0xB8,0x5C,0xFF,0xD4,0x4B,0xFF,0x47,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0x88,0x21,0xFF,0xE3,0x18,0xB9,0x08,0x42,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x6E,0xA4,0x08,0xFE,0xD4,0x4B,0xFF,0x98,0x5C,0xFF,0xEF,0x3A,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC9,0x21,0xFF,0x56,0x54,0xFF,0x77,0x5C,0xFF,0x0A,0x2A,0xFF,0xC3,0x10,0xC8,0xC7,0x39,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x5D,0xA4,0x08,0xFE,0xF5,0x4B,0xFF,0x98,0x5C,0xFF,0x4C,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE5,0x10,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0x0B,0x2A,0xFF,0xC3,0x18,0xC3,0x8A,0x52,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x3F,0x62,0x08,0xF9,0xD4,0x4B,0xFF,0x98,0x5C,0xFF,0x0B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0xA8,0x21,0xFF,0x25,0x29,0xA7,0x30,0x8C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x41,0x14,0x82,0x10,0xE6,0x51,0x43,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xAD,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE5,0x10,0xFF,0x36,0x54,0xFF,0x57,0x54,0xFF,0xE5,0x10,0xFF,0xC7,0x39,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x2C,0x32,0xFF,0xB8,0x5C,0xFF,0x10,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x06,0x11,0xFF,0x57,0x54,0xFF,0xB9,0x5C,0xFF,
-    0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x77,0x5C,0xFF,0xB3,0x4B,0xFF,0xA2,0x10,0xF6,0x28,0x42,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x42,0xC4,0x08,0xFE,0x57,0x5C,0xFF,0xF4,0x4B,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0xF4,0x53,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0x98,0x54,0xFF,0xEA,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8D,0x32,0xFF,0xB9,0x5C,0xFF,0x8D,0x32,0xFF,0x24,0x21,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x03,0x62,0x10,0xCD,0x31,0x43,0xFF,0x98,0x5C,0xFF,0x67,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x51,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0x57,0x54,0xFF,0x26,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB4,0x4B,0xFF,0x57,0x5C,0xFF,0xA3,0x08,0xFF,0xA6,0x31,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x5B,0x26,0x11,0xFF,
-    0x98,0x5C,0xFF,0x30,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0x15,0x4C,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x98,0x5C,0xFF,0x10,0x3B,0xFF,0xA3,0x18,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xCF,0x51,0x43,0xFF,0x78,0x5C,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x2B,0x2A,0xFF,0xC4,0x10,0xFF,0x36,0x54,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x4B,0xFF,0x77,0x5C,0xFF,0x83,0x08,0xFF,0x45,0x29,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x29,0x34,0x83,0x08,0xFF,0x77,0x5C,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0x77,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x10,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x78,0x54,0xFF,0xB9,0x5C,0xFF,0xBA,0x54,0xFF,0xCE,0x3A,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x21,0xFF,0xB8,0x5C,0xFF,0x8E,0x3A,0xFF,0xC3,0x18,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x90,0x6D,0x32,0xFF,0xB9,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x15,0x54,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x16,0x54,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0B,0x2A,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x99,0x5C,0xFF,0x2B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0xF5,0x53,0xFF,0xF4,0x4B,0xFF,0x62,0x08,0xEC,0x28,0x42,0x04,0x96,0xB5,0x01,0xC3,0x18,0xE0,0xB3,0x4B,0xFF,0x36,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x92,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x78,0x5C,0xFF,0x67,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0x98,0x5C,0xFF,0xC4,0x10,0xFF,0xE4,0x20,0x35,0x8A,0x52,0x28,0x21,0x00,0xFF,0x57,0x54,0xFF,0x51,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x54,0xFF,0xB8,0x5C,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x52,0x4B,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x36,0x54,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x62,0x10,0x72,0x66,0x31,0x5E,0x47,0x19,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4C,0x2A,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x54,0xFF,0x78,0x54,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0xF4,0x53,0xFF,0xDA,0x54,0xFF,0xD9,0x54,0xFF,0xB3,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x57,0x54,0xFF,0x51,0x43,0xFF,0x21,0x08,0xA7,0x45,0x29,0x88,0x6C,0x32,0xFF,0xB9,0x5C,0xFF,0x26,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0x78,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x54,0xFF,0xDA,0x54,0xFF,0x98,0x5C,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x05,0x11,0xFF,0x56,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x4B,0xFF,0xD4,0x4B,0xFF,0x41,0x08,0xD3,0x25,0x29,0xAC,0xEF,0x3A,0xFF,0x78,0x5C,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xD3,0x4B,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0x72,0x43,0xFF,0x36,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x0B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCA,0x21,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0x98,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x43,0xFF,0x36,0x54,0xFF,0x21,0x00,0xF7,0x67,0x31,0xBB,0x51,0x43,0xFF,
-    0x57,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0xF5,0x53,0xFF,0x42,0x00,0xFF,0x72,0x43,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCE,0x3A,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB3,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x10,0x3B,0xFF,0x77,0x5C,0xFF,0x01,0x00,0xFF,0xA8,0x39,0xBD,0x72,0x43,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB3,0x4B,0xFF,0xDA,0x5C,0xFF,
-    0xB9,0x5C,0xFF,0xEA,0x21,0xFF,0x00,0x00,0xFF,0xA8,0x21,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xAE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x36,0x54,0xFF,0xBA,0x54,0xFF,0x98,0x5C,0xFF,0x05,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x22,0x00,0xFF,0xA7,0x39,0xB9,0x92,0x4B,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x00,0xFF,0x77,0x5C,0xFF,0xDA,0x54,0xFF,0x36,0x54,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x52,0x43,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x10,0x43,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0xAE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0x98,0x5C,0xFF,0x42,0x00,0xFF,0x66,0x31,0xB1,0x72,0x43,0xFF,0x36,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x52,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x08,0xFF,0xF5,0x53,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x15,0x54,0xFF,0xC9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x93,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x22,0x00,0xFF,0xE4,0x20,0xA5,0x30,0x43,0xFF,0x57,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8E,0x32,0xFF,0xD9,0x54,0xFF,0xBA,0x5C,0xFF,0xAF,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xBA,0x54,0xFF,0xB9,0x5C,0xFF,0x30,0x43,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x98,0x54,0xFF,0xBA,0x5C,0xFF,0x16,0x4C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x31,0x43,0xFF,0x57,0x5C,0xFF,0x21,0x00,0xFB,0xE3,0x20,0x92,0xCE,0x3A,0xFF,0x98,0x5C,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0xD9,0x54,0xFF,0xBA,0x5C,0xFF,0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xF4,0x53,0xFF,0xC4,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x77,0x5C,0xFF,0xBA,0x5C,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x92,0x4B,0xFF,0x16,0x54,0xFF,0x21,0x00,0xE4,0x25,0x29,0x74,0x0B,0x2A,0xFF,0xB9,0x5C,0xFF,0xA8,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x27,0x19,0xFF,0xB4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xDA,0x54,0xFF,0xF5,0x53,0xFF,0x63,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0xF5,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x15,0x4C,0xFF,0xB3,0x4B,0xFF,0x41,0x08,0xBE,0xA6,0x31,0x44,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xCE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0xB9,0x5C,0xFF,0xD9,0x54,0xFF,0x93,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xF0,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x5C,0xFF,0xDA,0x54,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x21,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,
-    0x93,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x98,0x5C,0xFF,0xEF,0x42,0xFF,0x61,0x08,0x8F,0xEB,0x5A,0x0F,0x62,0x08,0xF9,0x16,0x54,0xFF,0xB3,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0x57,0x54,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x30,0x43,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0xB9,0x5C,0xFF,0xC9,0x21,0xFF,0x82,0x10,0x55,
-    0x00,0x00,0x00,0xA3,0x18,0xBA,0x31,0x43,0xFF,0x78,0x5C,0xFF,0x63,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x4B,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xAE,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x93,0x4B,0xFF,0xA4,0x08,0xFF,0x77,0x54,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x47,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x43,0xFF,0x77,0x54,0xFF,0x42,0x00,0xFC,0x45,0x29,0x17,0x00,0x00,0x00,0xC3,0x18,0x64,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0x6D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x2B,0x2A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x77,0x54,0xFF,0x26,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x29,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x37,0x4C,0xFF,0x72,0x43,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xD4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x57,0x54,0xFF,0x72,0x43,0xFF,0x61,0x10,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x39,0x13,0x42,0x08,0xF8,0x15,0x54,0xFF,0xF4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x15,0x54,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x21,0x00,0xFF,0x78,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x99,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6C,0x32,0xFF,0xB9,0x5C,0xFF,0xCA,0x21,0xFF,0xA2,0x10,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x8D,0x32,0xFF,0xB9,0x5C,0xFF,0xEA,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x67,0x19,0xFF,0x77,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0x36,0x54,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x57,0x54,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xF0,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x15,0x54,0xFF,0xF4,0x53,0xFF,0x41,0x08,0xF1,0x66,0x29,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2A,0x62,0x00,0xFB,0x36,0x54,0xFF,0xF4,0x53,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x98,0x5C,0xFF,0x72,0x4B,0xFF,0xA9,0x21,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x26,0x11,0xFF,0xEF,0x3A,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0x93,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6D,0x32,0xFF,0xB9,0x5C,0xFF,0x2B,0x2A,0xFF,0x82,0x10,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x9A,0x4C,0x2A,0xFF,0xB9,0x5C,0xFF,
-    0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2C,0x2A,0xFF,0x77,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x77,0x5C,0xFF,0x15,0x54,0xFF,0x15,0x54,0xFF,0x57,0x54,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x52,0x43,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x57,0x54,0xFF,0xD4,0x4B,0xFF,0x41,0x08,0xEF,0x65,0x29,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x29,0x17,0x42,0x08,0xEC,0xB3,0x4B,0xFF,0x77,0x5C,0xFF,0x46,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0xB3,0x4B,0xFF,
-    0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x57,0x54,0xFF,0x4D,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x92,0x4B,0xFF,0x98,0x5C,0xFF,0x67,0x19,0xFF,0xE3,0x18,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x58,0x06,0x11,0xFF,0x57,0x5C,0xFF,0xF5,0x4B,0xFF,0x63,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x21,0xFF,0x51,0x43,0xFF,0x16,0x54,0xFF,0x98,0x5C,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x77,0x5C,0xFF,0xB4,0x4B,0xFF,0x6D,0x32,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xAE,0x3A,0xFF,0x82,0x10,0xBF,0xAA,0x52,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x9C,0x0A,0x2A,0xFF,0x98,0x5C,0xFF,0x93,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x26,0x11,0xFF,0x88,0x19,0xFF,0x06,0x11,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0x72,0x4B,0xFF,0x41,0x08,0xEA,0x25,0x29,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0x08,0x62,0x10,0xC3,0x8D,0x32,0xFF,0xB8,0x5C,0xFF,0x72,0x4B,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0xF5,0x53,0xFF,0x83,0x08,0xF7,0xE4,0x20,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x13,0x62,0x08,0xD2,0xCE,0x3A,0xFF,0xB9,0x5C,0xFF,0xB3,0x4B,0xFF,0x83,0x08,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6D,0x32,0xFF,0x98,0x5C,0xFF,0xF5,0x53,0xFF,0xC4,0x08,0xFB,0xA2,0x10,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x15,0x62,0x08,0xCC,0x6D,0x32,0xFF,0x98,0x5C,0xFF,0x16,0x54,0xFF,0x88,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x62,0x00,0xFF,0x51,0x43,0xFF,0xB9,0x5C,0xFF,0xB3,0x4B,0xFF,0x83,0x08,0xF8,0xA2,0x18,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x0D,0x62,0x08,0xB1,0xEA,0x21,0xFF,0x36,0x54,0xFF,0x98,0x5C,0xFF,0xF0,0x3A,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x29,0xFF,0x36,0x54,0xFF,0xB8,0x5C,0xFF,0x10,0x43,0xFF,
-    0x42,0x00,0xEC,0xA3,0x18,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x03,0x82,0x10,0x7D,0xC4,0x08,0xFA,0x72,0x43,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0x8D,0x3A,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA8,0x21,0xFF,0xB3,0x4B,0xFF,0xB9,0x5C,0xFF,0x16,0x54,0xFF,0xEA,0x29,0xFF,0x41,0x08,0xC3,0xC3,0x18,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x35,0x41,0x08,0xCF,0xCA,0x21,0xFF,0xD4,0x53,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0x31,0x43,0xFF,0x88,0x19,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC4,0x08,0xFF,0x8E,0x32,0xFF,0xF5,0x4B,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0xCE,0x3A,0xFF,0x62,0x08,0xF0,0x62,0x10,0x6F,0x86,0x31,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x04,0x82,0x10,0x65,0x41,0x08,0xE1,0xC9,0x21,0xFF,0x93,0x4B,0xFF,0x98,0x54,0xFF,
-    0xB9,0x5C,0xFF,0x57,0x54,0xFF,0x93,0x43,0xFF,0xEF,0x3A,0xFF,0x4C,0x32,0xFF,0xA9,0x21,0xFF,0x47,0x19,0xFF,0x47,0x19,0xFF,0x88,0x21,0xFF,0x0B,0x2A,0xFF,0xAE,0x3A,0xFF,0x51,0x43,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xF5,0x53,0xFF,0xAE,0x3A,0xFF,0x63,0x08,0xF8,0x41,0x08,0x96,0xA3,0x10,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x06,0x61,0x08,0x5B,0x21,0x08,0xC1,0x83,0x08,0xFD,0x4C,0x32,0xFF,0x71,0x4B,0xFF,0x15,0x54,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xD9,0x5C,0xFF,0xD9,0x5C,0xFF,0xB9,0x5C,0xFF,0xD9,0x5C,0xFF,0xD9,0x5C,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0xB3,0x4B,0xFF,0xEF,0x3A,0xFF,
-    0x47,0x19,0xFF,0x21,0x00,0xE3,0x21,0x08,0x85,0xA3,0x10,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x1F,0x41,0x08,0x69,0x21,0x00,0xAE,0x21,0x00,0xE8,0x42,0x00,0xFE,0x06,0x11,0xFF,0xC9,0x29,0xFF,0x2B,0x32,0xFF,0x2B,0x32,0xFF,0xEA,0x29,0xFF,0x68,0x19,0xFF,0x84,0x08,0xFF,0x21,0x00,0xF6,0x21,0x00,0xC6,0x21,0x00,0x86,0x61,0x08,0x3C,0x45,0x29,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x01,0xC3,0x18,0x17,0x41,0x08,0x3B,0x61,0x08,0x54,0x41,0x08,0x66,0x20,0x00,0x66,0x41,0x08,0x57,0x41,0x08,0x41,0x82,0x10,0x23,0xE3,0x18,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x72,0x04,0x4A,0x49,0x32,0x29,0x65,0x65,0x18,0xE3,0x86,0x10,0x82,0x98,0x10,0xA3,0xA5,0x10,0x62,0xAF,0x08,0x61,0xB0,0x10,0xA3,0xAE,0x18,0xC3,0xA8,0x18,0xE3,0x94,0x29,0x45,0x78,0x31,0xA7,0x4A,0x5A,0xEC,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x84,0x10,0x05,0x39,0xE7,0x52,0x21,0x24,0xAD,0x18,0xC3,0xEF,0x00,0x63,0xFF,0x21,0xCA,0xFF,0x3A,0xCE,0xFF,0x43,0x51,0xFF,0x4B,0x93,0xFF,0x4B,0xD4,0xFF,0x4B,0xD4,0xFF,0x4B,0xB3,0xFF,0x43,0x72,0xFF,0x3B,0x10,0xFF,0x32,0x4C,0xFF,0x10,0xE5,0xFF,0x08,0x42,0xFB,0x21,0x04,0xC6,0x31,0xA7,0x77,0x5A,0xCB,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xCB,0x0A,0x31,0x86,0x70,0x18,0xE3,0xE1,0x08,0xC5,0xFF,0x3A,0xCE,0xFF,0x4B,0xD4,0xFF,0x5C,0x78,0xFF,0x5C,0xB9,0xFF,0x5C,0x98,0xFF,0x54,0x57,0xFF,0x54,0x16,0xFF,0x53,0xF5,0xFF,0x4B,0xF5,0xFF,0x54,0x16,0xFF,0x54,0x36,0xFF,
+    0x5C,0x78,0xFF,0x5C,0xB9,0xFF,0x5C,0xB9,0xFF,0x54,0x36,0xFF,0x43,0x51,0xFF,0x21,0xA8,0xFF,0x10,0x82,0xF8,0x29,0x45,0x9D,0x42,0x08,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x55,0x18,0xA2,0xE1,0x19,0x88,0xFF,0x43,0x92,0xFF,0x5C,0x98,0xFF,0x5C,0xB9,0xFF,0x53,0xF5,0xFF,0x3B,0x10,0xFF,0x29,0xEA,0xFF,0x08,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x42,0xFF,0x19,0x67,0xFF,0x3A,0xAE,0xFF,0x4B,0xB3,0xFF,0x5C,0x77,0xFF,0x5C,0xB9,0xFF,0x54,0x14,0xFF,0x32,0x6D,0xFF,0x08,0x82,0xF8,0x29,0x25,0x8C,0x52,0x8A,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x28,0x18,0x21,0x04,0xB0,0x11,0x05,0xFF,0x43,0x72,0xFF,0x5C,0xB8,0xFF,0x54,0x78,0xFF,0x43,0x31,0xFF,0x19,0x46,0xFF,0x00,0x01,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x63,0xFF,0x32,0x6D,0xFF,0x53,0xF5,0xFF,0x5C,0xB9,0xFF,0x54,0x15,0xFF,0x2A,0x0B,0xFF,0x18,0xC3,0xE3,0x39,0xC7,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x43,0x10,0xA3,0xE8,0x32,0x6C,0xFF,0x5C,0x77,0xFF,0x5C,0x98,0xFF,0x3B,0x10,0xFF,0x08,0xA3,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x01,0xFF,0x2A,0x0B,0xFF,0x54,0x15,0xFF,0x5C,0xB9,0xFF,0x4B,0x72,0xFF,0x10,0xA4,0xFE,0x29,0x45,0x8E,0x6B,0x4D,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x64,0x08,0x62,0xFA,0x43,0x51,0xFF,0x5C,0xB8,0xFF,0x4B,0xD4,0xFF,0x19,0x47,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x3A,0xCF,0xFF,0x5C,0x98,0xFF,0x54,0x36,0xFF,0x21,0x88,0xFF,0x18,0xE3,0xB9,0x42,0x08,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x04,0x6E,0x08,0xA4,0xFE,0x4B,0xD4,0xFF,0x5C,0x98,0xFF,0x3A,0xEF,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xC9,0xFF,0x54,0x56,0xFF,0x5C,0x77,0xFF,0x2A,0x0A,0xFF,0x10,0xC3,0xC8,0x39,0xC7,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x04,0x5D,0x08,0xA4,0xFE,0x4B,0xF5,0xFF,0x5C,0x98,0xFF,0x2A,0x4C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x10,0xE5,0xFF,0x53,0xF5,0xFF,0x5C,0x98,0xFF,0x2A,0x0B,0xFF,0x18,0xC3,0xC3,0x52,0x8A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x65,0x3F,0x08,0x62,0xF9,0x4B,0xD4,0xFF,0x5C,0x98,0xFF,0x2A,0x0B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xA4,0xFF,0x53,0xF5,0xFF,0x5C,0x98,0xFF,0x21,0xA8,0xFF,0x29,0x25,0xA7,0x8C,0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE8,0x14,0x10,0x82,0xE6,0x43,0x51,0xFF,0x5C,0xB9,0xFF,0x32,0x6C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xA9,0xFF,0x3A,0xAD,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x10,0xE5,0xFF,0x54,0x36,0xFF,0x54,0x57,0xFF,0x10,0xE5,0xFF,0x39,0xC7,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC3,0xA6,0x32,0x2C,0xFF,0x5C,0xB8,0xFF,0x43,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x11,0x06,0xFF,0x54,0x57,0xFF,0x5C,0xB9,0xFF,
+    0x32,0x8D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x68,0xFF,0x5C,0x77,0xFF,0x4B,0xB3,0xFF,0x10,0xA2,0xF6,0x42,0x28,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x04,0x42,0x08,0xC4,0xFE,0x5C,0x57,0xFF,0x4B,0xF4,0xFF,0x00,0x22,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x42,0xFF,0x53,0xF4,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x54,0x98,0xFF,0x21,0xEA,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x32,0x8D,0xFF,0x5C,0xB9,0xFF,0x32,0x8D,0xFF,0x21,0x24,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x0C,0x03,0x10,0x62,0xCD,0x43,0x31,0xFF,0x5C,0x98,0xFF,0x19,0x67,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0x51,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x5C,0xDA,0xFF,0x54,0x57,0xFF,0x19,0x26,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0xB4,0xFF,0x5C,0x57,0xFF,0x08,0xA3,0xFF,0x31,0xA6,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x24,0x5B,0x11,0x26,0xFF,
+    0x5C,0x98,0xFF,0x43,0x30,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xAE,0xFF,0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,0x5C,0x98,0xFF,0x54,0x36,0xFF,0x5C,0xD9,0xFF,0x5C,0xBA,0xFF,0x4C,0x15,0xFF,0x00,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x68,0xFF,0x5C,0x98,0xFF,0x3B,0x10,0xFF,0x18,0xA3,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA2,0xCF,0x43,0x51,0xFF,0x5C,0x78,0xFF,0x10,0xE5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x0A,0xFF,0x5C,0x98,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x2A,0x2B,0xFF,0x10,0xC4,0xFF,0x54,0x36,0xFF,0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,0x43,0x72,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0x72,0xFF,0x5C,0x77,0xFF,0x08,0x83,0xFF,0x29,0x45,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x34,0x08,0x83,0xFF,0x5C,0x77,0xFF,0x43,0x72,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x47,0xFF,0x54,0x77,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x43,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x68,0xFF,0x54,0x78,0xFF,0x5C,0xB9,0xFF,0x54,0xBA,0xFF,0x3A,0xCE,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x88,0xFF,0x5C,0xB8,0xFF,0x3A,0x8E,0xFF,0x18,0xC3,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xE3,0x90,0x32,0x6D,0xFF,0x5C,0xB9,0xFF,0x21,0xA9,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x63,0xFF,0x54,0x15,0xFF,0x5C,0xBA,0xFF,0x54,0xDA,0xFF,0x54,0x16,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x0B,0xFF,0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,0x5C,0x99,0xFF,0x2A,0x2B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x53,0xF5,0xFF,0x4B,0xF4,0xFF,0x08,0x62,0xEC,0x42,0x28,0x04,0xB5,0x96,0x01,0x18,0xC3,0xE0,0x4B,0xB3,0xFF,0x54,0x36,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x4B,0x92,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x32,0x8D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xAE,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x5C,0x78,0xFF,0x19,0x67,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xEF,0xFF,0x5C,0x98,0xFF,0x10,0xC4,0xFF,0x20,0xE4,0x35,0x52,0x8A,0x28,0x00,0x21,0xFF,0x54,0x57,0xFF,0x43,0x51,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xEF,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x54,0xBA,0xFF,0x5C,0xB8,0xFF,0x10,0xE5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x4B,0x52,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x54,0x36,0xFF,0x08,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x47,0xFF,0x5C,0xB9,0xFF,0x32,0x6C,0xFF,0x10,0x62,0x72,0x31,0x66,0x5E,0x19,0x47,0xFF,0x5C,0xB9,0xFF,0x32,0x6C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x4C,0xFF,0x5C,0xB9,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x54,0xBA,0xFF,0x54,0x78,0xFF,0x00,0x22,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x42,0xFF,0x53,0xF4,0xFF,0x54,0xDA,0xFF,0x54,0xD9,0xFF,0x4B,0xB3,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x01,0xFF,0x54,0x57,0xFF,0x43,0x51,0xFF,0x08,0x21,0xA7,0x29,0x45,0x88,0x32,0x6C,0xFF,0x5C,0xB9,0xFF,0x11,0x26,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x47,0xFF,0x5C,0x78,0xFF,0x54,0xDA,0xFF,0x5C,0xBA,0xFF,0x54,0xB9,0xFF,0x54,0xDA,0xFF,0x5C,0x98,0xFF,0x08,0xA4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x11,0x05,0xFF,0x5C,0x56,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x3A,0xEF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0xD4,0xFF,0x4B,0xD4,0xFF,0x08,0x41,0xD3,0x29,0x25,0xAC,0x3A,0xEF,0xFF,0x5C,0x78,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x4B,0xD3,0xFF,0x54,0xDA,0xFF,0x5C,0xBA,0xFF,0x43,0x72,0xFF,0x54,0x36,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x2A,0x0B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xCA,0xFF,0x5C,0x98,0xFF,0x54,0xDA,0xFF,0x5C,0x98,0xFF,0x21,0xA9,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x72,0xFF,0x54,0x36,0xFF,0x00,0x21,0xF7,0x31,0x67,0xBB,0x43,0x51,0xFF,
+    0x54,0x57,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x2B,0xFF,0x54,0xDA,0xFF,0x5C,0xD9,0xFF,0x53,0xF5,0xFF,0x00,0x42,0xFF,0x43,0x72,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x4B,0xB4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xCE,0xFF,0x5C,0xD9,0xFF,0x5C,0xBA,0xFF,0x4B,0xB3,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3B,0x10,0xFF,0x5C,0x77,0xFF,0x00,0x01,0xFF,0x39,0xA8,0xBD,0x43,0x72,0xFF,0x54,0x16,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0xB3,0xFF,0x5C,0xDA,0xFF,
+    0x5C,0xB9,0xFF,0x21,0xEA,0xFF,0x00,0x00,0xFF,0x21,0xA8,0xFF,0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x3A,0xAE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x54,0x36,0xFF,0x54,0xBA,0xFF,0x5C,0x98,0xFF,0x11,0x05,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xCF,0xFF,0x5C,0x98,0xFF,0x00,0x22,0xFF,0x39,0xA7,0xB9,0x4B,0x92,0xFF,0x54,0x16,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x41,0xFF,0x5C,0x77,0xFF,0x54,0xDA,0xFF,0x54,0x36,0xFF,0x00,0x01,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x52,0xFF,0x5C,0xBA,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x43,0x10,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xEF,0xFF,0x5C,0xBA,0xFF,0x5C,0xDA,0xFF,0x3A,0xAE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xAE,0xFF,0x5C,0x98,0xFF,0x00,0x42,0xFF,0x31,0x66,0xB1,0x43,0x72,0xFF,0x54,0x36,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xA9,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x43,0x52,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0x63,0xFF,0x53,0xF5,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x54,0x15,0xFF,0x21,0xC9,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xA9,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x4B,0x93,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xCF,0xFF,0x5C,0x98,0xFF,0x00,0x22,0xFF,0x20,0xE4,0xA5,0x43,0x30,0xFF,0x54,0x57,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x32,0x8E,0xFF,0x54,0xD9,0xFF,0x5C,0xBA,0xFF,0x32,0xAF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xA4,0xFF,0x4B,0xD4,0xFF,0x5C,0xBA,0xFF,0x54,0xBA,0xFF,0x54,0xBA,0xFF,0x5C,0xB9,0xFF,0x43,0x30,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x63,0xFF,0x54,0x98,0xFF,0x5C,0xBA,0xFF,0x4C,0x16,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x31,0xFF,0x5C,0x57,0xFF,0x00,0x21,0xFB,0x20,0xE3,0x92,0x3A,0xCE,0xFF,0x5C,0x98,0xFF,0x00,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xCF,0xFF,0x54,0xD9,0xFF,0x5C,0xBA,0xFF,0x32,0x8D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x3A,0xCF,0xFF,0x5C,0x98,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x53,0xF4,0xFF,0x10,0xC4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x5C,0x77,0xFF,0x5C,0xBA,0xFF,0x54,0x16,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0x92,0xFF,0x54,0x16,0xFF,0x00,0x21,0xE4,0x29,0x25,0x74,0x2A,0x0B,0xFF,0x5C,0xB9,0xFF,0x21,0xA8,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xAE,0xFF,0x54,0xDA,0xFF,0x5C,0xD9,0xFF,0x3A,0xEF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x27,0xFF,0x4B,0xB4,0xFF,0x5C,0xBA,0xFF,0x54,0xBA,0xFF,0x54,0xDA,0xFF,0x53,0xF5,0xFF,0x00,0x63,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xA4,0xFF,0x5C,0x98,0xFF,0x54,0xDA,0xFF,0x4B,0xF5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4C,0x15,0xFF,0x4B,0xB3,0xFF,0x08,0x41,0xBE,0x31,0xA6,0x44,0x08,0xA4,0xFF,0x5C,0x98,0xFF,0x3A,0xCE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x0A,0xFF,0x5C,0xB9,0xFF,0x54,0xD9,0xFF,0x43,0x93,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x3A,0xF0,0xFF,0x5C,0xB9,0xFF,0x5C,0xDA,0xFF,0x54,0xDA,0xFF,0x43,0x72,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xEA,0xFF,0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,
+    0x4B,0x93,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x42,0xFF,0x5C,0x98,0xFF,0x42,0xEF,0xFF,0x08,0x61,0x8F,0x5A,0xEB,0x0F,0x08,0x62,0xF9,0x54,0x16,0xFF,0x4B,0xB3,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xA4,0xFF,0x5C,0x98,0xFF,0x5C,0xBA,0xFF,0x54,0x57,0xFF,0x00,0x62,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xCF,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x21,0xA9,0xFF,0x00,0x00,0xFF,0x43,0x30,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x3A,0xEF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x0A,0xFF,0x5C,0xB9,0xFF,0x21,0xC9,0xFF,0x10,0x82,0x55,
+    0x00,0x00,0x00,0x18,0xA3,0xBA,0x43,0x31,0xFF,0x5C,0x78,0xFF,0x00,0x63,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4B,0xD4,0xFF,0x54,0xDA,0xFF,0x5C,0xBA,0xFF,0x32,0xAE,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x20,0xFF,0x4B,0xD4,0xFF,0x5C,0xBA,0xFF,0x54,0xDA,0xFF,0x4B,0x93,0xFF,0x08,0xA4,0xFF,0x54,0x77,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x19,0x47,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x43,0x72,0xFF,0x54,0x77,0xFF,0x00,0x42,0xFC,0x29,0x45,0x17,0x00,0x00,0x00,0x18,0xC3,0x64,0x21,0xA9,0xFF,0x5C,0xB9,0xFF,0x32,0x6D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x2A,0x2B,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x54,0x77,0xFF,0x11,0x26,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x29,0xEA,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x4C,0x37,0xFF,0x43,0x72,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x4B,0xD4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x42,0xFF,0x54,0x57,0xFF,0x43,0x72,0xFF,0x10,0x61,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xE8,0x13,0x08,0x42,0xF8,0x54,0x15,0xFF,0x4B,0xF4,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x4B,0xD4,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x54,0x15,0xFF,0x10,0xE5,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x21,0xFF,0x54,0x78,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x54,0xDA,0xFF,0x5C,0x99,0xFF,0x21,0xA9,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x32,0x6C,0xFF,0x5C,0xB9,0xFF,0x21,0xCA,0xFF,0x10,0xA2,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC3,0xA2,0x32,0x8D,0xFF,0x5C,0xB9,0xFF,0x29,0xEA,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x67,0xFF,0x5C,0x77,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x54,0x36,0xFF,0x21,0xA9,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x01,0xFF,0x54,0x57,0xFF,0x5C,0xBA,0xFF,0x5C,0xDA,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x3A,0xF0,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x54,0x15,0xFF,0x53,0xF4,0xFF,0x08,0x41,0xF1,0x29,0x66,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x2A,0x00,0x62,0xFB,0x54,0x36,0xFF,0x53,0xF4,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x2B,0xFF,0x5C,0x98,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x5C,0x98,0xFF,0x4B,0x72,0xFF,0x21,0xA9,0xFF,0x00,0x22,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x21,0xFF,0x11,0x26,0xFF,0x3A,0xEF,0xFF,0x5C,0x98,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x5C,0xD9,0xFF,0x4B,0x93,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x32,0x6D,0xFF,0x5C,0xB9,0xFF,0x2A,0x2B,0xFF,0x10,0x82,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA2,0x9A,0x2A,0x4C,0xFF,0x5C,0xB9,0xFF,
+    0x32,0x8D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x2C,0xFF,0x5C,0x77,0xFF,0x5C,0xBA,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x5C,0xB9,0xFF,0x5C,0x77,0xFF,0x54,0x15,0xFF,0x54,0x15,0xFF,0x54,0x57,0xFF,0x5C,0xB9,0xFF,0x5C,0xB9,0xFF,0x54,0xDA,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x43,0x52,0xFF,0x00,0x22,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xA4,0xFF,0x54,0x57,0xFF,0x4B,0xD4,0xFF,0x08,0x41,0xEF,0x29,0x65,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x66,0x17,0x08,0x42,0xEC,0x4B,0xB3,0xFF,0x5C,0x77,0xFF,0x19,0x46,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x19,0x47,0xFF,0x4B,0xB3,0xFF,
+    0x5C,0xB9,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x54,0xBA,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x54,0xDA,0xFF,0x5C,0xBA,0xFF,0x5C,0xBA,0xFF,0x54,0x57,0xFF,0x2A,0x4D,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x01,0xFF,0x4B,0x92,0xFF,0x5C,0x98,0xFF,0x19,0x67,0xFF,0x18,0xE3,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x04,0x58,0x11,0x06,0xFF,0x5C,0x57,0xFF,0x4B,0xF5,0xFF,0x08,0x63,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x88,0xFF,0x43,0x51,0xFF,0x54,0x16,0xFF,0x5C,0x98,0xFF,0x5C,0xD9,0xFF,0x5C,0xBA,0xFF,0x5C,0xB9,0xFF,0x5C,0x77,0xFF,0x4B,0xB4,0xFF,0x32,0x6D,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x3A,0xAE,0xFF,0x5C,0xB9,0xFF,0x3A,0xAE,0xFF,0x10,0x82,0xBF,0x52,0xAA,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC3,0x9C,0x2A,0x0A,0xFF,0x5C,0x98,0xFF,0x4B,0x93,0xFF,0x00,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x63,0xFF,0x11,0x26,0xFF,0x19,0x88,0xFF,0x11,0x06,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x2B,0xFF,0x5C,0x98,0xFF,0x4B,0x72,0xFF,0x08,0x41,0xEA,0x29,0x25,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xA6,0x08,0x10,0x62,0xC3,0x32,0x8D,0xFF,0x5C,0xB8,0xFF,0x4B,0x72,0xFF,0x00,0x22,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2A,0x2B,0xFF,0x5C,0x98,0xFF,0x53,0xF5,0xFF,0x08,0x83,0xF7,0x20,0xE4,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x25,0x13,0x08,0x62,0xD2,0x3A,0xCE,0xFF,0x5C,0xB9,0xFF,0x4B,0xB3,0xFF,0x08,0x83,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x32,0x6D,0xFF,0x5C,0x98,0xFF,0x53,0xF5,0xFF,0x08,0xC4,0xFB,0x10,0xA2,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x24,0x15,0x08,0x62,0xCC,0x32,0x6D,0xFF,0x5C,0x98,0xFF,0x54,0x16,0xFF,0x21,0x88,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
+    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x62,0xFF,0x43,0x51,0xFF,0x5C,0xB9,0xFF,0x4B,0xB3,0xFF,0x08,0x83,0xF8,0x18,0xA2,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x65,0x0D,0x08,0x62,0xB1,0x21,0xEA,0xFF,0x54,0x36,0xFF,0x5C,0x98,0xFF,0x3A,0xF0,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x29,0xEA,0xFF,0x54,0x36,0xFF,0x5C,0xB8,0xFF,0x43,0x10,0xFF,
+    0x00,0x42,0xEC,0x18,0xA3,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x65,0x03,0x10,0x82,0x7D,0x08,0xC4,0xFA,0x43,0x72,0xFF,0x5C,0x98,0xFF,0x54,0x36,0xFF,0x3A,0x8D,0xFF,0x00,0x42,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0xA8,0xFF,0x4B,0xB3,0xFF,0x5C,0xB9,0xFF,0x54,0x16,0xFF,0x29,0xEA,0xFF,0x08,0x41,0xC3,0x18,0xC3,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC3,0x35,0x08,0x41,0xCF,0x21,0xCA,0xFF,0x53,0xD4,0xFF,0x5C,0xB9,0xFF,0x54,0x57,0xFF,0x43,0x31,0xFF,0x19,0x88,0xFF,0x00,0x01,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x08,0xC4,0xFF,0x32,0x8E,0xFF,0x4B,0xF5,0xFF,0x5C,0xB9,0xFF,0x54,0x57,0xFF,0x3A,0xCE,0xFF,0x08,0x62,0xF0,0x10,0x62,0x6F,0x31,0x86,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x04,0x10,0x82,0x65,0x08,0x41,0xE1,0x21,0xC9,0xFF,0x4B,0x93,0xFF,0x54,0x98,0xFF,
+    0x5C,0xB9,0xFF,0x54,0x57,0xFF,0x43,0x93,0xFF,0x3A,0xEF,0xFF,0x32,0x4C,0xFF,0x21,0xA9,0xFF,0x19,0x47,0xFF,0x19,0x47,0xFF,0x21,0x88,0xFF,0x2A,0x0B,0xFF,0x3A,0xAE,0xFF,0x43,0x51,0xFF,0x53,0xF5,0xFF,0x5C,0x98,0xFF,0x5C,0xB9,0xFF,0x53,0xF5,0xFF,0x3A,0xAE,0xFF,0x08,0x63,0xF8,0x08,0x41,0x96,0x10,0xA3,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x45,0x06,0x08,0x61,0x5B,0x08,0x21,0xC1,0x08,0x83,0xFD,0x32,0x4C,0xFF,0x4B,0x71,0xFF,0x54,0x15,0xFF,0x5C,0x98,0xFF,0x5C,0xB9,0xFF,0x5C,0xD9,0xFF,0x5C,0xD9,0xFF,0x5C,0xB9,0xFF,0x5C,0xD9,0xFF,0x5C,0xD9,0xFF,0x5C,0xB9,0xFF,0x54,0x57,0xFF,0x4B,0xB3,0xFF,0x3A,0xEF,0xFF,
+    0x19,0x47,0xFF,0x00,0x21,0xE3,0x08,0x21,0x85,0x10,0xA3,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA2,0x1F,0x08,0x41,0x69,0x00,0x21,0xAE,0x00,0x21,0xE8,0x00,0x42,0xFE,0x11,0x06,0xFF,0x29,0xC9,0xFF,0x32,0x2B,0xFF,0x32,0x2B,0xFF,0x29,0xEA,0xFF,0x19,0x68,0xFF,0x08,0x84,0xFF,0x00,0x21,0xF6,0x00,0x21,0xC6,0x00,0x21,0x86,0x08,0x61,0x3C,0x29,0x45,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x01,0x18,0xC3,0x17,0x08,0x41,0x3B,0x08,0x61,0x54,0x08,0x41,0x66,0x00,0x20,0x66,0x08,0x41,0x57,0x08,0x41,0x41,0x10,0x82,0x23,0x18,0xE3,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 const lv_img_dsc_t ui_img_suiicon_png = {
     .header.always_zero = 0,